@@ -0,0 +1,48 @@
+#include "game/Animation/AnimBlendBatch.h"
+#include "game/Core/SimdMath.h"
+#include "hosttest.h"
+
+#include <random>
+#include <vector>
+
+// Uncompressing a sequence of root frames: the per-frame getters against the batch.
+
+#define FRAME_COUNT	1003
+
+int main()
+{
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<int> dist(-32768, 32767);
+	std::vector<KeyFrameTransCompressed> in(FRAME_COUNT);
+	for (auto& frame : in)
+	{
+		for (auto& v : frame.rot) v = (int16_t)dist(rng);
+		for (auto& v : frame.trans) v = (int16_t)dist(rng);
+		frame.deltaTime = (int16_t)dist(rng);
+	}
+	std::vector<KeyFrameTrans> out(FRAME_COUNT);
+
+	double fPerFrame = BenchNs(2000, [&](int) {
+		for (int i = 0; i < FRAME_COUNT; i++)
+		{
+			in[i].GetRotation(&out[i].rotation);
+			out[i].deltaTime = in[i].GetDeltaTime();
+			in[i].GetTranslation(&out[i].translation);
+		}
+		DoNotOptimize(out.data());
+	});
+	double fBatch = BenchNs(2000, [&](int) {
+		AnimBlendBatch::UncompressFrames(in.data(), out.data(), FRAME_COUNT);
+		DoNotOptimize(out.data());
+	});
+
+#if SIMD_MATH_NEON
+	printf("backend: neon\n");
+#elif SIMD_MATH_SSE
+	printf("backend: sse\n");
+#else
+	printf("backend: scalar\n");
+#endif
+	printf("%d root frames: per frame %.2f us, batch %.2f us\n", FRAME_COUNT, fPerFrame / 1000, fBatch / 1000);
+	return 0;
+}
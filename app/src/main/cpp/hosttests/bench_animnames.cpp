@@ -0,0 +1,31 @@
+#include "game/animnames.h"
+#include "hosttest.h"
+
+#include <strings.h>
+
+// Lookup cost over every animation name: the sorted index against the linear scan.
+
+static int LinearAnimIdx(const char* szName)
+{
+	for (int i = 0; const char* szAnim = GetAnimByIdx(i); i++)
+		if (!strcasecmp(szAnim, szName)) return i;
+	return -1;
+}
+
+int main()
+{
+	int iCount = 0;
+	while (GetAnimByIdx(iCount)) iCount++;
+
+	GetAnimIdxByName("PED:WALK_civi");
+
+	double fLinear = BenchNs(iCount * 20, [&](int i) { DoNotOptimize(LinearAnimIdx(GetAnimByIdx(i % iCount))); });
+	double fSorted = BenchNs(iCount * 20, [&](int i) { DoNotOptimize(GetAnimIdxByName(GetAnimByIdx(i % iCount))); });
+	double fMissing = BenchNs(iCount * 20, [&](int) { DoNotOptimize(GetAnimIdxByName("NOPE:nope")); });
+
+	printf("%d names\n", iCount);
+	printf("linear scan:  %7.1f ns/lookup\n", fLinear);
+	printf("sorted index: %7.1f ns/lookup\n", fSorted);
+	printf("unknown name: %7.1f ns/lookup\n", fMissing);
+	return 0;
+}
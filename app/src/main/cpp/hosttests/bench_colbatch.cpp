@@ -0,0 +1,82 @@
+#include "game/Collision/ColBatch.h"
+#include "game/Core/SimdMath.h"
+#include "hosttest.h"
+#include "colbatch_scene.h"
+
+// One query against the whole random col model: every primitive through its scalar reference
+// against the four-wide kernels.
+
+#define QUERY_COUNT	1024
+
+int main()
+{
+	std::mt19937 rng(1);
+	CColScene scene;
+	BuildScene(scene, rng);
+
+	std::vector<CColLine> lines(QUERY_COUNT);
+	std::vector<CSphere> spheres(QUERY_COUNT);
+	for (int i = 0; i < QUERY_COUNT; i++)
+	{
+		lines[i] = SceneRandomLine(rng);
+		spheres[i] = CSphere(SceneRandomPoint(rng), SceneRandom(rng, 0.0f, 5.0f));
+	}
+
+	double fRefTriangles = BenchNs(QUERY_COUNT, [&](int i) {
+		float fFraction = 1.0f, f;
+		int32 iNearest = -1;
+		for (int32 k = 0; k < SCENE_TRIANGLES; k++)
+			if (CColBatch::LineTriangleRef(lines[i], scene.triangleSet, k, 1.0f, f) && f < fFraction) { fFraction = f; iNearest = k; }
+		DoNotOptimize(iNearest);
+	});
+	double fTriangles = BenchNs(QUERY_COUNT, [&](int i) {
+		float fFraction = 1.0f;
+		DoNotOptimize(CColBatch::ProcessLineTriangles(lines[i], scene.triangleSet, fFraction));
+	});
+
+	double fRefSpheres = BenchNs(QUERY_COUNT, [&](int i) {
+		float fFraction = 1.0f, f;
+		int32 iNearest = -1;
+		for (int32 k = 0; k < SCENE_SPHERES; k++)
+			if (CColBatch::LineSphereRef(lines[i], scene.sphereSet, k, 1.0f, f) && f < fFraction) { fFraction = f; iNearest = k; }
+		DoNotOptimize(iNearest);
+	});
+	double fSpheres = BenchNs(QUERY_COUNT, [&](int i) {
+		float fFraction = 1.0f;
+		DoNotOptimize(CColBatch::ProcessLineSpheres(lines[i], scene.sphereSet, fFraction));
+	});
+
+	int32 hits[64];
+	double fRefOverlaps = BenchNs(QUERY_COUNT, [&](int i) {
+		int32 iHits = 0;
+		for (int32 k = 0; k < SCENE_SPHERES && iHits < 64; k++)
+			if (CColBatch::SphereSphereRef(spheres[i], scene.sphereSet, k)) hits[iHits++] = k;
+		DoNotOptimize(iHits);
+	});
+	double fOverlaps = BenchNs(QUERY_COUNT, [&](int i) {
+		DoNotOptimize(CColBatch::TestSphereSpheres(spheres[i], scene.sphereSet, hits, 64));
+	});
+
+	CMatrix transform;
+	transform.SetRotate(0.3f, -1.2f, 2.0f);
+	transform.m_pos = CVector(1200.0f, -800.0f, 15.0f);
+	CColPoint colPoint;
+	double fLineOfSight = BenchNs(QUERY_COUNT, [&](int i) {
+		float fFraction = 1.0f;
+		DoNotOptimize(CColBatch::ProcessLineOfSight(lines[i], transform, scene.triangleSet, scene.sphereSet, colPoint, fFraction));
+	});
+
+#if SIMD_MATH_NEON
+	printf("backend: neon\n");
+#elif SIMD_MATH_SSE
+	printf("backend: sse\n");
+#else
+	printf("backend: scalar\n");
+#endif
+	printf("                          reference   batched\n");
+	printf("line vs %d triangles   %8.2f  %8.2f us\n", SCENE_TRIANGLES, fRefTriangles / 1000, fTriangles / 1000);
+	printf("line vs %d spheres      %8.2f  %8.2f us\n", SCENE_SPHERES, fRefSpheres / 1000, fSpheres / 1000);
+	printf("sphere vs %d spheres    %8.2f  %8.2f us\n", SCENE_SPHERES, fRefOverlaps / 1000, fOverlaps / 1000);
+	printf("line of sight, whole model           %8.2f us\n", fLineOfSight / 1000);
+	return 0;
+}
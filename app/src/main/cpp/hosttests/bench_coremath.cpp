@@ -0,0 +1,78 @@
+#include "main.h"
+#include "game/Core/Matrix.h"
+#include "game/Core/SimdMath.h"
+#include "hosttest.h"
+#include "coremath_ref.h"
+
+#include <random>
+
+// Per call cost of the core math paths, the old scalar code against the SIMD one, over a
+// working set of matrices larger than L1 so loads count like they do in the game.
+
+#define MATRIX_COUNT	4096
+
+static CMatrix g_matrices[MATRIX_COUNT];
+static CVector g_vectors[MATRIX_COUNT];
+static CQuaternion g_quats[MATRIX_COUNT];
+
+int main()
+{
+	std::mt19937 rng(5);
+	std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		CMatrix& mat = g_matrices[i];
+		mat.m_right = CVector(dist(rng), dist(rng), dist(rng));
+		mat.m_forward = CVector(dist(rng), dist(rng), dist(rng));
+		mat.m_up = CVector(dist(rng), dist(rng), dist(rng));
+		mat.m_pos = CVector(dist(rng), dist(rng), dist(rng)) * 1000.0f;
+		g_vectors[i] = CVector(dist(rng), dist(rng), dist(rng));
+		g_quats[i].Set(dist(rng), dist(rng), dist(rng), dist(rng));
+		g_quats[i].Normalize();
+	}
+
+	const int iCalls = MATRIX_COUNT * 100;
+	auto next = [](int i) { return (i * 7 + 1) % MATRIX_COUNT; };
+
+	CMatrix result;
+	double fRefMul = BenchNs(iCalls, [&](int i) {
+		result = RefMultiply(g_matrices[i % MATRIX_COUNT], g_matrices[next(i)]); DoNotOptimize(result.m_pos.x); });
+	double fMul = BenchNs(iCalls, [&](int i) {
+		result = g_matrices[i % MATRIX_COUNT] * g_matrices[next(i)]; DoNotOptimize(result.m_pos.x); });
+
+	double fRefInvert = BenchNs(iCalls, [&](int i) {
+		RefInvert(g_matrices[i % MATRIX_COUNT], result); DoNotOptimize(result.m_pos.x); });
+	double fInvert = BenchNs(iCalls, [&](int i) {
+		Invert(g_matrices[i % MATRIX_COUNT], result); DoNotOptimize(result.m_pos.x); });
+
+	double fRefTransform = BenchNs(iCalls, [&](int i) {
+		DoNotOptimize(RefTransform(g_matrices[i % MATRIX_COUNT], g_vectors[next(i)]).x); });
+	double fTransform = BenchNs(iCalls, [&](int i) {
+		DoNotOptimize((g_matrices[i % MATRIX_COUNT] * g_vectors[next(i)]).x); });
+
+	double fRefByMatrix = BenchNs(iCalls, [&](int i) {
+		DoNotOptimize(RefMultiply3x3(g_vectors[next(i)], g_matrices[i % MATRIX_COUNT]).x); });
+	double fByMatrix = BenchNs(iCalls, [&](int i) {
+		DoNotOptimize(Multiply3x3(g_vectors[next(i)], g_matrices[i % MATRIX_COUNT]).x); });
+
+	CQuaternion quat;
+	double fRefSlerp = BenchNs(iCalls, [&](int i) {
+		RefSlerp(quat, g_quats[i % MATRIX_COUNT], g_quats[next(i)], 0.3f); DoNotOptimize(quat.w); });
+	double fSlerp = BenchNs(iCalls, [&](int i) {
+		quat.Slerp(&g_quats[i % MATRIX_COUNT], &g_quats[next(i)], 0.3f); DoNotOptimize(quat.w); });
+
+#if SIMD_MATH_NEON
+	printf("backend: neon\n");
+#elif SIMD_MATH_SSE
+	printf("backend: sse\n");
+#else
+	printf("backend: scalar\n");
+#endif
+	printf("                   scalar     simd\n");
+	printf("matrix * matrix  %7.2f  %7.2f ns\n", fRefMul, fMul);
+	printf("invert           %7.2f  %7.2f ns\n", fRefInvert, fInvert);
+	printf("matrix * vector  %7.2f  %7.2f ns\n", fRefTransform, fTransform);
+	printf("vector * matrix  %7.2f  %7.2f ns\n", fRefByMatrix, fByMatrix);
+	printf("slerp            %7.2f  %7.2f ns\n", fRefSlerp, fSlerp);
+	return 0;
+}
@@ -0,0 +1,70 @@
+#include "framearena.h"
+#include "hosttest.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Per-allocation cost over a frame's worth of work: small transient blocks from malloc and
+// from the frame arena, formatted score rows in std::string and in FrameString, and packet
+// sized blocks grown once, from malloc/realloc and from the pool.
+
+#define FRAME_ALLOCS	1000
+
+static size_t g_sizes[FRAME_ALLOCS];
+
+static void TransientMalloc(int)
+{
+	void* blocks[FRAME_ALLOCS];
+	for (int i = 0; i < FRAME_ALLOCS; i++) { blocks[i] = malloc(16 + (i % 13) * 24); DoNotOptimize(blocks[i]); }
+	for (int i = 0; i < FRAME_ALLOCS; i++) free(blocks[i]);
+}
+
+static void TransientArena(int)
+{
+	for (int i = 0; i < FRAME_ALLOCS; i++) DoNotOptimize(CFrameArena::Alloc(16 + (i % 13) * 24));
+	CFrameArena::EndFrame();
+}
+
+template<typename S>
+static void Rows(int)
+{
+	S rows;
+	for (int i = 0; i < FRAME_ALLOCS; i++)
+	{
+		char szRow[64];
+		snprintf(szRow, sizeof(szRow), "%d\tPlayer_%d\t%d\t%d\n", i, i, i * 3, i % 200);
+		rows += szRow;
+	}
+	DoNotOptimize(rows.size());
+	CFrameArena::EndFrame();
+}
+
+static void PacketsMalloc(int)
+{
+	void* blocks[FRAME_ALLOCS];
+	for (int i = 0; i < FRAME_ALLOCS; i++) { blocks[i] = malloc(g_sizes[i]); blocks[i] = realloc(blocks[i], g_sizes[i] * 2); }
+	for (int i = FRAME_ALLOCS; i-- > 0;) free(blocks[i]);
+}
+
+static void PacketsPool(int)
+{
+	void* blocks[FRAME_ALLOCS];
+	for (int i = 0; i < FRAME_ALLOCS; i++) { blocks[i] = CMemPool::Alloc(g_sizes[i]); blocks[i] = CMemPool::Realloc(blocks[i], g_sizes[i] * 2); }
+	for (int i = FRAME_ALLOCS; i-- > 0;) CMemPool::Free(blocks[i]);
+}
+
+int main()
+{
+	srand(1);
+	for (size_t& size : g_sizes) size = 16 + rand() % 1500;
+
+	printf("ns per allocation, %d per frame\n", FRAME_ALLOCS);
+	printf("transient  malloc/free          %6.1f\n", BenchNs(2000, TransientMalloc) / FRAME_ALLOCS);
+	printf("transient  frame arena          %6.1f\n", BenchNs(2000, TransientArena) / FRAME_ALLOCS);
+	printf("rows       std::string          %6.1f\n", BenchNs(200, Rows<std::string>) / FRAME_ALLOCS);
+	printf("rows       FrameString          %6.1f\n", BenchNs(200, Rows<FrameString>) / FRAME_ALLOCS);
+	printf("packets    malloc/realloc/free  %6.1f\n", BenchNs(2000, PacketsMalloc) / FRAME_ALLOCS);
+	printf("packets    CMemPool             %6.1f\n", BenchNs(2000, PacketsPool) / FRAME_ALLOCS);
+	return 0;
+}
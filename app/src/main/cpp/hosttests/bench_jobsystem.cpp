@@ -0,0 +1,59 @@
+#include "jobsystem.h"
+#include "hosttest.h"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+// Many small jobs: serially, a thread each (the detached std::thread the audio stream used),
+// and through the pool, for tiny and for moderate jobs.
+
+#define JOB_COUNT	20000
+
+static double Work(int iIterations)
+{
+	double fSum = 0.0;
+	for (int i = 0; i < iIterations; i++) fSum += std::sqrt((double)i + fSum);
+	return fSum;
+}
+
+template<typename F>
+static double Ms(F&& fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	for (int iIterations : { 10, 2000 })
+	{
+		std::atomic<double> fSink{0.0};
+		auto job = [&]() { fSink = fSink + Work(iIterations); };
+
+		double fSerial = Ms([&]() { for (int i = 0; i < JOB_COUNT; i++) job(); });
+		double fThreads = Ms([&]() {
+			for (int i = 0; i < JOB_COUNT; i += 100)
+			{
+				std::vector<std::thread> threads;
+				for (int k = 0; k < 100; k++) threads.emplace_back(job);
+				for (auto& thread : threads) thread.join();
+			}
+		});
+
+		CJobSystem::Initialise(CJobSystem::GetDefaultWorkerCount());
+		double fPool = Ms([&]() {
+			CJobFence fence;
+			for (int i = 0; i < JOB_COUNT; i++) CJobSystem::Submit(job, JOB_PRIORITY_NORMAL, &fence);
+			CJobSystem::Wait(fence);
+		});
+		int iWorkers = CJobSystem::GetWorkerCount();
+		CJobSystem::Shutdown();
+
+		printf("%d jobs of %d iterations, %d workers: serial %.1f ms, thread per job %.1f ms, pool %.1f ms\n",
+			JOB_COUNT, iIterations, iWorkers, fSerial, fThreads, fPool);
+	}
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include "main.h"
+#include "crashlytics.h"
+#include "hosttest.h"
+
+#include <cstdarg>
+
+// Cost of an FLog call on the calling thread: the old FLog formatted, wrote and flushed the
+// file every line; now a call fills a ring record and the writer thread does the rest.
+// Bursts stay within one ring so the numbers are the enqueue cost, the drain is not timed.
+
+char* g_pszStorage = nullptr;
+
+static char g_szStorage[] = "/tmp/samp_logger_bench_XXXXXX";
+
+#define BENCH_BURST		(LOG_RING_SIZE / 2)
+#define BENCH_BURSTS	200
+
+// FLog before the asynchronous logger
+static void OldFLog(const char* fmt, ...)
+{
+	char buffer[0xFF];
+	static FILE* flLog = nullptr;
+	const char* pszStorage = g_pszStorage;
+
+	if (flLog == nullptr && pszStorage != nullptr && pszStorage[0] != '\0')
+	{
+		sprintf(buffer, "%s/old_log.txt", pszStorage);
+		flLog = fopen(buffer, "a");
+	}
+
+	memset(buffer, 0, sizeof(buffer));
+
+	va_list arg;
+	va_start(arg, fmt);
+	vsnprintf(buffer, sizeof(buffer), fmt, arg);
+	va_end(arg);
+
+	LOGI("%s", buffer);
+	firebase::crashlytics::Log(buffer);
+
+	if (flLog == nullptr) return;
+	fprintf(flLog, "%s\n", buffer);
+	fflush(flLog);
+}
+
+template<typename F>
+static double BurstNs(F&& fn)
+{
+	std::chrono::duration<double, std::nano> total(0);
+	for (int burst = 0; burst < BENCH_BURSTS; burst++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < BENCH_BURST; i++) fn(burst * BENCH_BURST + i);
+		total += std::chrono::steady_clock::now() - start;
+		CLogger::Flush();
+	}
+	return total.count() / (BENCH_BURSTS * BENCH_BURST);
+}
+
+int main()
+{
+	if (!mkdtemp(g_szStorage)) return 1;
+	g_pszStorage = g_szStorage;
+	g_bHostLogcatQuiet = true;
+
+	const char* szName = "Some_Player";
+	FLog("warm up %d", 0);
+	CLogger::Flush();
+
+	double fOld = BurstNs([&](int i) { OldFLog("player %d (%s) at %f,%f hp %u", i, szName, 1.5f * i, 2.0f, 100u); });
+	double fNew = BurstNs([&](int i) { FLog("player %d (%s) at %f,%f hp %u", i, szName, 1.5f * i, 2.0f, 100u); });
+	double fText = BurstNs([&](int) { FLog("a line with no arguments"); });
+
+	printf("old FLog:         %6.0f ns/call\n", fOld);
+	printf("FLog, 5 args:     %6.0f ns/call\n", fNew);
+	printf("FLog, plain text: %6.0f ns/call\n", fText);
+
+	std::string storage = g_szStorage;
+	unlink((storage + "/old_log.txt").c_str());
+	unlink((storage + "/samp_log.txt").c_str());
+	rmdir(g_szStorage);
+	return 0;
+}
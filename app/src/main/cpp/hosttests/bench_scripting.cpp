@@ -0,0 +1,53 @@
+#include "main.h"
+#include "game/scripting.h"
+#include "hosttest.h"
+
+// Encoding cost per command: the generic encoder walks the parameter string and va_list,
+// CScriptCommand<> copies a template and patches the values. Commands with strings are
+// still written parameter by parameter.
+
+char* g_pszStorage = nullptr;
+uintptr_t g_libGTASA = 0;
+
+static uint8_t g_Data[0xFF];
+
+static bool Generic(SCRIPT_BUFFER* pBuffer, const SCRIPT_COMMAND* pCommand, ...)
+{
+	va_list ap;
+	va_start(ap, pCommand);
+	bool bEncoded = EncodeScriptCommand(pBuffer, pCommand, ap);
+	va_end(ap);
+	return bEncoded;
+}
+
+#define BENCH_CALLS		1000000
+
+#define BENCH_COMMAND(cmd, ...) \
+	do { \
+		double fGeneric = BenchNs(BENCH_CALLS, [&](int i) { \
+			SCRIPT_BUFFER buffer; \
+			ScriptBufferInit(&buffer, g_Data, sizeof(g_Data)); \
+			DoNotOptimize(Generic(&buffer, &cmd, __VA_ARGS__)); \
+			DoNotOptimize(g_Data); \
+		}); \
+		double fPrecompiled = BenchNs(BENCH_CALLS, [&](int i) { \
+			SCRIPT_BUFFER buffer; \
+			ScriptBufferInit(&buffer, g_Data, sizeof(g_Data)); \
+			DoNotOptimize(CScriptCommand<cmd>::Encode(&buffer, __VA_ARGS__)); \
+			DoNotOptimize(g_Data); \
+		}); \
+		printf("%-26s generic %5.1f ns, precompiled %5.1f ns\n", #cmd, fGeneric, fPrecompiled); \
+	} while (0)
+
+int main()
+{
+	float fGround;
+	uint32_t dwHandle;
+
+	BENCH_COMMAND(request_model, i);
+	BENCH_COMMAND(get_ground_z, 1.0f, 2.0f, (float)i, &fGround);
+	BENCH_COMMAND(create_racing_checkpoint, 1, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, (float)i, &dwHandle);
+	BENCH_COMMAND(get_line_of_sight, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, (float)i, 1, 0, 0, 1, 0);
+	BENCH_COMMAND(apply_animation, i, "WALK_civi", "PED", 4.1f, 1, 0, 0, 1, -1);
+	return 0;
+}
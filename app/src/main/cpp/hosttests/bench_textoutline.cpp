@@ -0,0 +1,91 @@
+#include "gui/imguirenderer.h"
+#include "gui/uisettings.h"
+#include "hosttest.h"
+
+class CSettings;
+CSettings* pSettings = nullptr;
+
+// Vertices ImGuiRenderer emits for a busy screen of outlined text: a full chat, name tags
+// and 3D text labels, all at fontSize() / 2 like the game draws them. Once with the
+// outline glyph set (one quad per glyph) and once with the multi-pass fallback. The fonts
+// are ImGui's built-in one set up like ImGuiWrapper::initialize() does; only glyph counts
+// matter here, not the shapes.
+
+#define CHAT_LINES		30
+#define NAME_TAGS		60
+#define TEXT_LABELS		120
+
+static ImFont* g_pFont;
+static ImFont* g_pOutlineFont;
+
+static void DrawScene(ImGuiRenderer& renderer)
+{
+	float fSize = UISettings::fontSize() / 2;
+	char szLine[128];
+
+	for (int i = 0; i < CHAT_LINES; i++)
+	{
+		snprintf(szLine, sizeof(szLine), "{FFFF00}Player_%03d{FFFFFF}: the quick brown fox jumps over the lazy dog %d", i, i);
+		renderer.drawText(ImVec2(20.0f, 20.0f + i * fSize), ImColor(1.0f, 1.0f, 1.0f), std::string_view(szLine), true, fSize);
+	}
+	for (int i = 0; i < NAME_TAGS; i++)
+	{
+		snprintf(szLine, sizeof(szLine), "Some_Player_%d (%d)", i, i);
+		renderer.drawText(ImVec2(100.0f + i * 13.0f, 300.0f), ImColor(0.2f, 0.6f, 1.0f), std::string_view(szLine), true, fSize);
+	}
+	for (int i = 0; i < TEXT_LABELS; i++)
+	{
+		snprintf(szLine, sizeof(szLine), "{00FF00}Label %d\n{FFFFFF}/enter to get inside", i);
+		renderer.drawText(ImVec2(50.0f + i * 7.0f, 500.0f), ImColor(1.0f, 1.0f, 1.0f), std::string_view(szLine), true, fSize);
+	}
+}
+
+// vertices of one scene and ns to build it
+static int MeasureScene(ImFont* pOutlineFont, double& fNs)
+{
+	int iVertices = 0;
+	fNs = BenchNs(200, [&](int) {
+		ImGui::NewFrame();
+		ImDrawList* pDrawList = ImGui::GetBackgroundDrawList();
+		ImGuiRenderer renderer(pDrawList, g_pFont, pOutlineFont);
+		DrawScene(renderer);
+		iVertices = pDrawList->VtxBuffer.Size;
+		ImGui::EndFrame();
+	});
+	return iVertices;
+}
+
+int main()
+{
+	ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+	io.DeltaTime = 1.0f / 60.0f;
+	io.IniFilename = nullptr;
+
+	ImFontConfig fontCfg;
+	fontCfg.SizePixels = UISettings::fontSize();
+	g_pFont = io.Fonts->AddFontDefault(&fontCfg);
+
+	ImFontConfig outlineCfg;
+	outlineCfg.SizePixels = UISettings::fontSize() / 2;
+	outlineCfg.GlyphExtraSpacing.x = UISettings::outlineSize() / 2;
+	outlineCfg.OversampleH = 1;
+	outlineCfg.OversampleV = 1;
+	g_pOutlineFont = io.Fonts->AddFontDefault(&outlineCfg);
+
+	unsigned char* pPixels;
+	int iWidth, iHeight;
+	io.Fonts->GetTexDataAsRGBA32(&pPixels, &iWidth, &iHeight);
+
+	double fOutlineNs, fMultiPassNs;
+	int iOutline = MeasureScene(g_pOutlineFont, fOutlineNs);
+	int iMultiPass = MeasureScene(nullptr, fMultiPassNs);
+
+	printf("%d chat lines, %d name tags, %d labels\n", CHAT_LINES, NAME_TAGS, TEXT_LABELS);
+	printf("outline glyph set: %6d vertices, %.1f us to build\n", iOutline, fOutlineNs / 1000.0);
+	printf("multi-pass:        %6d vertices, %.1f us to build\n", iMultiPass, fMultiPassNs / 1000.0);
+
+	ImGui::DestroyContext();
+	return 0;
+}
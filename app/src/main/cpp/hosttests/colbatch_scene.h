@@ -0,0 +1,68 @@
+#pragma once
+
+#include "game/Collision/ColBatch.h"
+
+#include <random>
+
+// A random col model for test_colbatch and bench_colbatch: triangles and spheres scattered over
+// a 100x100x20 box, counts that leave a tail past the last group of four.
+
+#define SCENE_TRIANGLES	3001
+#define SCENE_SPHERES	403
+
+struct CColScene
+{
+	std::vector<CVector>		vertices;
+	std::vector<CColTriangle>	triangles;
+	std::vector<CColSphere>		spheres;
+	CCollisionData				data;
+	CColTriangleSet				triangleSet;
+	CColSphereSet				sphereSet;
+};
+
+inline float SceneRandom(std::mt19937& rng, float fMin, float fMax)
+{
+	return std::uniform_real_distribution<float>(fMin, fMax)(rng);
+}
+
+inline CVector SceneRandomPoint(std::mt19937& rng, float fExtra = 0.0f)
+{
+	return CVector(SceneRandom(rng, -50 - fExtra, 50 + fExtra), SceneRandom(rng, -50 - fExtra, 50 + fExtra),
+		SceneRandom(rng, -10 - fExtra / 2, 10 + fExtra / 2));
+}
+
+// every primitive gets its index as surface type, so a hit tells which one it was
+inline void BuildScene(CColScene& scene, std::mt19937& rng)
+{
+	scene.vertices.resize(SCENE_TRIANGLES * 3);
+	scene.triangles.resize(SCENE_TRIANGLES);
+	scene.spheres.resize(SCENE_SPHERES);
+
+	for (int i = 0; i < SCENE_TRIANGLES; i++)
+	{
+		CVector center = SceneRandomPoint(rng);
+		for (int k = 0; k < 3; k++)
+			scene.vertices[i * 3 + k] = center + CVector(SceneRandom(rng, -4, 4), SceneRandom(rng, -4, 4), SceneRandom(rng, -4, 4));
+		scene.triangles[i] = CColTriangle(i * 3, i * 3 + 1, i * 3 + 2, (eSurfaceType)(i % 179), tColLighting(i % 251));
+	}
+	// degenerate ones: a point and a segment
+	scene.vertices[4] = scene.vertices[5] = scene.vertices[3];
+	scene.vertices[7] = scene.vertices[6];
+
+	for (int i = 0; i < SCENE_SPHERES; i++)
+		scene.spheres[i] = CColSphere(CSphere(SceneRandomPoint(rng), SceneRandom(rng, 0.1f, 3.0f)), (eSurfaceType)(i % 179), i % 13, tColLighting(i % 251));
+
+	scene.data.m_nNumTriangles = SCENE_TRIANGLES;
+	scene.data.m_nNumSpheres = SCENE_SPHERES;
+	scene.data.m_pVertices = scene.vertices.data();
+	scene.data.m_pTriangles = scene.triangles.data();
+	scene.data.m_pSpheres = scene.spheres.data();
+	scene.triangleSet.Build(scene.data);
+	scene.sphereSet.Build(scene.data);
+}
+
+inline CColLine SceneRandomLine(std::mt19937& rng)
+{
+	CVector start = SceneRandomPoint(rng, 10.0f);
+	return CColLine(start, SceneRandomPoint(rng, 10.0f));
+}
@@ -0,0 +1,30 @@
+#include "game/Collision/CollisionData.h"
+
+// CollisionData.cpp leans on the NDK's transitive includes and __stdcall and doesn't build on
+// the host. The col batch targets only need its constructor, which clears the counts and pointers
+// the same way.
+
+CCollisionData::CCollisionData()
+{
+	bUsesDisks = false;
+	bHasFaceGroups = false;
+	bHasShadowInfo = false;
+
+	m_nNumSpheres = 0;
+	m_nNumBoxes = 0;
+	m_nNumTriangles = 0;
+	m_nNumLines = 0;
+
+	m_pSpheres = nullptr;
+	m_pBoxes = nullptr;
+	m_pLines = nullptr;
+	m_pVertices = nullptr;
+	m_pTriangles = nullptr;
+	m_pTrianglePlanes = nullptr;
+
+	m_nNumShadowTriangles = 0;
+	m_nNumShadowVertices = 0;
+	m_pShadowTriangles = nullptr;
+	m_pShadowVertices = nullptr;
+	m_modelSec = nullptr;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "game/Core/Matrix.h"
+
+// The scalar matrix and quaternion code the SIMD paths replaced, for test_coremath and
+// bench_coremath to hold them against. Out of line and returning by value like the real
+// ones, so the benchmark pays the same call and copy on both sides.
+
+[[gnu::noinline]] inline CMatrix RefMultiply(const CMatrix& a, const CMatrix& b)
+{
+	CMatrix result;
+	result.m_right =   a.m_right * b.m_right.x   + a.m_forward * b.m_right.y   + a.m_up * b.m_right.z;
+	result.m_forward = a.m_right * b.m_forward.x + a.m_forward * b.m_forward.y + a.m_up * b.m_forward.z;
+	result.m_up =      a.m_right * b.m_up.x      + a.m_forward * b.m_up.y      + a.m_up * b.m_up.z;
+	result.m_pos =     a.m_right * b.m_pos.x     + a.m_forward * b.m_pos.y     + a.m_up * b.m_pos.z + a.m_pos;
+	return result;
+}
+
+[[gnu::noinline]] inline CVector RefTransform(const CMatrix& a, const CVector& b)
+{
+	return CVector(a.m_pos.x + a.m_right.x * b.x + a.m_forward.x * b.y + a.m_up.x * b.z,
+		a.m_pos.y + a.m_right.y * b.x + a.m_forward.y * b.y + a.m_up.y * b.z,
+		a.m_pos.z + a.m_right.z * b.x + a.m_forward.z * b.y + a.m_up.z * b.z);
+}
+
+[[gnu::noinline]] inline void RefInvert(const CMatrix& in, CMatrix& out)
+{
+	out.m_pos = CVector(0.0f, 0.0f, 0.0f);
+	out.m_right = CVector(in.m_right.x, in.m_forward.x, in.m_up.x);
+	out.m_forward = CVector(in.m_right.y, in.m_forward.y, in.m_up.y);
+	out.m_up = CVector(in.m_right.z, in.m_forward.z, in.m_up.z);
+	out.m_pos += in.m_pos.x * out.m_right;
+	out.m_pos += in.m_pos.y * out.m_forward;
+	out.m_pos += in.m_pos.z * out.m_up;
+	out.m_pos *= -1.0f;
+}
+
+[[gnu::noinline]] inline CVector RefMultiply3x3(const CMatrix& m, const CVector& v)
+{
+	return CVector(m.m_right.x * v.x + m.m_forward.x * v.y + m.m_up.x * v.z,
+		m.m_right.y * v.x + m.m_forward.y * v.y + m.m_up.y * v.z,
+		m.m_right.z * v.x + m.m_forward.z * v.y + m.m_up.z * v.z);
+}
+
+[[gnu::noinline]] inline CVector RefMultiply3x3(const CVector& v, const CMatrix& m)
+{
+	return CVector(DotProduct(m.m_right, v), DotProduct(m.m_forward, v), DotProduct(m.m_up, v));
+}
+
+[[gnu::noinline]] inline void RefSlerp(CQuaternion& out, const CQuaternion& q1, const CQuaternion& q2, float t)
+{
+	double omega, cosom, sinom, scale0, scale1;
+	float p1[4];
+	cosom = q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+
+	if (cosom < 0.0) {
+		cosom = -cosom;
+		p1[0] = -q2.x; p1[1] = -q2.y; p1[2] = -q2.z; p1[3] = -q2.w;
+	} else {
+		p1[0] = q2.x; p1[1] = q2.y; p1[2] = q2.z; p1[3] = q2.w;
+	}
+
+	if ((1.0 - cosom) > 0.1) {
+		omega = acos(cosom);
+		sinom = sin(omega);
+		scale0 = sin((1.0 - t) * omega) / sinom;
+		scale1 = sin(t * omega) / sinom;
+	} else {
+		scale0 = 1.0 - t;
+		scale1 = t;
+	}
+
+	out.Set(scale0 * q1.x + scale1 * p1[0], scale0 * q1.y + scale1 * p1[1],
+		scale0 * q1.z + scale1 * p1[2], scale0 * q1.w + scale1 * p1[3]);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal checks for the host tests: a failed CHECK prints where and carries on, the
+// test's exit code is the number of failures. Works with NDEBUG, unlike assert().
+
+static int g_iHostTestFailures = 0;
+
+#define CHECK(expr) \
+	do { \
+		if (!(expr)) { \
+			fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+			g_iHostTestFailures++; \
+		} \
+	} while (0)
+
+#define CHECK_EQ(a, b) \
+	do { \
+		if (!((a) == (b))) { \
+			fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, \
+				#a, #b, (long long)(a), (long long)(b)); \
+			g_iHostTestFailures++; \
+		} \
+	} while (0)
+
+inline int HostTestResult(const char* szName)
+{
+	if (g_iHostTestFailures) {
+		fprintf(stderr, "%s: %d check(s) failed\n", szName, g_iHostTestFailures);
+		return 1;
+	}
+	printf("%s: ok\n", szName);
+	return 0;
+}
+
+// nanoseconds per call of fn over iCalls calls, best of three runs
+template<typename F>
+double BenchNs(int iCalls, F&& fn)
+{
+	double fBest = 0.0;
+	for (int run = 0; run < 3; run++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iCalls; i++) fn(i);
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		double fNs = elapsed.count() / iCalls;
+		if (run == 0 || fNs < fBest) fBest = fNs;
+	}
+	return fBest;
+}
+
+// keeps the compiler from dropping a result nobody reads
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
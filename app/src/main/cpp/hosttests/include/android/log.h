@@ -0,0 +1,30 @@
+#pragma once
+
+// Stand-in for the NDK's logcat API, host builds print to stderr unless a test that logs
+// a lot turns it off.
+
+#include <cstdio>
+
+inline bool g_bHostLogcatQuiet = false;
+
+#define ANDROID_LOG_VERBOSE	2
+#define ANDROID_LOG_DEBUG	3
+#define ANDROID_LOG_INFO	4
+#define ANDROID_LOG_WARN	5
+#define ANDROID_LOG_ERROR	6
+#define ANDROID_LOG_FATAL	7
+
+inline int __android_log_write(int, const char* tag, const char* text)
+{
+	if (g_bHostLogcatQuiet) return 0;
+	return fprintf(stderr, "%s: %s\n", tag, text);
+}
+
+template<typename... Args>
+inline int __android_log_print(int, const char* tag, const char* fmt, Args... args)
+{
+	if (g_bHostLogcatQuiet) return 0;
+	fprintf(stderr, "%s: ", tag);
+	fprintf(stderr, fmt, args...);
+	return fputc('\n', stderr);
+}
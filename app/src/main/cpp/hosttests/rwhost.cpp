@@ -0,0 +1,7 @@
+#include "game/RW/RenderWare.h"
+
+// The RenderWare calls the core math reaches on the host: ~CMatrix detaches from a RwMatrix
+// it owns and operator= updates an attached one, the tests never attach any.
+
+RwBool RwMatrixDestroy(RwMatrix*) { return true; }
+RwMatrix* RwMatrixUpdate(RwMatrix* matrix) { return matrix; }
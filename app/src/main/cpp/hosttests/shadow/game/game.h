@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for samp/game/game.h, nothing under test needs the game itself, only the
+// core math types it pulls in.
+#include "../game/Core/Quaternion.h"
@@ -0,0 +1,23 @@
+#pragma once
+
+// Host stand-in for samp/main.h: the standard headers and core types the code under test
+// expects, without JNI, BASS or the game.
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <list>
+#include <string>
+#include <memory>
+#include <unistd.h>
+#include "log.h"
+#include "logger.h"
+#include "threadplacement.h"
+#include "game/common.h"
+
+extern char* g_pszStorage;
+extern uintptr_t g_libGTASA;
+
+uint32_t GetTickCount();
@@ -0,0 +1,24 @@
+#pragma once
+
+// Host stand-in for samp/net/netgame.h: the id types and the headers of the net code under
+// test, without RakNet and the pools.
+
+#include "game/Core/Quaternion.h"
+
+typedef unsigned short PLAYERID;
+typedef unsigned short VEHICLEID;
+typedef unsigned short OBJECTID;
+
+#define NETMODE_AIM_SENDRATE	100
+
+class CPlayerPed;
+class CVehicle;
+
+#include "net/spatialgrid.h"
+#include "net/unoccupiedsync.h"
+#include "net/aimsync.h"
+#include "net/localplayer.h"
+#include "net/bulletbatch.h"
+#include "net/updatescheduler.h"
+#include "net/visibilityservice.h"
+#include "net/prefetchpredictor.h"
@@ -0,0 +1,168 @@
+#include "main.h"
+#include "net/netgame.h"
+#include "hosttest.h"
+
+#include <functional>
+#include <random>
+
+// CAimShaper and CAimInterpolator: the send rules one by one, then synthetic camera paths
+// with hand jitter sent over a link with jittery latency and played back, checking the
+// packet rate each path costs and how far the remote aim is from the true one once the
+// latency is taken out; what's left is mostly the interpolation delay.
+
+static AIM_SAMPLE Aim(float fYaw, float fPitch)
+{
+	AIM_SAMPLE aim;
+	aim.vecAimf = CVector(cosf(fYaw) * cosf(fPitch), sinf(fYaw) * cosf(fPitch), sinf(fPitch));
+	aim.vecAimPos = CVector(10.0f, 10.0f, 2.0f);
+	aim.fAimZ = fPitch;
+	return aim;
+}
+
+static float Angle(const CVector& a, const CVector& b)
+{
+	float fDot = a.x * b.x + a.y * b.y + a.z * b.z;
+	float fLengths = sqrtf((a.x * a.x + a.y * a.y + a.z * a.z) * (b.x * b.x + b.y * b.y + b.z * b.z));
+	return acosf(std::clamp(fDot / fLengths, -1.0f, 1.0f));
+}
+
+static void TestShaperRules()
+{
+	CAimShaper shaper;
+
+	// the first sample always goes
+	CHECK(shaper.Update(1000, Aim(0.0f, 0.0f), false, NETMODE_AIM_SENDRATE));
+
+	// within the dead-band: nothing until the keepalive
+	CHECK(!shaper.Update(1200, Aim(0.005f, 0.0f), false, NETMODE_AIM_SENDRATE));
+	CHECK(!shaper.Update(1999, Aim(0.005f, 0.0f), false, NETMODE_AIM_SENDRATE));
+	CHECK(shaper.Update(2000, Aim(0.005f, 0.0f), false, NETMODE_AIM_SENDRATE));
+
+	// a flick waits out the minimum interval, then goes at once
+	CHECK(!shaper.Update(2050, Aim(0.5f, 0.0f), false, NETMODE_AIM_SENDRATE));
+	CHECK(shaper.Update(2100, Aim(0.5f, 0.0f), false, NETMODE_AIM_SENDRATE));
+
+	// a forced update ignores every rule
+	CHECK(shaper.Update(2101, Aim(0.5f, 0.0f), true, NETMODE_AIM_SENDRATE));
+
+	// a small change without velocity goes after AIM_MAX_INTERVAL
+	CAimShaper drift;
+	drift.Update(0, Aim(0.0f, 0.0f), false, 0);
+	drift.Update(1, Aim(0.0f, 0.0f), false, 0);
+	for (int i = 0; i < 20; i++) drift.Update(2 + i, Aim(0.0f, 0.0f), false, 0);
+	CHECK(!drift.Update(AIM_MAX_INTERVAL - 1, Aim(0.02f, 0.0f), false, 0));
+	CHECK(drift.Update(AIM_MAX_INTERVAL, Aim(0.02f, 0.0f), false, 0));
+
+	shaper.Reset();
+	CHECK(shaper.Update(5000, Aim(0.5f, 0.0f), false, NETMODE_AIM_SENDRATE));
+}
+
+static void TestInterpolatorRules()
+{
+	CAimInterpolator interp;
+	AIM_SAMPLE out = Aim(9.0f, 0.0f);
+
+	interp.Get(0, out);
+	CHECK(fabsf(Angle(out.vecAimf, Aim(9.0f, 0.0f).vecAimf)) < 1e-6f);
+	CHECK(!interp.HasSample());
+
+	// the first sample is shown as it is
+	interp.Push(1000, Aim(0.0f, 0.0f), false);
+	interp.Get(1000, out);
+	CHECK(Angle(out.vecAimf, Aim(0.0f, 0.0f).vecAimf) < 1e-3f);
+
+	// the next is turned to over the gap between them
+	interp.Get(1100, out);
+	CHECK(!interp.IsInterpolating());
+	interp.Push(1100, Aim(0.2f, 0.0f), false);
+	CHECK(interp.IsInterpolating());
+	interp.Get(1150, out);
+	CHECK(fabsf(Angle(out.vecAimf, Aim(0.1f, 0.0f).vecAimf)) < 2e-3f);
+	CHECK(fabsf(sqrtf(out.vecAimf.x * out.vecAimf.x + out.vecAimf.y * out.vecAimf.y) - 1.0f) < 1e-4f);
+	interp.Get(1200, out);
+	CHECK(Angle(out.vecAimf, Aim(0.2f, 0.0f).vecAimf) < 1e-3f);
+	CHECK(!interp.IsInterpolating());
+
+	// after a pause the turn is caught up within AIM_INTERP_RESUME
+	interp.Push(3000, Aim(0.6f, 0.0f), false);
+	interp.Get(3000 + AIM_INTERP_RESUME, out);
+	CHECK(Angle(out.vecAimf, Aim(0.6f, 0.0f).vecAimf) < 1e-3f);
+
+	// a large jump or a camera change isn't turned to
+	interp.Push(3100, Aim(0.6f + AIM_SNAP_ANGLE + 0.1f, 0.0f), false);
+	interp.Get(3100, out);
+	CHECK(Angle(out.vecAimf, Aim(0.6f + AIM_SNAP_ANGLE + 0.1f, 0.0f).vecAimf) < 1e-3f);
+	interp.Push(3200, Aim(0.0f, 0.0f), true);
+	interp.Get(3200, out);
+	CHECK(Angle(out.vecAimf, Aim(0.0f, 0.0f).vecAimf) < 1e-3f);
+}
+
+struct AIM_PATH
+{
+	const char*						szName;
+	std::function<float(float)>		yaw;		// of the time in s
+	float							fMaxRate;	// packets/s the path may cost
+	float							fMaxAvgError;	// rad, remote against the true aim
+};
+
+static void TestPaths()
+{
+	const uint32_t dwLatency = 60;
+	const AIM_PATH paths[] = {
+		{ "still, hand jitter",	[](float) { return 0.3f; },						1.5f,	0.02f },
+		{ "slow pan 0.2 rad/s",	[](float t) { return 0.2f * t; },				8.0f,	0.05f },
+		{ "tracking 1.5 rad/s",	[](float t) { return 1.5f * t; },				10.5f,	0.25f },
+		{ "flick every second",	[](float t) { return floorf(t) * 0.8f; },		4.0f,	0.10f },
+		{ "sine sweep",			[](float t) { return 0.6f * sinf(t * 2.0f); },	10.5f,	0.10f },
+	};
+
+	for (const AIM_PATH& path : paths)
+	{
+		std::mt19937 rng(3);
+		std::normal_distribution<float> jitter(0.0f, 0.0015f);
+
+		CAimShaper shaper;
+		CAimInterpolator interp;
+		std::vector<std::pair<uint32_t, AIM_SAMPLE>> inFlight;
+		int iSent = 0, iFrames = 0;
+		float fSumError = 0.0f;
+
+		for (uint32_t dwNow = 0; dwNow < 10000; dwNow += 16)
+		{
+			AIM_SAMPLE aim = Aim(path.yaw(dwNow / 1000.0f) + jitter(rng), 0.1f + jitter(rng));
+			if (shaper.Update(dwNow, aim, false, NETMODE_AIM_SENDRATE)) {
+				iSent++;
+				inFlight.push_back({ dwNow + dwLatency + rng() % 40, aim });
+			}
+
+			// delivered in order, as RakNet's sequenced channel does
+			while (!inFlight.empty() && inFlight.front().first <= dwNow) {
+				interp.Push(dwNow, inFlight.front().second, false);
+				inFlight.erase(inFlight.begin());
+			}
+
+			if (!interp.HasSample() || dwNow < 1000) continue;
+
+			AIM_SAMPLE shown;
+			interp.Get(dwNow, shown);
+			AIM_SAMPLE truth = Aim(path.yaw((dwNow - dwLatency - 20) / 1000.0f), 0.1f);
+			fSumError += Angle(shown.vecAimf, truth.vecAimf);
+			iFrames++;
+		}
+
+		float fRate = iSent / 10.0f;
+		float fAvgError = fSumError / iFrames;
+		CHECK(fRate <= path.fMaxRate);
+		CHECK(fAvgError <= path.fMaxAvgError);
+		printf("%-20s %5.1f packets/s, remote error %.3f rad\n", path.szName, fRate, fAvgError);
+	}
+}
+
+int main()
+{
+	TestShaperRules();
+	TestInterpolatorRules();
+	TestPaths();
+
+	return HostTestResult("test_aimsync");
+}
@@ -0,0 +1,115 @@
+#include "game/Animation/AnimBlendBatch.h"
+#include "game/Core/SimdMath.h"
+#include "hosttest.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+// AnimBlendBatch::UncompressFrames against the per-frame KeyFrameCompressed getters it replaces:
+// the same floats to the bit for every int16, both frame layouts, any count. Built once with
+// the host's SIMD backend and once with SIMD_MATH_SCALAR.
+
+static bool SameBits(const void* a, const void* b, size_t size)
+{
+	return !memcmp(a, b, size);
+}
+
+template<typename T>
+static void FillFrames(std::vector<T>& frames, std::mt19937& rng)
+{
+	std::uniform_int_distribution<int> dist(-32768, 32767);
+	int16_t* p = (int16_t*)frames.data();
+	for (size_t i = 0; i < frames.size() * sizeof(T) / sizeof(int16_t); i++) p[i] = (int16_t)dist(rng);
+}
+
+static void TestChildFrames(int iCount, std::mt19937& rng)
+{
+	std::vector<KeyFrameCompressed> in(iCount);
+	FillFrames(in, rng);
+	if (iCount >= 3) {
+		in[0] = { { INT16_MIN, INT16_MAX, 0, -1 }, INT16_MIN };
+		in[1] = { { 1, -4096, 4096, 0 }, INT16_MAX };
+		in[2] = { { 0, 0, 0, 0 }, 0 };
+	}
+
+	// a guard frame past the end must stay untouched
+	KeyFrame guard{};
+	guard.rotation.Set(-1.0f, -2.0f, -3.0f, -4.0f);
+	guard.deltaTime = -5.0f;
+	std::vector<KeyFrame> out(iCount + 1, guard);
+
+	AnimBlendBatch::UncompressFrames(in.data(), out.data(), iCount);
+
+	for (int i = 0; i < iCount; i++)
+	{
+		CQuaternion rotation;
+		in[i].GetRotation(&rotation);
+		float fDeltaTime = in[i].GetDeltaTime();
+		CHECK(SameBits(&out[i].rotation, &rotation, sizeof(CQuaternion)));
+		CHECK(SameBits(&out[i].deltaTime, &fDeltaTime, sizeof(float)));
+	}
+	CHECK(SameBits(&out[iCount], &guard, sizeof(KeyFrame)));
+}
+
+static void TestRootFrames(int iCount, std::mt19937& rng)
+{
+	std::vector<KeyFrameTransCompressed> in(iCount);
+	FillFrames(in, rng);
+
+	KeyFrameTrans guard{};
+	guard.rotation.Set(-1.0f, -2.0f, -3.0f, -4.0f);
+	guard.deltaTime = -5.0f;
+	guard.translation.Set(-6.0f, -7.0f, -8.0f);
+	std::vector<KeyFrameTrans> out(iCount + 1, guard);
+
+	AnimBlendBatch::UncompressFrames(in.data(), out.data(), iCount);
+
+	for (int i = 0; i < iCount; i++)
+	{
+		CQuaternion rotation;
+		CVector translation;
+		in[i].GetRotation(&rotation);
+		in[i].GetTranslation(&translation);
+		float fDeltaTime = in[i].GetDeltaTime();
+		CHECK(SameBits(&out[i].rotation, &rotation, sizeof(CQuaternion)));
+		CHECK(SameBits(&out[i].translation, &translation, sizeof(CVector)));
+		CHECK(SameBits(&out[i].deltaTime, &fDeltaTime, sizeof(float)));
+	}
+	CHECK(SameBits(&out[iCount], &guard, sizeof(KeyFrameTrans)));
+}
+
+// every int16 in every rotation lane
+static void TestEveryValue()
+{
+	std::vector<KeyFrameCompressed> in(65536);
+	for (int i = 0; i < 65536; i++)
+	{
+		int16_t v = (int16_t)(i - 32768);
+		in[i] = { { v, (int16_t)~v, (int16_t)(v ^ 0x5555), (int16_t)-v }, v };
+	}
+	std::vector<KeyFrame> out(in.size());
+	AnimBlendBatch::UncompressFrames(in.data(), out.data(), (int32)in.size());
+
+	int iMismatches = 0;
+	for (size_t i = 0; i < in.size(); i++)
+	{
+		CQuaternion rotation;
+		in[i].GetRotation(&rotation);
+		iMismatches += !SameBits(&out[i].rotation, &rotation, sizeof(CQuaternion));
+	}
+	CHECK_EQ(iMismatches, 0);
+}
+
+int main()
+{
+	std::mt19937 rng(7);
+	for (int iCount : { 0, 1, 3, 4, 5, 17, 1003 })
+	{
+		TestChildFrames(iCount, rng);
+		TestRootFrames(iCount, rng);
+	}
+	TestEveryValue();
+
+	return HostTestResult("test_animblendbatch");
+}
@@ -0,0 +1,182 @@
+#include "game/Animation/AnimLod.h"
+#include "hosttest.h"
+
+#include <cmath>
+#include <vector>
+
+// CAnimLod on a synthetic clock: which calls run at which distance, that held back steps all
+// reach the animation, that large steps go straight through and that clumps are forgotten.
+
+#define FRAME_MS	16
+#define FRAME_STEP	0.016f
+
+struct CClump
+{
+	float	fDistance;
+	bool	bOnScreen;
+	double	fStepped = 0.0;		// what the animation was advanced by
+	double	fElapsed = 0.0;		// what it should have been
+	uint32_t dwLastRun = 0;
+	uint32_t dwWorstGap = 0;
+	int		iRuns = 0;
+};
+
+static void Step(CClump& clump, uint32_t dwNow, float fStep = FRAME_STEP)
+{
+	float fOutStep;
+	clump.fElapsed += fStep;
+	if (!CAnimLod::Update(&clump, clump.fDistance, clump.bOnScreen, dwNow, fStep, fOutStep)) return;
+
+	clump.fStepped += fOutStep;
+	if (clump.iRuns++) clump.dwWorstGap = std::max(clump.dwWorstGap, dwNow - clump.dwLastRun);
+	clump.dwLastRun = dwNow;
+}
+
+static void TestIntervals()
+{
+	CAnimLod::SetEnabled(true);
+	CAnimLod::ResetStats();
+
+	std::vector<CClump> clumps;
+	for (int i = 0; i < 300; i++)
+	{
+		CClump clump;
+		clump.fDistance = i < 100 ? 10.0f : (i < 200 ? 50.0f : 200.0f);
+		clump.bOnScreen = i % 2;
+		clumps.push_back(clump);
+	}
+
+	uint32_t dwNow = 1000;
+	for (int frame = 0; frame < 600; frame++, dwNow += FRAME_MS)
+		for (auto& clump : clumps) Step(clump, dwNow);
+
+	int iMidRuns = 0, iMidCount = 0;
+	for (size_t i = 0; i < clumps.size(); i++)
+	{
+		const CClump& clump = clumps[i];
+		bool bNear = i < 100, bMid = !bNear && i < 200 && clump.bOnScreen;
+		uint32_t dwInterval = bNear ? 0 : (bMid ? ANIM_LOD_MID_INTERVAL : ANIM_LOD_FAR_INTERVAL);
+
+		if (bNear) CHECK_EQ(clump.iRuns, 600);
+		else CHECK(clump.dwWorstGap < dwInterval + FRAME_MS);
+		if (bMid) {
+			iMidRuns += clump.iRuns;
+			iMidCount++;
+		}
+
+		// everything but what's held back since the last run reached the animation
+		CHECK(clump.fStepped <= clump.fElapsed + 1e-3);
+		CHECK(clump.fElapsed - clump.fStepped < dwInterval / 1000.0 + 1e-3);
+	}
+	// a mid clump runs about every fourth frame, not every frame and not once in a while
+	float fMidRate = (float)iMidRuns / iMidCount / 600;
+	CHECK(fMidRate > 0.2f && fMidRate < 0.35f);
+
+	const ANIM_LOD_STATS& stats = CAnimLod::GetStats();
+	CHECK_EQ(stats.nRun + stats.nSkipped, 600u * 300u);
+	CHECK_EQ(stats.nTracked, 200u);
+
+	CAnimLod::SetEnabled(false);
+	CHECK_EQ(CAnimLod::GetStats().nTracked, 0u);
+}
+
+// new clumps run on their first call and then spread over the interval
+static void TestStagger()
+{
+	CAnimLod::SetEnabled(true);
+
+	std::vector<CClump> clumps(200);
+	for (auto& clump : clumps) {
+		clump.fDistance = 200.0f;
+		clump.bOnScreen = false;
+	}
+
+	uint32_t dwNow = 1000;
+	for (auto& clump : clumps) Step(clump, dwNow);
+	for (auto& clump : clumps) CHECK_EQ(clump.iRuns, 1);
+
+	int iMostInOneFrame = 0;
+	for (int frame = 1; frame < ANIM_LOD_FAR_INTERVAL / FRAME_MS + 2; frame++)
+	{
+		dwNow += FRAME_MS;
+		int iRuns = 0;
+		for (auto& clump : clumps) {
+			int iBefore = clump.iRuns;
+			Step(clump, dwNow);
+			iRuns += clump.iRuns - iBefore;
+		}
+		iMostInOneFrame = std::max(iMostInOneFrame, iRuns);
+	}
+	// about a tenth per frame with a 150 ms interval, never all at once
+	CHECK(iMostInOneFrame < 60);
+	for (auto& clump : clumps) CHECK(clump.iRuns >= 2);
+
+	CAnimLod::SetEnabled(false);
+}
+
+static void TestLargeSteps()
+{
+	CAnimLod::SetEnabled(true);
+
+	CClump clump;
+	clump.fDistance = 200.0f;
+	clump.bOnScreen = false;
+
+	// the stagger puts the second run anywhere in the interval, depending on the address
+	uint32_t dwNow = 1000;
+	Step(clump, dwNow);
+	while (clump.iRuns < 2) Step(clump, dwNow += FRAME_MS);
+	Step(clump, dwNow += FRAME_MS);
+	Step(clump, dwNow += FRAME_MS);
+	CHECK_EQ(clump.iRuns, 2);
+
+	// a snapshot runs at once with everything held back
+	float fOutStep;
+	CHECK(CAnimLod::Update(&clump, clump.fDistance, false, dwNow += FRAME_MS, 100.0f, fOutStep));
+	CHECK(fabsf(fOutStep - (100.0f + 2 * FRAME_STEP)) < 1e-4f);
+
+	CHECK_EQ(CAnimLod::GetStats().nTracked, 0u);
+
+	// as does a clump coming near; the snapshot forgot it, so it runs on its first call again
+	int iRuns = clump.iRuns;
+	Step(clump, dwNow += FRAME_MS);
+	CHECK_EQ(clump.iRuns, iRuns + 1);
+	while (clump.iRuns < iRuns + 2) Step(clump, dwNow += FRAME_MS);
+	Step(clump, dwNow += FRAME_MS);
+	CHECK_EQ(clump.iRuns, iRuns + 2);
+	CHECK(CAnimLod::Update(&clump, 5.0f, false, dwNow += FRAME_MS, FRAME_STEP, fOutStep));
+	CHECK(fabsf(fOutStep - 2 * FRAME_STEP) < 1e-4f);
+	CHECK_EQ(CAnimLod::GetStats().nTracked, 0u);
+
+	CAnimLod::SetEnabled(false);
+}
+
+static void TestForget()
+{
+	CAnimLod::SetEnabled(true);
+
+	CClump a, b;
+	a.fDistance = b.fDistance = 200.0f;
+	uint32_t dwNow = 1000;
+	Step(a, dwNow);
+	Step(b, dwNow);
+	CHECK_EQ(CAnimLod::GetStats().nTracked, 2u);
+
+	// only b keeps being asked about
+	for (int frame = 0; frame < (ANIM_LOD_FORGET_TIME * 2) / FRAME_MS; frame++) Step(b, dwNow += FRAME_MS);
+	CHECK_EQ(CAnimLod::GetStats().nTracked, 1u);
+
+	CAnimLod::SetEnabled(false);
+}
+
+int main()
+{
+	CHECK(!CAnimLod::IsEnabled());
+
+	TestIntervals();
+	TestStagger();
+	TestLargeSteps();
+	TestForget();
+
+	return HostTestResult("test_animlod");
+}
@@ -0,0 +1,52 @@
+#include "game/animnames.h"
+#include "hosttest.h"
+
+#include <cctype>
+#include <string>
+#include <strings.h>
+
+// GetAnimIdxByName() against the linear scan it replaced, for every entry as written, in
+// upper and in lower case, plus names that aren't there.
+
+#define ANIM_NAMES_EXPECTED		1844
+
+static int LinearAnimIdx(const char* szName)
+{
+	for (int i = 0; const char* szAnim = GetAnimByIdx(i); i++)
+		if (!strcasecmp(szAnim, szName)) return i;
+	return -1;
+}
+
+int main()
+{
+	int iCount = 0;
+	while (GetAnimByIdx(iCount)) iCount++;
+	CHECK_EQ(iCount, ANIM_NAMES_EXPECTED);
+	CHECK(GetAnimByIdx(-1) == nullptr);
+
+	for (int i = 0; i < iCount; i++)
+	{
+		std::string name = GetAnimByIdx(i);
+		std::string upper = name, lower = name;
+		for (char& c : upper) c = (char)toupper((unsigned char)c);
+		for (char& c : lower) c = (char)tolower((unsigned char)c);
+
+		CHECK_EQ(GetAnimIdxByName(name.c_str()), LinearAnimIdx(name.c_str()));
+		CHECK_EQ(GetAnimIdxByName(upper.c_str()), LinearAnimIdx(upper.c_str()));
+		CHECK_EQ(GetAnimIdxByName(lower.c_str()), LinearAnimIdx(lower.c_str()));
+		CHECK(GetAnimationIndexFromName(name.c_str()));
+
+		// a prefix or an extended name is a different name
+		std::string longer = name + "x";
+		CHECK_EQ(GetAnimIdxByName(longer.c_str()), LinearAnimIdx(longer.c_str()));
+		std::string shorter = name.substr(0, name.size() - 1);
+		CHECK_EQ(GetAnimIdxByName(shorter.c_str()), LinearAnimIdx(shorter.c_str()));
+	}
+
+	CHECK_EQ(GetAnimIdxByName(""), -1);
+	CHECK_EQ(GetAnimIdxByName("NOPE:nope"), -1);
+	CHECK_EQ(GetAnimIdxByName("~"), -1);
+	CHECK(!GetAnimationIndexFromName("PED"));
+
+	return HostTestResult("test_animnames");
+}
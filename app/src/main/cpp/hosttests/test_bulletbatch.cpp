@@ -0,0 +1,175 @@
+#include "main.h"
+#include "net/netgame.h"
+#include "hosttest.h"
+
+#include <random>
+
+// CBulletBatcher records round trip within the quantization steps, fall back to floats
+// where they must, and reject every truncated or malformed record.
+
+#define ORIGIN_TOLERANCE	0.004f	// half of 1/256 on each axis
+#define HITPOS_TOLERANCE	0.015f	// half of 1/64 on each axis
+#define OFFSET_TOLERANCE	0.015f	// 1/1024 steps, or the hit position's
+
+static float Random(std::mt19937& rng, float fMin, float fMax)
+{
+	return std::uniform_real_distribution<float>(fMin, fMax)(rng);
+}
+
+static void TestRoundTrip()
+{
+	std::mt19937 rng(1);
+	CBulletBatcher batcher;
+	batcher.SetEnabled(true);
+
+	uint8_t buffer[BULLET_BATCH_MAX_BYTES];
+	float fOrigin = 0.0f, fHitPos = 0.0f, fOffset = 0.0f;
+
+	for (int iter = 0; iter < 20000; iter++)
+	{
+		int iShots = 1 + rng() % BULLET_BATCH_MAX;
+		BULLET_SYNC_DATA in[BULLET_BATCH_MAX], out[BULLET_BATCH_MAX];
+
+		CVector vecBase(Random(rng, -3000.0f, 3000.0f), Random(rng, -3000.0f, 3000.0f), Random(rng, 0.0f, 100.0f));
+		uint8_t byteWeapon = 22 + rng() % 17;
+
+		for (int i = 0; i < iShots; i++)
+		{
+			BULLET_SYNC_DATA& shot = in[i];
+			shot.byteHitType = rng() % 5;
+			shot.PlayerID = shot.byteHitType ? rng() % 1000 : 0;
+			shot.byteWeaponID = (rng() % 4 == 0) ? byteWeapon + 1 : byteWeapon;
+
+			// the same spot, a step away, or too far from the first shot for shorts
+			shot.vecOrigin = (rng() % 3 == 0) ? vecBase :
+				vecBase + CVector(Random(rng, -1.0f, 1.0f), Random(rng, -1.0f, 1.0f), Random(rng, -0.2f, 0.2f));
+			if (iter % 50 == 0) shot.vecOrigin = vecBase + CVector(500.0f, 0.0f, 0.0f);
+
+			float fRange = (iter % 97 == 0) ? 900.0f : Random(rng, 1.0f, 300.0f);
+			shot.vecPos = shot.vecOrigin + CVector(Random(rng, -fRange, fRange), Random(rng, -fRange, fRange), Random(rng, -20.0f, 20.0f));
+
+			switch (rng() % 4)
+			{
+				case 0: shot.vecOffset = CVector(0.0f, 0.0f, 0.0f); break;
+				case 1: shot.vecOffset = CVector(Random(rng, -2.0f, 2.0f), Random(rng, -2.0f, 2.0f), Random(rng, -1.0f, 1.0f)); break;
+				case 2: shot.vecOffset = shot.vecPos; break;
+				case 3: shot.vecOffset = CVector(Random(rng, -100.0f, 100.0f), 0.0f, 0.0f); break;
+			}
+
+			CHECK_EQ(batcher.Add(i * 5, shot), i + 1 == BULLET_BATCH_MAX);
+		}
+
+		int iLength = batcher.Encode(buffer, sizeof(buffer));
+		CHECK(iLength > 0);
+		CHECK_EQ(batcher.GetCount(), 0);
+
+		CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, BULLET_BATCH_MAX), iShots);
+		for (int i = 0; i < iLength; i++)
+			CHECK_EQ(CBulletBatcher::Decode(buffer, i, out + 0, BULLET_BATCH_MAX), -1);
+		CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, BULLET_BATCH_MAX), iShots);
+
+		for (int i = 0; i < iShots; i++)
+		{
+			CHECK_EQ(out[i].byteHitType, in[i].byteHitType);
+			CHECK_EQ(out[i].PlayerID, in[i].PlayerID);
+			CHECK_EQ(out[i].byteWeaponID, in[i].byteWeaponID);
+			fOrigin = std::max(fOrigin, (out[i].vecOrigin - in[i].vecOrigin).Magnitude());
+			fHitPos = std::max(fHitPos, (out[i].vecPos - in[i].vecPos).Magnitude());
+			fOffset = std::max(fOffset, (out[i].vecOffset - in[i].vecOffset).Magnitude());
+		}
+	}
+
+	CHECK(fOrigin <= ORIGIN_TOLERANCE);
+	CHECK(fHitPos <= HITPOS_TOLERANCE);
+	CHECK(fOffset <= OFFSET_TOLERANCE);
+	printf("largest error: origin %.4f, hit position %.4f, offset %.4f\n", fOrigin, fHitPos, fOffset);
+}
+
+static BULLET_SYNC_DATA Shot(float x)
+{
+	BULLET_SYNC_DATA shot;
+	shot.byteHitType = BULLET_HIT_TYPE_PLAYER;
+	shot.PlayerID = 7;
+	shot.vecOrigin = CVector(x, 0.0f, 10.0f);
+	shot.vecPos = CVector(x + 30.0f, 1.0f, 10.0f);
+	shot.vecOffset = CVector(0.1f, 0.2f, 0.3f);
+	shot.byteWeaponID = 31;
+	return shot;
+}
+
+static void TestQueue()
+{
+	CBulletBatcher batcher;
+	CHECK(!batcher.IsDue(0));
+
+	batcher.Add(1000, Shot(0.0f));
+	CHECK(!batcher.IsDue(1000 + BULLET_BATCH_WINDOW - 1));
+	CHECK(batcher.IsDue(1000 + BULLET_BATCH_WINDOW));
+
+	// the window runs from the first shot
+	batcher.Add(1040, Shot(1.0f));
+	CHECK(batcher.IsDue(1000 + BULLET_BATCH_WINDOW));
+
+	// a buffer too small gives nothing and still empties the queue
+	uint8_t small[16];
+	CHECK_EQ(batcher.Encode(small, sizeof(small)), 0);
+	CHECK_EQ(batcher.GetCount(), 0);
+	CHECK_EQ(batcher.Encode(small, sizeof(small)), 0);
+
+	// full: further shots are refused until it's sent
+	for (int i = 0; i < BULLET_BATCH_MAX; i++) batcher.Add(2000, Shot((float)i));
+	CHECK(batcher.Add(2000, Shot(99.0f)));
+	CHECK_EQ(batcher.GetCount(), BULLET_BATCH_MAX);
+
+	batcher.SetEnabled(false);
+	CHECK_EQ(batcher.GetCount(), 0);
+}
+
+static void TestMalformed()
+{
+	CBulletBatcher batcher;
+	uint8_t buffer[BULLET_BATCH_MAX_BYTES];
+	BULLET_SYNC_DATA out[BULLET_BATCH_MAX];
+
+	for (int i = 0; i < 3; i++) batcher.Add(0, Shot((float)i));
+	int iLength = batcher.Encode(buffer, sizeof(buffer));
+	CHECK(iLength > 0);
+
+	// more shots than the caller has room for
+	CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, 2), -1);
+
+	buffer[0] = BULLET_BATCH_VERSION + 1;
+	CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, BULLET_BATCH_MAX), -1);
+	buffer[0] = BULLET_BATCH_VERSION;
+
+	// first shot without a weapon, or with an unknown hit type
+	int iFlags = 2 + 3 * sizeof(float);
+	uint8_t byteFlags = buffer[iFlags];
+	buffer[iFlags] = byteFlags & ~0x08;
+	CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, BULLET_BATCH_MAX), -1);
+	buffer[iFlags] = (byteFlags & ~0x07) | 0x07;
+	CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, BULLET_BATCH_MAX), -1);
+	buffer[iFlags] = byteFlags;
+
+	CHECK_EQ(CBulletBatcher::Decode(buffer, iLength, out, BULLET_BATCH_MAX), 3);
+
+	// random bytes never read past the end
+	std::mt19937 rng(5);
+	for (int iter = 0; iter < 100000; iter++)
+	{
+		int iRandom = rng() % 64;
+		for (int i = 0; i < iRandom; i++) buffer[i] = rng();
+		if (rng() % 2) buffer[0] = BULLET_BATCH_VERSION;
+		int iShots = CBulletBatcher::Decode(buffer, iRandom, out, BULLET_BATCH_MAX);
+		CHECK(iShots >= -1 && iShots <= BULLET_BATCH_MAX);
+	}
+}
+
+int main()
+{
+	TestRoundTrip();
+	TestQueue();
+	TestMalformed();
+
+	return HostTestResult("test_bulletbatch");
+}
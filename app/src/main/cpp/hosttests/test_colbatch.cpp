@@ -0,0 +1,219 @@
+#include "game/Collision/ColBatch.h"
+#include "game/Core/SimdMath.h"
+#include "hosttest.h"
+#include "colbatch_scene.h"
+
+#include <algorithm>
+#include <cstring>
+
+// CColBatch's four-wide kernels against their scalar references on a random col model: same
+// nearest hit and the same fraction to the bit, the same any-hit answers and the same sphere
+// overlaps in order. The references are held against a double precision Moller-Trumbore, and
+// ProcessLineOfSight against the references under a random transform. Built once with the
+// host's SIMD backend and once with SIMD_MATH_SCALAR.
+
+static int32 NearestRef(const CColLine& line, const CColScene& scene, bool bSpheres, float& fFraction)
+{
+	int32 iNearest = -1;
+	int32 iCount = bSpheres ? scene.sphereSet.GetCount() : scene.triangleSet.GetCount();
+	float fMax = fFraction;
+	for (int32 i = 0; i < iCount; i++)
+	{
+		float f;
+		bool bHit = bSpheres ? CColBatch::LineSphereRef(line, scene.sphereSet, i, fMax, f) :
+			CColBatch::LineTriangleRef(line, scene.triangleSet, i, fMax, f);
+		if (bHit && f < fFraction) {
+			fFraction = f;
+			iNearest = i;
+		}
+	}
+	return iNearest;
+}
+
+static bool SameBits(float a, float b)
+{
+	return !memcmp(&a, &b, sizeof(float));
+}
+
+static void TestKernels(const CColScene& scene)
+{
+	std::mt19937 rng(2);
+	int iTriangleHits = 0, iSphereHits = 0, iOverlaps = 0;
+
+	for (int iter = 0; iter < 4000; iter++)
+	{
+		CColLine line = SceneRandomLine(rng);
+		if (iter % 10 == 0) line.m_vecEnd = line.m_vecStart;
+		float fMax = iter % 3 ? 1.0f : SceneRandom(rng, 0.0f, 1.0f);
+
+		float fWant = fMax, fGot = fMax;
+		int32 iWant = NearestRef(line, scene, false, fWant);
+		int32 iGot = CColBatch::ProcessLineTriangles(line, scene.triangleSet, fGot);
+		CHECK_EQ(iGot, iWant);
+		CHECK(SameBits(fGot, fWant));
+		iTriangleHits += iGot >= 0;
+
+		float fAny = 1.0f;
+		CHECK_EQ(CColBatch::TestLineTriangles(line, scene.triangleSet), NearestRef(line, scene, false, fAny) >= 0);
+
+		fWant = fGot = fMax;
+		iWant = NearestRef(line, scene, true, fWant);
+		iGot = CColBatch::ProcessLineSpheres(line, scene.sphereSet, fGot);
+		CHECK_EQ(iGot, iWant);
+		CHECK(SameBits(fGot, fWant));
+		iSphereHits += iGot >= 0;
+
+		fAny = 1.0f;
+		CHECK_EQ(CColBatch::TestLineSpheres(line, scene.sphereSet), NearestRef(line, scene, true, fAny) >= 0);
+
+		CSphere sphere(SceneRandomPoint(rng), SceneRandom(rng, 0.0f, 5.0f));
+		int32 gotHits[64], wantHits[64];
+		int32 iMaxHits = iter % 7 ? 64 : 2;
+		int32 iGotHits = CColBatch::TestSphereSpheres(sphere, scene.sphereSet, gotHits, iMaxHits);
+		int32 iWantHits = 0;
+		for (int32 i = 0; i < scene.sphereSet.GetCount() && iWantHits < iMaxHits; i++)
+			if (CColBatch::SphereSphereRef(sphere, scene.sphereSet, i)) wantHits[iWantHits++] = i;
+		CHECK_EQ(iGotHits, iWantHits);
+		CHECK(!memcmp(gotHits, wantHits, iWantHits * sizeof(int32)));
+		iOverlaps += iGotHits;
+	}
+
+	// the random scene has to exercise every path, not just the misses
+	CHECK(iTriangleHits > 1000);
+	CHECK(iSphereHits > 1000);
+	CHECK(iOverlaps > 1000);
+	printf("kernels: %d triangle hits, %d sphere hits, %d overlaps in 4000 queries\n", iTriangleHits, iSphereHits, iOverlaps);
+}
+
+// the reference triangle test against a double precision one, away from the edges where
+// float rounding may go either way
+static void TestTriangleRefAccuracy(const CColScene& scene)
+{
+	std::mt19937 rng(4);
+	int iHits = 0;
+
+	for (int iter = 0; iter < 1000; iter++)
+	{
+		CColLine line = SceneRandomLine(rng);
+		double dx = line.m_vecEnd.x - line.m_vecStart.x, dy = line.m_vecEnd.y - line.m_vecStart.y, dz = line.m_vecEnd.z - line.m_vecStart.z;
+
+		for (int32 i = 0; i < SCENE_TRIANGLES; i++)
+		{
+			float f;
+			bool bHit = CColBatch::LineTriangleRef(line, scene.triangleSet, i, 1.0f, f);
+
+			const CVector& a = scene.vertices[i * 3];
+			const CVector& b = scene.vertices[i * 3 + 1];
+			const CVector& c = scene.vertices[i * 3 + 2];
+			double e1[3] = { b.x - a.x, b.y - a.y, b.z - a.z };
+			double e2[3] = { c.x - a.x, c.y - a.y, c.z - a.z };
+			double p[3] = { dy * e2[2] - dz * e2[1], dz * e2[0] - dx * e2[2], dx * e2[1] - dy * e2[0] };
+			double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+			if (fabs(det) < 1e-9) {
+				CHECK(!bHit || i == 1 || i == 2);
+				continue;
+			}
+
+			double s[3] = { line.m_vecStart.x - a.x, line.m_vecStart.y - a.y, line.m_vecStart.z - a.z };
+			double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+			double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) / det;
+			double v = (dx * q[0] + dy * q[1] + dz * q[2]) / det;
+			double t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) / det;
+			bool bWant = u >= 0 && v >= 0 && u + v <= 1 && t >= 0 && t <= 1;
+
+			double fMargin = std::min({ u, v, 1 - u - v, t, 1 - t });
+			if (fabs(fMargin) > 1e-4) CHECK_EQ(bHit, bWant);
+			if (bHit && bWant) CHECK(fabs(f - t) < 1e-4);
+			iHits += bHit;
+		}
+	}
+	CHECK(iHits > 100);
+}
+
+static void TestLineOfSight(const CColScene& scene)
+{
+	std::mt19937 rng(6);
+	int iHits = 0;
+
+	for (int iter = 0; iter < 2000; iter++)
+	{
+		CMatrix transform;
+		transform.SetRotate(SceneRandom(rng, -3.1f, 3.1f), SceneRandom(rng, -3.1f, 3.1f), SceneRandom(rng, -3.1f, 3.1f));
+		transform.m_pos = SceneRandomPoint(rng) * 20.0f;
+
+		// a model space line taken to the world
+		CColLine modelLine = SceneRandomLine(rng);
+		CColLine worldLine = TransformObject(modelLine, transform);
+		float fMax = iter % 2 ? 1.0f : SceneRandom(rng, 0.2f, 1.0f);
+
+		// what it should find: the references on the line as ProcessLineOfSight sees it
+		CColLine ln = TransformObject(worldLine, Invert(transform));
+		float fWant = fMax;
+		int32 iSphere = NearestRef(ln, scene, true, fWant);
+		int32 iTriangle = NearestRef(ln, scene, false, fWant);
+
+		CColPoint colPoint;
+		float fGot = fMax;
+		bool bHit = CColBatch::ProcessLineOfSight(worldLine, transform, scene.triangleSet, scene.sphereSet, colPoint, fGot);
+		CHECK_EQ(bHit, iSphere >= 0 || iTriangle >= 0);
+		if (!bHit) {
+			CHECK(SameBits(fGot, fMax));
+			continue;
+		}
+		iHits++;
+
+		CHECK(SameBits(fGot, fWant));
+		if (iTriangle >= 0) CHECK_EQ(colPoint.m_nSurfaceTypeB, scene.triangles[iTriangle].m_nMaterial);
+		else CHECK_EQ(colPoint.m_nSurfaceTypeB, scene.spheres[iSphere].m_Surface.m_nMaterial);
+
+		// a world space point on the line, a unit normal facing it
+		CVector dir = worldLine.m_vecEnd - worldLine.m_vecStart;
+		CVector point = worldLine.m_vecStart + dir * fGot;
+		CHECK((colPoint.m_vecPoint - point).Magnitude() < 0.01f);
+		CHECK(fabsf(colPoint.m_vecNormal.Magnitude() - 1.0f) < 1e-4f);
+		// a line starting inside a sphere hits it at its start, anywhere inside
+		if (fGot == 0.0f) continue;
+		CHECK(DotProduct(colPoint.m_vecNormal, dir) <= 1e-4f);
+
+		if (iTriangle < 0) {
+			const CColSphere& sphere = scene.spheres[iSphere];
+			CVector toCenter = transform * sphere.m_vecCenter - colPoint.m_vecPoint;
+			CHECK(fabsf(toCenter.Magnitude() - sphere.m_fRadius) < 0.01f);
+		}
+	}
+	CHECK(iHits > 500);
+	printf("line of sight: %d hits in 2000 queries\n", iHits);
+}
+
+static void TestEmpty()
+{
+	CCollisionData data;
+	CColTriangleSet tris;
+	CColSphereSet spheres;
+	tris.Build(data);
+	spheres.Build(data);
+
+	CColLine line(CVector(-1.0f, 0.0f, 0.0f), CVector(1.0f, 0.0f, 0.0f));
+	float fFraction = 1.0f;
+	CHECK_EQ(CColBatch::ProcessLineTriangles(line, tris, fFraction), -1);
+	CHECK_EQ(CColBatch::ProcessLineSpheres(line, spheres, fFraction), -1);
+	CHECK(!CColBatch::TestLineTriangles(line, tris));
+	CHECK(!CColBatch::TestLineSpheres(line, spheres));
+	int32 hits[4];
+	CHECK_EQ(CColBatch::TestSphereSpheres(CSphere(CVector(0.0f, 0.0f, 0.0f), 10.0f), spheres, hits, 4), 0);
+	CHECK_EQ(fFraction, 1.0f);
+}
+
+int main()
+{
+	std::mt19937 rng(1);
+	CColScene scene;
+	BuildScene(scene, rng);
+
+	TestKernels(scene);
+	TestTriangleRefAccuracy(scene);
+	TestLineOfSight(scene);
+	TestEmpty();
+
+	return HostTestResult("test_colbatch");
+}
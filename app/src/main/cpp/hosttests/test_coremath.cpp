@@ -0,0 +1,138 @@
+#include "main.h"
+#include "game/Core/Matrix.h"
+#include "game/Core/SimdMath.h"
+#include "hosttest.h"
+#include "coremath_ref.h"
+
+#include <random>
+
+// The SIMD paths of CMatrix, Multiply3x3 and CQuaternion::Slerp against the scalar code
+// they replaced, on random input. Built once with the host's SIMD backend and once with
+// SIMD_MATH_SCALAR; both must match the old code to rounding and leave the padding words alone.
+
+#define PAD_MAGIC	0xA5A5A5A5u
+
+static float g_fWorstError = 0.0f;
+
+static float Random(std::mt19937& rng, float fMin, float fMax)
+{
+	return std::uniform_real_distribution<float>(fMin, fMax)(rng);
+}
+
+static CVector RandomVector(std::mt19937& rng, float fRange)
+{
+	return CVector(Random(rng, -fRange, fRange), Random(rng, -fRange, fRange), Random(rng, -fRange, fRange));
+}
+
+static void RandomMatrix(std::mt19937& rng, CMatrix& mat)
+{
+	mat.m_right = RandomVector(rng, 2.0f);
+	mat.m_forward = RandomVector(rng, 2.0f);
+	mat.m_up = RandomVector(rng, 2.0f);
+	mat.m_pos = RandomVector(rng, 3000.0f);
+	mat.flags = PAD_MAGIC;
+	mat.pad1 = PAD_MAGIC;
+	mat.pad2 = PAD_MAGIC;
+	mat.pad3 = PAD_MAGIC;
+	mat.m_pAttachMatrix = nullptr;
+	mat.m_bOwnsAttachedMatrix = 0;
+}
+
+// within rounding of the magnitudes that went into the result
+static bool Close(float fGot, float fWant, float fScale)
+{
+	float fError = fabsf(fGot - fWant) / std::max(fScale, 1.0f);
+	g_fWorstError = std::max(g_fWorstError, fError);
+	return fError <= 1e-6f;
+}
+
+static bool Close(const CVector& got, const CVector& want, float fScale)
+{
+	return Close(got.x, want.x, fScale) && Close(got.y, want.y, fScale) && Close(got.z, want.z, fScale);
+}
+
+static bool Close(const CMatrix& got, const CMatrix& want)
+{
+	return Close(got.m_right, want.m_right, 12.0f) && Close(got.m_forward, want.m_forward, 12.0f) &&
+		Close(got.m_up, want.m_up, 12.0f) && Close(got.m_pos, want.m_pos, 3000.0f * 12.0f);
+}
+
+static bool PaddingIntact(const CMatrix& mat)
+{
+	return mat.flags == PAD_MAGIC && mat.pad1 == PAD_MAGIC && mat.pad2 == PAD_MAGIC && mat.pad3 == PAD_MAGIC;
+}
+
+static void TestMatrix()
+{
+	std::mt19937 rng(7);
+	CMatrix a, b, want;
+
+	for (int iter = 0; iter < 100000; iter++)
+	{
+		RandomMatrix(rng, a);
+		RandomMatrix(rng, b);
+		CVector v = RandomVector(rng, 100.0f);
+
+		CHECK(Close(a * b, RefMultiply(a, b)));
+
+		CHECK(Close(a * v, RefTransform(a, v), 3000.0f + 100.0f * 6.0f));
+		CHECK(Close(Multiply3x3(a, v), RefMultiply3x3(a, v), 100.0f * 6.0f));
+		CHECK(Close(Multiply3x3(v, a), RefMultiply3x3(v, a), 100.0f * 6.0f));
+
+		RefInvert(a, want);
+		CMatrix out;
+		RandomMatrix(rng, out);
+		Invert(a, out);
+		CHECK(Close(out, want));
+		CHECK(PaddingIntact(out));
+
+		// in place
+		Invert(a, a);
+		CHECK(Close(a, want));
+		CHECK(PaddingIntact(a));
+	}
+}
+
+static void TestSlerp()
+{
+	std::mt19937 rng(3);
+
+	for (int iter = 0; iter < 100000; iter++)
+	{
+		CQuaternion q1, q2, got, want;
+		q1.Set(Random(rng, -1, 1), Random(rng, -1, 1), Random(rng, -1, 1), Random(rng, -1, 1));
+		q1.Normalize();
+		// every other pair close together, for the linear branch
+		if (iter & 1) {
+			q2.Set(q1.x + Random(rng, -0.1f, 0.1f), q1.y + Random(rng, -0.1f, 0.1f),
+				q1.z + Random(rng, -0.1f, 0.1f), q1.w + Random(rng, -0.1f, 0.1f));
+			if (iter & 2) q2.Set(-q2.x, -q2.y, -q2.z, -q2.w);
+		} else {
+			q2.Set(Random(rng, -1, 1), Random(rng, -1, 1), Random(rng, -1, 1), Random(rng, -1, 1));
+		}
+		q2.Normalize();
+		float t = Random(rng, 0.0f, 1.0f);
+
+		got.Slerp(&q1, &q2, t);
+		RefSlerp(want, q1, q2, t);
+		CHECK(Close(got.x, want.x, 1.0f) && Close(got.y, want.y, 1.0f) &&
+			Close(got.z, want.z, 1.0f) && Close(got.w, want.w, 1.0f));
+	}
+}
+
+int main()
+{
+	TestMatrix();
+	TestSlerp();
+
+#if SIMD_MATH_NEON
+	printf("backend: neon, ");
+#elif SIMD_MATH_SSE
+	printf("backend: sse, ");
+#else
+	printf("backend: scalar, ");
+#endif
+	printf("worst relative error %g\n", g_fWorstError);
+
+	return HostTestResult("test_coremath");
+}
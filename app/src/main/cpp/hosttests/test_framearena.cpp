@@ -0,0 +1,190 @@
+#include "framearena.h"
+#include "hosttest.h"
+
+#include <cstring>
+#include <random>
+#include <thread>
+
+// CFrameArena and CMemPool, built with the memory stats on: arena alignment, chunks kept and
+// rewound, oversized requests, the STL adapters; pool size classes, block reuse, Realloc
+// across classes and into large blocks, and blocks that never overlap under several threads.
+
+static bool Filled(const void* pMem, uint8_t byte, size_t size)
+{
+	for (size_t i = 0; i < size; i++)
+		if (((const uint8_t*)pMem)[i] != byte) return false;
+	return true;
+}
+
+static void TestArena()
+{
+	CFrameArena::EndFrame();
+	void* pFirst = CFrameArena::Alloc(10);
+	CHECK_EQ((uintptr_t)pFirst % alignof(std::max_align_t), 0u);
+
+	for (size_t align = 1; align <= 256; align *= 2)
+	{
+		void* p = CFrameArena::Alloc(3, align);
+		CHECK_EQ((uintptr_t)p % align, 0u);
+	}
+	CHECK(CFrameArena::Alloc(0) != nullptr);
+
+	// a frame's allocations never overlap, also across chunks
+	std::mt19937 rng(1);
+	std::vector<std::pair<uint8_t*, size_t>> blocks;
+	for (int i = 0; i < 5000; i++)
+	{
+		size_t size = 1 + rng() % 400;
+		uint8_t* p = (uint8_t*)CFrameArena::Alloc(size, (size_t)1 << (rng() % 5));
+		memset(p, (uint8_t)i, size);
+		blocks.emplace_back(p, size);
+	}
+	bool bIntact = true;
+	for (size_t i = 0; i < blocks.size(); i++) bIntact &= Filled(blocks[i].first, (uint8_t)i, blocks[i].second);
+	CHECK(bIntact);
+
+	FRAME_ARENA_STATS stats = CFrameArena::GetStats();
+	CHECK(stats.iChunks >= 2);
+	CHECK(stats.used >= 5000);
+	CHECK_EQ(stats.dwAllocs, 5000u + 1 + 9 + 1);
+	int iChunks = stats.iChunks;
+	size_t used = stats.used;
+
+	// rewinds to the first chunk and keeps them all
+	CFrameArena::EndFrame();
+	CHECK(CFrameArena::Alloc(10) == pFirst);
+	stats = CFrameArena::GetStats();
+	CHECK_EQ(stats.iChunks, iChunks);
+	CHECK_EQ(stats.dwLastAllocs, 5000u + 1 + 9 + 1);
+	CHECK_EQ(stats.dwAllocs, 1u);
+	CHECK(stats.highWater >= used);
+
+	// bigger than a chunk: one of its own, gone with the frame
+	uint32_t dwOversized = stats.dwOversized;
+	void* pBig = CFrameArena::Alloc(FRAME_ARENA_CHUNK_SIZE * 2, 64);
+	CHECK_EQ((uintptr_t)pBig % 64, 0u);
+	memset(pBig, 1, FRAME_ARENA_CHUNK_SIZE * 2);
+	stats = CFrameArena::GetStats();
+	CHECK_EQ(stats.dwOversized, dwOversized + 1);
+	CHECK_EQ(stats.iChunks, iChunks);
+
+	char* szCopy = CFrameArena::StrDup("hello");
+	CHECK(!strcmp(szCopy, "hello"));
+
+	FrameString text;
+	for (int i = 0; i < 1000; i++) text += "abc";
+	CHECK_EQ(text.size(), 3000u);
+	FrameVector<int> values;
+	for (int i = 0; i < 100000; i++) values.push_back(i);
+	CHECK_EQ(values[99999], 99999);
+
+	CFrameArena::EndFrame();
+	CHECK_EQ(CFrameArena::GetStats().used, 0u);
+}
+
+static void TestPoolClasses()
+{
+	MEMPOOL_STATS before = CMemPool::GetStats();
+
+	// each size to the smallest class it fits in, aligned like malloc, usable to the end
+	const size_t sizes[] = { 0, 1, 16, 17, 32, 33, 100, 2048, 2049, 4096, 4097, 100000 };
+	const int classes[] = { 0, 0, 0, 1, 1, 2, 3, 7, 8, 8, -1, -1 };
+	for (int i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++)
+	{
+		MEMPOOL_STATS stats = CMemPool::GetStats();
+		void* p = CMemPool::Alloc(sizes[i]);
+		CHECK_EQ((uintptr_t)p % MEMPOOL_HEADER_SIZE, 0u);
+		memset(p, 0xAB, sizes[i]);
+
+		MEMPOOL_STATS after = CMemPool::GetStats();
+		if (classes[i] < 0) CHECK_EQ(after.dwLarge, stats.dwLarge + 1);
+		else CHECK_EQ(after.dwClassAllocs[classes[i]], stats.dwClassAllocs[classes[i]] + 1);
+		CMemPool::Free(p);
+	}
+
+	// a freed block is the next one handed out in its class
+	void* a = CMemPool::Alloc(40);
+	CMemPool::Free(a);
+	CHECK(CMemPool::Alloc(60) == a);
+	CMemPool::Free(a);
+	CMemPool::Free(nullptr);
+
+	MEMPOOL_STATS after = CMemPool::GetStats();
+	CHECK_EQ(after.iLive, before.iLive);
+}
+
+static void TestPoolRealloc()
+{
+	MEMPOOL_STATS before = CMemPool::GetStats();
+
+	void* p = CMemPool::Realloc(nullptr, 10);
+	memcpy(p, "0123456789", 10);
+
+	// within the class it stays put
+	CHECK(CMemPool::Realloc(p, 16) == p);
+
+	for (size_t size : { 3000, 10000, 100000, 50 })
+	{
+		p = CMemPool::Realloc(p, size);
+		CHECK(p != nullptr);
+		CHECK(!memcmp(p, "0123456789", 10));
+	}
+	// shrinking a large block keeps it large
+	CHECK_EQ(CMemPool::GetStats().iLive, before.iLive + 1);
+
+	CHECK(CMemPool::Realloc(p, 0) == nullptr);
+	CHECK_EQ(CMemPool::GetStats().iLive, before.iLive);
+
+	std::vector<int, MemPoolAllocator<int>> values;
+	for (int i = 0; i < 10000; i++) values.push_back(i);
+	CHECK_EQ(values[9999], 9999);
+	values.clear();
+	values.shrink_to_fit();
+	CHECK_EQ(CMemPool::GetStats().iLive, before.iLive);
+}
+
+// every thread stamps its blocks and checks the stamp before freeing them
+static void TestPoolThreads()
+{
+	MEMPOOL_STATS before = CMemPool::GetStats();
+	std::atomic<int> iCorrupt{0};
+
+	std::thread threads[4];
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t] = std::thread([t, &iCorrupt]() {
+			std::mt19937 rng(t);
+			void* blocks[64];
+			size_t sizes[64];
+			for (int round = 0; round < 2000; round++)
+			{
+				for (int i = 0; i < 64; i++) {
+					sizes[i] = rng() % 5000;
+					blocks[i] = CMemPool::Alloc(sizes[i]);
+					memset(blocks[i], t * 64 + i, sizes[i]);
+				}
+				for (int i = 0; i < 64; i++) {
+					if (!Filled(blocks[i], (uint8_t)(t * 64 + i), sizes[i])) iCorrupt++;
+					CMemPool::Free(blocks[i]);
+				}
+			}
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	CHECK_EQ(iCorrupt.load(), 0);
+	MEMPOOL_STATS after = CMemPool::GetStats();
+	CHECK_EQ(after.iLive, before.iLive);
+	CHECK_EQ(after.dwAllocs - before.dwAllocs, 4u * 2000u * 64u);
+}
+
+int main()
+{
+	TestArena();
+	TestPoolClasses();
+	TestPoolRealloc();
+	TestPoolThreads();
+
+	CHECK_EQ(CMemPool::GetStats().iLive, 0);
+	return HostTestResult("test_framearena");
+}
@@ -0,0 +1,109 @@
+#include "java/jnibridge.h"
+#include "hosttest.h"
+
+#include <vector>
+
+// CJavaBridge with a sink that records what would have crossed JNI: the HUD values are sent
+// once when they change and not again while they stay the same, and once more after the Java
+// side rebuilt its HUD.
+
+class CRecordingSink : public IJavaBridgeSink
+{
+public:
+	std::vector<HudInfo> pushed;
+
+	void PushHudInfo(const HudInfo& info) override { pushed.push_back(info); }
+};
+
+static HudInfo Hud(int iHealth, int iAmmoInClip, int iMoney)
+{
+	HudInfo info = {};
+	info.iHealth = iHealth;
+	info.iArmour = 50;
+	info.iWeaponId = 24;
+	info.iAmmo = 70;
+	info.iAmmoInClip = iAmmoInClip;
+	info.iMoney = iMoney;
+	info.iWanted = 0;
+	return info;
+}
+
+static void TestDiff()
+{
+	CRecordingSink sink;
+	CJavaBridge bridge(&sink);
+
+	// the first values always go, even all zero
+	HudInfo zero = {};
+	CHECK(bridge.UpdateHudInfo(zero));
+	CHECK_EQ(sink.pushed.size(), 1u);
+
+	// a frame after frame of the same values sends nothing
+	HudInfo hud = Hud(100, 7, 500);
+	CHECK(bridge.UpdateHudInfo(hud));
+	for (int frame = 0; frame < 100; frame++) CHECK(!bridge.UpdateHudInfo(hud));
+	CHECK_EQ(sink.pushed.size(), 2u);
+	CHECK(sink.pushed.back() == hud);
+
+	// each changed field is sent exactly once
+	int HudInfo::* fields[] = { &HudInfo::iHealth, &HudInfo::iArmour, &HudInfo::iWeaponId, &HudInfo::iAmmo,
+		&HudInfo::iAmmoInClip, &HudInfo::iMoney, &HudInfo::iWanted };
+	for (auto field : fields)
+	{
+		size_t count = sink.pushed.size();
+		hud.*field += 1;
+		CHECK(bridge.UpdateHudInfo(hud));
+		CHECK(!bridge.UpdateHudInfo(hud));
+		CHECK_EQ(sink.pushed.size(), count + 1);
+		CHECK(sink.pushed.back() == hud);
+	}
+
+	// going back to earlier values is a change too
+	HudInfo before = Hud(100, 7, 500);
+	CHECK(bridge.UpdateHudInfo(before));
+	CHECK(sink.pushed.back() == before);
+}
+
+static void TestInvalidate()
+{
+	CRecordingSink sink;
+	CJavaBridge bridge(&sink);
+
+	HudInfo hud = Hud(80, 3, 20);
+	bridge.UpdateHudInfo(hud);
+	bridge.UpdateHudInfo(hud);
+	CHECK_EQ(sink.pushed.size(), 1u);
+
+	// the Java side lost what it had: the same values are sent once more, then not again
+	bridge.InvalidateHud();
+	CHECK(bridge.UpdateHudInfo(hud));
+	CHECK(!bridge.UpdateHudInfo(hud));
+	CHECK_EQ(sink.pushed.size(), 2u);
+	CHECK(sink.pushed[1] == hud);
+
+	// a typical fight: health drops on some frames, ammo on others
+	size_t count = sink.pushed.size();
+	int iChanges = 0;
+	for (int frame = 0; frame < 300; frame++)
+	{
+		HudInfo next = hud;
+		if (frame % 10 == 0) next.iHealth--;
+		if (frame % 25 == 0) next.iAmmoInClip = (next.iAmmoInClip + 6) % 7;
+		iChanges += next != hud;
+		hud = next;
+		bridge.UpdateHudInfo(hud);
+	}
+	CHECK_EQ(sink.pushed.size(), count + iChanges);
+
+	// no sink: still diffs, nothing to crash on
+	CJavaBridge orphan(nullptr);
+	CHECK(orphan.UpdateHudInfo(hud));
+	CHECK(!orphan.UpdateHudInfo(hud));
+}
+
+int main()
+{
+	TestDiff();
+	TestInvalidate();
+	return HostTestResult("test_jnibridge");
+}
@@ -0,0 +1,165 @@
+#include "jobsystem.h"
+#include "hosttest.h"
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+// CJobSystem without workers, where the schedule is fixed and checked step by step, and with
+// workers: every job runs exactly once, fences and the frame fence hold, completions only run
+// on the main thread, jobs can submit and wait on jobs, other threads can wait.
+
+static double Work(int iIterations)
+{
+	double fSum = 0.0;
+	for (int i = 0; i < iIterations; i++) fSum += std::sqrt((double)i + fSum);
+	return fSum;
+}
+
+static void TestInline()
+{
+	CJobSystem::Initialise(0);
+	CHECK_EQ(CJobSystem::GetWorkerCount(), 0);
+	CHECK(CJobSystem::IsMainThread());
+
+	std::string order, done;
+	CJobFence fence;
+	for (int i = 0; i < 3; i++)
+		CJobSystem::Submit([&, i]() { order += (char)('l' + i); }, JOB_PRIORITY_LOW, &fence, [&, i]() { done += (char)('l' + i); });
+	for (int i = 0; i < 3; i++)
+		CJobSystem::Submit([&, i]() { order += (char)('n' + i); }, JOB_PRIORITY_NORMAL);
+	for (int i = 0; i < 3; i++)
+		CJobSystem::SubmitFrame([&, i]() { order += (char)('A' + i); });
+
+	// nothing runs until it's waited on
+	CHECK(order.empty());
+	CHECK(!fence.IsDone());
+	CHECK_EQ(CJobSystem::GetStats().iQueued, 9);
+
+	// by priority, then in submission order, up to the last fenced job
+	CJobSystem::Wait(fence);
+	CHECK(order == "ABCnoplmn");
+	CHECK(fence.IsDone());
+	CHECK(done.empty());
+
+	// completions wait for the end of the frame
+	CJobSystem::Submit([&]() { order += 'x'; }, JOB_PRIORITY_LOW);
+	CJobSystem::EndFrame();
+	CHECK(order == "ABCnoplmnx");
+	CHECK(done == "lmn");
+	CHECK_EQ(CJobSystem::GetStats().iQueued, 0);
+
+	// a job's completion may post another, it runs on the next call
+	CJobSystem::PostToMain([&]() { CJobSystem::PostToMain([&]() { done += '2'; }); done += '1'; });
+	CHECK_EQ(CJobSystem::ProcessCompletions(), 1);
+	CHECK(done == "lmn1");
+	CHECK_EQ(CJobSystem::ProcessCompletions(), 1);
+	CHECK(done == "lmn12");
+
+	// shutdown runs what's left
+	CJobSystem::Submit([&]() { order += 'y'; });
+	CJobSystem::Shutdown();
+	CHECK(order == "ABCnoplmnxy");
+}
+
+static void TestWorkers()
+{
+	CJobSystem::Initialise(4);
+	CHECK_EQ(CJobSystem::GetWorkerCount(), 4);
+	JOB_STATS before = CJobSystem::GetStats();
+
+	std::atomic<int> iRan{0};
+	std::atomic<int> iOffMain{0};
+	int iCompleted = 0;
+	const int iFrames = 50, iPerFrame = 200, iChildren = 20;
+
+	for (int frame = 0; frame < iFrames; frame++)
+	{
+		std::atomic<int> iFrameRan{0};
+		for (int i = 0; i < iPerFrame; i++)
+		{
+			CJobSystem::SubmitFrame([&]() {
+				DoNotOptimize(Work(200));
+				if (!CJobSystem::IsMainThread()) iOffMain++;
+				iFrameRan++;
+				iRan++;
+			}, [&]() {
+				CHECK(CJobSystem::IsMainThread());
+				iCompleted++;
+			});
+		}
+
+		// a job that fans out into more under the same fence
+		CJobFence fence;
+		CJobSystem::Submit([&]() {
+			for (int k = 0; k < iChildren; k++)
+				CJobSystem::Submit([&]() { DoNotOptimize(Work(100)); iRan++; }, JOB_PRIORITY_NORMAL, &fence);
+			iRan++;
+		}, JOB_PRIORITY_NORMAL, &fence);
+
+		CJobSystem::EndFrame();
+		CHECK_EQ(iFrameRan.load(), iPerFrame);
+		CHECK_EQ(iCompleted, iPerFrame * (frame + 1));
+
+		CJobSystem::Wait(fence);
+		CHECK(fence.IsDone());
+	}
+
+	CHECK_EQ(iRan.load(), iFrames * (iPerFrame + 1 + iChildren));
+	CHECK(iOffMain.load() > 0);
+
+	JOB_STATS after = CJobSystem::GetStats();
+	CHECK_EQ(after.dwSubmitted - before.dwSubmitted, (uint32_t)(iFrames * (iPerFrame + 1 + iChildren)));
+	CHECK_EQ(after.dwExecuted - before.dwExecuted, after.dwSubmitted - before.dwSubmitted);
+	CHECK_EQ(after.iQueued, 0);
+
+	CJobSystem::Shutdown();
+}
+
+// a job waiting on jobs it submitted, and a thread outside the pool waiting on a fence
+static void TestNestedWaits()
+{
+	CJobSystem::Initialise(2);
+
+	std::atomic<int> iRan{0};
+	CJobFence outer;
+	for (int i = 0; i < 8; i++)
+	{
+		CJobSystem::Submit([&]() {
+			CJobFence inner;
+			for (int k = 0; k < 16; k++)
+				CJobSystem::Submit([&]() { DoNotOptimize(Work(50)); iRan++; }, JOB_PRIORITY_HIGH, &inner);
+			CJobSystem::Wait(inner);
+			CHECK(inner.IsDone());
+		}, JOB_PRIORITY_NORMAL, &outer);
+	}
+	CJobSystem::Wait(outer);
+	CHECK_EQ(iRan.load(), 8 * 16);
+
+	std::atomic<int> iThreadRan{0};
+	std::thread thread([&]() {
+		CHECK(!CJobSystem::IsMainThread());
+		CJobFence fence;
+		for (int i = 0; i < 100; i++)
+			CJobSystem::Submit([&]() { iThreadRan++; }, JOB_PRIORITY_LOW, &fence);
+		CJobSystem::Wait(fence);
+		CHECK_EQ(iThreadRan.load(), 100);
+		CJobSystem::PostToMain([&]() { iThreadRan += 1000; });
+	});
+	thread.join();
+	CHECK_EQ(iThreadRan.load(), 100);
+	CJobSystem::EndFrame();
+	CHECK_EQ(iThreadRan.load(), 1100);
+
+	CJobSystem::Shutdown();
+}
+
+int main()
+{
+	TestInline();
+	TestWorkers();
+	TestNestedWaits();
+
+	return HostTestResult("test_jobsystem");
+}
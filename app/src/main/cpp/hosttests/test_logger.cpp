@@ -0,0 +1,175 @@
+#include "main.h"
+#include "hosttest.h"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <thread>
+
+// CLogger against the file it writes: order per thread, copied strings, truncation, rings
+// handed over between short-lived threads, and the synchronous crash mode.
+
+char* g_pszStorage = nullptr;
+
+static char g_szStorage[] = "/tmp/samp_logger_XXXXXX";
+
+static std::vector<std::string> ReadLog()
+{
+	CLogger::Flush();
+
+	std::vector<std::string> lines;
+	std::ifstream file(std::string(g_szStorage) + "/samp_log.txt");
+	for (std::string line; std::getline(file, line);) lines.push_back(line);
+	return lines;
+}
+
+static bool Contains(const std::vector<std::string>& lines, const std::string& line)
+{
+	return std::find(lines.begin(), lines.end(), line) != lines.end();
+}
+
+// more lines than one ring holds, so Write() has to drain on its own
+static void TestSingleThreadOrder()
+{
+	for (int i = 0; i < LOG_RING_SIZE * 4; i++)
+		FLog("order %d %s", i, "x");
+
+	std::vector<std::string> lines = ReadLog();
+	int iNext = 0;
+	for (const std::string& line : lines)
+	{
+		int iLine;
+		if (sscanf(line.c_str(), "order %d", &iLine) != 1) continue;
+		CHECK_EQ(iLine, iNext);
+		iNext = iLine + 1;
+	}
+	CHECK_EQ(iNext, LOG_RING_SIZE * 4);
+}
+
+static void TestArguments()
+{
+	char szName[32];
+	strcpy(szName, "before");
+	FLog("copy %s", szName);
+	strcpy(szName, "after");
+
+	FLog("null %s", (const char*)nullptr);
+	FLog("numbers %d %u %.2f %c %lld", -5, 7u, 1.25, 'z', 1LL << 40);
+	FLog("plain");
+	FLogWarn("warn %d", 1);
+	FLogError("error %d", 2);
+
+	std::vector<std::string> lines = ReadLog();
+	CHECK(Contains(lines, "copy before"));
+	CHECK(Contains(lines, "null (null)"));
+	CHECK(Contains(lines, "numbers -5 7 1.25 z 1099511627776"));
+	CHECK(Contains(lines, "plain"));
+	CHECK(Contains(lines, "warn 1"));
+	CHECK(Contains(lines, "error 2"));
+}
+
+static void TestTruncation()
+{
+	// a string argument bigger than the record is cut, the line still comes out
+	std::string big(LOG_RECORD_SIZE * 2, 'a');
+	FLog("big %s", big.c_str());
+
+	// a format string bigger than the record is formatted right away, cut to the line size
+	std::string format = "format " + std::string(LOG_RECORD_SIZE * 2, 'b') + " %d";
+	FLog(format.c_str(), 1);
+
+	std::vector<std::string> lines = ReadLog();
+	bool bBig = false, bFormat = false;
+	for (const std::string& line : lines)
+	{
+		if (line.rfind("big aaaa", 0) == 0) {
+			bBig = true;
+			CHECK(line.size() < LOG_RECORD_SIZE);
+			CHECK(line.find_first_not_of('a', 4) == std::string::npos);
+		}
+		if (line.rfind("format bbbb", 0) == 0) {
+			bFormat = true;
+			CHECK_EQ(line.size(), LOG_LINE_SIZE - 1);
+		}
+	}
+	CHECK(bBig);
+	CHECK(bFormat);
+}
+
+// more threads than rings over time: each one hands its ring back when it exits
+static void TestShortLivedThreads()
+{
+	const int iThreads = LOG_MAX_THREADS * 3;
+	for (int i = 0; i < iThreads; i++)
+	{
+		std::thread([i]() {
+			for (int j = 0; j < 10; j++) FLog("short %d %d", i, j);
+		}).join();
+	}
+
+	std::vector<std::string> lines = ReadLog();
+	std::set<std::string> seen(lines.begin(), lines.end());
+	for (int i = 0; i < iThreads; i++)
+		for (int j = 0; j < 10; j++)
+			CHECK(seen.count("short " + std::to_string(i) + " " + std::to_string(j)));
+}
+
+static void TestConcurrentThreads()
+{
+	const int iThreads = 8;
+	const int iLines = 5000;
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < iThreads; t++)
+	{
+		threads.emplace_back([t]() {
+			for (int i = 0; i < iLines; i++) FLog("thread %d line %d", t, i);
+		});
+	}
+	for (std::thread& thread : threads) thread.join();
+
+	std::vector<int> next(iThreads, 0);
+	for (const std::string& line : ReadLog())
+	{
+		int t, i;
+		if (sscanf(line.c_str(), "thread %d line %d", &t, &i) != 2) continue;
+		CHECK_EQ(i, next[t]);
+		next[t] = i + 1;
+	}
+	for (int t = 0; t < iThreads; t++) CHECK_EQ(next[t], iLines);
+}
+
+// last: the logger stays synchronous once a crash began
+static void TestCrash()
+{
+	FLog("queued before crash %d", 1);
+	CLogger::BeginCrash();
+	FLog("after crash %d", 2);
+
+	std::vector<std::string> lines;
+	std::ifstream file(std::string(g_szStorage) + "/samp_log.txt");
+	for (std::string line; std::getline(file, line);) lines.push_back(line);
+
+	CHECK(Contains(lines, "queued before crash 1"));
+	CHECK(Contains(lines, "after crash 2"));
+}
+
+int main()
+{
+	CHECK(mkdtemp(g_szStorage) != nullptr);
+	g_pszStorage = g_szStorage;
+	g_bHostLogcatQuiet = true;
+
+	TestSingleThreadOrder();
+	TestArguments();
+	TestTruncation();
+	TestShortLivedThreads();
+	TestConcurrentThreads();
+	TestCrash();
+
+	std::string path = std::string(g_szStorage) + "/samp_log.txt";
+	unlink(path.c_str());
+	rmdir(g_szStorage);
+
+	return HostTestResult("test_logger");
+}
@@ -0,0 +1,224 @@
+#include "game/modelcache.h"
+#include "hosttest.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+
+// CModelCache driven by synthetic traces through a fake store: the LRU order and the
+// hit/miss counts against a plain list model, pinned and busy models never evicted, the
+// scan and time budgets, and the cursor picking up where the last Trim() stopped.
+
+class CFakeStore : public IModelCacheStore
+{
+public:
+	std::map<int, size_t>	resident;
+	std::set<int>			busy;
+	uint64_t				qwTime = 0;
+	uint64_t				qwTimeStep = 1;
+	std::vector<int>		evicted;
+
+	size_t GetMemoryUsed() override {
+		size_t used = 0;
+		for (auto& model : resident) used += model.second;
+		return used;
+	}
+	bool IsResident(int iModel) override { return resident.count(iModel) != 0; }
+	bool CanEvict(int iModel) override { return IsResident(iModel) && !busy.count(iModel); }
+	void Evict(int iModel) override {
+		resident.erase(iModel);
+		evicted.push_back(iModel);
+	}
+	uint64_t GetTimeMicros() override { return qwTime += qwTimeStep; }
+};
+
+static void TestBasic()
+{
+	CFakeStore store;
+	CModelCache cache(&store);
+
+	for (int i = 0; i < 10; i++) {
+		store.resident[i] = 100;
+		cache.Observe(i, false);
+	}
+	cache.Access(3);
+	cache.Access(50);
+	CHECK_EQ(cache.GetStats().dwHits, 1);
+	CHECK_EQ(cache.GetStats().dwMisses, 1);
+	CHECK(!cache.IsTracked(50));
+
+	std::vector<int> order;
+	cache.GetOrder(order);
+	CHECK((order == std::vector<int>{ 3, 9, 8, 7, 6, 5, 4, 2, 1, 0 }));
+
+	// coldest first: 0 pinned, 1 busy, then 2, 4 and 5 go
+	cache.SetPins({ 0 });
+	store.busy.insert(1);
+	CHECK_EQ(cache.Trim(700, 100000), 300);
+	CHECK((store.evicted == std::vector<int>{ 2, 4, 5 }));
+	CHECK_EQ(cache.GetStats().dwPinnedSkips, 1);
+	CHECK_EQ(cache.GetStats().dwBusySkips, 1);
+	CHECK_EQ(cache.GetStats().dwEvictions, 3);
+	CHECK_EQ(cache.GetStats().qwEvictedBytes, 300);
+	CHECK_EQ(cache.GetCount(), 7);
+
+	// within budget: nothing to do
+	CHECK_EQ(cache.Trim(700, 100000), 0);
+
+	// a model that left by other means is dropped from the walk
+	store.resident.erase(6);
+	cache.Forget(6);
+	CHECK(!cache.IsTracked(6));
+	store.resident.erase(7);
+	cache.Trim(0, 100000);
+	CHECK(!cache.IsTracked(7));
+	CHECK(std::find(store.evicted.begin(), store.evicted.end(), 7) == store.evicted.end());
+}
+
+static void TestBudgets()
+{
+	CFakeStore store;
+	CModelCache cache(&store);
+	for (int i = 0; i < 100; i++) {
+		store.resident[i] = 100;
+		cache.Observe(i, false);
+	}
+
+	// time: every GetTimeMicros() call is 10 us, a 35 us budget gets through a few models
+	store.qwTimeStep = 10;
+	cache.Trim(0, 35);
+	CHECK(store.evicted.size() >= 1 && store.evicted.size() <= 4);
+	store.qwTimeStep = 1;
+
+	// scan limit
+	store.evicted.clear();
+	cache.SetScanLimit(5);
+	cache.Trim(0, 100000);
+	CHECK_EQ((int)store.evicted.size(), 5);
+
+	// the cursor resumes: a pinned cold end is skipped once, not every call
+	std::vector<int> pins;
+	std::vector<int> order;
+	cache.GetOrder(order);
+	for (int i = 0; i < 8; i++) pins.push_back(order[order.size() - 1 - i]);
+	cache.SetPins(pins);
+	cache.ResetStats();
+
+	store.evicted.clear();
+	cache.Trim(0, 100000);
+	CHECK_EQ(cache.GetStats().dwPinnedSkips, 5);
+	CHECK(store.evicted.empty());
+	cache.Trim(0, 100000);
+	CHECK_EQ(cache.GetStats().dwPinnedSkips, 8);
+	CHECK_EQ((int)store.evicted.size(), 2);
+}
+
+// the order the cache should keep, as a plain list
+static void Front(std::vector<int>& order, int iModel)
+{
+	order.erase(std::remove(order.begin(), order.end(), iModel), order.end());
+	order.insert(order.begin(), iModel);
+}
+
+static void TestTrace()
+{
+	CFakeStore store;
+	CModelCache cache(&store);
+	// enough for a full pass over the 1000 models, a Trim() that can't get within budget
+	// walks the whole scan limit
+	cache.SetScanLimit(2000);
+
+	std::vector<int> expected;
+	std::vector<int> pins;
+	uint32_t dwHits = 0, dwMisses = 0;
+	std::mt19937 rng(1);
+
+	for (int k = 0; k < 200000; k++)
+	{
+		// a hot set of 50 models and a long tail
+		int iModel = (rng() % 4) ? rng() % 50 : 50 + rng() % 950;
+		int iOp = rng() % 100;
+
+		if (iOp < 50)
+		{
+			bool bResident = store.IsResident(iModel);
+			bResident ? dwHits++ : dwMisses++;
+			if (cache.IsTracked(iModel) || bResident) Front(expected, iModel);
+			cache.Access(iModel);
+
+			// loads in the background
+			if (!bResident) store.resident[iModel] = 50 + rng() % 100;
+		}
+		else if (iOp < 80)
+		{
+			if (!store.IsResident(iModel)) continue;
+			bool bInUse = rng() % 2;
+			if (!cache.IsTracked(iModel) || bInUse) Front(expected, iModel);
+			cache.Observe(iModel, bInUse);
+		}
+		else if (iOp < 85)
+		{
+			store.resident.erase(iModel);
+			if (rng() % 2) {
+				cache.Forget(iModel);
+				expected.erase(std::remove(expected.begin(), expected.end(), iModel), expected.end());
+			}
+		}
+		else if (iOp < 87)
+		{
+			if (rng() % 2) store.busy.insert(iModel);
+			else store.busy.erase(iModel);
+		}
+		else if (iOp < 88)
+		{
+			pins.clear();
+			for (int i = 0; i < 5; i++) pins.push_back(rng() % 1000);
+			cache.SetPins(pins);
+		}
+		else
+		{
+			size_t budget = 3000 + rng() % 3000;
+			std::vector<int> evictedBefore = store.evicted;
+			cache.Trim(budget, 1000000);
+
+			for (size_t i = evictedBefore.size(); i < store.evicted.size(); i++) {
+				CHECK(!cache.IsPinned(store.evicted[i]));
+				CHECK(!store.busy.count(store.evicted[i]));
+			}
+
+			// nothing left to evict, or within budget
+			if (store.GetMemoryUsed() > budget) {
+				std::vector<int> order;
+				cache.GetOrder(order);
+				for (int iLeft : order)
+					CHECK(!store.IsResident(iLeft) || cache.IsPinned(iLeft) || store.busy.count(iLeft));
+			}
+
+			// Trim() only removes entries
+			expected.erase(std::remove_if(expected.begin(), expected.end(),
+				[&](int iLeft) { return !cache.IsTracked(iLeft); }), expected.end());
+		}
+
+		if (k % 1000 == 0) {
+			std::vector<int> order;
+			cache.GetOrder(order);
+			CHECK(order == expected);
+			CHECK_EQ((int)order.size(), cache.GetCount());
+		}
+	}
+
+	CHECK_EQ(cache.GetStats().dwHits, dwHits);
+	CHECK_EQ(cache.GetStats().dwMisses, dwMisses);
+	printf("trace: %u hits, %u misses, %u evictions\n",
+		cache.GetStats().dwHits, cache.GetStats().dwMisses, cache.GetStats().dwEvictions);
+}
+
+int main()
+{
+	TestBasic();
+	TestBudgets();
+	TestTrace();
+
+	return HostTestResult("test_modelcache");
+}
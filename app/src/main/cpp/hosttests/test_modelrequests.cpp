@@ -0,0 +1,238 @@
+#include "game/modelrequests.h"
+#include "hosttest.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+// CModelRequests through a fake loader: requests sharing a model, the priority order and the
+// per-frame budget of models handed to the streamer, the timeout, cancelling, and the callback
+// that runs right away when everything is already resident.
+
+class CFakeLoader : public IModelLoader
+{
+public:
+	std::set<int>		resident;
+	std::vector<int>	requested;
+
+	bool IsModelLoaded(int iModel) override { return resident.count(iModel) != 0; }
+	void RequestModel(int iModel) override { requested.push_back(iModel); }
+
+	// the streamer finishes everything handed to it
+	void LoadRequested() { resident.insert(requested.begin(), requested.end()); }
+};
+
+static void TestResident()
+{
+	CFakeLoader loader;
+	CModelRequests requests(&loader);
+	loader.resident = { 400, 401 };
+
+	int iCalls = 0;
+	bool bResult = false;
+	int models[] = { 400, 401, 400 };
+	MODELREQUEST hRequest = requests.Request(models, 3, MODEL_PRIORITY_NORMAL, [&](bool bLoaded) { iCalls++; bResult = bLoaded; });
+	CHECK_EQ(iCalls, 1);
+	CHECK(bResult);
+	CHECK(hRequest != INVALID_MODEL_REQUEST);
+	CHECK_EQ(requests.GetState(hRequest), MODEL_REQUEST_READY);
+	CHECK_EQ(requests.GetPendingCount(), 0);
+	CHECK(loader.requested.empty());
+
+	requests.Process(1000);
+	CHECK_EQ(iCalls, 1);
+	CHECK_EQ(requests.GetState(INVALID_MODEL_REQUEST), MODEL_REQUEST_UNKNOWN);
+}
+
+static void TestDedup()
+{
+	CFakeLoader loader;
+	CModelRequests requests(&loader);
+	int ownerA, ownerB;
+
+	// two requesters and a duplicate in one request: the streamer is asked once
+	int iDone = 0;
+	int models[] = { 500, 500, 501 };
+	MODELREQUEST hA = requests.Request(models, 3, MODEL_PRIORITY_NORMAL, [&](bool bLoaded) { iDone += bLoaded; }, &ownerA);
+	MODELREQUEST hB = requests.Request(500, MODEL_PRIORITY_LOW, [&](bool bLoaded) { iDone += bLoaded; }, &ownerB);
+	CHECK_EQ(requests.GetPendingCount(), 2);
+	CHECK_EQ(requests.GetQueuedModelCount(), 2);
+	CHECK_EQ(requests.GetState(hA), MODEL_REQUEST_PENDING);
+
+	requests.Process(1000);
+	CHECK_EQ(loader.requested.size(), 2u);
+	CHECK_EQ(std::count(loader.requested.begin(), loader.requested.end(), 500), 1);
+
+	// B only needed 500, A waits for 501 as well
+	loader.resident.insert(500);
+	requests.Process(1016);
+	CHECK_EQ(iDone, 1);
+	CHECK_EQ(requests.GetState(hB), MODEL_REQUEST_READY);
+	CHECK_EQ(requests.GetState(hA), MODEL_REQUEST_PENDING);
+
+	loader.resident.insert(501);
+	requests.Process(1032);
+	CHECK_EQ(iDone, 2);
+	CHECK_EQ(requests.GetState(hA), MODEL_REQUEST_READY);
+	CHECK_EQ(requests.GetQueuedModelCount(), 0);
+	CHECK_EQ(loader.requested.size(), 2u);
+}
+
+static void TestPriorityAndBudget()
+{
+	CFakeLoader loader;
+	CModelRequests requests(&loader);
+
+	for (int i = 0; i < 10; i++) requests.Request(600 + i, MODEL_PRIORITY_LOW);
+	requests.Request(700, MODEL_PRIORITY_NORMAL);
+	requests.Request(701, MODEL_PRIORITY_HIGH);
+	MODELREQUEST hPromoted = requests.Request(702, MODEL_PRIORITY_LOW);
+	requests.Promote(hPromoted, MODEL_PRIORITY_HIGH);
+	// a second requester with a higher priority lifts a shared model
+	requests.Request(609, MODEL_PRIORITY_NORMAL);
+
+	// four a frame, the most important first, the oldest first among equals
+	requests.Process(1000);
+	std::vector<int> expected = { 701, 702, 609, 700 };
+	CHECK(loader.requested == expected);
+
+	requests.Process(1016);
+	expected.insert(expected.end(), { 600, 601, 602, 603 });
+	CHECK(loader.requested == expected);
+
+	requests.Process(1032);
+	requests.Process(1048);
+	CHECK_EQ(loader.requested.size(), 13u);
+
+	// a high priority request queued behind a backlog still goes on the next frame
+	CFakeLoader busyLoader;
+	CModelRequests busy(&busyLoader);
+	for (int i = 0; i < 40; i++) busy.Request(800 + i, MODEL_PRIORITY_NORMAL);
+	busy.Process(1000);
+	busy.Request(900, MODEL_PRIORITY_HIGH);
+	busy.Process(1016);
+	CHECK_EQ(busyLoader.requested.size(), 2u * MODEL_REQUEST_BUDGET);
+	CHECK_EQ(busyLoader.requested[MODEL_REQUEST_BUDGET], 900);
+
+	busy.SetBudget(1);
+	busy.Process(1032);
+	CHECK_EQ(busyLoader.requested.size(), 2u * MODEL_REQUEST_BUDGET + 1);
+}
+
+static void TestTimeout()
+{
+	CFakeLoader loader;
+	CModelRequests requests(&loader);
+
+	int iFailed = 0, iLoaded = 0;
+	int models[] = { 400, 401 };
+	MODELREQUEST hGroup = requests.Request(models, 2, MODEL_PRIORITY_NORMAL, [&](bool bLoaded) { bLoaded ? iLoaded++ : iFailed++; });
+	MODELREQUEST hOther = requests.Request(401, MODEL_PRIORITY_NORMAL, [&](bool bLoaded) { bLoaded ? iLoaded++ : iFailed++; });
+
+	// the timeout runs from handing the model over, not from the request
+	requests.Process(1000);
+	loader.resident.insert(401);
+	requests.Process(1000 + MODEL_REQUEST_TIMEOUT - 1);
+	CHECK_EQ(iLoaded, 1);
+	CHECK_EQ(iFailed, 0);
+	CHECK_EQ(requests.GetState(hGroup), MODEL_REQUEST_PENDING);
+
+	requests.Process(1000 + MODEL_REQUEST_TIMEOUT);
+	CHECK_EQ(iFailed, 1);
+	CHECK_EQ(requests.GetState(hGroup), MODEL_REQUEST_FAILED);
+	CHECK_EQ(requests.GetState(hOther), MODEL_REQUEST_READY);
+	CHECK_EQ(requests.GetPendingCount(), 0);
+	CHECK_EQ(requests.GetQueuedModelCount(), 0);
+
+	// a failed group stops waiting for its other models, the one that still streams doesn't fail twice
+	int models2[] = { 410, 411 };
+	int iGroupCalls = 0;
+	MODELREQUEST hGroup2 = requests.Request(models2, 2, MODEL_PRIORITY_NORMAL, [&](bool) { iGroupCalls++; });
+	requests.SetBudget(1);
+	requests.Process(5000);
+	requests.Process(5000 + MODEL_REQUEST_TIMEOUT);
+	CHECK_EQ(iGroupCalls, 1);
+	CHECK_EQ(requests.GetState(hGroup2), MODEL_REQUEST_FAILED);
+	CHECK(!requests.IsModelQueued(411));
+
+	// a request made again after a timeout is handed over again
+	size_t count = loader.requested.size();
+	MODELREQUEST hRetry = requests.Request(410, MODEL_PRIORITY_NORMAL);
+	requests.Process(9000);
+	CHECK_EQ(loader.requested.size(), count + 1);
+	loader.LoadRequested();
+	requests.Process(9016);
+	CHECK_EQ(requests.GetState(hRetry), MODEL_REQUEST_READY);
+}
+
+static void TestCancel()
+{
+	CFakeLoader loader;
+	CModelRequests requests(&loader);
+	int owner;
+
+	int iCalls = 0;
+	MODELREQUEST hA = requests.Request(400, MODEL_PRIORITY_NORMAL, [&](bool) { iCalls++; });
+	MODELREQUEST hB = requests.Request(400, MODEL_PRIORITY_NORMAL, [&](bool) { iCalls++; });
+	MODELREQUEST hC = requests.Request(401, MODEL_PRIORITY_NORMAL, [&](bool) { iCalls++; }, &owner);
+	MODELREQUEST hD = requests.Request(402, MODEL_PRIORITY_NORMAL, [&](bool) { iCalls++; }, &owner);
+
+	// a model another request still waits for stays queued
+	requests.Cancel(hA);
+	CHECK_EQ(requests.GetState(hA), MODEL_REQUEST_UNKNOWN);
+	CHECK(requests.IsModelQueued(400));
+	requests.Cancel(hA);
+
+	requests.CancelOwner(&owner);
+	CHECK_EQ(requests.GetState(hC), MODEL_REQUEST_UNKNOWN);
+	CHECK_EQ(requests.GetState(hD), MODEL_REQUEST_UNKNOWN);
+	CHECK(!requests.IsModelQueued(401));
+	CHECK(!requests.IsModelQueued(402));
+	requests.CancelOwner(nullptr);
+
+	requests.Process(1000);
+	CHECK(loader.requested == std::vector<int>{ 400 });
+	loader.LoadRequested();
+	loader.resident.insert({ 401, 402 });
+	requests.Process(1016);
+	CHECK_EQ(iCalls, 1);
+	CHECK_EQ(requests.GetState(hB), MODEL_REQUEST_READY);
+	CHECK_EQ(requests.GetPendingCount(), 0);
+}
+
+// a callback may queue the next request, like a pool creating an entity that needs more models
+static void TestReentrant()
+{
+	CFakeLoader loader;
+	CModelRequests requests(&loader);
+
+	MODELREQUEST hNext = INVALID_MODEL_REQUEST;
+	int iNextCalls = 0;
+	requests.Request(400, MODEL_PRIORITY_NORMAL, [&](bool) {
+		hNext = requests.Request(401, MODEL_PRIORITY_NORMAL, [&](bool) { iNextCalls++; });
+		requests.Request(400, MODEL_PRIORITY_NORMAL, [&](bool) { iNextCalls++; });
+	});
+
+	requests.Process(1000);
+	loader.LoadRequested();
+	requests.Process(1016);
+	CHECK_EQ(iNextCalls, 1);
+	CHECK_EQ(requests.GetState(hNext), MODEL_REQUEST_PENDING);
+
+	requests.Process(1032);
+	loader.LoadRequested();
+	requests.Process(1048);
+	CHECK_EQ(iNextCalls, 2);
+	CHECK_EQ(requests.GetState(hNext), MODEL_REQUEST_READY);
+}
+
+int main()
+{
+	TestResident();
+	TestDedup();
+	TestPriorityAndBudget();
+	TestTimeout();
+	TestCancel();
+	TestReentrant();
+	return HostTestResult("test_modelrequests");
+}
@@ -0,0 +1,198 @@
+#include "net/nettelemetry.h"
+#include "hosttest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// CNetTelemetry on a fake clock: the counter deltas and the rates in the report, buckets
+// leaving the window, and the per-sync loss and jitter estimates against simulated streams
+// with known loss, delivered the way UpdateNetwork polls.
+
+#define ID_SYNC		207
+#define ID_OTHER	200
+
+static bool Near(float fValue, float fExpected, float fTolerance)
+{
+	return fValue >= fExpected - fTolerance && fValue <= fExpected + fTolerance;
+}
+
+static void TestCounters()
+{
+	CNetTelemetry telemetry;
+	NET_REPORT report;
+	telemetry.GetReport(report);
+	CHECK(report.fWindowSec == 0.0f);
+	CHECK_EQ(report.iRttMs, -1);
+	CHECK_EQ(report.iRttMinMs, -1);
+
+	// the first sample is the baseline, every later one adds what changed
+	NET_COUNTERS counters = {};
+	counters.dwMessagesSent = 5000;
+	counters.iPing = -1;
+	telemetry.Sample(counters, 1000);
+	for (uint32_t dwNow = 1100; dwNow <= 11000; dwNow += 100)
+	{
+		counters.dwMessagesSent += 20;
+		counters.dwMessageResends += 1;
+		counters.dwSequencedInOrder += 9;
+		counters.dwSequencedSkipped += 1;
+		counters.dwBitsSent += 1000;
+		counters.dwBitsReceived += 4000;
+		counters.dwOutOfOrder += 1;
+		counters.iPing = dwNow < 6000 ? 60 : 100;
+		counters.dwResendQueue = dwNow / 100;
+		telemetry.Sample(counters, dwNow);
+	}
+	telemetry.GetReport(report);
+	CHECK(Near(report.fWindowSec, 10.0f, 0.001f));
+	CHECK(Near(report.fLossOutPercent, 5.0f, 0.01f));
+	CHECK(Near(report.fLossInPercent, 10.0f, 0.01f));
+	CHECK(Near(report.fKbitOutPerSec, 10.0f, 0.01f));
+	CHECK(Near(report.fKbitInPerSec, 40.0f, 0.01f));
+	CHECK_EQ(report.dwOutOfOrder, 100u);
+	CHECK_EQ(report.dwResendQueue, 110u);
+	CHECK_EQ(report.iRttMs, 100);
+	CHECK_EQ(report.iRttMinMs, 60);
+	CHECK_EQ(report.iRttMaxMs, 100);
+	CHECK(Near(report.fRttAvgMs, (49 * 60 + 51 * 100) / 100.0f, 0.01f));
+	CHECK(Near(report.fRttJitterMs, 40.0f, 0.01f));	// one change, the same ping again is none
+	CHECK(Near(report.fPollAvgMs, 100.0f, 0.01f));
+	CHECK_EQ(report.dwPollMaxMs, 100u);
+
+	// a stall shows in the poll maximum, counters going down in the next connection's deltas
+	counters.dwMessagesSent = 20;
+	counters.dwMessageResends = 20;
+	telemetry.Sample(counters, 11700);
+	telemetry.GetReport(report);
+	CHECK_EQ(report.dwPollMaxMs, 700u);
+	CHECK(Near(report.fLossOutPercent, 120.0f / 2020.0f * 100.0f, 0.01f));
+
+	telemetry.Reset();
+	telemetry.GetReport(report);
+	CHECK(report.fWindowSec == 0.0f);
+	CHECK_EQ(report.iRttMs, -1);
+	CHECK_EQ(report.dwOutOfOrder, 0u);
+}
+
+static void TestWindow()
+{
+	CNetTelemetry telemetry;
+	telemetry.SetSyncType(ID_SYNC, NET_SYNC_VEHICLE);
+	CHECK(!strcmp(CNetTelemetry::GetSyncTypeName(NET_SYNC_VEHICLE), "vehicle"));
+	CHECK(!strcmp(CNetTelemetry::GetSyncTypeName(NET_SYNC_COUNT), "?"));
+
+	telemetry.OnPacket(ID_OTHER, 10, NET_TELEMETRY_NO_SENDER, 1000);
+	telemetry.OnPacket(ID_SYNC, 50, 3, 1000);
+	telemetry.OnPacket(ID_SYNC, 50, NET_TELEMETRY_NO_SENDER, 1500);
+	telemetry.OnPacket(ID_SYNC, 50, NET_TELEMETRY_MAX_SENDERS, 1500);
+	CHECK_EQ(telemetry.GetPacketCount(ID_OTHER), 1u);
+	CHECK_EQ(telemetry.GetPacketBytes(ID_OTHER), 10u);
+	CHECK_EQ(telemetry.GetPacketCount(ID_SYNC), 3u);
+
+	NET_REPORT report;
+	telemetry.GetReport(report);
+	CHECK_EQ(report.sync[NET_SYNC_VEHICLE].dwPackets, 3u);
+	CHECK(Near(report.sync[NET_SYNC_VEHICLE].fKbitPerSec, 150 * 8 / 0.5f / 1000.0f, 0.001f));
+	CHECK_EQ(report.sync[NET_SYNC_PLAYER].dwPackets, 0u);
+
+	// the clock going back lands in the current bucket
+	telemetry.OnPacket(ID_OTHER, 10, NET_TELEMETRY_NO_SENDER, 900);
+	CHECK_EQ(telemetry.GetPacketCount(ID_OTHER), 2u);
+
+	// still in the window at its far end, gone one bucket later
+	telemetry.OnPacket(ID_OTHER, 10, NET_TELEMETRY_NO_SENDER, 1000 + (NET_TELEMETRY_BUCKETS - 1) * NET_TELEMETRY_BUCKET_MS);
+	CHECK_EQ(telemetry.GetPacketCount(ID_OTHER), 3u);
+	telemetry.GetReport(report);
+	CHECK(Near(report.fWindowSec, (float)NET_TELEMETRY_BUCKETS - 1, 0.001f));
+
+	telemetry.OnPacket(ID_OTHER, 10, NET_TELEMETRY_NO_SENDER, 1000 + NET_TELEMETRY_BUCKETS * NET_TELEMETRY_BUCKET_MS);
+	CHECK_EQ(telemetry.GetPacketCount(ID_OTHER), 2u);
+	CHECK_EQ(telemetry.GetPacketCount(ID_SYNC), 0u);
+	telemetry.GetReport(report);
+	CHECK(Near(report.fWindowSec, (float)NET_TELEMETRY_BUCKETS - 1, 0.001f));	// the new bucket just began
+
+	// a long silence empties it
+	telemetry.OnPacket(ID_OTHER, 10, NET_TELEMETRY_NO_SENDER, 1000000);
+	CHECK_EQ(telemetry.GetPacketCount(ID_OTHER), 1u);
+}
+
+// senders streams at a fixed period with random delay and loss, delivered at each poll
+static NET_SYNC_REPORT Simulate(uint32_t dwSeed, int iPeriod, int iDelay, float fLoss, int iPollMs)
+{
+	const int iSenders = 10, iSeconds = 30;
+
+	struct ARRIVAL { uint32_t dwAt; uint16_t wSender; };
+	std::vector<ARRIVAL> arrivals;
+	std::mt19937 rng(dwSeed);
+	std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+	for (int s = 0; s < iSenders; s++)
+	{
+		for (int k = 0; k * iPeriod < iSeconds * 1000; k++)
+		{
+			if (chance(rng) < fLoss) continue;
+			uint32_t dwAt = 1000 + s * 3 + k * iPeriod + (iDelay ? rng() % iDelay : 0);
+			arrivals.push_back({ dwAt, (uint16_t)s });
+		}
+	}
+	std::sort(arrivals.begin(), arrivals.end(), [](const ARRIVAL& a, const ARRIVAL& b) { return a.dwAt < b.dwAt; });
+
+	CNetTelemetry telemetry;
+	telemetry.SetSyncType(ID_SYNC, NET_SYNC_PLAYER);
+	NET_COUNTERS counters = {};
+	counters.iPing = 80;
+
+	size_t next = 0;
+	for (uint32_t dwNow = 1000; dwNow < 1000 + iSeconds * 1000u; dwNow += iPollMs)
+	{
+		telemetry.Sample(counters, dwNow);
+		for (; next < arrivals.size() && arrivals[next].dwAt <= dwNow; next++)
+			telemetry.OnPacket(ID_SYNC, 60, arrivals[next].wSender, dwNow);
+	}
+
+	NET_REPORT report;
+	telemetry.GetReport(report);
+	return report.sync[NET_SYNC_PLAYER];
+}
+
+static void TestSyncLoss()
+{
+	// a clean stream: the poll alone is no loss, its rate and bandwidth come out right
+	NET_SYNC_REPORT sync = Simulate(1, 50, 0, 0.0f, 33);
+	CHECK(sync.fLossPercent < 0.5f);
+	CHECK(Near(sync.fPacketsPerSec, 200.0f, 10.0f));
+	CHECK(Near(sync.fKbitPerSec, 200.0f * 60 * 8 / 1000.0f, 5.0f));
+	CHECK(sync.fJitterMs > 0.0f && sync.fJitterMs < 40.0f);
+
+	sync = Simulate(2, 40, 30, 0.0f, 33);
+	CHECK(sync.fLossPercent < 0.5f);
+
+	// real loss shows, never overstated, more loss estimated higher
+	for (int iPeriod : { 40, 100 })
+	{
+		for (int iDelay : { 0, 20 })
+		{
+			float fLast = 0.0f;
+			for (float fLoss : { 0.05f, 0.1f, 0.2f })
+			{
+				sync = Simulate(7, iPeriod, iDelay, fLoss, 33);
+				CHECK(sync.fLossPercent >= fLoss * 100.0f * 0.25f);
+				CHECK(sync.fLossPercent <= fLoss * 100.0f * 1.1f);
+				CHECK(sync.fLossPercent > fLast);
+				fLast = sync.fLossPercent;
+			}
+		}
+	}
+
+	// delay that varies more shows as more jitter
+	CHECK(Simulate(3, 100, 40, 0.0f, 10).fJitterMs > Simulate(3, 100, 0, 0.0f, 10).fJitterMs + 5.0f);
+}
+
+int main()
+{
+	TestCounters();
+	TestWindow();
+	TestSyncLoss();
+	return HostTestResult("test_nettelemetry");
+}
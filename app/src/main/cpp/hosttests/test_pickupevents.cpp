@@ -0,0 +1,127 @@
+#include "net/pickupevents.h"
+#include "hosttest.h"
+
+#include <deque>
+#include <initializer_list>
+#include <random>
+
+// CPickupEventFilter on frame traces: one event per contact, no resend within the
+// interval, the token bucket holds over any second and deferred events fire later.
+
+#define FRAME_MS	16
+
+class CTrace
+{
+public:
+	CTrace(int iCapacity) : filter(iCapacity) {}
+
+	// one frame touching the given pickups, returns the events sent
+	int Frame(std::initializer_list<int> contacts) {
+		filter.BeginFrame(dwNow);
+		int iSent = 0;
+		for (int iPickup : contacts) iSent += filter.OnContact(iPickup);
+		dwNow += FRAME_MS;
+		return iSent;
+	}
+	void Idle(int iFrames) {
+		for (int i = 0; i < iFrames; i++) Frame({});
+	}
+
+	CPickupEventFilter filter;
+	uint32_t dwNow = 1000;
+};
+
+static void TestScenario()
+{
+	CTrace trace(16);
+
+	// standing on it fires once
+	CHECK_EQ(trace.Frame({ 1 }), 1);
+	CHECK_EQ(trace.Frame({ 1 }), 0);
+	CHECK_EQ(trace.Frame({ 1 }), 0);
+
+	// stepping off and back on within the interval
+	CHECK_EQ(trace.Frame({}), 0);
+	CHECK_EQ(trace.Frame({ 1 }), 0);
+	CHECK_EQ(trace.filter.GetSuppressedCount(), 1);
+
+	// and after it
+	trace.Idle(PICKUP_RESEND_INTERVAL / FRAME_MS + 1);
+	CHECK_EQ(trace.Frame({ 1 }), 1);
+
+	// eight at once: the burst goes now, the rest while the contact lasts
+	trace.Idle(60);
+	int iSent = trace.Frame({ 2, 3, 4, 5, 6, 7, 8, 9 });
+	CHECK_EQ(iSent, PICKUP_RATE_BURST);
+	for (int i = 0; i < 60; i++) iSent += trace.Frame({ 2, 3, 4, 5, 6, 7, 8, 9 });
+	CHECK_EQ(iSent, 8);
+	CHECK(trace.filter.GetDeferredCount() > 0);
+
+	// a destroyed slot starts over
+	trace.filter.Forget(2);
+	CHECK_EQ(trace.Frame({ 2 }), 1);
+
+	// out of range ids are ignored
+	CHECK_EQ(trace.Frame({ -1, 16, 1000 }), 0);
+
+	trace.filter.Clear();
+	CHECK_EQ(trace.filter.GetSentCount(), 0);
+	CHECK_EQ(trace.Frame({ 3 }), 1);
+}
+
+static void TestRandomTrace()
+{
+	const int iPickups = 64;
+	CTrace trace(iPickups);
+	std::mt19937 rng(7);
+
+	std::vector<bool> touching(iPickups, false);
+	std::vector<uint32_t> lastEvent(iPickups, 0);
+	std::vector<bool> hasEvent(iPickups, false);
+	std::deque<uint32_t> events;
+
+	for (int frame = 0; frame < 100000; frame++)
+	{
+		// contacts start and end at random, a few at a time
+		for (int i = 0; i < 3; i++) {
+			int iPickup = rng() % iPickups;
+			touching[iPickup] = !touching[iPickup];
+		}
+		if (rng() % 500 == 0) {
+			int iPickup = rng() % iPickups;
+			trace.filter.Forget(iPickup);
+			hasEvent[iPickup] = false;
+		}
+
+		uint32_t dwNow = trace.dwNow;
+		trace.filter.BeginFrame(dwNow);
+		for (int iPickup = 0; iPickup < iPickups; iPickup++)
+		{
+			if (!touching[iPickup] || !trace.filter.OnContact(iPickup)) continue;
+
+			CHECK(!hasEvent[iPickup] || dwNow - lastEvent[iPickup] >= PICKUP_RESEND_INTERVAL);
+			hasEvent[iPickup] = true;
+			lastEvent[iPickup] = dwNow;
+			events.push_back(dwNow);
+		}
+		trace.dwNow += FRAME_MS;
+
+		// any second holds the burst plus a second's worth
+		while (!events.empty() && dwNow - events.front() >= 1000) events.pop_front();
+		CHECK((int)events.size() <= PICKUP_RATE_BURST + PICKUP_RATE_PER_SECOND);
+	}
+
+	CHECK(trace.filter.GetSentCount() > 0);
+	CHECK(trace.filter.GetSuppressedCount() > 0);
+	CHECK(trace.filter.GetDeferredCount() > 0);
+	printf("trace: %d sent, %d suppressed, %d deferred\n", trace.filter.GetSentCount(),
+		trace.filter.GetSuppressedCount(), trace.filter.GetDeferredCount());
+}
+
+int main()
+{
+	TestScenario();
+	TestRandomTrace();
+
+	return HostTestResult("test_pickupevents");
+}
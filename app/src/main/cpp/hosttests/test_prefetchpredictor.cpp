@@ -0,0 +1,270 @@
+#include "main.h"
+#include "net/netgame.h"
+#include "hosttest.h"
+
+#include <functional>
+#include <random>
+#include <vector>
+
+// CStreamingPredictor and CPrefetchQueue driven by position traces sampled the way the local
+// player's sync is: straight and curved drives with GPS-like noise, walking, stopping and a
+// teleport, the predicted points checked against where the trace actually goes; then a drive
+// down a street of models, checking the queue hands them out before the player gets there.
+
+#define SAMPLE_MS	50
+
+typedef std::function<CVector(float fTime)> Path;
+
+struct TRACE_SAMPLE
+{
+	uint32_t	dwTime;
+	CVector		vecPos;
+};
+
+// the path sampled every SAMPLE_MS for fSeconds, with uniform noise of fNoise units
+static std::vector<TRACE_SAMPLE> Record(const Path& path, float fSeconds, float fNoise, uint32_t dwSeed)
+{
+	std::mt19937 rng(dwSeed);
+	std::uniform_real_distribution<float> noise(-fNoise, fNoise);
+
+	std::vector<TRACE_SAMPLE> trace;
+	for (uint32_t dwTime = 0; dwTime <= (uint32_t)(fSeconds * 1000.0f); dwTime += SAMPLE_MS)
+	{
+		CVector vecPos = path(dwTime / 1000.0f);
+		vecPos.x += noise(rng);
+		vecPos.y += noise(rng);
+		trace.push_back({ 1000 + dwTime, vecPos });
+	}
+	return trace;
+}
+
+static float Distance2D(const CVector& a, const CVector& b)
+{
+	return sqrtf((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+// worst distance between each predicted point and the true position that far ahead, over
+// every sample past the warm-up
+static float WorstError(const Path& path, float fSeconds, float fNoise, float fHorizonMax = 3.0f)
+{
+	std::vector<TRACE_SAMPLE> trace = Record(path, fSeconds, fNoise, 1);
+	CStreamingPredictor predictor;
+	float fWorst = 0.0f;
+
+	for (const TRACE_SAMPLE& sample : trace)
+	{
+		predictor.AddSample(sample.dwTime, sample.vecPos);
+		float fNow = (sample.dwTime - 1000) / 1000.0f;
+		if (fNow < 2.0f) continue;
+
+		PREFETCH_POINT points[PREFETCH_MAX_POINTS];
+		int iCount = predictor.Predict(sample.dwTime, points, PREFETCH_MAX_POINTS);
+		CHECK_EQ(iCount, 4);
+		for (int i = 0; i < iCount; i++)
+		{
+			if (points[i].fTime > fHorizonMax) continue;
+			fWorst = std::max(fWorst, Distance2D(points[i].vecPos, path(fNow + points[i].fTime)));
+		}
+	}
+	return fWorst;
+}
+
+static void TestPaths()
+{
+	// a straight drive at about 30 units/s lands on the road; a few centimetres of noise on the
+	// samples cost some units 90 ahead, well inside the prefetch radius
+	Path straight = [](float t) { return CVector(100.0f + 30.0f * t, 200.0f + 10.0f * t, 10.0f); };
+	CHECK(WorstError(straight, 8.0f, 0.0f) < 1.0f);
+	CHECK(WorstError(straight, 8.0f, 0.05f) < PREFETCH_RADIUS * 0.1f);
+
+	// a long bend: the turn rate keeps the points on the arc, a straight guess misses by far more
+	const float fRadius = 80.0f, fSpeed = 25.0f;
+	Path bend = [=](float t) { float a = fSpeed / fRadius * t; return CVector(fRadius * sinf(a), fRadius * (1.0f - cosf(a)), 5.0f); };
+	float fBend = WorstError(bend, 10.0f, 0.0f);
+	CHECK(fBend < fSpeed * 3.0f * 0.1f);
+	CHECK(WorstError(bend, 10.0f, 0.05f) < PREFETCH_RADIUS * 0.1f);
+
+	// what a straight line would have said 3 s into the bend
+	float fChord = Distance2D(bend(5.0f) + CVector(fSpeed * 3.0f * cosf(fSpeed / fRadius * 5.0f), fSpeed * 3.0f * sinf(fSpeed / fRadius * 5.0f), 0.0f), bend(8.0f));
+	CHECK(fBend * 3.0f < fChord);
+
+	// the points are ordered by time and climb with the road
+	Path ramp = [](float t) { return CVector(20.0f * t, 0.0f, 2.0f * t); };
+	std::vector<TRACE_SAMPLE> trace = Record(ramp, 3.0f, 0.0f, 1);
+	CStreamingPredictor predictor;
+	for (const TRACE_SAMPLE& sample : trace) predictor.AddSample(sample.dwTime, sample.vecPos);
+	PREFETCH_POINT points[PREFETCH_MAX_POINTS];
+	int iCount = predictor.Predict(trace.back().dwTime, points, PREFETCH_MAX_POINTS);
+	CHECK_EQ(iCount, 4);
+	for (int i = 1; i < iCount; i++) CHECK(points[i].fTime > points[i - 1].fTime);
+	CHECK(fabsf(points[3].vecPos.z - ramp(6.0f).z) < 0.5f);
+	CHECK(fabsf(predictor.GetTurnRate()) < 0.01f);
+
+	// fewer points when the caller has less room
+	CHECK_EQ(predictor.Predict(trace.back().dwTime, points, 2), 2);
+}
+
+static void TestSlow()
+{
+	CStreamingPredictor predictor;
+	PREFETCH_POINT points[PREFETCH_MAX_POINTS];
+
+	// walking is below the speed worth predicting
+	Path walk = [](float t) { return CVector(1.5f * t, 0.0f, 0.0f); };
+	for (const TRACE_SAMPLE& sample : Record(walk, 4.0f, 0.0f, 1)) predictor.AddSample(sample.dwTime, sample.vecPos);
+	CHECK_EQ(predictor.Predict(5000, points, PREFETCH_MAX_POINTS), 0);
+
+	// a car that stops: the points go away within a second or so
+	predictor.Reset();
+	Path stop = [](float t) { return CVector(30.0f * std::min(t, 3.0f), 0.0f, 0.0f); };
+	std::vector<TRACE_SAMPLE> trace = Record(stop, 6.0f, 0.0f, 1);
+	uint32_t dwStopped = 0;
+	for (const TRACE_SAMPLE& sample : trace)
+	{
+		predictor.AddSample(sample.dwTime, sample.vecPos);
+		if (!dwStopped && sample.dwTime > 1000 + 3000 && predictor.Predict(sample.dwTime, points, PREFETCH_MAX_POINTS) == 0)
+			dwStopped = sample.dwTime;
+	}
+	CHECK(dwStopped != 0);
+	CHECK(dwStopped - 4000 <= 1500);
+
+	// samples with no time between them change nothing
+	predictor.Reset();
+	predictor.AddSample(1000, CVector(0.0f, 0.0f, 0.0f));
+	predictor.AddSample(1000, CVector(5.0f, 0.0f, 0.0f));
+	CHECK(predictor.GetSpeed2D() == 0.0f);
+}
+
+static void TestTeleport()
+{
+	CStreamingPredictor predictor;
+	PREFETCH_POINT points[PREFETCH_MAX_POINTS];
+
+	Path drive = [](float t) { return CVector(30.0f * t, 0.0f, 0.0f); };
+	std::vector<TRACE_SAMPLE> trace = Record(drive, 3.0f, 0.0f, 1);
+	for (const TRACE_SAMPLE& sample : trace) predictor.AddSample(sample.dwTime, sample.vecPos);
+	uint32_t dwNow = trace.back().dwTime;
+
+	// the server's target comes first, reached right away
+	CVector vecTarget(2000.0f, -1500.0f, 20.0f);
+	predictor.AddTeleport(dwNow, vecTarget);
+	CHECK_EQ(predictor.Predict(dwNow, points, PREFETCH_MAX_POINTS), 5);
+	CHECK(points[0].fTime == 0.0f);
+	CHECK(Distance2D(points[0].vecPos, vecTarget) == 0.0f);
+	CHECK_EQ(predictor.Predict(dwNow, points, 1), 1);
+
+	// held for a while if the player isn't moved, then dropped
+	CHECK_EQ(predictor.Predict(dwNow + PREFETCH_TELEPORT_HOLD - 1, points, PREFETCH_MAX_POINTS), 5);
+	CHECK_EQ(predictor.Predict(dwNow + PREFETCH_TELEPORT_HOLD, points, PREFETCH_MAX_POINTS), 4);
+
+	// arriving there: the target is dropped and the old motion forgotten
+	predictor.AddTeleport(dwNow, vecTarget);
+	predictor.AddSample(dwNow + SAMPLE_MS, vecTarget + CVector(3.0f, 0.0f, 0.0f));
+	CHECK_EQ(predictor.Predict(dwNow + SAMPLE_MS, points, PREFETCH_MAX_POINTS), 0);
+	CHECK(predictor.GetSpeed2D() == 0.0f);
+
+	// a jump the server didn't announce resets the motion the same way
+	predictor.Reset();
+	for (const TRACE_SAMPLE& sample : trace) predictor.AddSample(sample.dwTime, sample.vecPos);
+	predictor.AddSample(dwNow + SAMPLE_MS, trace.back().vecPos + CVector(0.0f, PREFETCH_TELEPORT_DIST + 1.0f, 0.0f));
+	CHECK_EQ(predictor.Predict(dwNow + SAMPLE_MS, points, PREFETCH_MAX_POINTS), 0);
+}
+
+static void TestQueue()
+{
+	CPrefetchQueue queue;
+	PREFETCH_POINT points[2] = { { CVector(0.0f, 0.0f, 0.0f), 0.0f }, { CVector(100.0f, 0.0f, 0.0f), 2.0f } };
+	queue.Begin(points, 2, 50.0f);
+
+	// eta is the point's time plus the way from it at the player's speed
+	CHECK(fabsf(queue.GetEta(CVector(10.0f, 0.0f, 0.0f)) - 0.2f) < 1e-4f);
+	CHECK(fabsf(queue.GetEta(CVector(150.0f, 0.0f, 0.0f)) - 3.0f) < 1e-4f);
+	CHECK(queue.GetEta(CVector(0.0f, 500.0f, 0.0f)) < 0.0f);
+
+	// per model the nearest placement counts, models off every point aren't queued
+	queue.Consider(1, CVector(150.0f, 0.0f, 0.0f));
+	queue.Consider(2, CVector(20.0f, 0.0f, 0.0f));
+	queue.Consider(3, CVector(90.0f, 0.0f, 0.0f));
+	queue.Consider(1, CVector(5.0f, 0.0f, 0.0f));
+	queue.Consider(4, CVector(0.0f, 500.0f, 0.0f));
+	CHECK_EQ(queue.GetCount(), 3);
+
+	int models[4];
+	CHECK_EQ(queue.Pop(models, 2), 2);
+	CHECK_EQ(models[0], 1);
+	CHECK_EQ(models[1], 2);
+	CHECK_EQ(queue.GetCount(), 1);
+	CHECK_EQ(queue.Pop(models, 4), 1);
+	CHECK_EQ(models[0], 3);
+	CHECK_EQ(queue.Pop(models, 4), 0);
+
+	// slow players are timed at walking speed, a new scan drops the old candidates
+	queue.Begin(points, 1, 0.0f);
+	CHECK(fabsf(queue.GetEta(CVector(PREFETCH_WALK_SPEED, 0.0f, 0.0f)) - 1.0f) < 1e-4f);
+	queue.Consider(1, CVector(1.0f, 0.0f, 0.0f));
+	queue.Begin(points, 1, 0.0f);
+	CHECK_EQ(queue.GetCount(), 0);
+	queue.Consider(1, CVector(1.0f, 0.0f, 0.0f));
+	queue.Clear();
+	CHECK_EQ(queue.GetCount(), 0);
+	CHECK(queue.GetEta(CVector(0.0f, 0.0f, 0.0f)) < 0.0f);
+}
+
+// a drive down a street lined with a different model every 25 units, a scan twice a second
+// popping a few models like CPrefetchService does: every model near the road is handed out
+// before the player reaches it
+static void TestStreet()
+{
+	const int iModels = 120;
+	std::vector<CVector> placements;
+	for (int i = 0; i < iModels; i++)
+		placements.push_back(CVector(25.0f * i, (i % 2) ? 15.0f : -15.0f, 0.0f));
+
+	Path drive = [](float t) { return CVector(35.0f * t, 0.0f, 0.0f); };
+	std::vector<TRACE_SAMPLE> trace = Record(drive, 80.0f, 0.3f, 2);
+
+	CStreamingPredictor predictor;
+	CPrefetchQueue queue;
+	std::vector<uint32_t> popped(iModels, 0);
+	std::vector<uint32_t> reached(iModels, 0);
+
+	for (const TRACE_SAMPLE& sample : trace)
+	{
+		predictor.AddSample(sample.dwTime, sample.vecPos);
+
+		for (int i = 0; i < iModels; i++)
+			if (!reached[i] && Distance2D(sample.vecPos, placements[i]) < 30.0f) reached[i] = sample.dwTime;
+
+		if (sample.dwTime % 500) continue;
+
+		PREFETCH_POINT points[PREFETCH_MAX_POINTS];
+		int iCount = predictor.Predict(sample.dwTime, points, PREFETCH_MAX_POINTS);
+		queue.Begin(points, iCount, predictor.GetSpeed2D());
+		for (int i = 0; i < iModels; i++) if (!popped[i]) queue.Consider(400 + i, placements[i]);
+
+		int models[8];
+		int iPopped = queue.Pop(models, 8);
+		for (int i = 0; i < iPopped; i++) popped[models[i] - 400] = sample.dwTime;
+	}
+
+	// past the start, where there was no motion to go by yet
+	int iEarly = 0, iChecked = 0;
+	for (int i = 4; i < iModels; i++)
+	{
+		if (!reached[i]) continue;
+		iChecked++;
+		if (popped[i] && popped[i] + 1000 <= reached[i]) iEarly++;
+	}
+	CHECK(iChecked > 90);
+	CHECK_EQ(iEarly, iChecked);
+}
+
+int main()
+{
+	TestPaths();
+	TestSlow();
+	TestTeleport();
+	TestQueue();
+	TestStreet();
+	return HostTestResult("test_prefetchpredictor");
+}
@@ -0,0 +1,362 @@
+#include "profiler.h"
+#include "hosttest.h"
+
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+// The profiler rings and the Chrome trace export, built with PROFILER_ENABLED: a ring keeps
+// the newest events once it wraps, a reader racing the producer never returns an event that
+// was overwritten while it copied, a thread of the same name takes over a ring an exited
+// thread left, the frame stats fold the events in, and the dump parses as JSON.
+
+static const char* g_szNames[] = { "alpha", "beta", "gamma", "delta" };
+
+// an event whose fields all follow from its sequence number, so a torn copy shows
+static void PushEvent(CProfileRing& ring, uint32_t dwSeq)
+{
+	ring.Push(g_szNames[dwSeq % 4], dwSeq, dwSeq + (dwSeq * 2654435761u >> 8));
+}
+
+static bool IsEvent(const PROFILE_EVENT& event, uint64_t qwSeq)
+{
+	uint32_t dwSeq = (uint32_t)qwSeq;
+	return event.qwStart == qwSeq && event.szName == g_szNames[dwSeq % 4] && event.dwDuration == (dwSeq * 2654435761u >> 8);
+}
+
+static void TestWrap()
+{
+	auto pRing = std::make_unique<CProfileRing>("wrap");
+	std::vector<PROFILE_EVENT> events;
+
+	for (uint32_t i = 0; i < 100; i++) PushEvent(*pRing, i);
+	CHECK_EQ(pRing->Read(0, events), 100u);
+	CHECK_EQ(events.size(), 100u);
+	CHECK(IsEvent(events[0], 0) && IsEvent(events[99], 99));
+
+	// past the end the oldest events are gone, the rest are in order
+	for (uint32_t i = 100; i < PROFILE_RING_SIZE + 500; i++) PushEvent(*pRing, i);
+	events.clear();
+	uint32_t dwHead = pRing->Read(0, events);
+	CHECK_EQ(dwHead, PROFILE_RING_SIZE + 500u);
+	CHECK_EQ(events.size(), PROFILE_RING_SIZE - 1u);
+	bool bInOrder = true;
+	for (size_t i = 0; i < events.size(); i++) bInOrder &= IsEvent(events[i], dwHead - events.size() + i);
+	CHECK(bInOrder);
+
+	// reading on from where the last read stopped
+	for (uint32_t i = dwHead; i < dwHead + 10; i++) PushEvent(*pRing, i);
+	events.clear();
+	CHECK_EQ(pRing->Read(dwHead, events), dwHead + 10);
+	CHECK_EQ(events.size(), 10u);
+	CHECK(IsEvent(events[0], dwHead));
+
+	// a reader that fell more than a ring behind gets what's left
+	for (uint32_t i = dwHead + 10; i < dwHead + 3 * PROFILE_RING_SIZE; i++) PushEvent(*pRing, i);
+	events.clear();
+	pRing->Read(dwHead, events);
+	CHECK_EQ(events.size(), PROFILE_RING_SIZE - 1u);
+	CHECK(IsEvent(events.back(), dwHead + 3 * PROFILE_RING_SIZE - 1));
+}
+
+// the producer wraps the ring many times over while the reader copies
+static void TestRacingReader()
+{
+	auto pRing = std::make_unique<CProfileRing>("race");
+	std::atomic<bool> bStop{false};
+
+	std::thread producer([&]() {
+		for (uint32_t i = 0; !bStop.load(std::memory_order_relaxed); i++) PushEvent(*pRing, i);
+	});
+
+	int iTorn = 0, iGaps = 0, iReads = 0;
+	size_t total = 0;
+	uint32_t dwFrom = 0;
+	std::vector<PROFILE_EVENT> events;
+	auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+	while (std::chrono::steady_clock::now() < end || iReads < 100)
+	{
+		events.clear();
+		uint32_t dwHead = pRing->Read(dwFrom, events);
+		iReads++;
+		total += events.size();
+
+		// whatever survived is intact, contiguous and ends right before the head
+		for (size_t i = 0; i < events.size(); i++)
+		{
+			if (!IsEvent(events[i], events[0].qwStart + i)) iTorn++;
+		}
+		if (!events.empty() && events.back().qwStart != dwHead - 1u) iGaps++;
+		dwFrom = dwHead;
+	}
+	bStop = true;
+	producer.join();
+
+	CHECK_EQ(iTorn, 0);
+	CHECK_EQ(iGaps, 0);
+	CHECK(total > 0);
+}
+
+static CProfileRing* RingOfThread(const char* szName)
+{
+	CProfileRing* pRing = nullptr;
+	std::thread thread([&]() {
+		if (szName) PROFILE_THREAD(szName);
+		PROFILE_SCOPE("work");
+		pRing = CProfiler::GetThreadRing();
+	});
+	thread.join();
+	return pRing;
+}
+
+static void TestThreadRings()
+{
+	PROFILE_THREAD("main");
+	CProfileRing* pMain = CProfiler::GetThreadRing();
+	CHECK(pMain != nullptr);
+	CHECK(!strcmp(pMain->GetThreadName(), "main"));
+
+	// a connection's threads come and go: the next one of the same name takes the ring over
+	int iRings = CProfiler::GetRingCount();
+	CProfileRing* pFirst = RingOfThread("raknet");
+	CHECK_EQ(CProfiler::GetRingCount(), iRings + 1);
+	CHECK(pFirst->GetHead() >= 1);
+	uint32_t dwHead = pFirst->GetHead();
+
+	CProfileRing* pSecond = RingOfThread("raknet");
+	CHECK(pSecond == pFirst);
+	CHECK_EQ(CProfiler::GetRingCount(), iRings + 1);
+	CHECK(pSecond->GetHead() > dwHead);
+
+	// another name or no name gets its own
+	CHECK(RingOfThread("voice") != pFirst);
+	CProfileRing* pUnnamed = RingOfThread(nullptr);
+	CHECK(!strcmp(pUnnamed->GetThreadName(), "thread"));
+	CHECK(RingOfThread(nullptr) == pUnnamed);
+	CHECK_EQ(CProfiler::GetRingCount(), iRings + 3);
+
+	// two live threads of one name don't share
+	std::atomic<int> iReady{0};
+	std::atomic<bool> bGo{false};
+	CProfileRing* pLive[2] = {};
+	std::thread threads[2];
+	for (int t = 0; t < 2; t++)
+	{
+		threads[t] = std::thread([&, t]() {
+			PROFILE_THREAD("pool");
+			pLive[t] = CProfiler::GetThreadRing();
+			iReady++;
+			while (!bGo) std::this_thread::yield();
+		});
+	}
+	while (iReady < 2) std::this_thread::yield();
+	bGo = true;
+	for (auto& thread : threads) thread.join();
+	CHECK(pLive[0] != pLive[1]);
+
+	// rings run out at PROFILE_MAX_THREADS, recording then does nothing
+	std::vector<std::string> names;
+	for (int i = 0; i < PROFILE_MAX_THREADS; i++) names.push_back("extra" + std::to_string(i));
+	int iMissing = 0;
+	for (auto& name : names) iMissing += RingOfThread(name.c_str()) == nullptr;
+	CHECK_EQ(CProfiler::GetRingCount(), PROFILE_MAX_THREADS);
+	CHECK(iMissing > 0);
+}
+
+static void TestStats()
+{
+	CProfileRing* pMain = CProfiler::GetThreadRing();
+	CProfiler::EndFrame();
+
+	// two calls of 1.5 ms and one of 0.25 ms in the frame
+	uint64_t qwNow = CProfiler::Now();
+	CProfiler::Record("update", qwNow, qwNow + 1500000);
+	CProfiler::Record("update", qwNow, qwNow + 1500000);
+	CProfiler::Record("render", qwNow, qwNow + 250000);
+	CProfiler::EndFrame();
+
+	PROFILE_STAT stats[PROFILE_MAX_SCOPES + 1];
+	int iCount = CProfiler::GetStats(stats, PROFILE_MAX_SCOPES + 1);
+	CHECK(iCount >= 3);
+	CHECK(!strcmp(stats[0].szName, "Frame"));
+
+	const PROFILE_STAT* pUpdate = nullptr;
+	const PROFILE_STAT* pRender = nullptr;
+	for (int i = 1; i < iCount; i++)
+	{
+		if (strcmp(stats[i].szThread, pMain->GetThreadName())) continue;
+		if (!strcmp(stats[i].szName, "update")) pUpdate = &stats[i];
+		if (!strcmp(stats[i].szName, "render")) pRender = &stats[i];
+	}
+	CHECK(pUpdate && pRender);
+	if (pUpdate && pRender)
+	{
+		CHECK(fabsf(pUpdate->fLastMs - 3.0f) < 1e-3f);
+		CHECK_EQ(pUpdate->iCalls, 2);
+		CHECK(fabsf(pUpdate->fMaxMs - 3.0f) < 1e-3f);
+		CHECK(fabsf(pRender->fLastMs - 0.25f) < 1e-3f);
+		CHECK(pUpdate < pRender);
+	}
+
+	// a quiet frame: nothing last frame, still in the average
+	CProfiler::EndFrame();
+	iCount = CProfiler::GetStats(stats, PROFILE_MAX_SCOPES + 1);
+	for (int i = 1; i < iCount; i++)
+	{
+		if (strcmp(stats[i].szName, "update") || strcmp(stats[i].szThread, "main")) continue;
+		CHECK(stats[i].fLastMs == 0.0f);
+		CHECK_EQ(stats[i].iCalls, 0);
+		CHECK(stats[i].fAvgMs > 0.0f);
+	}
+	CHECK_EQ(CProfiler::GetStats(stats, 1), 1);
+}
+
+// just enough of a JSON parser to tell a valid document from an invalid one
+class CJsonChecker
+{
+public:
+	CJsonChecker(const std::string& text) : m_Text(text), m_iPos(0) {}
+
+	bool Valid()
+	{
+		bool bValid = Value();
+		Space();
+		return bValid && m_iPos == m_Text.size();
+	}
+
+	int iObjects = 0;
+	int iCompleteEvents = 0;
+
+private:
+	void Space() { while (m_iPos < m_Text.size() && strchr(" \t\r\n", m_Text[m_iPos])) m_iPos++; }
+	bool Eat(char c) { Space(); if (m_iPos < m_Text.size() && m_Text[m_iPos] == c) { m_iPos++; return true; } return false; }
+
+	bool String(std::string* pOut = nullptr)
+	{
+		if (!Eat('"')) return false;
+		while (m_iPos < m_Text.size())
+		{
+			unsigned char c = m_Text[m_iPos++];
+			if (c == '"') return true;
+			if (c < 0x20) return false;
+			if (c == '\\')
+			{
+				if (m_iPos >= m_Text.size()) return false;
+				char e = m_Text[m_iPos++];
+				if (e == 'u') {
+					for (int i = 0; i < 4; i++) if (m_iPos >= m_Text.size() || !isxdigit(m_Text[m_iPos++])) return false;
+					c = '?';
+				}
+				else if (!strchr("\"\\/bfnrt", e)) return false;
+				else c = e;
+			}
+			if (pOut) *pOut += (char)c;
+		}
+		return false;
+	}
+
+	bool Number()
+	{
+		Space();
+		size_t start = m_iPos;
+		if (m_iPos < m_Text.size() && m_Text[m_iPos] == '-') m_iPos++;
+		while (m_iPos < m_Text.size() && (isdigit(m_Text[m_iPos]) || strchr(".eE+-", m_Text[m_iPos]))) m_iPos++;
+		return m_iPos > start && isdigit(m_Text[m_iPos - 1]);
+	}
+
+	bool Value()
+	{
+		Space();
+		if (m_iPos >= m_Text.size()) return false;
+		char c = m_Text[m_iPos];
+		if (c == '{') return Object();
+		if (c == '[')
+		{
+			m_iPos++;
+			if (Eat(']')) return true;
+			do { if (!Value()) return false; } while (Eat(','));
+			return Eat(']');
+		}
+		if (c == '"') return String();
+		for (const char* szWord : { "true", "false", "null" })
+		{
+			if (!m_Text.compare(m_iPos, strlen(szWord), szWord)) { m_iPos += strlen(szWord); return true; }
+		}
+		return Number();
+	}
+
+	bool Object()
+	{
+		m_iPos++;
+		iObjects++;
+		if (Eat('}')) return true;
+		do
+		{
+			std::string key, value;
+			if (!String(&key) || !Eat(':')) return false;
+			Space();
+			if (key == "ph" && m_iPos < m_Text.size() && m_Text[m_iPos] == '"') {
+				if (!String(&value)) return false;
+				iCompleteEvents += value == "X";
+			}
+			else if (!Value()) return false;
+		} while (Eat(','));
+		return Eat('}');
+	}
+
+	const std::string&	m_Text;
+	size_t				m_iPos;
+};
+
+static void TestChromeTrace()
+{
+	// names with characters JSON has to escape
+	uint64_t qwNow = CProfiler::Now();
+	CProfiler::Record("quote\" back\\slash\ttab", qwNow, qwNow + 1000);
+
+	char* pBuffer = nullptr;
+	size_t size = 0;
+	FILE* pFile = open_memstream(&pBuffer, &size);
+	CHECK(CProfiler::ExportChromeTrace(pFile));
+	fclose(pFile);
+	std::string trace(pBuffer, size);
+	free(pBuffer);
+
+	CJsonChecker json(trace);
+	CHECK(json.Valid());
+
+	// one complete event per event still in the rings
+	int iEvents = 0;
+	for (int i = 0; i < CProfiler::GetRingCount(); i++)
+	{
+		std::vector<PROFILE_EVENT> events;
+		CProfiler::GetRing(i)->Read(0, events);
+		iEvents += (int)events.size();
+	}
+	CHECK_EQ(json.iCompleteEvents, iEvents);
+	CHECK(trace.find("\"thread_name\"") != std::string::npos);
+	CHECK(trace.find("quote\\\" back\\\\slash\\u0009tab") != std::string::npos);
+	CHECK(trace.find("\"raknet\"") != std::string::npos);
+
+	// the checker itself turns down what it should
+	std::string broken = trace.substr(0, trace.size() / 2);
+	CHECK(!CJsonChecker(broken).Valid());
+	std::string unescaped = "{\"a\":\"x\ty\"}";
+	CHECK(!CJsonChecker(unescaped).Valid());
+
+	CHECK(!CProfiler::ExportChromeTrace("/nonexistent/dir/trace.json"));
+}
+
+int main()
+{
+	TestWrap();
+	TestRacingReader();
+	TestThreadRings();
+	TestStats();
+	TestChromeTrace();
+	return HostTestResult("test_profiler");
+}
@@ -0,0 +1,206 @@
+#include "main.h"
+#include "game/scripting.h"
+#include "hosttest.h"
+
+// CScriptCommand<> against EncodeScriptCommand(): same bytes and the same local variables
+// for every parameter type, batches are the commands back to back, a command that
+// doesn't fit leaves the buffer alone. ExecuteScriptBuffer() runs on a small stand-in for
+// the game's interpreter, reached through g_libGTASA like the real one.
+
+char* g_pszStorage = nullptr;
+uintptr_t g_libGTASA = 0;
+
+#define PROCESS_ONE_COMMAND_OFFSET	0x3F445C	// VER_x32 is false on the host
+
+static int Generic(SCRIPT_BUFFER* pBuffer, const SCRIPT_COMMAND* pCommand, ...)
+{
+	va_list ap;
+	va_start(ap, pCommand);
+	bool bEncoded = EncodeScriptCommand(pBuffer, pCommand, ap);
+	va_end(ap);
+	return bEncoded;
+}
+
+// the generic encoder takes every variable for an uintptr, CScriptCommand<> knows its size
+static bool SameBuffers(const SCRIPT_BUFFER& a, const SCRIPT_BUFFER& b)
+{
+	if (a.iPos != b.iPos || a.iVars != b.iVars) return false;
+	if (memcmp(a.pData, b.pData, a.iPos) != 0) return false;
+	for (int i = 0; i < a.iVars; i++)
+		if (a.pVars[i] != b.pVars[i]) return false;
+	return true;
+}
+
+#define CHECK_ENCODING(cmd, ...) \
+	do { \
+		uint8_t generic[0xFF] = { 0 }, precompiled[0xFF] = { 0 }; \
+		SCRIPT_BUFFER a, b; \
+		ScriptBufferInit(&a, generic, sizeof(generic)); \
+		ScriptBufferInit(&b, precompiled, sizeof(precompiled)); \
+		CHECK(Generic(&a, &cmd, ##__VA_ARGS__)); \
+		CHECK(CScriptCommand<cmd>::Encode(&b, ##__VA_ARGS__)); \
+		CHECK(SameBuffers(a, b)); \
+	} while (0)
+
+static void TestEncoding()
+{
+	int iActor = 5, iPlayer = 6;
+	uint32_t dwHandle = 7;
+	float fGround = 1.0f;
+	uintptr dwWide = 8;
+
+	CHECK_ENCODING(create_player, &iActor, 1.5f, 2.0f, 3.0f, &iPlayer);
+	CHECK_ENCODING(request_model, 411);
+	CHECK_ENCODING(set_camera_behind_player);
+	CHECK_ENCODING(apply_animation, 3, "abc", "PED", 4.1f, 1, 0, 0, 1, -1);
+	CHECK_ENCODING(task_pick_up_object, 1, 2, 1.0f, 2.0f, 3.0f, 4, 5, "LIB", "ANIMNAME", 6);
+	CHECK_ENCODING(attach_particle_to_actor2, "prt_x", 1, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 1, &dwHandle);
+	CHECK_ENCODING(get_ground_z, 1.0f, 2.0f, 3.0f, &fGround);
+	CHECK_ENCODING(get_ground_z, -1.0f, 0.0f, 1e30f, &dwWide);
+	CHECK_ENCODING(get_line_of_sight, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 1, 0, 0, 1, 0);
+	CHECK_ENCODING(is_char_playing_anim, 10, "walk");
+	CHECK_ENCODING(is_char_playing_anim, 10, "");
+	CHECK_ENCODING(create_racing_checkpoint, 1, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, &dwHandle);
+
+	uint8_t data[0xFF];
+	SCRIPT_BUFFER buffer;
+	ScriptBufferInit(&buffer, data, sizeof(data));
+	CHECK(CScriptCommand<create_player>::Encode(&buffer, &iActor, 1.0f, 2.0f, 3.0f, &dwWide));
+	CHECK_EQ(buffer.iVars, 2);
+	CHECK_EQ(buffer.byteVarSize[0], 4);
+	CHECK_EQ(buffer.byteVarSize[1], sizeof(uintptr));
+}
+
+static void TestBatch()
+{
+	float fGround = 0.0f;
+
+	CScriptBatch batch;
+	CHECK(batch.Add<request_model>(1));
+	CHECK(batch.Add<get_ground_z>(1.0f, 2.0f, 3.0f, &fGround));
+	CHECK(batch.Add<is_pickup_picked_up>(9));
+	CHECK_EQ(batch.GetCount(), 3);
+
+	uint8_t data[0xFF];
+	SCRIPT_BUFFER expected;
+	ScriptBufferInit(&expected, data, sizeof(data));
+	CHECK(Generic(&expected, &request_model, 1));
+	CHECK(Generic(&expected, &get_ground_z, 1.0, 2.0, 3.0, &fGround));
+	CHECK(Generic(&expected, &is_pickup_picked_up, 9));
+
+	CHECK_EQ(batch.GetSize(), expected.iPos);
+	CHECK(memcmp(batch.GetData(), data, expected.iPos) == 0);
+
+	// full: refused, nothing written
+	CScriptBatch full;
+	int iAdded = 0;
+	while (full.Add<request_model>(iAdded)) iAdded++;
+	CHECK_EQ(iAdded, SCRIPT_BATCH_MAX_COMMANDS);
+	CHECK_EQ(full.GetCount(), SCRIPT_BATCH_MAX_COMMANDS);
+	CHECK_EQ(full.GetSize(), SCRIPT_BATCH_MAX_COMMANDS * CScriptCommand<request_model>::Size);
+}
+
+static void TestOverflow()
+{
+	float fGround = 0.0f;
+	uint8_t small[8];
+	memset(small, 0xAB, sizeof(small));
+
+	SCRIPT_BUFFER a, b;
+	ScriptBufferInit(&a, small, sizeof(small));
+	ScriptBufferInit(&b, small, sizeof(small));
+	CHECK(!Generic(&a, &get_ground_z, 1.0, 2.0, 3.0, &fGround));
+	CHECK(!CScriptCommand<get_ground_z>::Encode(&b, 1.0f, 2.0f, 3.0f, &fGround));
+	CHECK_EQ(b.iPos, 0);
+	CHECK_EQ(b.iVars, 0);
+
+	// a string that doesn't fit, after a command that did
+	uint8_t data[16];
+	ScriptBufferInit(&b, data, sizeof(data));
+	CHECK(CScriptCommand<request_model>::Encode(&b, 1));
+	int iPos = b.iPos;
+	CHECK(!CScriptCommand<is_char_playing_anim>::Encode(&b, 1, "a string too long for the rest"));
+	CHECK_EQ(b.iPos, iPos);
+}
+
+// stand-in for CRunningScript::ProcessOneCommand, knows the commands TestExecute() uses
+static void FakeProcessOneCommand(GAME_SCRIPT_THREAD* pThread)
+{
+	uint8_t* p = (uint8_t*)pThread->dwScriptIP;
+	uint16_t wOpCode;
+	memcpy(&wOpCode, p, 2);
+	p += 2;
+
+	auto readInt = [&]() { int32_t i; CHECK_EQ(*p, SCRIPT_PARAM_INT); memcpy(&i, p + 1, 4); p += 5; return i; };
+	auto readFloat = [&]() { float f; CHECK_EQ(*p, SCRIPT_PARAM_FLOAT); memcpy(&f, p + 1, 4); p += 5; return f; };
+	auto readVar = [&]() { uint16_t v; CHECK_EQ(*p, SCRIPT_PARAM_LOCALVAR); memcpy(&v, p + 1, 2); p += 3; return v; };
+
+	if (wOpCode == request_model.OpCode) {
+		readInt();
+		pThread->condResult = true;
+	}
+	else if (wOpCode == get_ground_z.OpCode) {
+		float fSum = readFloat() + readFloat() + readFloat();
+		memcpy(&pThread->dwLocalVar[readVar()], &fSum, 4);
+		pThread->condResult = true;
+	}
+	else if (wOpCode == is_pickup_picked_up.OpCode) {
+		pThread->condResult = readInt() & 1;
+	}
+	else {
+		CHECK(!"unexpected opcode");
+		p = (uint8_t*)-1;
+	}
+
+	pThread->dwScriptIP = (uintptr)p;
+}
+
+void InitScripting();
+extern GAME_SCRIPT_THREAD* gst;
+
+static void TestExecute()
+{
+	g_libGTASA = (uintptr_t)&FakeProcessOneCommand - PROCESS_ONE_COMMAND_OFFSET;
+	InitScripting();
+
+	float fGround = 0.0f;
+	uintptr dwGround = 0;
+
+	CScriptBatch batch;
+	batch.Add<request_model>(1);
+	batch.Add<get_ground_z>(1.0f, 2.0f, 3.0f, &fGround);
+	batch.Add<is_pickup_picked_up>(9);
+	batch.Add<is_pickup_picked_up>(4);
+	CHECK_EQ(batch.Execute(), 0);
+
+	CHECK(fGround == 6.0f);
+	CHECK(batch.GetResult(0));
+	CHECK(batch.GetResult(1));
+	CHECK(batch.GetResult(2));
+	CHECK(!batch.GetResult(3));
+
+	// a single command through the precompiled path, into a pointer-sized variable
+	CHECK_EQ(ScriptCommand<is_pickup_picked_up>(3), 1);
+	CHECK_EQ(ScriptCommand<get_ground_z>(0.5f, 0.5f, 0.0f, &dwGround), 1);
+	float fWide;
+	uint32_t dwBits = (uint32_t)dwGround;
+	memcpy(&fWide, &dwBits, 4);
+	CHECK(fWide == 1.0f);
+
+	// and through the generic one
+	fGround = 0.0f;
+	CHECK_EQ(ScriptCommand(&get_ground_z, 2.0f, 2.0f, 2.0f, &fGround), 1);
+	CHECK(fGround == 6.0f);
+}
+
+int main()
+{
+	g_bHostLogcatQuiet = true;
+
+	TestEncoding();
+	TestBatch();
+	TestOverflow();
+	TestExecute();
+
+	return HostTestResult("test_scripting");
+}
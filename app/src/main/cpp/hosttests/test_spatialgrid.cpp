@@ -0,0 +1,136 @@
+#include "main.h"
+#include "net/spatialgrid.h"
+#include "hosttest.h"
+
+#include <algorithm>
+#include <random>
+
+#define SLOTS 512
+
+static std::vector<int> BruteForce(const std::vector<bool>& used, const std::vector<CVector>& pos,
+								   const std::vector<float>& radius, const CVector& vecCenter, float fRadius)
+{
+	std::vector<int> result;
+	for (int i = 0; i < (int)used.size(); i++)
+	{
+		if (!used[i]) continue;
+		CVector d = pos[i] - vecCenter;
+		float fLimit = fRadius + radius[i];
+		if (d.x * d.x + d.y * d.y + d.z * d.z <= fLimit * fLimit) result.push_back(i);
+	}
+	return result;
+}
+
+static void TestMatchesBruteForce()
+{
+	std::mt19937 rng(26);
+	std::uniform_real_distribution<float> coord(-3200.0f, 3200.0f);	// a bit past the map edge
+	std::uniform_real_distribution<float> radius(0.0f, 150.0f);
+	std::uniform_int_distribution<int> slot(0, SLOTS - 1);
+
+	CSpatialGrid grid(SLOTS);
+	std::vector<bool> used(SLOTS);
+	std::vector<CVector> pos(SLOTS);
+	std::vector<float> rad(SLOTS);
+
+	int result[SLOTS];
+	for (int step = 0; step < 20000; step++)
+	{
+		int i = slot(rng);
+		if (step % 5 == 0)
+		{
+			grid.Remove(i);
+			used[i] = false;
+			rad[i] = 0.0f;
+		}
+		else
+		{
+			pos[i] = CVector(coord(rng), coord(rng), coord(rng) * 0.01f);
+			rad[i] = step % 3 ? 0.0f : radius(rng);
+			grid.Update(i, pos[i], rad[i]);
+			used[i] = true;
+		}
+
+		CHECK_EQ(grid.GetCount(), (int)std::count(used.begin(), used.end(), true));
+		float fMax = 0.0f;
+		for (int j = 0; j < SLOTS; j++) if (used[j]) fMax = std::max(fMax, rad[j]);
+		CHECK(grid.GetMaxRadius() == fMax);
+
+		if (step % 50 == 0)
+		{
+			CVector vecCenter(coord(rng), coord(rng), 0.0f);
+			float fRadius = radius(rng) * 2.0f;
+			int iFound = grid.Query(vecCenter, fRadius, result, SLOTS);
+			std::sort(result, result + iFound);
+			std::vector<int> expected = BruteForce(used, pos, rad, vecCenter, fRadius);
+			CHECK(std::vector<int>(result, result + iFound) == expected);
+		}
+	}
+}
+
+static void TestMaxRadiusShrinks()
+{
+	CSpatialGrid grid(8);
+	grid.Update(0, CVector(0.0f, 0.0f, 0.0f), 300.0f);
+	grid.Update(1, CVector(10.0f, 0.0f, 0.0f), 300.0f);
+	grid.Update(2, CVector(20.0f, 0.0f, 0.0f), 40.0f);
+	CHECK(grid.GetMaxRadius() == 300.0f);
+
+	// one of two holders leaves, the other still counts
+	grid.Remove(0);
+	CHECK(grid.GetMaxRadius() == 300.0f);
+
+	// the last holder shrinks
+	grid.Update(1, CVector(10.0f, 0.0f, 0.0f), 10.0f);
+	CHECK(grid.GetMaxRadius() == 40.0f);
+
+	grid.Remove(2);
+	CHECK(grid.GetMaxRadius() == 10.0f);
+
+	// a removed slot comes back as a point
+	grid.Update(2, CVector(20.0f, 0.0f, 0.0f));
+	grid.Remove(1);
+	CHECK(grid.GetMaxRadius() == 0.0f);
+	CHECK_EQ(grid.GetCount(), 1);
+
+	grid.Clear();
+	CHECK_EQ(grid.GetCount(), 0);
+	CHECK(grid.GetMaxRadius() == 0.0f);
+}
+
+static void TestQueryLimit()
+{
+	CSpatialGrid grid(16);
+	for (int i = 0; i < 16; i++) grid.Update(i, CVector((float)i, 0.0f, 0.0f));
+
+	int result[4];
+	CHECK_EQ(grid.Query(CVector(0.0f, 0.0f, 0.0f), 100.0f, result, 4), 4);
+}
+
+static void TestViewCone()
+{
+	CVector vecCam(0.0f, 0.0f, 0.0f);
+	CVector vecForward(0.0f, 1.0f, 0.0f);
+
+	CHECK(CSpatialGrid::IsInViewCone(vecCam, vecForward, CVector(0.0f, 50.0f, 0.0f), 2.0f));
+	CHECK(!CSpatialGrid::IsInViewCone(vecCam, vecForward, CVector(0.0f, -50.0f, 0.0f), 2.0f));
+	CHECK(!CSpatialGrid::IsInViewCone(vecCam, vecForward, CVector(50.0f, 1.0f, 0.0f), 2.0f));
+	// right behind the camera but inside the margin
+	CHECK(CSpatialGrid::IsInViewCone(vecCam, vecForward, CVector(0.0f, -1.0f, 0.0f), 2.0f));
+
+	CSpatialGrid grid(4);
+	grid.Update(0, CVector(0.0f, 30.0f, 0.0f));
+	grid.Update(1, CVector(0.0f, -30.0f, 0.0f));
+	int result[4];
+	CHECK_EQ(grid.QueryVisible(vecCam, vecForward, 100.0f, result, 4), 1);
+	CHECK_EQ(result[0], 0);
+}
+
+int main()
+{
+	TestMatchesBruteForce();
+	TestMaxRadiusShrinks();
+	TestQueryLimit();
+	TestViewCone();
+	return HostTestResult("test_spatialgrid");
+}
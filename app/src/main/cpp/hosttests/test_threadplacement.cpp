@@ -0,0 +1,192 @@
+#include "threadplacement.h"
+#include "hosttest.h"
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+// CThreadPlacement against fake sysfs trees: big.LITTLE from cpu_capacity and from
+// cpuinfo_max_freq, holes in the possible list, missing and broken files, and the policy
+// and worker count that come out of each. Register() is run for real against one of them.
+
+static char g_szRoot[] = "/tmp/samp_threadplacement_XXXXXX";
+
+static void Put(const std::string& path, const std::string& text)
+{
+	std::string full = std::string(g_szRoot) + "/" + path;
+	std::filesystem::create_directories(std::filesystem::path(full).parent_path());
+	FILE* pFile = fopen(full.c_str(), "w");
+	CHECK(pFile != nullptr);
+	if (!pFile) return;
+	fputs(text.c_str(), pFile);
+	fclose(pFile);
+}
+
+static std::string Tree(const char* szName)
+{
+	return std::string(g_szRoot) + "/" + szName;
+}
+
+static void PutCpu(const char* szTree, int iCpu, const char* szFile, const char* szValue)
+{
+	Put(std::string(szTree) + "/devices/system/cpu/cpu" + std::to_string(iCpu) + "/" + szFile, szValue);
+}
+
+static void TestCapacity()
+{
+	// 4 little, 3 mid and a prime core, as on most current phones
+	Put("capacity/devices/system/cpu/possible", "0-7\n");
+	for (int i = 0; i < 8; i++) PutCpu("capacity", i, "cpu_capacity", i < 4 ? "325\n" : (i < 7 ? "870\n" : "1024\n"));
+
+	CPU_TOPOLOGY topology;
+	CHECK(CThreadPlacement::ReadTopology(Tree("capacity").c_str(), topology));
+	CHECK_EQ(topology.iCount, 8);
+	CHECK_EQ(topology.dwAllMask, 0xFFu);
+	CHECK_EQ(topology.dwBigMask, 0xF0u);
+	CHECK_EQ(topology.dwLittleMask, 0x0Fu);
+	CHECK_EQ(topology.iBigCount, 4);
+	CHECK_EQ(topology.iLittleCount, 4);
+	CHECK_EQ(topology.cpus[7].dwCapacity, 1024u);
+
+	uint32_t dwMask;
+	int iNice;
+	CThreadPlacement::GetPolicy(topology, THREAD_ROLE_GAME, dwMask, iNice);
+	CHECK_EQ(dwMask, 0xF0u);
+	CHECK_EQ(iNice, THREAD_NICE_URGENT);
+	CThreadPlacement::GetPolicy(topology, THREAD_ROLE_RENDER, dwMask, iNice);
+	CHECK_EQ(dwMask, 0xF0u);
+	CThreadPlacement::GetPolicy(topology, THREAD_ROLE_NETWORK, dwMask, iNice);
+	CHECK_EQ(dwMask, 0xFFu);
+	CHECK_EQ(iNice, THREAD_NICE_LATENCY);
+	CThreadPlacement::GetPolicy(topology, THREAD_ROLE_WORKER, dwMask, iNice);
+	CHECK_EQ(dwMask, 0xFFu);
+	CHECK_EQ(iNice, THREAD_NICE_DEFAULT);
+	CThreadPlacement::GetPolicy(topology, THREAD_ROLE_BACKGROUND, dwMask, iNice);
+	CHECK_EQ(dwMask, 0x0Fu);
+	CHECK_EQ(iNice, THREAD_NICE_BACKGROUND);
+
+	// game and render take two big cores
+	CHECK_EQ(CThreadPlacement::GetWorkerCount(topology), 6);
+}
+
+static void TestFrequency()
+{
+	// no cpu_capacity, only cpufreq, and a hole in the possible list
+	Put("freq/devices/system/cpu/possible", "0-1,4-5");
+	for (int i : { 0, 1 }) PutCpu("freq", i, "cpufreq/cpuinfo_max_freq", "1800000");
+	for (int i : { 4, 5 }) PutCpu("freq", i, "cpufreq/cpuinfo_max_freq", "2400000");
+
+	CPU_TOPOLOGY topology;
+	CHECK(CThreadPlacement::ReadTopology(Tree("freq").c_str(), topology));
+	CHECK_EQ(topology.iCount, 4);
+	CHECK_EQ(topology.cpus[2].iCpu, 4);
+	// within half of the fastest: all big, no little cluster to put the background on
+	CHECK_EQ(topology.dwBigMask, 0x33u);
+	CHECK_EQ(topology.dwLittleMask, 0u);
+
+	uint32_t dwMask;
+	int iNice;
+	CThreadPlacement::GetPolicy(topology, THREAD_ROLE_BACKGROUND, dwMask, iNice);
+	CHECK_EQ(dwMask, 0x33u);
+
+	for (int i : { 0, 1 }) PutCpu("freq", i, "cpufreq/cpuinfo_max_freq", "600000");
+	CHECK(CThreadPlacement::ReadTopology(Tree("freq").c_str(), topology));
+	CHECK_EQ(topology.dwBigMask, 0x30u);
+	CHECK_EQ(topology.dwLittleMask, 0x03u);
+	CHECK_EQ(CThreadPlacement::GetWorkerCount(topology), 2);
+
+	// cpu_capacity wins over the frequency where both are there
+	PutCpu("freq", 0, "cpu_capacity", "1024");
+	PutCpu("freq", 1, "cpu_capacity", "300");
+	PutCpu("freq", 4, "cpu_capacity", "1024");
+	PutCpu("freq", 5, "cpu_capacity", "1024");
+	CHECK(CThreadPlacement::ReadTopology(Tree("freq").c_str(), topology));
+	CHECK_EQ(topology.cpus[0].dwCapacity, 1024u);
+	CHECK_EQ(topology.dwLittleMask, 0x02u);
+}
+
+static void TestBrokenTrees()
+{
+	CPU_TOPOLOGY topology;
+
+	// no sysfs: the cores the system reports, all alike
+	CHECK(!CThreadPlacement::ReadTopology(Tree("none").c_str(), topology));
+	CHECK(topology.iCount >= 1);
+	CHECK_EQ(topology.dwLittleMask, 0u);
+	CHECK_EQ(topology.dwBigMask, topology.dwAllMask);
+	CHECK(CThreadPlacement::GetWorkerCount(topology) >= 1);
+
+	// one core and nothing about it
+	Put("single/devices/system/cpu/possible", "0");
+	CHECK(!CThreadPlacement::ReadTopology(Tree("single").c_str(), topology));
+	CHECK_EQ(topology.iCount, 1);
+	CHECK_EQ(CThreadPlacement::GetWorkerCount(topology), 1);
+
+	// a core that tells nothing or garbage counts as big
+	Put("partial/devices/system/cpu/possible", "0-3,6,8-9\n");
+	PutCpu("partial", 0, "cpu_capacity", "200");
+	PutCpu("partial", 1, "cpu_capacity", "1024");
+	PutCpu("partial", 2, "cpu_capacity", "fast");
+	CHECK(CThreadPlacement::ReadTopology(Tree("partial").c_str(), topology));
+	CHECK_EQ(topology.iCount, 7);
+	CHECK_EQ(topology.dwAllMask, 0x34Fu);
+	CHECK_EQ(topology.dwLittleMask, 0x01u);
+	CHECK_EQ(topology.dwBigMask, 0x34Eu);
+
+	// more cores than the masks hold
+	Put("many/devices/system/cpu/possible", "0-63");
+	CThreadPlacement::ReadTopology(Tree("many").c_str(), topology);
+	CHECK_EQ(topology.iCount, THREAD_MAX_CPUS);
+	CHECK_EQ(topology.dwAllMask, 0xFFFFFFFFu);
+
+	// an unreadable list falls back to the system's count
+	Put("garbage/devices/system/cpu/possible", "cpus\n");
+	CThreadPlacement::ReadTopology(Tree("garbage").c_str(), topology);
+	CHECK(topology.iCount >= 1);
+}
+
+// the kernel may refuse the masks of the fake tree, the decisions are kept anyway
+static void TestRegister()
+{
+	CThreadPlacement::Initialise(Tree("capacity").c_str());
+	CHECK_EQ(CThreadPlacement::GetTopology().dwBigMask, 0xF0u);
+
+	std::thread([]() {
+		CThreadPlacement::Register(THREAD_ROLE_BACKGROUND);
+		// placed once, the first role sticks
+		CThreadPlacement::Register(THREAD_ROLE_GAME);
+	}).join();
+	CThreadPlacement::Register(THREAD_ROLE_WORKER);
+
+	THREAD_PLACEMENT placements[THREAD_MAX_PLACED];
+	int iCount = CThreadPlacement::GetPlacements(placements, THREAD_MAX_PLACED);
+	CHECK_EQ(iCount, 2);
+	if (iCount != 2) return;
+
+	CHECK_EQ(placements[0].role, THREAD_ROLE_BACKGROUND);
+	CHECK_EQ(placements[0].dwMask, 0x0Fu);
+	CHECK_EQ(placements[0].iNice, THREAD_NICE_BACKGROUND);
+	// anyone may lower their own priority
+	CHECK(placements[0].bNiceSet);
+	CHECK_EQ(placements[1].role, THREAD_ROLE_WORKER);
+	CHECK_EQ(placements[1].dwMask, 0xFFu);
+	CHECK(placements[0].tid != placements[1].tid);
+
+	CHECK_EQ(CThreadPlacement::GetPlacements(placements, 1), 1);
+	CHECK(!strcmp(CThreadPlacement::GetRoleName(THREAD_ROLE_VOICE), "voice"));
+	CHECK(!strcmp(CThreadPlacement::GetRoleName((eThreadRole)99), "?"));
+}
+
+int main()
+{
+	CHECK(mkdtemp(g_szRoot) != nullptr);
+
+	TestCapacity();
+	TestFrequency();
+	TestBrokenTrees();
+	TestRegister();
+
+	std::filesystem::remove_all(g_szRoot);
+	return HostTestResult("test_threadplacement");
+}
@@ -0,0 +1,206 @@
+#include "main.h"
+#include "net/netgame.h"
+#include "hosttest.h"
+
+#include <random>
+
+// CUnoccupiedCorrector against packet traces: a simulated local vehicle follows the
+// corrector's speeds each frame while the sender's vehicle drives a known path. Checks the
+// error closes at the documented rate without overshoot, a moving target is tracked,
+// large errors snap, resting vehicles are left alone and the sender times out.
+
+static float Dot(const CVector& a, const CVector& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static float Length(const CVector& a) { return sqrtf(Dot(a, a)); }
+
+static CVector Cross(const CVector& a, const CVector& b)
+{
+	return CVector(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+static CVector Rotate(const CVector& v, const CVector& vecRot)
+{
+	float fAngle = Length(vecRot);
+	if (fAngle < 1e-7f) return v;
+	CVector k = vecRot / fAngle;
+	return v * cosf(fAngle) + Cross(k, v) * sinf(fAngle) + k * (Dot(k, v) * (1.0f - cosf(fAngle)));
+}
+
+static UNOC_STATE RestingAt(const CVector& vecPos)
+{
+	UNOC_STATE state;
+	state.vecPos = vecPos;
+	state.vecRight = CVector(1.0f, 0.0f, 0.0f);
+	state.vecUp = CVector(0.0f, 1.0f, 0.0f);
+	state.vecMoveSpeed = CVector(0.0f, 0.0f, 0.0f);
+	state.vecTurnSpeed = CVector(0.0f, 0.0f, 0.0f);
+	return state;
+}
+
+// the local vehicle: takes the corrector's output, then its own physics runs for the frame
+static int Step(CUnoccupiedCorrector& corrector, UNOC_STATE& local, uint32_t dwNow, uint32_t dwFrame)
+{
+	UNOC_STATE out;
+	int iCorrection = corrector.Update(dwNow, local, out);
+	if (iCorrection == UNOC_CORRECTION_SNAP) local = out;
+	else if (iCorrection == UNOC_CORRECTION_STEER) {
+		local.vecMoveSpeed = out.vecMoveSpeed;
+		local.vecTurnSpeed = out.vecTurnSpeed;
+	}
+
+	float fSteps = dwFrame / UNOC_STEP_TIME;
+	local.vecPos = local.vecPos + local.vecMoveSpeed * fSteps;
+	CVector vecRot = local.vecTurnSpeed * fSteps;
+	local.vecRight = Rotate(local.vecRight, vecRot);
+	local.vecUp = Rotate(local.vecUp, vecRot);
+	local.vecMoveSpeed = Rotate(local.vecMoveSpeed, vecRot);
+	return iCorrection;
+}
+
+static void TestCloses()
+{
+	for (uint32_t dwFrame : { 8u, 16u, 33u, 50u })
+	{
+		CUnoccupiedCorrector corrector;
+		UNOC_STATE local = RestingAt(CVector(0.0f, 0.0f, 0.0f));
+		CVector vecStart(3.0f, 1.0f, 0.0f);
+		float fStart = Length(vecStart);
+
+		uint32_t dwNow = 1000;
+		corrector.SetTarget(dwNow, RestingAt(vecStart));
+
+		float fMinAlong = fStart;
+		for (uint32_t t = 0; t < 4 * UNOC_CORRECTION_TIME; t += dwFrame, dwNow += dwFrame)
+		{
+			CHECK_EQ(Step(corrector, local, dwNow, dwFrame), UNOC_CORRECTION_STEER);
+			fMinAlong = std::min(fMinAlong, Dot(vecStart - local.vecPos, vecStart) / fStart);
+		}
+
+		// 90% gone after 4x the correction time, and never past the target
+		CHECK(Length(vecStart - local.vecPos) < fStart * 0.1f);
+		CHECK(fMinAlong > -0.01f);
+
+		// then left alone once settled
+		int iCorrection = UNOC_CORRECTION_STEER;
+		for (int i = 0; i < 200 && iCorrection != UNOC_CORRECTION_NONE; i++, dwNow += dwFrame)
+			iCorrection = Step(corrector, local, dwNow, dwFrame);
+		CHECK_EQ(iCorrection, UNOC_CORRECTION_NONE);
+		CHECK_EQ(corrector.GetSnapCount(), 0);
+	}
+}
+
+static void TestRotation()
+{
+	CUnoccupiedCorrector corrector;
+	UNOC_STATE local = RestingAt(CVector(0.0f, 0.0f, 0.0f));
+	UNOC_STATE target = local;
+	CVector vecRot(0.0f, 0.0f, 0.6f);
+	target.vecRight = Rotate(target.vecRight, vecRot);
+	target.vecUp = Rotate(target.vecUp, vecRot);
+
+	uint32_t dwNow = 1000;
+	corrector.SetTarget(dwNow, target);
+	for (int i = 0; i < 30; i++, dwNow += 16) Step(corrector, local, dwNow, 16);
+
+	CHECK(corrector.GetAngleError() < 0.06f);
+	CHECK(Dot(local.vecRight, target.vecRight) > 0.998f);
+	CHECK_EQ(corrector.GetSnapCount(), 0);
+}
+
+static void TestSnap()
+{
+	CUnoccupiedCorrector corrector;
+	UNOC_STATE local = RestingAt(CVector(0.0f, 0.0f, 0.0f));
+
+	corrector.SetTarget(1000, RestingAt(CVector(UNOC_SNAP_DIST + 1.0f, 0.0f, 0.0f)));
+	CHECK_EQ(Step(corrector, local, 1000, 16), UNOC_CORRECTION_SNAP);
+	CHECK_EQ(corrector.GetSnapCount(), 1);
+	CHECK(fabsf(local.vecPos.x - (UNOC_SNAP_DIST + 1.0f)) < 1e-4f);
+
+	UNOC_STATE flipped = RestingAt(local.vecPos);
+	flipped.vecUp = CVector(0.0f, -1.0f, 0.0f);
+	flipped.vecRight = CVector(-1.0f, 0.0f, 0.0f);
+	corrector.SetTarget(1100, flipped);
+	CHECK_EQ(Step(corrector, local, 1100, 16), UNOC_CORRECTION_SNAP);
+}
+
+// the sender drives a circle and sends at ~10 Hz with jitter and the odd lost packet
+static void TestMovingTarget()
+{
+	std::mt19937 rng(3);
+	CUnoccupiedCorrector corrector;
+
+	const float fSpeed = 0.4f;		// units per step, 20 m/s
+	const float fTurn = 0.01f;		// rad per step
+	auto sender = [&](uint32_t dwTime) {
+		float fSteps = dwTime / UNOC_STEP_TIME;
+		float fAngle = fTurn * fSteps;
+		float fRadius = fSpeed / fTurn;
+
+		UNOC_STATE state;
+		state.vecUp = CVector(-sinf(fAngle), cosf(fAngle), 0.0f);
+		state.vecRight = CVector(cosf(fAngle), sinf(fAngle), 0.0f);
+		state.vecPos = CVector(fRadius * (cosf(fAngle) - 1.0f), fRadius * sinf(fAngle), 0.0f);
+		state.vecMoveSpeed = state.vecUp * fSpeed;
+		state.vecTurnSpeed = CVector(0.0f, 0.0f, fTurn);
+		return state;
+	};
+
+	// starts a little off the sender and at rest
+	UNOC_STATE local = RestingAt(sender(1000).vecPos + CVector(1.0f, -1.0f, 0.0f));
+	local.vecRight = sender(1000).vecRight;
+	local.vecUp = sender(1000).vecUp;
+	uint32_t dwNextPacket = 0;
+	float fWorst = 0.0f;
+
+	for (uint32_t dwNow = 1000; dwNow < 21000; dwNow += 16)
+	{
+		if (dwNow >= dwNextPacket)
+		{
+			// sent 30-80 ms ago, the corrector extrapolates from its arrival
+			uint32_t dwLatency = 30 + rng() % 50;
+			if (rng() % 20) corrector.SetTarget(dwNow, sender(dwNow - dwLatency));
+			dwNextPacket = dwNow + 80 + rng() % 40;
+		}
+
+		Step(corrector, local, dwNow, 16);
+
+		// once settled, the local vehicle stays within the latency of the sender
+		if (dwNow > 2000) fWorst = std::max(fWorst, corrector.GetPositionError());
+	}
+
+	CHECK(fWorst < 1.0f);
+	CHECK(corrector.GetAverageError() < 0.5f);
+	CHECK_EQ(corrector.GetSnapCount(), 0);
+	printf("circle: worst error %.3f, average on arrival %.3f\n", fWorst, corrector.GetAverageError());
+}
+
+static void TestTimeout()
+{
+	CUnoccupiedCorrector corrector;
+	UNOC_STATE local = RestingAt(CVector(0.0f, 0.0f, 0.0f));
+	UNOC_STATE target = RestingAt(CVector(1.0f, 0.0f, 0.0f));
+	target.vecMoveSpeed = CVector(0.1f, 0.0f, 0.0f);
+	corrector.SetTarget(1000, target);
+
+	CHECK_EQ(Step(corrector, local, 1000 + UNOC_TIMEOUT, 16), UNOC_CORRECTION_STEER);
+	CHECK_EQ(Step(corrector, local, 1001 + UNOC_TIMEOUT, 16), UNOC_CORRECTION_NONE);
+	CHECK(!corrector.HasTarget());
+
+	// extrapolation stops at the limit
+	corrector.SetTarget(5000, target);
+	UNOC_STATE out;
+	corrector.GetTarget(5000 + UNOC_EXTRAPOLATE_LIMIT * 2, out);
+	float fLimit = 1.0f + 0.1f * UNOC_EXTRAPOLATE_LIMIT / UNOC_STEP_TIME;
+	CHECK(fabsf(out.vecPos.x - fLimit) < 1e-4f);
+}
+
+int main()
+{
+	TestCloses();
+	TestRotation();
+	TestSnap();
+	TestMovingTarget();
+	TestTimeout();
+
+	return HostTestResult("test_unoccupiedsync");
+}
@@ -0,0 +1,202 @@
+#include "main.h"
+#include "net/netgame.h"
+#include "hosttest.h"
+
+#include <algorithm>
+#include <random>
+
+// CUpdateScheduler on a synthetic clock: tiers and their hysteresis, tick intervals without
+// budget pressure, the budget with no slot starving, measured costs feeding back, and a
+// crowd moving around the camera.
+
+#define FRAME_MS	16
+
+static void TestTiers()
+{
+	CUpdateScheduler scheduler(8, 1000.0f);
+	scheduler.BeginFrame(1000);
+	scheduler.Classify(0, 10.0f, true, false);
+	scheduler.Classify(1, 80.0f, true, false);
+	scheduler.Classify(2, 80.0f, false, false);
+	scheduler.Classify(3, 500.0f, true, false);
+	scheduler.Classify(4, 500.0f, true, true);
+	scheduler.Schedule();
+
+	CHECK_EQ(scheduler.GetTier(0), LOD_TIER_NEAR);
+	CHECK_EQ(scheduler.GetTier(1), LOD_TIER_MID);
+	CHECK_EQ(scheduler.GetTier(2), LOD_TIER_FAR);
+	CHECK_EQ(scheduler.GetTier(3), LOD_TIER_FAR);
+	CHECK_EQ(scheduler.GetTier(4), LOD_TIER_NEAR);
+	CHECK_EQ(scheduler.GetTier(5), -1);
+	CHECK_EQ(scheduler.GetStats().iSlots[LOD_TIER_NEAR], 2);
+	CHECK_EQ(scheduler.GetStats().iSlots[LOD_TIER_MID], 1);
+	CHECK_EQ(scheduler.GetStats().iSlots[LOD_TIER_FAR], 2);
+
+	// past a border by less than the hysteresis keeps the tier, further changes it
+	scheduler.BeginFrame(1016);
+	scheduler.Classify(0, LOD_NEAR_DIST + LOD_HYSTERESIS - 1.0f, true, false);
+	scheduler.Classify(1, LOD_MID_DIST + LOD_HYSTERESIS - 1.0f, true, false);
+	scheduler.Schedule();
+	CHECK_EQ(scheduler.GetTier(0), LOD_TIER_NEAR);
+	CHECK_EQ(scheduler.GetTier(1), LOD_TIER_MID);
+
+	scheduler.BeginFrame(1032);
+	scheduler.Classify(0, LOD_NEAR_DIST + LOD_HYSTERESIS + 1.0f, true, false);
+	scheduler.Classify(1, LOD_MID_DIST + LOD_HYSTERESIS + 1.0f, true, false);
+	scheduler.Schedule();
+	CHECK_EQ(scheduler.GetTier(0), LOD_TIER_MID);
+	CHECK_EQ(scheduler.GetTier(1), LOD_TIER_FAR);
+
+	// and coming back needs the plain border
+	scheduler.BeginFrame(1048);
+	scheduler.Classify(0, LOD_NEAR_DIST + 1.0f, true, false);
+	scheduler.Schedule();
+	CHECK_EQ(scheduler.GetTier(0), LOD_TIER_MID);
+
+	// a slot not classified this frame doesn't tick
+	CHECK(!scheduler.IsScheduled(2));
+	scheduler.Remove(0);
+	CHECK_EQ(scheduler.GetTier(0), -1);
+}
+
+static void TestIntervals()
+{
+	CUpdateScheduler scheduler(3, 1e6f);
+	std::vector<uint32_t> lastTick(3, 0);
+	std::vector<uint32_t> minGap(3, UINT32_MAX), maxGap(3, 0);
+
+	for (uint32_t dwNow = 1000; dwNow < 11000; dwNow += FRAME_MS)
+	{
+		scheduler.BeginFrame(dwNow);
+		scheduler.Classify(0, 10.0f, true, false);
+		scheduler.Classify(1, 80.0f, true, false);
+		scheduler.Classify(2, 500.0f, true, false);
+		scheduler.Schedule();
+
+		for (int i = 0; i < 3; i++)
+		{
+			if (!scheduler.IsScheduled(i)) continue;
+			if (lastTick[i]) {
+				minGap[i] = std::min(minGap[i], dwNow - lastTick[i]);
+				maxGap[i] = std::max(maxGap[i], dwNow - lastTick[i]);
+			}
+			lastTick[i] = dwNow;
+		}
+	}
+
+	CHECK_EQ(maxGap[0], FRAME_MS);
+	CHECK(minGap[1] >= LOD_MID_INTERVAL && maxGap[1] < LOD_MID_INTERVAL + FRAME_MS);
+	CHECK(minGap[2] >= LOD_FAR_INTERVAL && maxGap[2] < LOD_FAR_INTERVAL + FRAME_MS);
+}
+
+static void TestBudget()
+{
+	const int iSlots = 1000;
+	const float fBudget = 200.0f;
+	CUpdateScheduler scheduler(iSlots, fBudget);
+
+	std::vector<uint32_t> lastTick(iSlots, 0);
+	uint32_t dwWorstGap = 0;
+	int iFrames = 0;
+
+	for (uint32_t dwNow = 1000; dwNow < 21000; dwNow += FRAME_MS, iFrames++)
+	{
+		scheduler.BeginFrame(dwNow);
+		for (int i = 0; i < iSlots; i++) scheduler.Classify(i, 500.0f, true, false);
+		scheduler.Schedule();
+
+		int iTicked = 0;
+		for (int i = 0; i < iSlots; i++)
+		{
+			if (!scheduler.IsScheduled(i)) continue;
+			iTicked++;
+			if (lastTick[i]) dwWorstGap = std::max(dwWorstGap, dwNow - lastTick[i]);
+			lastTick[i] = dwNow;
+			scheduler.ReportCost(i, LOD_DEFAULT_COST);
+		}
+
+		CHECK(iTicked >= 1);
+		CHECK(scheduler.GetStats().fPlanned <= fBudget + 0.01f);
+		CHECK_EQ(scheduler.GetStats().iUpdated[LOD_TIER_FAR], iTicked);
+		CHECK(scheduler.GetStats().iDeferred + iTicked <= iSlots);
+		if (iFrames == 0) CHECK_EQ(scheduler.GetStats().iDeferred, iSlots - (int)(fBudget / LOD_DEFAULT_COST));
+	}
+
+	// round robin: every slot ticks once per pass over all of them
+	int iPerFrame = (int)(fBudget / LOD_DEFAULT_COST);
+	uint32_t dwPass = (uint32_t)((iSlots + iPerFrame - 1) / iPerFrame) * FRAME_MS;
+	CHECK(dwWorstGap <= dwPass + FRAME_MS);
+	for (int i = 0; i < iSlots; i++) CHECK(lastTick[i] != 0);
+
+	// dearer ticks than assumed: fewer per frame, still at least one
+	for (uint32_t dwNow = 21000; dwNow < 23000; dwNow += FRAME_MS)
+	{
+		scheduler.BeginFrame(dwNow);
+		for (int i = 0; i < iSlots; i++) scheduler.Classify(i, 500.0f, true, false);
+		scheduler.Schedule();
+		for (int i = 0; i < iSlots; i++)
+			if (scheduler.IsScheduled(i)) scheduler.ReportCost(i, 500.0f);
+	}
+	CHECK(scheduler.GetStats().fTickCost[LOD_TIER_FAR] > 400.0f);
+	CHECK_EQ(scheduler.GetStats().iUpdated[LOD_TIER_FAR], 1);
+}
+
+// a crowd walking around the camera with a tight budget
+static void TestCrowd()
+{
+	const int iSlots = 300;
+	CUpdateScheduler scheduler(iSlots, 300.0f);
+	std::mt19937 rng(11);
+
+	std::vector<float> distance(iSlots);
+	std::vector<bool> onScreen(iSlots);
+	std::vector<uint32_t> lastTick(iSlots, 0);
+	for (int i = 0; i < iSlots; i++) {
+		distance[i] = 5.0f + rng() % 300;
+		onScreen[i] = rng() % 2;
+	}
+
+	uint32_t dwWorstNear = 0, dwWorstFar = 0;
+	int iUpdates = 0, iFrames = 0;
+
+	for (uint32_t dwNow = 1000; dwNow < 31000; dwNow += FRAME_MS, iFrames++)
+	{
+		scheduler.BeginFrame(dwNow);
+		for (int i = 0; i < iSlots; i++)
+		{
+			distance[i] = std::clamp(distance[i] + ((int)(rng() % 21) - 10) * 0.1f, 1.0f, 300.0f);
+			if (rng() % 200 == 0) onScreen[i] = !onScreen[i];
+			scheduler.Classify(i, distance[i], onScreen[i], false);
+		}
+		scheduler.Schedule();
+
+		for (int i = 0; i < iSlots; i++)
+		{
+			if (scheduler.IsScheduled(i)) {
+				scheduler.ReportCost(i, 10.0f + rng() % 20);
+				lastTick[i] = dwNow;
+				iUpdates++;
+				continue;
+			}
+			uint32_t dwGap = dwNow - lastTick[i];
+			if (scheduler.GetTier(i) == LOD_TIER_NEAR) dwWorstNear = std::max(dwWorstNear, dwGap);
+			else dwWorstFar = std::max(dwWorstFar, dwGap);
+		}
+	}
+
+	// near slots never wait; a slot that just came near may have been ticked a while ago
+	CHECK_EQ(dwWorstNear, 0);
+	CHECK(dwWorstFar < 2000);
+	printf("crowd: %.1f ticks per frame for %d slots, slowest far slot waited %u ms\n",
+		(float)iUpdates / iFrames, iSlots, dwWorstFar);
+}
+
+int main()
+{
+	TestTiers();
+	TestIntervals();
+	TestBudget();
+	TestCrowd();
+
+	return HostTestResult("test_updatescheduler");
+}
@@ -0,0 +1,181 @@
+#include "main.h"
+#include "net/netgame.h"
+#include "hosttest.h"
+
+// CVisibilityService with a fake raycast: the per-frame raycast budget, results reused until
+// they expire or an endpoint moves, the flip hysteresis, eviction of pairs nobody asks about,
+// and what a pair nobody could test yet reports.
+
+#define FRAME_MS	16
+
+struct CFakeWorld
+{
+	bool	bClear = true;
+	int		iRaycasts = 0;
+
+	CVisibilityService::RaycastFunc Raycast()
+	{
+		return [this](const CVector&, const CVector&) { iRaycasts++; return bClear; };
+	}
+};
+
+static const CVector g_vecFrom(0.0f, 0.0f, 0.0f);
+static const CVector g_vecTo(10.0f, 0.0f, 0.0f);
+
+static void TestBudget()
+{
+	CFakeWorld world;
+	CVisibilityService service(world.Raycast());
+
+	// the first twelve new pairs are tested right away, the rest wait and read as not visible
+	service.Process(1000);
+	int iVisible = 0;
+	for (int i = 0; i < 20; i++) iVisible += service.IsVisible(LOS_KEY_PLAYER(i), g_vecFrom, g_vecTo);
+	CHECK_EQ(iVisible, LOS_RAYCASTS_PER_FRAME);
+	CHECK_EQ(world.iRaycasts, LOS_RAYCASTS_PER_FRAME);
+	CHECK_EQ(service.GetRaycastsThisFrame(), LOS_RAYCASTS_PER_FRAME);
+	CHECK_EQ(service.GetPendingCount(), 20 - LOS_RAYCASTS_PER_FRAME);
+
+	// asking again doesn't queue them twice
+	for (int i = 0; i < 20; i++) service.IsVisible(LOS_KEY_PLAYER(i), g_vecFrom, g_vecTo);
+	CHECK_EQ(service.GetPendingCount(), 20 - LOS_RAYCASTS_PER_FRAME);
+
+	service.Process(1000 + FRAME_MS);
+	CHECK_EQ(world.iRaycasts, 20);
+	CHECK_EQ(service.GetPendingCount(), 0);
+	for (int i = 0; i < 20; i++) CHECK(service.IsVisible(LOS_KEY_PLAYER(i), g_vecFrom, g_vecTo));
+
+	// a crowd never costs more than the budget in a frame
+	uint32_t dwNow = 2000;
+	for (int frame = 0; frame < 100; frame++, dwNow += FRAME_MS)
+	{
+		service.Process(dwNow);
+		for (int i = 0; i < 200; i++) service.IsVisible(LOS_KEY_LABEL(i), g_vecFrom, g_vecTo);
+		CHECK(service.GetRaycastsThisFrame() <= LOS_RAYCASTS_PER_FRAME);
+	}
+	CHECK(world.iRaycasts <= 20 + 100 * LOS_RAYCASTS_PER_FRAME);
+	CHECK(world.iRaycasts >= 20 + 200);
+}
+
+static void TestReuse()
+{
+	CFakeWorld world;
+	CVisibilityService service(world.Raycast());
+
+	service.Process(1000);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+	CHECK_EQ(world.iRaycasts, 1);
+
+	// still fresh: the wall that came up isn't seen yet
+	world.bClear = false;
+	service.Process(1000 + LOS_RESULT_TTL - 1);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+	CHECK_EQ(service.GetPendingCount(), 0);
+
+	// expired: queued, tested next frame
+	service.Process(1000 + LOS_RESULT_TTL);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+	CHECK_EQ(service.GetPendingCount(), 1);
+	service.Process(1000 + LOS_RESULT_TTL + FRAME_MS);
+	CHECK_EQ(world.iRaycasts, 2);
+
+	// within the threshold an endpoint may drift without a re-test, past it not
+	CFakeWorld still;
+	CVisibilityService moving(still.Raycast());
+	moving.Process(1000);
+	moving.IsVisible(1, g_vecFrom, g_vecTo);
+	moving.Process(1000 + FRAME_MS);
+	moving.IsVisible(1, CVector(LOS_MOVE_THRESHOLD - 0.01f, 0.0f, 0.0f), g_vecTo);
+	CHECK_EQ(moving.GetPendingCount(), 0);
+	moving.IsVisible(1, g_vecFrom, CVector(10.0f, LOS_MOVE_THRESHOLD + 0.01f, 0.0f));
+	CHECK_EQ(moving.GetPendingCount(), 1);
+	moving.Process(1000 + 2 * FRAME_MS);
+	CHECK_EQ(still.iRaycasts, 2);
+}
+
+static void TestHysteresis()
+{
+	CFakeWorld world;
+	CVisibilityService service(world.Raycast());
+
+	uint32_t dwNow = 1000;
+	service.Process(dwNow);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+
+	// one stray hit doesn't hide it
+	world.bClear = false;
+	service.Process(dwNow += LOS_RESULT_TTL);
+	service.IsVisible(1, g_vecFrom, g_vecTo);
+	service.Process(dwNow += FRAME_MS);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+
+	world.bClear = true;
+	service.Process(dwNow += FRAME_MS);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+	CHECK_EQ(world.iRaycasts, 3);
+
+	// two in a row do, the second one is tested on the next frame instead of after the TTL
+	world.bClear = false;
+	service.Process(dwNow += LOS_RESULT_TTL);
+	service.IsVisible(1, g_vecFrom, g_vecTo);
+	service.Process(dwNow += FRAME_MS);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+	service.Process(dwNow += FRAME_MS);
+	CHECK(!service.IsVisible(1, g_vecFrom, g_vecTo));
+	CHECK_EQ(world.iRaycasts, 5);
+
+	// and back the same way
+	world.bClear = true;
+	service.Process(dwNow += LOS_RESULT_TTL);
+	service.IsVisible(1, g_vecFrom, g_vecTo);
+	service.Process(dwNow += FRAME_MS);
+	CHECK(!service.IsVisible(1, g_vecFrom, g_vecTo));
+	service.Process(dwNow += FRAME_MS);
+	CHECK(service.IsVisible(1, g_vecFrom, g_vecTo));
+}
+
+static void TestEviction()
+{
+	CFakeWorld world;
+	CVisibilityService service(world.Raycast());
+
+	service.Process(1000);
+	service.IsVisible(1, g_vecFrom, g_vecTo);
+	service.IsVisible(2, g_vecFrom, g_vecTo);
+	CHECK_EQ(world.iRaycasts, 2);
+
+	// only 2 keeps being asked about; 1 is dropped and tested like a new pair
+	uint32_t dwNow = 1000;
+	while (dwNow < 1000 + LOS_EVICT_TIME + 1000)
+	{
+		service.Process(dwNow += FRAME_MS);
+		service.IsVisible(2, g_vecFrom, g_vecTo);
+	}
+	int iRaycasts = world.iRaycasts;
+	service.IsVisible(1, g_vecFrom, g_vecTo);
+	CHECK_EQ(world.iRaycasts, iRaycasts + 1);
+
+	// still asked about: an expired result is queued, not tested like a new pair
+	service.IsVisible(2, g_vecFrom, g_vecTo);
+	CHECK_EQ(world.iRaycasts, iRaycasts + 1);
+
+	// a pair that's forgotten while it waits leaves the queue
+	CVisibilityService busy(world.Raycast(), 0);
+	busy.Process(1000);
+	busy.IsVisible(1, g_vecFrom, g_vecTo);
+	busy.IsVisible(2, g_vecFrom, g_vecTo);
+	CHECK_EQ(busy.GetPendingCount(), 2);
+	busy.Forget(1);
+	CHECK_EQ(busy.GetPendingCount(), 1);
+	busy.Clear();
+	CHECK_EQ(busy.GetPendingCount(), 0);
+}
+
+int main()
+{
+	TestBudget();
+	TestReuse();
+	TestHysteresis();
+	TestEviction();
+	return HostTestResult("test_visibilityservice");
+}
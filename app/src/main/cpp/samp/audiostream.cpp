@@ -1,4 +1,7 @@
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <pthread.h>
 #include <unistd.h>
 #include "audiostream.h"
 #include "log.h"
@@ -18,31 +21,39 @@ bool g_audioStreamUsePos;
 bool g_bAudioStreamStop;
 bool g_bAudioStreamThreadWorked;
 
-void* audioStreamThread(void*)
+// the connect thread against Stop
+static std::mutex g_AudioStreamMutex;
+static std::condition_variable g_AudioStreamConnected;
+static bool g_bAudioStreamConnecting;
+
+static void WaitAudioStreamConnect()
 {
-	g_bAudioStreamThreadWorked = true;
-	if (bassStream)
+	std::unique_lock<std::mutex> lock(g_AudioStreamMutex);
+	g_AudioStreamConnected.wait(lock, [] { return !g_bAudioStreamConnecting; });
+}
+
+// connecting blocks for up to BASS_CONFIG_NET_TIMEOUT, so it gets its own thread and not a job
+// (see jobsystem.h); the stream then plays on BASS's own threads
+static void* audioStreamThread(void*)
+{
+	HSTREAM stream = BASS_StreamCreateURL(g_szAudioStreamUrl, 0, 0x940000, 0,0);
+
+	std::lock_guard<std::mutex> lock(g_AudioStreamMutex);
+	g_bAudioStreamConnecting = false;
+	g_AudioStreamConnected.notify_all();
+	if (g_bAudioStreamStop)
 	{
-		BASS_ChannelStop(bassStream);
-		bassStream = 0;
+		// stopped while connecting
+		if (stream) BASS_StreamFree(stream);
+		return nullptr;
 	}
 
-	bassStream = BASS_StreamCreateURL(g_szAudioStreamUrl, 0, 0x940000, 0,0);
+	bassStream = stream;
 	BASS_ChannelPlay(bassStream, 0);
 
 	//BASS_ChannelSetSync(bassStream, 4, 0, 0, 0);
 	//BASS_ChannelSetSync(bassStream, 12, 0, 0, 0);
-
-	while (!g_bAudioStreamStop)
-	{
-		// ..
-		usleep(2000);
-	}
-
-	BASS_ChannelStop(bassStream);
-	bassStream = 0;
-	g_bAudioStreamThreadWorked = false;
-	pthread_exit(0);
+	return nullptr;
 }
 
 CAudioStream::CAudioStream()
@@ -87,6 +98,8 @@ bool CAudioStream::Play(const char* szUrl, float fX, float fY, float fZ, float f
 
 	if (!m_bInited) return false;
 	Stop(true);
+	// after a Stop(false) the last connect may still be running, it reads the url
+	WaitAudioStreamConnect();
 
 	if (bassStream)
 	{
@@ -104,9 +117,18 @@ bool CAudioStream::Play(const char* szUrl, float fX, float fY, float fZ, float f
 	g_audioStreamUsePos = bUsePos;
 
 	g_bAudioStreamStop = false;
+	g_bAudioStreamThreadWorked = true;
+
+	g_bAudioStreamConnecting = true;
 
 	pthread_t thread;
-	pthread_create(&thread, 0, audioStreamThread, 0);
+	if (pthread_create(&thread, 0, audioStreamThread, 0) != 0)
+	{
+		g_bAudioStreamConnecting = false;
+		g_bAudioStreamThreadWorked = false;
+		return false;
+	}
+	pthread_detach(thread);
 	return true;
 }
 // 0.3.7
@@ -116,15 +138,23 @@ bool CAudioStream::Stop(bool bWaitThread)
 	if (!m_bInited || !g_bAudioStreamThreadWorked)
 		return false;
 
-	g_bAudioStreamStop = true;
+	HSTREAM stream;
+	{
+		std::lock_guard<std::mutex> lock(g_AudioStreamMutex);
+		g_bAudioStreamStop = true;
+		stream = bassStream;
+		bassStream = 0;
+	}
 
+	// a connect that's still running frees its stream itself
 	if (bWaitThread)
+		WaitAudioStreamConnect();
+
+	if (stream)
 	{
-		while (g_bAudioStreamThreadWorked)
-			usleep(200);
+		BASS_ChannelStop(stream);
+		BASS_StreamFree(stream);
 	}
-
-	BASS_StreamFree(bassStream);
-	bassStream = 0;
+	g_bAudioStreamThreadWorked = false;
 	return true;
 }
\ No newline at end of file
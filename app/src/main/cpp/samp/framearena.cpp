@@ -0,0 +1,255 @@
+#include "framearena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#define MEMPOOL_CLASS_LARGE		0xFFFFFFFF
+
+struct MEMPOOL_HEADER
+{
+	size_t		size;		// only kept for large blocks
+	uint32_t	dwClass;
+};
+static_assert(sizeof(MEMPOOL_HEADER) <= MEMPOOL_HEADER_SIZE, "MEMPOOL_HEADER doesn't fit");
+
+struct MemPoolClass
+{
+	std::mutex	mutex;
+	void*		pFree = nullptr;	// blocks, header first; the next one is kept where the header goes
+};
+
+static std::vector<uint8_t*> g_ArenaChunks;
+static std::vector<void*> g_ArenaOversized;
+static size_t g_iArenaChunk = 0;
+static size_t g_ArenaOffset = 0;
+static size_t g_ArenaUsed = 0;
+static size_t g_ArenaHighWater = 0;
+
+static MemPoolClass g_PoolClasses[MEMPOOL_CLASS_COUNT];
+static std::atomic<uint32_t> g_dwPoolSlabs(0);
+
+#if MEMSTATS_ENABLED
+static uint32_t g_dwArenaAllocs = 0;
+static uint32_t g_dwArenaLastAllocs = 0;
+static uint32_t g_dwArenaOversized = 0;
+
+static std::atomic<uint32_t> g_dwPoolAllocs(0);
+static std::atomic<uint32_t> g_dwPoolFrees(0);
+static std::atomic<uint32_t> g_dwPoolLarge(0);
+static std::atomic<uint32_t> g_dwPoolClassAllocs[MEMPOOL_CLASS_COUNT];
+#define MEMSTAT_INC(x)	(x).fetch_add(1, std::memory_order_relaxed)
+#else
+#define MEMSTAT_INC(x)
+#endif
+
+static inline uintptr_t AlignUp(uintptr_t p, size_t align)
+{
+	return (p + align - 1) & ~(uintptr_t)(align - 1);
+}
+
+void* CFrameArena::Alloc(size_t size, size_t align)
+{
+	if (size == 0) size = 1;
+#if MEMSTATS_ENABLED
+	g_dwArenaAllocs++;
+#endif
+	g_ArenaUsed += size;
+
+	if (size + align > FRAME_ARENA_CHUNK_SIZE)
+	{
+		uint8_t* pChunk = (uint8_t*)malloc(size + align);
+		if (!pChunk) return nullptr;
+		g_ArenaOversized.push_back(pChunk);
+#if MEMSTATS_ENABLED
+		g_dwArenaOversized++;
+#endif
+		return (void*)AlignUp((uintptr_t)pChunk, align);
+	}
+
+	while (true)
+	{
+		if (g_iArenaChunk < g_ArenaChunks.size())
+		{
+			uintptr_t base = (uintptr_t)g_ArenaChunks[g_iArenaChunk];
+			uintptr_t p = AlignUp(base + g_ArenaOffset, align);
+			if (p + size <= base + FRAME_ARENA_CHUNK_SIZE) {
+				g_ArenaOffset = p + size - base;
+				return (void*)p;
+			}
+
+			// the rest of this one is lost for the frame
+			g_iArenaChunk++;
+			g_ArenaOffset = 0;
+			continue;
+		}
+
+		uint8_t* pChunk = (uint8_t*)malloc(FRAME_ARENA_CHUNK_SIZE);
+		if (!pChunk) return nullptr;
+		g_ArenaChunks.push_back(pChunk);
+	}
+}
+
+char* CFrameArena::StrDup(const char* szText)
+{
+	size_t len = strlen(szText) + 1;
+	char* szCopy = (char*)Alloc(len, 1);
+	if (szCopy) memcpy(szCopy, szText, len);
+	return szCopy;
+}
+
+void CFrameArena::EndFrame()
+{
+	g_ArenaHighWater = std::max(g_ArenaHighWater, g_ArenaUsed);
+	g_ArenaUsed = 0;
+	g_iArenaChunk = 0;
+	g_ArenaOffset = 0;
+
+	for (void* pChunk : g_ArenaOversized) free(pChunk);
+	g_ArenaOversized.clear();
+
+#if MEMSTATS_ENABLED
+	g_dwArenaLastAllocs = g_dwArenaAllocs;
+	g_dwArenaAllocs = 0;
+#endif
+}
+
+FRAME_ARENA_STATS CFrameArena::GetStats()
+{
+	FRAME_ARENA_STATS stats;
+	stats.used = g_ArenaUsed;
+	stats.highWater = std::max(g_ArenaHighWater, g_ArenaUsed);
+	stats.iChunks = (int)g_ArenaChunks.size();
+#if MEMSTATS_ENABLED
+	stats.dwAllocs = g_dwArenaAllocs;
+	stats.dwLastAllocs = g_dwArenaLastAllocs;
+	stats.dwOversized = g_dwArenaOversized;
+#endif
+	return stats;
+}
+
+// smallest class the size fits in
+static inline uint32_t GetPoolClass(size_t size)
+{
+	if (size <= MEMPOOL_MIN_SIZE) return 0;
+	return (uint32_t)(sizeof(unsigned long long) * 8 - __builtin_clzll((unsigned long long)(size - 1))) - 4;
+}
+
+static inline size_t GetPoolClassSize(uint32_t dwClass)
+{
+	return (size_t)MEMPOOL_MIN_SIZE << dwClass;
+}
+
+// under the class mutex
+static void RefillPoolClass(uint32_t dwClass)
+{
+	size_t blockSize = GetPoolClassSize(dwClass) + MEMPOOL_HEADER_SIZE;
+	size_t count = MEMPOOL_SLAB_SIZE / blockSize;
+
+	uint8_t* pSlab = (uint8_t*)malloc(count * blockSize);
+	if (!pSlab) return;
+	g_dwPoolSlabs.fetch_add(1, std::memory_order_relaxed);
+
+	MemPoolClass& poolClass = g_PoolClasses[dwClass];
+	for (size_t i = count; i-- > 0; )
+	{
+		void* pBlock = pSlab + i * blockSize;
+		*(void**)pBlock = poolClass.pFree;
+		poolClass.pFree = pBlock;
+	}
+}
+
+void* CMemPool::Alloc(size_t size)
+{
+	MEMSTAT_INC(g_dwPoolAllocs);
+
+	MEMPOOL_HEADER* pHeader;
+	if (size > MEMPOOL_MAX_SIZE)
+	{
+		pHeader = (MEMPOOL_HEADER*)malloc(size + MEMPOOL_HEADER_SIZE);
+		if (!pHeader) return nullptr;
+		pHeader->size = size;
+		pHeader->dwClass = MEMPOOL_CLASS_LARGE;
+		MEMSTAT_INC(g_dwPoolLarge);
+		return (uint8_t*)pHeader + MEMPOOL_HEADER_SIZE;
+	}
+
+	uint32_t dwClass = GetPoolClass(size);
+	MemPoolClass& poolClass = g_PoolClasses[dwClass];
+	{
+		std::lock_guard<std::mutex> lock(poolClass.mutex);
+		if (!poolClass.pFree) {
+			RefillPoolClass(dwClass);
+			if (!poolClass.pFree) return nullptr;
+		}
+		pHeader = (MEMPOOL_HEADER*)poolClass.pFree;
+		poolClass.pFree = *(void**)pHeader;
+	}
+
+	pHeader->size = size;
+	pHeader->dwClass = dwClass;
+	MEMSTAT_INC(g_dwPoolClassAllocs[dwClass]);
+	return (uint8_t*)pHeader + MEMPOOL_HEADER_SIZE;
+}
+
+void* CMemPool::Realloc(void* pMem, size_t size)
+{
+	if (!pMem) return Alloc(size);
+	if (size == 0) {
+		Free(pMem);
+		return nullptr;
+	}
+
+	MEMPOOL_HEADER* pHeader = (MEMPOOL_HEADER*)((uint8_t*)pMem - MEMPOOL_HEADER_SIZE);
+	size_t capacity = pHeader->dwClass == MEMPOOL_CLASS_LARGE ? pHeader->size : GetPoolClassSize(pHeader->dwClass);
+	if (size <= capacity) return pMem;
+
+	if (pHeader->dwClass == MEMPOOL_CLASS_LARGE)
+	{
+		pHeader = (MEMPOOL_HEADER*)realloc(pHeader, size + MEMPOOL_HEADER_SIZE);
+		if (!pHeader) return nullptr;
+		pHeader->size = size;
+		return (uint8_t*)pHeader + MEMPOOL_HEADER_SIZE;
+	}
+
+	void* pNew = Alloc(size);
+	if (!pNew) return nullptr;
+	memcpy(pNew, pMem, capacity);
+	Free(pMem);
+	return pNew;
+}
+
+void CMemPool::Free(void* pMem)
+{
+	if (!pMem) return;
+	MEMSTAT_INC(g_dwPoolFrees);
+
+	MEMPOOL_HEADER* pHeader = (MEMPOOL_HEADER*)((uint8_t*)pMem - MEMPOOL_HEADER_SIZE);
+	if (pHeader->dwClass == MEMPOOL_CLASS_LARGE) {
+		free(pHeader);
+		return;
+	}
+
+	MemPoolClass& poolClass = g_PoolClasses[pHeader->dwClass];
+	std::lock_guard<std::mutex> lock(poolClass.mutex);
+	*(void**)pHeader = poolClass.pFree;
+	poolClass.pFree = pHeader;
+}
+
+MEMPOOL_STATS CMemPool::GetStats()
+{
+	MEMPOOL_STATS stats;
+	stats.dwSlabs = g_dwPoolSlabs.load(std::memory_order_relaxed);
+#if MEMSTATS_ENABLED
+	stats.dwAllocs = g_dwPoolAllocs.load(std::memory_order_relaxed);
+	stats.dwFrees = g_dwPoolFrees.load(std::memory_order_relaxed);
+	stats.dwLarge = g_dwPoolLarge.load(std::memory_order_relaxed);
+	stats.iLive = (int)(stats.dwAllocs - stats.dwFrees);
+	for (int i = 0; i < MEMPOOL_CLASS_COUNT; i++) {
+		stats.dwClassAllocs[i] = g_dwPoolClassAllocs[i].load(std::memory_order_relaxed);
+	}
+#endif
+	return stats;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Frame memory.
+// CFrameArena is a bump allocator for data that dies with the frame: text being
+// formatted, split rows, scratch arrays. Nothing is freed one by one, EndFrame() just
+// rewinds to the first chunk, and the chunks are kept for the next frame. A request
+// bigger than a chunk gets a chunk of its own, dropped at the end of the frame.
+// Main thread only; pointers into it must not be kept past EndFrame().
+// CMemPool is for buffers that outlive the frame but come and go all the time
+// (bitstreams, RPC payloads, material text): power-of-two size classes from
+// MEMPOOL_MIN_SIZE to MEMPOOL_MAX_SIZE, each with its own freelist refilled from slabs,
+// bigger blocks go to malloc. Any thread. Slabs are never given back.
+// FrameAllocator and MemPoolAllocator put STL containers on either of them.
+// Debug builds count allocations, release builds (NDEBUG) leave the counters out.
+
+#ifndef MEMSTATS_ENABLED
+#ifdef NDEBUG
+#define MEMSTATS_ENABLED	0
+#else
+#define MEMSTATS_ENABLED	1
+#endif
+#endif
+
+#define FRAME_ARENA_CHUNK_SIZE	(256 * 1024)
+
+#define MEMPOOL_MIN_SIZE		16
+#define MEMPOOL_MAX_SIZE		4096
+#define MEMPOOL_CLASS_COUNT		9			// 16, 32, ... 4096
+#define MEMPOOL_SLAB_SIZE		(64 * 1024)
+#define MEMPOOL_HEADER_SIZE		16			// in front of every block, keeps malloc's alignment
+
+struct FRAME_ARENA_STATS
+{
+	size_t		used;			// this frame so far
+	size_t		highWater;		// most any frame used
+	int			iChunks;
+#if MEMSTATS_ENABLED
+	uint32_t	dwAllocs;		// this frame
+	uint32_t	dwLastAllocs;	// the frame before
+	uint32_t	dwOversized;	// since start
+#endif
+};
+
+struct MEMPOOL_STATS
+{
+	uint32_t	dwSlabs;
+#if MEMSTATS_ENABLED
+	uint32_t	dwAllocs;
+	uint32_t	dwFrees;
+	uint32_t	dwLarge;		// past MEMPOOL_MAX_SIZE, went to malloc
+	int			iLive;			// allocated and not freed yet
+	uint32_t	dwClassAllocs[MEMPOOL_CLASS_COUNT];
+#endif
+};
+
+class CFrameArena
+{
+public:
+	static void* Alloc(size_t size, size_t align = alignof(std::max_align_t));
+	static char* StrDup(const char* szText);
+
+	// main thread, once a frame, after everything that used the arena
+	static void EndFrame();
+
+	static FRAME_ARENA_STATS GetStats();
+};
+
+class CMemPool
+{
+public:
+	static void* Alloc(size_t size);
+	// like realloc: nullptr allocates, the contents move when the class changes
+	static void* Realloc(void* pMem, size_t size);
+	static void Free(void* pMem);
+
+	static MEMPOOL_STATS GetStats();
+};
+
+template<class T>
+struct FrameAllocator
+{
+	typedef T value_type;
+
+	FrameAllocator() noexcept {}
+	template<class U> FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n) { return (T*)CFrameArena::Alloc(n * sizeof(T), alignof(T)); }
+	void deallocate(T*, size_t) noexcept {}		// goes with the frame
+
+	template<class U> bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+	template<class U> bool operator!=(const FrameAllocator<U>&) const noexcept { return false; }
+};
+
+template<class T>
+struct MemPoolAllocator
+{
+	typedef T value_type;
+
+	MemPoolAllocator() noexcept {}
+	template<class U> MemPoolAllocator(const MemPoolAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n) { return (T*)CMemPool::Alloc(n * sizeof(T)); }
+	void deallocate(T* p, size_t) noexcept { CMemPool::Free(p); }
+
+	template<class U> bool operator==(const MemPoolAllocator<U>&) const noexcept { return true; }
+	template<class U> bool operator!=(const MemPoolAllocator<U>&) const noexcept { return false; }
+};
+
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
+template<class T> using FrameVector = std::vector<T, FrameAllocator<T>>;
@@ -0,0 +1,31 @@
+#include "AnimBlendBatch.h"
+#include "SimdMath.h"
+
+namespace {
+
+constexpr float ROTATION_SCALE = 1.0f / 4096.0f;
+constexpr float TRANSLATION_SCALE = 1.0f / 1024.0f;
+
+// the compressed rotation is x, y, z, w, CQuaternion keeps w first
+void UncompressRotation(const int16_t* rot, CQuaternion& out) {
+    SimdStore4(&out.w, SimdRotateRight(SimdMul(SimdLoadInt16x4(rot), ROTATION_SCALE)));
+}
+
+} // namespace
+
+void AnimBlendBatch::UncompressFrames(const KeyFrameCompressed* in, KeyFrame* out, int32 count) {
+    for (auto i = 0; i < count; i++) {
+        UncompressRotation(in[i].rot, out[i].rotation);
+        out[i].deltaTime = in[i].GetDeltaTime();
+    }
+}
+
+void AnimBlendBatch::UncompressFrames(const KeyFrameTransCompressed* in, KeyFrameTrans* out, int32 count) {
+    for (auto i = 0; i < count; i++) {
+        UncompressRotation(in[i].rot, out[i].rotation);
+        out[i].deltaTime = in[i].GetDeltaTime();
+        out[i].translation.x = float(in[i].trans[0]) * TRANSLATION_SCALE;
+        out[i].translation.y = float(in[i].trans[1]) * TRANSLATION_SCALE;
+        out[i].translation.z = float(in[i].trans[2]) * TRANSLATION_SCALE;
+    }
+}
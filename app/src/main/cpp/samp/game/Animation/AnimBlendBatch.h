@@ -0,0 +1,13 @@
+#pragma once
+
+#include "AnimSequenceFrames.h"
+#include "../common.h"
+
+// NOTSA
+// Keyframe decompression over whole arrays with game/Core/SimdMath.h. It is exact, it gives
+// the same floats as KeyFrameCompressed::GetRotation and friends.
+
+namespace AnimBlendBatch {
+    void UncompressFrames(const KeyFrameCompressed* in, KeyFrame* out, int32 count);
+    void UncompressFrames(const KeyFrameTransCompressed* in, KeyFrameTrans* out, int32 count);
+}
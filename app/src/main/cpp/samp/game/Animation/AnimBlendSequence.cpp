@@ -1,4 +1,5 @@
 #include "AnimBlendSequence.h"
+#include "AnimBlendBatch.h"
 #include "game/MemoryMgr.h"
 #include "game/Core/KeyGen.h"
 
@@ -117,21 +118,11 @@ void CAnimBlendSequence::Uncompress(uint8* frameData) {
     }
 
     void* frames = (frameData ? frameData : CMemoryMgr::Malloc(GetDataSize(false)));
+    // NOTSA: batched, same floats as GetRotation/GetDeltaTime/GetTranslation per frame
     if (m_isRoot) {
-        auto* kftc = (KeyFrameTransCompressed*)m_pFrames;
-        auto* kf = (KeyFrameTrans*)frames;
-        for (auto i = 0; i < m_nFrameCount; i++, kf++, kftc++) {
-            kftc->GetRotation(&kf->rotation);
-            kf->deltaTime = kftc->GetDeltaTime();
-            kftc->GetTranslation(&kf->translation);
-        }
+        AnimBlendBatch::UncompressFrames((KeyFrameTransCompressed*)m_pFrames, (KeyFrameTrans*)frames, m_nFrameCount);
     } else {
-        auto* kfc = (KeyFrameCompressed*)m_pFrames;
-        auto* kf = (KeyFrame*)frames;
-        for (auto i = 0; i < m_nFrameCount; i++, kf++, kfc++) {
-            kfc->GetRotation(&kf->rotation);
-            kf->deltaTime = kfc->GetDeltaTime();
-        }
+        AnimBlendBatch::UncompressFrames((KeyFrameCompressed*)m_pFrames, (KeyFrame*)frames, m_nFrameCount);
     }
 
     if (!m_usingExternalMemory) {
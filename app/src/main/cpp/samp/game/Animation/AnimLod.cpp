@@ -0,0 +1,72 @@
+#include "AnimLod.h"
+#include <algorithm>
+
+void CAnimLod::SetEnabled(bool bEnabled) {
+    ms_bEnabled = bEnabled;
+    if (!bEnabled) {
+        ms_Entries.clear();
+        ms_Stats.nTracked = 0;
+    }
+}
+
+void CAnimLod::ResetStats() {
+    ms_Stats.nRun = 0;
+    ms_Stats.nSkipped = 0;
+}
+
+bool CAnimLod::Update(const void* pKey, float fDistance, bool bOnScreen, uint32 dwNow, float fStep, float& fOutStep) {
+    if (dwNow - ms_dwLastPrune >= ANIM_LOD_FORGET_TIME / 2) {
+        Prune(dwNow);
+    }
+
+    fOutStep = fStep;
+    if (fDistance < ANIM_LOD_NEAR_DIST || fStep < 0.0f || fStep > ANIM_LOD_MAX_STEP) {
+        // a near clump keeps no state, it may have pending step from when it was further out
+        if (auto it = ms_Entries.find(pKey); it != ms_Entries.end()) {
+            fOutStep += it->second.fPending;
+            ms_Entries.erase(it);
+            ms_Stats.nTracked = (uint32)ms_Entries.size();
+        }
+        ms_Stats.nRun++;
+        return true;
+    }
+
+    const uint32 dwInterval = (fDistance < ANIM_LOD_MID_DIST && bOnScreen) ? ANIM_LOD_MID_INTERVAL : ANIM_LOD_FAR_INTERVAL;
+    auto [it, bInserted] = ms_Entries.try_emplace(pKey);
+    auto& entry = it->second;
+    if (bInserted) {
+        // staggered: a new clump runs now and its next run lands somewhere in the interval
+        const auto hash = (uint32)(std::hash<const void*>{}(pKey) >> 4);
+        entry.dwLastRun = dwNow - hash % dwInterval;
+        entry.fPending = 0.0f;
+        entry.dwLastSeen = dwNow;
+        ms_Stats.nTracked = (uint32)ms_Entries.size();
+        ms_Stats.nRun++;
+        return true;
+    }
+
+    entry.dwLastSeen = dwNow;
+    entry.fPending += fStep;
+    if (dwNow - entry.dwLastRun < dwInterval && entry.fPending < ANIM_LOD_MAX_STEP) {
+        ms_Stats.nSkipped++;
+        return false;
+    }
+
+    fOutStep = std::min(entry.fPending, ANIM_LOD_MAX_STEP);
+    entry.fPending = 0.0f;
+    entry.dwLastRun = dwNow;
+    ms_Stats.nRun++;
+    return true;
+}
+
+void CAnimLod::Prune(uint32 dwNow) {
+    ms_dwLastPrune = dwNow;
+    for (auto it = ms_Entries.begin(); it != ms_Entries.end();) {
+        if (dwNow - it->second.dwLastSeen > ANIM_LOD_FORGET_TIME) {
+            it = ms_Entries.erase(it);
+        } else {
+            it++;
+        }
+    }
+    ms_Stats.nTracked = (uint32)ms_Entries.size();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../common.h"
+#include <unordered_map>
+
+// NOTSA
+// Reduced-rate animation for distant clumps. RpAnimBlendClumpUpdateAnimations asks Update whether a
+// clump's animations run on this call. Near clumps run every call; mid ones run every
+// ANIM_LOD_MID_INTERVAL ms, and far or off-screen ones every ANIM_LOD_FAR_INTERVAL ms. A skipped
+// call's step is held back and added to the next call that runs, so animations keep their timing
+// and only move in coarser steps. Clumps are staggered by their key so they don't all run on the
+// same frame. Off by default.
+
+#define ANIM_LOD_NEAR_DIST      30.0f
+#define ANIM_LOD_MID_DIST       80.0f   // within this an on-screen clump is mid, else far
+#define ANIM_LOD_MID_INTERVAL   50      // ms
+#define ANIM_LOD_FAR_INTERVAL   150     // ms
+#define ANIM_LOD_MAX_STEP       0.5f    // s, larger steps (snapshots, skips) always go through as they are
+#define ANIM_LOD_FORGET_TIME    2000    // ms a clump is remembered after its last call
+
+struct ANIM_LOD_STATS {
+    uint32 nRun;        // calls that ran
+    uint32 nSkipped;    // calls held back
+    uint32 nTracked;    // clumps remembered
+};
+
+class CAnimLod {
+public:
+    static void SetEnabled(bool bEnabled);
+    static bool IsEnabled() { return ms_bEnabled; }
+
+    // false when the call is skipped; otherwise fOutStep is fStep plus what the skipped calls held back
+    static bool Update(const void* pKey, float fDistance, bool bOnScreen, uint32 dwNow, float fStep, float& fOutStep);
+
+    static const ANIM_LOD_STATS& GetStats() { return ms_Stats; }
+    static void ResetStats();
+
+private:
+    struct Entry {
+        uint32 dwLastRun;
+        uint32 dwLastSeen;
+        float  fPending;
+    };
+
+    static void Prune(uint32 dwNow);
+
+    static inline bool ms_bEnabled;
+    static inline uint32 ms_dwLastPrune;
+    static inline std::unordered_map<const void*, Entry> ms_Entries;
+    static inline ANIM_LOD_STATS ms_Stats;
+};
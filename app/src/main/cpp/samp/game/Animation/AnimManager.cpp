@@ -38,7 +38,7 @@ void CAnimManager::Initialise() {
     CAnimManager::ms_numAnimAssocDefinitions = 0x76;
 
   //  ms_numAnimAssocDefinitions = 118; // ANIM_TOTAL_GROUPS aka NUM_ANIM_ASSOC_GROUPS
-    ms_animCache.Init(50);
+    ms_animCache.Init(ANIM_CACHE_SIZE);
     ReadAnimAssociationDefinitions();
     RegisterAnimBlock("ped");
 }
@@ -411,12 +411,48 @@ int32 CAnimManager::GetNumRefsToAnimBlock(int32 index) {
 
 // 0x4D41C0
 void CAnimManager::UncompressAnimation(CAnimBlendHierarchy* hier) {
-    return CHook::CallFunction<void>(g_libGTASA + (VER_x32 ? 0x0038DD54 + 1 : 0x466740), hier);
+    if (!hier) { // NOTSA: was a PLT guard in hooks.cpp
+        return;
+    }
+
+    if (hier->m_bKeepCompressed) {
+        if (hier->m_fTotalTime == 0.0f) {
+            hier->CalcTotalTimeCompressed();
+        }
+        return;
+    }
+
+    if (!hier->m_bRunningCompressed) {
+        // already uncompressed, most recently used goes to the front
+        ms_nCacheHits++;
+        if (hier->m_Link) {
+            hier->m_Link->Remove();
+            ms_animCache.usedListHead.Insert(hier->m_Link);
+        }
+        return;
+    }
+
+    ms_nCacheMisses++;
+    auto link = ms_animCache.Insert(hier);
+    if (!link) {
+        // full, drop the least recently used one
+        auto tail = ms_animCache.GetTail();
+        tail->data->RemoveUncompressedData();
+        tail->data->m_Link = nullptr;
+        ms_animCache.Remove(tail);
+        ms_nCacheEvictions++;
+        link = ms_animCache.Insert(hier);
+    }
+    hier->m_Link = link;
+    hier->Uncompress();
 }
 
 // 0x4D42A0
 void CAnimManager::RemoveFromUncompressedCache(CAnimBlendHierarchy* hier) {
-    return CHook::CallFunction<void>(g_libGTASA + (VER_x32 ? 0x0038DE60 + 1 : 0x4668AC), hier);
+    if (hier->m_Link) {
+        ms_animCache.Remove(hier->m_Link);
+        hier->m_Link = nullptr;
+    }
 }
 
 // 0x4D4410
@@ -873,4 +909,6 @@ void CAnimManager::InjectHooks() {
 
     CHook::Redirect("_ZN12CAnimManager10InitialiseEv", &CAnimManager::Initialise);
     CHook::Redirect("_ZN12CAnimManager13LoadAnimFilesEv", &CAnimManager::LoadAnimFiles);
+    CHook::Redirect("_ZN12CAnimManager19UncompressAnimationEP19CAnimBlendHierarchy", &CAnimManager::UncompressAnimation);
+    CHook::Redirect("_ZN12CAnimManager27RemoveFromUncompressedCacheEP19CAnimBlendHierarchy", &CAnimManager::RemoveFromUncompressedCache);
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 constexpr auto MAX_ANIM_BLOCK_NAME = 16;
 constexpr auto NUM_ANIM_ASSOC_GROUPS = 145;
 constexpr auto NUM_ANIM_BLOCKS = 180;
+constexpr auto ANIM_CACHE_SIZE = 160; // uncompressed hierarchies kept, 50 in the original
 
 class CAnimManager {
 public:
@@ -32,6 +33,11 @@ public:
     static inline std::array<CAnimBlock, NUM_ANIM_BLOCKS> ms_aAnimBlocks;
     static inline CLinkList<CAnimBlendHierarchy*> ms_animCache;
 
+    // NOTSA: UncompressAnimation counters
+    static inline uint32 ms_nCacheHits;
+    static inline uint32 ms_nCacheMisses;
+    static inline uint32 ms_nCacheEvictions;
+
 public:
     static void InjectHooks();
 
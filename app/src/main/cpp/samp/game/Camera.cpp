@@ -34,25 +34,25 @@ void CCamera::RestoreWithJumpCut() {
 
 void CCamera::SetBehindPlayer()
 {
-    ScriptCommand(&lock_camera_position, 0);
-    ScriptCommand(&restore_camera_to_user);
-    ScriptCommand(&set_camera_behind_player);
-    ScriptCommand(&restore_camera_jumpcut);
+    ScriptCommand<lock_camera_position>(0);
+    ScriptCommand<restore_camera_to_user>();
+    ScriptCommand<set_camera_behind_player>();
+    ScriptCommand<restore_camera_jumpcut>();
 }
 
 // 0.3.7
 void CCamera::SetPosition(float fX, float fY, float fZ, float fRotationX, float fRotationY, float fRotationZ)
 {
-    ScriptCommand(&restore_camera_to_user);
-    ScriptCommand(&set_camera_position, fX, fY, fZ, fRotationX, fRotationY, fRotationZ);
+    ScriptCommand<restore_camera_to_user>();
+    ScriptCommand<set_camera_position>(fX, fY, fZ, fRotationX, fRotationY, fRotationZ);
 }
 
 
 // 0.3.7
 void CCamera::LookAtPoint(float fX, float fY, float fZ, int iType)
 {
-    ScriptCommand(&restore_camera_to_user);
-    ScriptCommand(&point_camera, fX, fY, fZ, iType);
+    ScriptCommand<restore_camera_to_user>();
+    ScriptCommand<point_camera>(fX, fY, fZ, iType);
 }
 
 // 0.3.7
@@ -60,15 +60,15 @@ void CCamera::InterpolateCameraPos(CVector *posFrom, CVector *posTo, int time, u
 {
     CCamera& TheCamera = *reinterpret_cast<CCamera*>(g_libGTASA + (VER_x32 ? 0x00951FA8 : 0xBBA8D0));
 
-    ScriptCommand(&restore_camera_to_user);
-    ScriptCommand(&lock_camera_position1, 1);
-    ScriptCommand(&set_camera_pos_time_smooth, posFrom->x, posFrom->y, posFrom->z, posTo->x, posTo->y, posTo->z, time, mode);
+    ScriptCommand<restore_camera_to_user>();
+    ScriptCommand<lock_camera_position1>(1);
+    ScriptCommand<set_camera_pos_time_smooth>(posFrom->x, posFrom->y, posFrom->z, posTo->x, posTo->y, posTo->z, time, mode);
 }
 
 // 0.3.7
 void CCamera::InterpolateCameraLookAt(CVector *posFrom, CVector *posTo, int time, uint8_t mode)
 {
-    ScriptCommand(&lock_camera_position, 1);
-    ScriptCommand(&point_camera_transverse, posFrom->x, posFrom->y, posFrom->z, posTo->x, posTo->y, posTo->z, time, mode);
+    ScriptCommand<lock_camera_position>(1);
+    ScriptCommand<point_camera_transverse>(posFrom->x, posFrom->y, posFrom->z, posTo->x, posTo->y, posTo->z, time, mode);
 }
 
@@ -0,0 +1,381 @@
+#include "ColBatch.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <cmath>
+
+// The batched and reference paths only agree bit for bit when neither gets its multiplies and adds fused
+#ifdef __clang__
+#pragma clang fp contract(off)
+#endif
+
+void CColTriangleSet::Build(const CCollisionData& data) {
+    m_nCount = data.m_nNumTriangles;
+    m_pTriangles = data.m_pTriangles;
+    m_Data.resize(COL_TRI_LANE_COUNT * m_nCount);
+
+    float* lanes[COL_TRI_LANE_COUNT];
+    for (auto l = 0; l < COL_TRI_LANE_COUNT; l++) {
+        lanes[l] = m_Data.data() + l * m_nCount;
+    }
+
+    for (auto i = 0; i < m_nCount; i++) {
+        const auto& tri = m_pTriangles[i];
+        const CVector& a = data.m_pVertices[tri.vA];
+        const CVector& b = data.m_pVertices[tri.vB];
+        const CVector& c = data.m_pVertices[tri.vC];
+
+        lanes[COL_TRI_AX][i] = a.x;
+        lanes[COL_TRI_AY][i] = a.y;
+        lanes[COL_TRI_AZ][i] = a.z;
+        lanes[COL_TRI_E1X][i] = b.x - a.x;
+        lanes[COL_TRI_E1Y][i] = b.y - a.y;
+        lanes[COL_TRI_E1Z][i] = b.z - a.z;
+        lanes[COL_TRI_E2X][i] = c.x - a.x;
+        lanes[COL_TRI_E2Y][i] = c.y - a.y;
+        lanes[COL_TRI_E2Z][i] = c.z - a.z;
+    }
+}
+
+void CColTriangleSet::Clear() {
+    m_Data.clear();
+    m_pTriangles = nullptr;
+    m_nCount = 0;
+}
+
+void CColSphereSet::Build(const CCollisionData& data) {
+    m_nCount = data.m_nNumSpheres;
+    m_pSpheres = data.m_pSpheres;
+    m_Data.resize(COL_SPHERE_LANE_COUNT * m_nCount);
+
+    float* lanes[COL_SPHERE_LANE_COUNT];
+    for (auto l = 0; l < COL_SPHERE_LANE_COUNT; l++) {
+        lanes[l] = m_Data.data() + l * m_nCount;
+    }
+
+    for (auto i = 0; i < m_nCount; i++) {
+        const auto& sphere = m_pSpheres[i];
+        lanes[COL_SPHERE_X][i] = sphere.m_vecCenter.x;
+        lanes[COL_SPHERE_Y][i] = sphere.m_vecCenter.y;
+        lanes[COL_SPHERE_Z][i] = sphere.m_vecCenter.z;
+        lanes[COL_SPHERE_R][i] = sphere.m_fRadius;
+    }
+}
+
+void CColSphereSet::Clear() {
+    m_Data.clear();
+    m_pSpheres = nullptr;
+    m_nCount = 0;
+}
+
+// Moller-Trumbore, two sided, with the divisions by the determinant folded into the comparisons
+bool CColBatch::LineTriangleRef(const CColLine& line, const CColTriangleSet& set, int32 i, float fMaxFraction, float& fFraction) {
+    const CVector& s = line.m_vecStart;
+    const float dx = line.m_vecEnd.x - s.x;
+    const float dy = line.m_vecEnd.y - s.y;
+    const float dz = line.m_vecEnd.z - s.z;
+
+    const float e1x = set.GetLane(COL_TRI_E1X)[i], e1y = set.GetLane(COL_TRI_E1Y)[i], e1z = set.GetLane(COL_TRI_E1Z)[i];
+    const float e2x = set.GetLane(COL_TRI_E2X)[i], e2y = set.GetLane(COL_TRI_E2Y)[i], e2z = set.GetLane(COL_TRI_E2Z)[i];
+
+    const float px = dy * e2z - dz * e2y;
+    const float py = dz * e2x - dx * e2z;
+    const float pz = dx * e2y - dy * e2x;
+    float det = e1x * px + e1y * py + e1z * pz;
+
+    const float sx = s.x - set.GetLane(COL_TRI_AX)[i];
+    const float sy = s.y - set.GetLane(COL_TRI_AY)[i];
+    const float sz = s.z - set.GetLane(COL_TRI_AZ)[i];
+    const float qx = sy * e1z - sz * e1y;
+    const float qy = sz * e1x - sx * e1z;
+    const float qz = sx * e1y - sy * e1x;
+
+    float u = sx * px + sy * py + sz * pz;
+    float v = dx * qx + dy * qy + dz * qz;
+    float t = e2x * qx + e2y * qy + e2z * qz;
+    if (std::signbit(det)) {
+        det = -det;
+        u = -u;
+        v = -v;
+        t = -t;
+    }
+
+    if (!(det > 0.0f && u >= 0.0f && v >= 0.0f && u + v <= det && t >= 0.0f && t <= fMaxFraction * det))
+        return false;
+
+    fFraction = t / det;
+    return true;
+}
+
+// A line starting inside a sphere hits it at its start
+bool CColBatch::LineSphereRef(const CColLine& line, const CColSphereSet& set, int32 i, float fMaxFraction, float& fFraction) {
+    const CVector& s = line.m_vecStart;
+    const float dx = line.m_vecEnd.x - s.x;
+    const float dy = line.m_vecEnd.y - s.y;
+    const float dz = line.m_vecEnd.z - s.z;
+
+    const float fx = s.x - set.GetLane(COL_SPHERE_X)[i];
+    const float fy = s.y - set.GetLane(COL_SPHERE_Y)[i];
+    const float fz = s.z - set.GetLane(COL_SPHERE_Z)[i];
+    const float r = set.GetLane(COL_SPHERE_R)[i];
+
+    const float a = dx * dx + dy * dy + dz * dz;
+    const float b = fx * dx + fy * dy + fz * dz;
+    const float c = (fx * fx + fy * fy + fz * fz) - r * r;
+    if (c <= 0.0f) {
+        fFraction = 0.0f;
+        return true;
+    }
+
+    // the entry point -b - sqrt(disc) is within fMaxFraction * a when k <= sqrt(disc)
+    const float disc = b * b - a * c;
+    const float k = (0.0f - b) - fMaxFraction * a;
+    if (!(a > 0.0f && b < 0.0f && disc >= 0.0f && (k <= 0.0f || k * k <= disc)))
+        return false;
+
+    fFraction = std::min(((0.0f - b) - sqrtf(disc)) / a, fMaxFraction);
+    return true;
+}
+
+bool CColBatch::SphereSphereRef(const CSphere& sphere, const CColSphereSet& set, int32 i) {
+    const float dx = sphere.m_vecCenter.x - set.GetLane(COL_SPHERE_X)[i];
+    const float dy = sphere.m_vecCenter.y - set.GetLane(COL_SPHERE_Y)[i];
+    const float dz = sphere.m_vecCenter.z - set.GetLane(COL_SPHERE_Z)[i];
+    const float rr = sphere.m_fRadius + set.GetLane(COL_SPHERE_R)[i];
+    return dx * dx + dy * dy + dz * dz <= rr * rr;
+}
+
+namespace {
+
+struct tLineLanes {
+    simd4f sx, sy, sz;
+    simd4f dx, dy, dz;
+};
+
+tLineLanes SplatLine(const CColLine& line) {
+    const CVector& s = line.m_vecStart;
+    return {
+        SimdSplat(s.x), SimdSplat(s.y), SimdSplat(s.z),
+        SimdSplat(line.m_vecEnd.x - s.x), SimdSplat(line.m_vecEnd.y - s.y), SimdSplat(line.m_vecEnd.z - s.z)
+    };
+}
+
+simd4f Dot(simd4f ax, simd4f ay, simd4f az, simd4f bx, simd4f by, simd4f bz) {
+    return SimdAdd(SimdAdd(SimdMul(ax, bx), SimdMul(ay, by)), SimdMul(az, bz));
+}
+
+// LineTriangleRef for the four triangles from i on, bit n set when i + n is hit
+int LineTriangleMask(const tLineLanes& ln, const CColTriangleSet& set, int32 i, float fMaxFraction) {
+    const simd4f e1x = SimdLoad4(set.GetLane(COL_TRI_E1X) + i);
+    const simd4f e1y = SimdLoad4(set.GetLane(COL_TRI_E1Y) + i);
+    const simd4f e1z = SimdLoad4(set.GetLane(COL_TRI_E1Z) + i);
+    const simd4f e2x = SimdLoad4(set.GetLane(COL_TRI_E2X) + i);
+    const simd4f e2y = SimdLoad4(set.GetLane(COL_TRI_E2Y) + i);
+    const simd4f e2z = SimdLoad4(set.GetLane(COL_TRI_E2Z) + i);
+
+    const simd4f px = SimdSub(SimdMul(ln.dy, e2z), SimdMul(ln.dz, e2y));
+    const simd4f py = SimdSub(SimdMul(ln.dz, e2x), SimdMul(ln.dx, e2z));
+    const simd4f pz = SimdSub(SimdMul(ln.dx, e2y), SimdMul(ln.dy, e2x));
+    const simd4f det = Dot(e1x, e1y, e1z, px, py, pz);
+
+    const simd4f sx = SimdSub(ln.sx, SimdLoad4(set.GetLane(COL_TRI_AX) + i));
+    const simd4f sy = SimdSub(ln.sy, SimdLoad4(set.GetLane(COL_TRI_AY) + i));
+    const simd4f sz = SimdSub(ln.sz, SimdLoad4(set.GetLane(COL_TRI_AZ) + i));
+    const simd4f qx = SimdSub(SimdMul(sy, e1z), SimdMul(sz, e1y));
+    const simd4f qy = SimdSub(SimdMul(sz, e1x), SimdMul(sx, e1z));
+    const simd4f qz = SimdSub(SimdMul(sx, e1y), SimdMul(sy, e1x));
+
+    const simd4f u = SimdFlipSign(Dot(sx, sy, sz, px, py, pz), det);
+    const simd4f v = SimdFlipSign(Dot(ln.dx, ln.dy, ln.dz, qx, qy, qz), det);
+    const simd4f t = SimdFlipSign(Dot(e2x, e2y, e2z, qx, qy, qz), det);
+    const simd4f absDet = SimdAbs(det);
+
+    const simd4f zero = SimdSplat(0.0f);
+    simd4f hit = SimdAnd(SimdCmpLt(zero, absDet), SimdCmpLe(zero, u));
+    hit = SimdAnd(hit, SimdCmpLe(zero, v));
+    hit = SimdAnd(hit, SimdCmpLe(SimdAdd(u, v), absDet));
+    hit = SimdAnd(hit, SimdCmpLe(zero, t));
+    hit = SimdAnd(hit, SimdCmpLe(t, SimdMul(SimdSplat(fMaxFraction), absDet)));
+    return SimdMask(hit);
+}
+
+// LineSphereRef for the four spheres from i on
+int LineSphereMask(const tLineLanes& ln, const CColSphereSet& set, int32 i, float fMaxFraction) {
+    const simd4f fx = SimdSub(ln.sx, SimdLoad4(set.GetLane(COL_SPHERE_X) + i));
+    const simd4f fy = SimdSub(ln.sy, SimdLoad4(set.GetLane(COL_SPHERE_Y) + i));
+    const simd4f fz = SimdSub(ln.sz, SimdLoad4(set.GetLane(COL_SPHERE_Z) + i));
+    const simd4f r = SimdLoad4(set.GetLane(COL_SPHERE_R) + i);
+
+    const simd4f a = Dot(ln.dx, ln.dy, ln.dz, ln.dx, ln.dy, ln.dz);
+    const simd4f b = Dot(fx, fy, fz, ln.dx, ln.dy, ln.dz);
+    const simd4f c = SimdSub(Dot(fx, fy, fz, fx, fy, fz), SimdMul(r, r));
+
+    const simd4f zero = SimdSplat(0.0f);
+    const simd4f disc = SimdSub(SimdMul(b, b), SimdMul(a, c));
+    const simd4f k = SimdSub(SimdSub(zero, b), SimdMul(SimdSplat(fMaxFraction), a));
+
+    simd4f hit = SimdAnd(SimdCmpLt(zero, a), SimdCmpLt(b, zero));
+    hit = SimdAnd(hit, SimdCmpLe(zero, disc));
+    hit = SimdAnd(hit, SimdOr(SimdCmpLe(k, zero), SimdCmpLe(SimdMul(k, k), disc)));
+    hit = SimdOr(hit, SimdCmpLe(c, zero));
+    return SimdMask(hit);
+}
+
+int SphereSphereMask(const CSphere& sphere, const CColSphereSet& set, int32 i) {
+    const simd4f dx = SimdSub(SimdSplat(sphere.m_vecCenter.x), SimdLoad4(set.GetLane(COL_SPHERE_X) + i));
+    const simd4f dy = SimdSub(SimdSplat(sphere.m_vecCenter.y), SimdLoad4(set.GetLane(COL_SPHERE_Y) + i));
+    const simd4f dz = SimdSub(SimdSplat(sphere.m_vecCenter.z), SimdLoad4(set.GetLane(COL_SPHERE_Z) + i));
+    const simd4f rr = SimdAdd(SimdSplat(sphere.m_fRadius), SimdLoad4(set.GetLane(COL_SPHERE_R) + i));
+    return SimdMask(SimdCmpLe(Dot(dx, dy, dz, dx, dy, dz), SimdMul(rr, rr)));
+}
+
+int LowestBit(int mask) {
+    return __builtin_ctz((unsigned)mask);
+}
+
+} // namespace
+
+int32 CColBatch::ProcessLineTriangles(const CColLine& line, const CColTriangleSet& set, float& fFraction) {
+    const float fMaxFraction = fFraction;
+    int32 nearest = -1;
+
+    // the masks only pick the lanes, the fraction of a hit always comes from the reference
+    const auto Consider = [&](int32 i) {
+        float f;
+        if (LineTriangleRef(line, set, i, fMaxFraction, f) && f < fFraction) {
+            fFraction = f;
+            nearest = i;
+        }
+    };
+
+    const auto ln = SplatLine(line);
+    const int32 count = set.GetCount();
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        for (int mask = LineTriangleMask(ln, set, i, fMaxFraction); mask; mask &= mask - 1) {
+            Consider(i + LowestBit(mask));
+        }
+    }
+    for (; i < count; i++) {
+        Consider(i);
+    }
+    return nearest;
+}
+
+int32 CColBatch::ProcessLineSpheres(const CColLine& line, const CColSphereSet& set, float& fFraction) {
+    const float fMaxFraction = fFraction;
+    int32 nearest = -1;
+
+    const auto Consider = [&](int32 i) {
+        float f;
+        if (LineSphereRef(line, set, i, fMaxFraction, f) && f < fFraction) {
+            fFraction = f;
+            nearest = i;
+        }
+    };
+
+    const auto ln = SplatLine(line);
+    const int32 count = set.GetCount();
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        for (int mask = LineSphereMask(ln, set, i, fMaxFraction); mask; mask &= mask - 1) {
+            Consider(i + LowestBit(mask));
+        }
+    }
+    for (; i < count; i++) {
+        Consider(i);
+    }
+    return nearest;
+}
+
+bool CColBatch::TestLineTriangles(const CColLine& line, const CColTriangleSet& set) {
+    const auto ln = SplatLine(line);
+    const int32 count = set.GetCount();
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        if (LineTriangleMask(ln, set, i, 1.0f))
+            return true;
+    }
+
+    float f;
+    for (; i < count; i++) {
+        if (LineTriangleRef(line, set, i, 1.0f, f))
+            return true;
+    }
+    return false;
+}
+
+bool CColBatch::TestLineSpheres(const CColLine& line, const CColSphereSet& set) {
+    const auto ln = SplatLine(line);
+    const int32 count = set.GetCount();
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        if (LineSphereMask(ln, set, i, 1.0f))
+            return true;
+    }
+
+    float f;
+    for (; i < count; i++) {
+        if (LineSphereRef(line, set, i, 1.0f, f))
+            return true;
+    }
+    return false;
+}
+
+int32 CColBatch::TestSphereSpheres(const CSphere& sphere, const CColSphereSet& set, int32* pHits, int32 iMaxHits) {
+    int32 hits = 0;
+    const int32 count = set.GetCount();
+    int32 i = 0;
+    for (; i + 4 <= count && hits < iMaxHits; i += 4) {
+        for (int mask = SphereSphereMask(sphere, set, i); mask && hits < iMaxHits; mask &= mask - 1) {
+            pHits[hits++] = i + LowestBit(mask);
+        }
+    }
+    for (; i < count && hits < iMaxHits; i++) {
+        if (SphereSphereRef(sphere, set, i))
+            pHits[hits++] = i;
+    }
+    return hits;
+}
+
+bool CColBatch::ProcessLineOfSight(const CColLine& line, const CMatrix& transform, const CColTriangleSet& tris, const CColSphereSet& spheres, CColPoint& colPoint, float& maxTouchDistance) {
+    const auto ln = TransformObject(line, Invert(transform));
+
+    // triangles only win when they're closer than the nearest sphere
+    float fraction = maxTouchDistance;
+    const int32 sphere = ProcessLineSpheres(ln, spheres, fraction);
+    const int32 tri = ProcessLineTriangles(ln, tris, fraction);
+    if (sphere < 0 && tri < 0)
+        return false;
+
+    const CVector dir = ln.m_vecEnd - ln.m_vecStart;
+    const CVector point = ln.m_vecStart + dir * fraction;
+    CVector normal;
+
+    colPoint = {};
+    if (tri >= 0) {
+        const CVector e1{ tris.GetLane(COL_TRI_E1X)[tri], tris.GetLane(COL_TRI_E1Y)[tri], tris.GetLane(COL_TRI_E1Z)[tri] };
+        const CVector e2{ tris.GetLane(COL_TRI_E2X)[tri], tris.GetLane(COL_TRI_E2Y)[tri], tris.GetLane(COL_TRI_E2Z)[tri] };
+        normal = CrossProduct(e1, e2);
+        if (DotProduct(normal, dir) > 0.0f)
+            normal = -normal; // two sided, face the line
+
+        const auto& triangle = tris.GetTriangle(tri);
+        colPoint.m_nSurfaceTypeB = triangle.m_nMaterial;
+        colPoint.m_nLightingB = triangle.m_nLight;
+    } else {
+        const auto& colSphere = spheres.GetSphere(sphere);
+        normal = point - colSphere.m_vecCenter;
+
+        colPoint.m_nSurfaceTypeB = colSphere.m_Surface.m_nMaterial;
+        colPoint.m_nPieceTypeB = colSphere.m_Surface.m_nPiece;
+        colPoint.m_nLightingB = colSphere.m_Surface.m_nLighting;
+    }
+    normal.Normalise();
+
+    colPoint.m_vecPoint = transform * point;
+    colPoint.m_vecNormal = Multiply3x3(transform, normal);
+    maxTouchDistance = fraction;
+    return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CollisionData.h"
+#include <vector>
+
+// NOTSA
+// Structure-of-arrays copies of a col model's triangles and spheres, and kernels that test a line
+// or a sphere against four of them at once (game/Core/SimdMath.h). Every kernel has a scalar
+// per-primitive reference and the batched path does the same float operations in the same order,
+// so both find exactly the same hits; primitives past the last full group of four go through the
+// reference. Sets are in col model space, a world line is taken into it by the inverse transform.
+// Divisions and square roots are only done for lanes that hit.
+
+enum eColTriLane {
+    COL_TRI_AX, COL_TRI_AY, COL_TRI_AZ,     // first vertex
+    COL_TRI_E1X, COL_TRI_E1Y, COL_TRI_E1Z,  // second vertex - first
+    COL_TRI_E2X, COL_TRI_E2Y, COL_TRI_E2Z,  // third vertex - first
+    COL_TRI_LANE_COUNT
+};
+
+enum eColSphereLane {
+    COL_SPHERE_X, COL_SPHERE_Y, COL_SPHERE_Z, COL_SPHERE_R,
+    COL_SPHERE_LANE_COUNT
+};
+
+class CColTriangleSet {
+public:
+    void Build(const CCollisionData& data);
+    void Clear();
+
+    int32 GetCount() const { return m_nCount; }
+    const float* GetLane(eColTriLane lane) const { return m_Data.data() + lane * m_nCount; }
+    const CColTriangle& GetTriangle(int32 i) const { return m_pTriangles[i]; }
+
+private:
+    std::vector<float>  m_Data;
+    const CColTriangle* m_pTriangles{};
+    int32               m_nCount{};
+};
+
+class CColSphereSet {
+public:
+    void Build(const CCollisionData& data);
+    void Clear();
+
+    int32 GetCount() const { return m_nCount; }
+    const float* GetLane(eColSphereLane lane) const { return m_Data.data() + lane * m_nCount; }
+    const CColSphere& GetSphere(int32 i) const { return m_pSpheres[i]; }
+
+private:
+    std::vector<float> m_Data;
+    const CColSphere*  m_pSpheres{};
+    int32              m_nCount{};
+};
+
+class CColBatch {
+public:
+    // Scalar references, one primitive each. A hit lies within fMaxFraction of the line,
+    // fFraction is where along it (0 = start, 1 = end).
+    static bool LineTriangleRef(const CColLine& line, const CColTriangleSet& set, int32 i, float fMaxFraction, float& fFraction);
+    static bool LineSphereRef(const CColLine& line, const CColSphereSet& set, int32 i, float fMaxFraction, float& fFraction);
+    static bool SphereSphereRef(const CSphere& sphere, const CColSphereSet& set, int32 i);
+
+    // Nearest hit closer than fFraction, which then holds where it is; -1 when there's none.
+    static int32 ProcessLineTriangles(const CColLine& line, const CColTriangleSet& set, float& fFraction);
+    static int32 ProcessLineSpheres(const CColLine& line, const CColSphereSet& set, float& fFraction);
+
+    // Anything between the start and the end of the line.
+    static bool TestLineTriangles(const CColLine& line, const CColTriangleSet& set);
+    static bool TestLineSpheres(const CColLine& line, const CColSphereSet& set);
+
+    // Indices of the spheres overlapping sphere, in order, at most iMaxHits of them; returns how many.
+    static int32 TestSphereSpheres(const CSphere& sphere, const CColSphereSet& set, int32* pHits, int32 iMaxHits);
+
+    // CCollision::ProcessLineOfSight over prebuilt sets: world space line and result,
+    // maxTouchDistance is the fraction of the line a hit has to be within.
+    static bool ProcessLineOfSight(const CColLine& line, const CMatrix& transform, const CColTriangleSet& tris, const CColSphereSet& spheres, CColPoint& colPoint, float& maxTouchDistance);
+};
@@ -6,6 +6,7 @@
 */
 
 #include "Matrix.h"
+#include "SimdMath.h"
 #include "../vendor/armhook/patch.h"
 //uint8_t* CMatrix::EulerIndices1 = (uint8_t*)0x866D9C;
 //uint8_t* CMatrix::EulerIndices2 = (uint8_t*)0x866D94;
@@ -482,19 +483,21 @@ void CMatrix::operator*=(const CMatrix& rvalue)
 CMatrix operator*(const CMatrix& a, const CMatrix& b)
 {
     auto result = CMatrix();
-    result.m_right =   a.m_right * b.m_right.x   + a.m_forward * b.m_right.y   + a.m_up * b.m_right.z;
-    result.m_forward = a.m_right * b.m_forward.x + a.m_forward * b.m_forward.y + a.m_up * b.m_forward.z;
-    result.m_up =      a.m_right * b.m_up.x      + a.m_forward * b.m_up.y      + a.m_up * b.m_up.z;
-    result.m_pos =     a.m_right * b.m_pos.x     + a.m_forward * b.m_pos.y     + a.m_up * b.m_pos.z + a.m_pos;
+    simd4f right = SimdLoadRow(&a.m_right.x);
+    simd4f forward = SimdLoadRow(&a.m_forward.x);
+    simd4f up = SimdLoadRow(&a.m_up.x);
+    SimdStore3(&result.m_right.x, SimdCombine3(right, forward, up, b.m_right.x, b.m_right.y, b.m_right.z));
+    SimdStore3(&result.m_forward.x, SimdCombine3(right, forward, up, b.m_forward.x, b.m_forward.y, b.m_forward.z));
+    SimdStore3(&result.m_up.x, SimdCombine3(right, forward, up, b.m_up.x, b.m_up.y, b.m_up.z));
+    SimdStore3(&result.m_pos.x, SimdAdd(SimdCombine3(right, forward, up, b.m_pos.x, b.m_pos.y, b.m_pos.z), SimdLoadRow(&a.m_pos.x)));
     return result;
 }
 
 CVector operator*(const CMatrix& a, const CVector& b)
 {
     CVector result;
-    result.x = a.m_pos.x + a.m_right.x * b.x + a.m_forward.x * b.y + a.m_up.x * b.z;
-    result.y = a.m_pos.y + a.m_right.y * b.x + a.m_forward.y * b.y + a.m_up.y * b.z;
-    result.z = a.m_pos.z + a.m_right.z * b.x + a.m_forward.z * b.y + a.m_up.z * b.z;
+    simd4f v = SimdCombine3(SimdLoadRow(&a.m_right.x), SimdLoadRow(&a.m_forward.x), SimdLoadRow(&a.m_up.x), b.x, b.y, b.z);
+    SimdStore3(&result.x, SimdAdd(SimdLoadRow(&a.m_pos.x), v));
     return result;
 }
 CMatrix operator+(const CMatrix& a, const CMatrix& b)
@@ -509,16 +512,17 @@ CMatrix operator+(const CMatrix& a, const CMatrix& b)
 
 CMatrix& Invert(CMatrix& in, CMatrix& out)
 {
-    out.GetPosition().Set(0.0F, 0.0F, 0.0F);
-
-    out.GetRight().Set(in.GetRight().x, in.GetForward().x, in.GetUp().x);
-    out.GetForward().Set(in.GetRight().y, in.GetForward().y, in.GetUp().y);
-    out.GetUp().Set(in.GetRight().z, in.GetForward().z, in.GetUp().z);
-
-    out.GetPosition() += in.GetPosition().x * out.GetRight();
-    out.GetPosition() += in.GetPosition().y * out.GetForward();
-    out.GetPosition() += in.GetPosition().z * out.GetUp();
-    out.GetPosition() *= -1.0F;
+    // in and out may be the same matrix, everything is read before the first store
+    simd4f right = SimdLoadRow(&in.m_right.x);
+    simd4f forward = SimdLoadRow(&in.m_forward.x);
+    simd4f up = SimdLoadRow(&in.m_up.x);
+    CVector pos = in.m_pos;
+    SimdTranspose3(right, forward, up);
+
+    SimdStore3(&out.m_right.x, right);
+    SimdStore3(&out.m_forward.x, forward);
+    SimdStore3(&out.m_up.x, up);
+    SimdStore3(&out.m_pos.x, SimdSub(SimdSplat(0.0F), SimdCombine3(right, forward, up, pos.x, pos.y, pos.z)));
 
     return out;
 }
@@ -1,6 +1,7 @@
 #include "main.h"
 #include "game/game.h"
 #include <cmath>
+#include "SimdMath.h"
 
 void CQuaternion::SetFromMatrix(RwMatrix* mat)
 {
@@ -59,20 +60,15 @@ void CQuaternion::Slerp(CQuaternion *pQ1, CQuaternion *pQ2, float t)
 	if(!pQ1 || !pQ2) return;
 	if(t > 1) return;
 
-	float p1[4];
 	double omega, cosom, sinom, scale0, scale1;
 	cosom = pQ1->x*pQ2->x + pQ1->y*pQ2->y + pQ1->z*pQ2->z + pQ1->w*pQ2->w;
 
+	// the shorter arc goes to -q2, its sign is folded into scale1
+	double sign = 1.0;
 	if(cosom < 0.0)
 	{
 		cosom = -cosom;
-		p1[0] = - pQ2->x;  p1[1] = - pQ2->y;
-		p1[2] = - pQ2->z;  p1[3] = - pQ2->w;
-	}	
-	else
-	{
-		p1[0] = pQ2->x;    p1[1] = pQ2->y;
-		p1[2] = pQ2->z;    p1[3] = pQ2->w;
+		sign = -1.0;
 	}
 
 	if((1.0 - cosom) > SLERP_DELTA)
@@ -89,8 +85,7 @@ void CQuaternion::Slerp(CQuaternion *pQ1, CQuaternion *pQ2, float t)
 		scale0 = 1.0 - t;
 		scale1 = t;
 	}
-	Set(scale0 * pQ1->x + scale1 * p1[0],
-		scale0 * pQ1->y + scale1 * p1[1],
-		scale0 * pQ1->z + scale1 * p1[2],
-		scale0 * pQ1->w + scale1 * p1[3]);
+	// all four lanes at once, the layout (w, x, y, z) doesn't matter to a blend
+	simd4f q = SimdAdd(SimdMul(SimdLoad4(&pQ1->w), (float)scale0), SimdMul(SimdLoad4(&pQ2->w), (float)(sign * scale1)));
+	SimdStore4(&w, q);
 }
\ No newline at end of file
@@ -0,0 +1,298 @@
+#pragma once
+
+// Four-lane float helpers behind the core math types: NEON on ARM, SSE on x86 hosts and a
+// scalar reference path (define SIMD_MATH_SCALAR to force it). CMatrix rows are 16 bytes
+// apart with a padding word after each vector, so a row loads as one register and only
+// its xyz lanes are ever stored back. A lone CVector is 12 bytes and goes through
+// SimdLoad3/SimdStore3.
+
+#include <cstdint>
+
+#if !defined(SIMD_MATH_SCALAR) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define SIMD_MATH_NEON 1
+#include <arm_neon.h>
+typedef float32x4_t simd4f;
+#elif !defined(SIMD_MATH_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+#define SIMD_MATH_SSE 1
+#include <emmintrin.h>
+typedef __m128 simd4f;
+#else
+#define SIMD_MATH_REF 1
+#include <cstring>
+struct simd4f { float v[4]; };
+#endif
+
+// Comparisons return lane masks in a simd4f, all bits set where true, for SimdAnd/SimdOr and SimdMask.
+
+// p must have 16 readable bytes, w is cleared
+inline simd4f SimdLoadRow(const float* p)
+{
+#if SIMD_MATH_NEON
+    return vsetq_lane_f32(0.0f, vld1q_f32(p), 3);
+#elif SIMD_MATH_SSE
+    return _mm_and_ps(_mm_loadu_ps(p), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+#else
+    return { { p[0], p[1], p[2], 0.0f } };
+#endif
+}
+
+inline simd4f SimdLoad4(const float* p)
+{
+#if SIMD_MATH_NEON
+    return vld1q_f32(p);
+#elif SIMD_MATH_SSE
+    return _mm_loadu_ps(p);
+#else
+    return { { p[0], p[1], p[2], p[3] } };
+#endif
+}
+
+inline simd4f SimdLoad3(const float* p)
+{
+#if SIMD_MATH_NEON
+    return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0.0f), 0));
+#elif SIMD_MATH_SSE
+    return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((const double*)p)), _mm_load_ss(p + 2));
+#else
+    return { { p[0], p[1], p[2], 0.0f } };
+#endif
+}
+
+inline void SimdStore3(float* p, simd4f v)
+{
+#if SIMD_MATH_NEON
+    vst1_f32(p, vget_low_f32(v));
+    vst1q_lane_f32(p + 2, v, 2);
+#elif SIMD_MATH_SSE
+    _mm_store_sd((double*)p, _mm_castps_pd(v));
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+#else
+    p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2];
+#endif
+}
+
+inline void SimdStore4(float* p, simd4f v)
+{
+#if SIMD_MATH_NEON
+    vst1q_f32(p, v);
+#elif SIMD_MATH_SSE
+    _mm_storeu_ps(p, v);
+#else
+    p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2]; p[3] = v.v[3];
+#endif
+}
+
+inline simd4f SimdSplat(float f)
+{
+#if SIMD_MATH_NEON
+    return vdupq_n_f32(f);
+#elif SIMD_MATH_SSE
+    return _mm_set1_ps(f);
+#else
+    return { { f, f, f, f } };
+#endif
+}
+
+inline simd4f SimdAdd(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vaddq_f32(a, b);
+#elif SIMD_MATH_SSE
+    return _mm_add_ps(a, b);
+#else
+    return { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } };
+#endif
+}
+
+inline simd4f SimdSub(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vsubq_f32(a, b);
+#elif SIMD_MATH_SSE
+    return _mm_sub_ps(a, b);
+#else
+    return { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } };
+#endif
+}
+
+inline simd4f SimdMul(simd4f a, float f)
+{
+#if SIMD_MATH_NEON
+    return vmulq_n_f32(a, f);
+#elif SIMD_MATH_SSE
+    return _mm_mul_ps(a, _mm_set1_ps(f));
+#else
+    return { { a.v[0] * f, a.v[1] * f, a.v[2] * f, a.v[3] * f } };
+#endif
+}
+
+inline simd4f SimdMul(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vmulq_f32(a, b);
+#elif SIMD_MATH_SSE
+    return _mm_mul_ps(a, b);
+#else
+    return { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } };
+#endif
+}
+
+#if SIMD_MATH_REF
+inline simd4f SimdRefBits(const uint32_t (&u)[4])
+{
+    simd4f r;
+    memcpy(r.v, u, sizeof(r.v));
+    return r;
+}
+
+inline void SimdRefBits(simd4f a, uint32_t (&u)[4])
+{
+    memcpy(u, a.v, sizeof(u));
+}
+#endif
+
+inline simd4f SimdCmpLe(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vreinterpretq_f32_u32(vcleq_f32(a, b));
+#elif SIMD_MATH_SSE
+    return _mm_cmple_ps(a, b);
+#else
+    uint32_t u[4];
+    for (int i = 0; i < 4; i++) u[i] = a.v[i] <= b.v[i] ? 0xFFFFFFFFu : 0u;
+    return SimdRefBits(u);
+#endif
+}
+
+inline simd4f SimdCmpLt(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vreinterpretq_f32_u32(vcltq_f32(a, b));
+#elif SIMD_MATH_SSE
+    return _mm_cmplt_ps(a, b);
+#else
+    uint32_t u[4];
+    for (int i = 0; i < 4; i++) u[i] = a.v[i] < b.v[i] ? 0xFFFFFFFFu : 0u;
+    return SimdRefBits(u);
+#endif
+}
+
+inline simd4f SimdAnd(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#elif SIMD_MATH_SSE
+    return _mm_and_ps(a, b);
+#else
+    uint32_t ua[4], ub[4];
+    SimdRefBits(a, ua);
+    SimdRefBits(b, ub);
+    for (int i = 0; i < 4; i++) ua[i] &= ub[i];
+    return SimdRefBits(ua);
+#endif
+}
+
+inline simd4f SimdOr(simd4f a, simd4f b)
+{
+#if SIMD_MATH_NEON
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#elif SIMD_MATH_SSE
+    return _mm_or_ps(a, b);
+#else
+    uint32_t ua[4], ub[4];
+    SimdRefBits(a, ua);
+    SimdRefBits(b, ub);
+    for (int i = 0; i < 4; i++) ua[i] |= ub[i];
+    return SimdRefBits(ua);
+#endif
+}
+
+// a with its sign flipped in the lanes where s is negative, exact like a multiply by -1
+inline simd4f SimdFlipSign(simd4f a, simd4f s)
+{
+#if SIMD_MATH_NEON
+    uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(s), vdupq_n_u32(0x80000000u));
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), sign));
+#elif SIMD_MATH_SSE
+    return _mm_xor_ps(a, _mm_and_ps(s, _mm_set1_ps(-0.0f)));
+#else
+    uint32_t ua[4], us[4];
+    SimdRefBits(a, ua);
+    SimdRefBits(s, us);
+    for (int i = 0; i < 4; i++) ua[i] ^= us[i] & 0x80000000u;
+    return SimdRefBits(ua);
+#endif
+}
+
+inline simd4f SimdAbs(simd4f a)
+{
+    return SimdFlipSign(a, a);
+}
+
+// bit i set when lane i of a mask is set
+inline int SimdMask(simd4f m)
+{
+#if SIMD_MATH_NEON
+    static const int32_t shifts[4] = { 0, 1, 2, 3 };
+    uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(m), 31), vld1q_s32(shifts));
+    uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return (int)vget_lane_u32(vpadd_u32(sum, sum), 0);
+#elif SIMD_MATH_SSE
+    return _mm_movemask_ps(m);
+#else
+    uint32_t u[4];
+    SimdRefBits(m, u);
+    return (int)((u[0] >> 31) | ((u[1] >> 31) << 1) | ((u[2] >> 31) << 2) | ((u[3] >> 31) << 3));
+#endif
+}
+
+// four int16s converted exactly
+inline simd4f SimdLoadInt16x4(const int16_t* p)
+{
+#if SIMD_MATH_NEON
+    return vcvtq_f32_s32(vmovl_s16(vld1_s16(p)));
+#elif SIMD_MATH_SSE
+    __m128i v = _mm_loadl_epi64((const __m128i*)p);
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+#else
+    return { { (float)p[0], (float)p[1], (float)p[2], (float)p[3] } };
+#endif
+}
+
+// (a0, a1, a2, a3) -> (a3, a0, a1, a2)
+inline simd4f SimdRotateRight(simd4f a)
+{
+#if SIMD_MATH_NEON
+    return vextq_f32(a, a, 3);
+#elif SIMD_MATH_SSE
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 1, 0, 3));
+#else
+    return { { a.v[3], a.v[0], a.v[1], a.v[2] } };
+#endif
+}
+
+// x * a + y * b + z * c, the columns of a 3x3 matrix combined by a vector
+inline simd4f SimdCombine3(simd4f a, simd4f b, simd4f c, float x, float y, float z)
+{
+    return SimdAdd(SimdAdd(SimdMul(a, x), SimdMul(b, y)), SimdMul(c, z));
+}
+
+// rows a, b, c of a 3x3 matrix become its columns, w lanes are zero
+inline void SimdTranspose3(simd4f& a, simd4f& b, simd4f& c)
+{
+#if SIMD_MATH_NEON
+    float32x4x2_t ab = vtrnq_f32(a, b);                     // a0 b0 a2 b2 | a1 b1 a3 b3
+    float32x4x2_t cz = vtrnq_f32(c, vdupq_n_f32(0.0f));     // c0 0 c2 0  | c1 0 c3 0
+    a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cz.val[0]));
+    b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cz.val[1]));
+    c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cz.val[0]));
+#elif SIMD_MATH_SSE
+    __m128 d = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+#else
+    simd4f ra = a, rb = b, rc = c;
+    a = { { ra.v[0], rb.v[0], rc.v[0], 0.0f } };
+    b = { { ra.v[1], rb.v[1], rc.v[1], 0.0f } };
+    c = { { ra.v[2], rb.v[2], rc.v[2], 0.0f } };
+#endif
+}
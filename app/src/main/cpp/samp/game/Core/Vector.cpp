@@ -9,6 +9,7 @@
 #include "Vector2D.h"
 #include "game/General.h"
 #include "Matrix.h"
+#include "SimdMath.h"
 
 void CVector::InjectHooks()
 {
@@ -212,12 +213,9 @@ float DotProduct2D(const CVector& v1, const CVector& v2)
 // NOTE: This function doesn't add m.GetPosition() like
 //       MultiplyMatrixWithVector @ 0x59C890 does.
 CVector Multiply3x3(const CMatrix& constm, const CVector& v) {
-    auto& m = const_cast<CMatrix&>(constm);
-    return {
-            m.GetRight().x * v.x + m.GetForward().x * v.y + m.GetUp().x * v.z,
-            m.GetRight().y * v.x + m.GetForward().y * v.y + m.GetUp().y * v.z,
-            m.GetRight().z * v.x + m.GetForward().z * v.y + m.GetUp().z * v.z,
-    };
+    CVector result;
+    SimdStore3(&result.x, SimdCombine3(SimdLoadRow(&constm.m_right.x), SimdLoadRow(&constm.m_forward.x), SimdLoadRow(&constm.m_up.x), v.x, v.y, v.z));
+    return result;
 }
 
 CVector MultiplyMatrixWithVector(const CMatrix& mat, const CVector& vec) {
@@ -226,10 +224,13 @@ CVector MultiplyMatrixWithVector(const CMatrix& mat, const CVector& vec) {
 
 // vector by matrix mult, resulting in a vector where each component is the dot product of the in vector and a matrix direction
 CVector Multiply3x3(const CVector& v, const CMatrix& constm) {
-    auto& m = const_cast<CMatrix&>(constm);
-    return {
-            DotProduct(m.GetRight(), v),
-            DotProduct(m.GetForward(), v),
-            DotProduct(m.GetUp(), v)
-    };
+    // the dot products with the rows are the transposed rows combined by v
+    simd4f right = SimdLoadRow(&constm.m_right.x);
+    simd4f forward = SimdLoadRow(&constm.m_forward.x);
+    simd4f up = SimdLoadRow(&constm.m_up.x);
+    SimdTranspose3(right, forward, up);
+
+    CVector result;
+    SimdStore3(&result.x, SimdCombine3(right, forward, up, v.x, v.y, v.z));
+    return result;
 }
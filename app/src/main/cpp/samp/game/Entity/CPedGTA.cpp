@@ -155,7 +155,7 @@ CPedGTA::~CPedGTA() {
     CHook::CallFunction<void>(g_libGTASA + (VER_x32 ? 0x49F6A4 + 1 : 0x59541C), this);
 }
 
-void CPedGTA::GiveWeapon(int iWeaponID, int iAmmo)
+void CPedGTA::GiveWeapon(int iWeaponID, int iAmmo, bool bSetCurrent)
 {
     int iModelID = 0;
     iModelID = GameGetWeaponModelIDFromWeaponID(iWeaponID);
@@ -163,11 +163,11 @@ void CPedGTA::GiveWeapon(int iWeaponID, int iAmmo)
 
     if (iModelID == -1 || iModelID == 350 || iModelID == 365) return;
 
-    if (!CStreaming::TryLoadModel(iModelID))
-        return;
+    if (!CStreaming::GetInfo(iModelID).IsLoaded()) return;
 
     CHook::CallFunction<void>(g_libGTASA + (VER_x32 ? 0x0049F588 + 1 : 0x59525C), this, iWeaponID, iAmmo); // CPed::GiveWeapon(thisptr, weapoid, ammo)
-    CHook::CallFunction<void>(g_libGTASA + (VER_x32 ? 0x004A521C + 1 : 0x59B86C), this, iWeaponID);	// CPed::SetCurrentWeapon(thisptr, weapid)
+    if (bSetCurrent)
+        CHook::CallFunction<void>(g_libGTASA + (VER_x32 ? 0x004A521C + 1 : 0x59B86C), this, iWeaponID);	// CPed::SetCurrentWeapon(thisptr, weapid)
 }
 
 void CPedGTA::RemoveFromVehicle()
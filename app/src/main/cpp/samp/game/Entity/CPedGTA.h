@@ -337,7 +337,8 @@ public:
     bool IsEnteringCar();
     bool IsExitingVehicle();
 
-    void GiveWeapon(int iWeaponID, int iAmmo);
+    // the weapon's model must be resident, CPlayerPed::GiveWeapon waits for it
+    void GiveWeapon(int iWeaponID, int iAmmo, bool bSetCurrent = true);
 
     void RemoveFromVehicle();
 };
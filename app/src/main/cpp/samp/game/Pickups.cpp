@@ -14,8 +14,18 @@ extern CNetGame* pNetGame;
 void CPickups::InjectHooks() {
 }
 
+static std::array<CPickup, MAX_NUM_PICKUPS>& GetPickupArray() {
+    return *(std::array<CPickup, MAX_NUM_PICKUPS>*)(g_libGTASA + (VER_x32 ? 0x007AFD70 : 0x991AB8));
+}
+
+CPickup* CPickups::GetPickup(int32 index) {
+    if (index < 0 || index >= (int32)MAX_NUM_PICKUPS)
+        return nullptr;
+    return &GetPickupArray()[index];
+}
+
 void CPickups::Update() {
-    static std::array<CPickup, MAX_NUM_PICKUPS>& aPickUps = *(std::array<CPickup, MAX_NUM_PICKUPS>*)(g_libGTASA + (VER_x32 ? 0x007AFD70 : 0x991AB8));
+    static std::array<CPickup, MAX_NUM_PICKUPS>& aPickUps = GetPickupArray();
 
     auto start = 620 * (CTimer::GetFrameCounter() % 32) / 32;
     auto end   = 620 * (CTimer::GetFrameCounter() % 32 + 1) / 32;
@@ -32,10 +42,8 @@ void CPickups::Update() {
                     CWorld::Add(obj);
                 }
             }
-            if (pickup.Update()) {
-                CPickupPool *pPickups = pNetGame->GetPickupPool();
-                pPickups->PickedUp( i );
-            }
+            // collection is reported by CPickupPool::Process, every frame rather than every 32nd
+            pickup.Update();
         } else {
             pickup.GetRidOfObjects();
         }
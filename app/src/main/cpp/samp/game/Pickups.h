@@ -80,6 +80,8 @@ public:
     static bool TestForPickupsInBubble(const CVector posn, float radius);
     static bool TryToMerge_WeaponType(CVector posn, eWeaponType weaponType, ePickupType pickupType, uint32 ammo, bool arg4);
     static void Update();
+    // NOTSA, the game's pickup slot, nullptr out of range
+    static CPickup* GetPickup(int32 index);
     static void UpdateMoneyPerDay(tPickupReference pickupRef, uint16 money);
     static eWeaponType WeaponForModel(int32 modelId);
     static void Load();
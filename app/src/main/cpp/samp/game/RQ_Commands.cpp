@@ -9,6 +9,7 @@
 
 #include "RQ_Commands.h"
 #include "../vendor/armhook/patch.h"
+#include "../threadplacement.h"
 
 bool RQCaps[16];
 
@@ -99,6 +100,9 @@ bool RQCaps[16];
 
 void CRQ_Commands::rqVertexBufferSelect(uintptr_t **qData)
 {
+    // NOTSA: the first of our commands the render queue runs, every frame; placed once
+    CThreadPlacement::Register(THREAD_ROLE_RENDER);
+
     if (!qData || !*qData)
     {
         glBindBuffer(0x8892, 0);
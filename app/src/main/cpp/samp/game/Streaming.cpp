@@ -15,33 +15,178 @@
 #include "Camera.h"
 #include "Renderer.h"
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <vector>
 #include <iostream>
 
 extern UI *pUI;
+extern CNetGame *pNetGame;
+
+class CStreamingModelLoader : public IModelLoader
+{
+public:
+    bool IsModelLoaded(int iModel) override {
+        return CStreaming::GetInfo(iModel).IsLoaded();
+    }
+    void RequestModel(int iModel) override {
+        CStreaming::RequestModel(iModel, STREAMING_GAME_REQUIRED | STREAMING_KEEP_IN_MEMORY);
+    }
+};
+
+CModelRequests& CStreaming::GetModelRequests() {
+    static CStreamingModelLoader loader;
+    static CModelRequests requests(&loader);
+    return requests;
+}
+
+class CStreamingModelCacheStore : public IModelCacheStore
+{
+public:
+    size_t GetMemoryUsed() override {
+        return CStreaming::ms_memoryUsed;
+    }
+    bool IsResident(int iModel) override {
+        return CStreaming::GetInfo(iModel).IsLoaded();
+    }
+    bool CanEvict(int iModel) override {
+        if (iModel == MODEL_MALE01)
+            return false;
+
+        auto& info = CStreaming::GetInfo(iModel);
+        if (!info.IsLoaded())
+            return false;
+
+        // RemoveLeastUsedModel only walks the loaded list, which models with these flags are never on
+        if (info.AreAnyFlagsSetOutOf(STREAMING_KEEP_IN_MEMORY | STREAMING_MISSION_REQUIRED | STREAMING_GAME_REQUIRED))
+            return false;
+        if (CStreaming::GetModelRequests().IsModelQueued(iModel))
+            return false;
+
+        switch (GetModelType(iModel)) {
+            case eModelType::DFF:
+                return !CModelInfo::GetModelInfo(iModel)->m_nRefCount;
+            case eModelType::IFP: {
+                const auto animBlockId = ModelIdToIFP(iModel);
+                return !CAnimManager::GetNumRefsToAnimBlock(animBlockId) && !CStreaming::AreAnimsUsedByRequestedModels(animBlockId);
+            }
+            default:
+                return false;
+        }
+    }
+    void Evict(int iModel) override {
+        CStreaming::RemoveModel(iModel);
+    }
+    uint64_t GetTimeMicros() override {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+CModelCache& CStreaming::GetModelCache() {
+    static CStreamingModelCacheStore store;
+    static CModelCache cache(&store);
+    return cache;
+}
+
+static void AddPin(std::vector<int>& pins, int modelId) {
+    if (modelId > 0 && modelId < RESOURCE_ID_TXD)
+        pins.push_back(modelId);
+}
+
+static void CollectPoolModels(std::vector<int>& pins) {
+    pins.clear();
+    if (!pNetGame)
+        return;
+
+    if (auto pObjectPool = pNetGame->GetObjectPool()) {
+        for (OBJECTID i = 0; i < MAX_OBJECTS; i++) {
+            auto pObject = pObjectPool->GetAt(i);
+            if (pObject && pObject->m_pEntity)
+                AddPin(pins, pObject->m_pEntity->m_nModelIndex);
+        }
+    }
+
+    if (auto pVehiclePool = pNetGame->GetVehiclePool()) {
+        for (VEHICLEID i = 0; i < MAX_VEHICLES; i++) {
+            auto pVehicle = pVehiclePool->GetAt(i);
+            if (pVehicle && pVehicle->m_pVehicle)
+                AddPin(pins, pVehicle->m_pVehicle->m_nModelIndex);
+        }
+    }
+
+    if (auto pPlayerPool = pNetGame->GetPlayerPool()) {
+        for (PLAYERID i = 0; i < MAX_PLAYERS; i++) {
+            auto pPlayer = pPlayerPool->GetAt(i);
+            if (pPlayer && pPlayer->GetPlayerPed() && pPlayer->GetPlayerPed()->m_pPed)
+                AddPin(pins, pPlayer->GetPlayerPed()->m_pPed->m_nModelIndex);
+        }
+
+        auto pLocalPlayer = pPlayerPool->GetLocalPlayer();
+        if (pLocalPlayer && pLocalPlayer->GetPlayerPed() && pLocalPlayer->GetPlayerPed()->m_pPed)
+            AddPin(pins, pLocalPlayer->GetPlayerPed()->m_pPed->m_nModelIndex);
+    }
+
+    if (auto pActorPool = pNetGame->GetActorPool()) {
+        for (PLAYERID i = 0; i < MAX_ACTORS; i++) {
+            auto pActor = pActorPool->GetAt(i);
+            if (pActor && pActor->m_pPed)
+                AddPin(pins, pActor->m_pPed->m_nModelIndex);
+        }
+    }
+}
+
+void CStreaming::UpdateModelCache() {
+    CModelCache& cache = GetModelCache();
+
+    // pool references change slowly, a rescan twice a second is plenty
+    static uint32_t dwLastPinScan = 0;
+    static std::vector<int> pins;
+    if (CTimer::m_snTimeInMillisecondsNonClipped - dwLastPinScan >= MODEL_CACHE_PIN_INTERVAL) {
+        dwLastPinScan = CTimer::m_snTimeInMillisecondsNonClipped;
+        CollectPoolModels(pins);
+        cache.SetPins(pins);
+    }
+
+    // the game loads and uses most models without going through us, a rolling
+    // sweep admits what became resident and refreshes what is in use
+    static int iSweep = 0;
+    for (int i = 0; i < MODEL_CACHE_SWEEP; i++, iSweep++) {
+        if (iSweep >= RESOURCE_ID_TXD && iSweep < RESOURCE_ID_IFP)
+            iSweep = RESOURCE_ID_IFP;
+        if (iSweep >= RESOURCE_ID_RRR)
+            iSweep = 0;
+
+        if (!GetInfo(iSweep).IsLoaded()) {
+            cache.Forget(iSweep);
+            continue;
+        }
+
+        bool bInUse = IsModelDFF(iSweep)
+            ? CModelInfo::GetModelInfo(iSweep)->m_nRefCount > 0
+            : CAnimManager::GetNumRefsToAnimBlock(ModelIdToIFP(iSweep)) > 0;
+        cache.Observe(iSweep, bInUse);
+    }
+
+    cache.Trim(ms_memoryAvailable / 100 * MODEL_CACHE_BUDGET_PERCENT, MODEL_CACHE_TIME_BUDGET);
+}
 
 bool CStreaming::TryLoadModel(int modelId) {
+    if(CStreaming::GetInfo(modelId).IsLoaded())
+        return true;
+
     FLog("TryLoadModel %d", modelId);
-    if(!CStreaming::GetInfo(modelId).IsLoaded()) {
-        FLog("TryLoadModel 1");
-        CStreaming::RequestModel(modelId, STREAMING_GAME_REQUIRED | STREAMING_KEEP_IN_MEMORY);
-        FLog("TryLoadModel 11");
+    CStreaming::RequestModel(modelId, STREAMING_GAME_REQUIRED | STREAMING_KEEP_IN_MEMORY);
+
+    // loading runs on this thread, sleeping doesn't bring the model any closer.
+    // a big model needs a second pass to finish
+    for (int i = 0; i < 2 && !CStreaming::GetInfo(modelId).IsLoaded(); i++) {
         CStreaming::LoadAllRequestedModels(false);
-        FLog("TryLoadModel 2");
-        uint32 count = 0;
-        while (!CStreaming::GetInfo(modelId).IsLoaded()) {
-            count++;
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
-            if (count > 30) {
-                pUI->chat()->addDebugMessage("{ff0000} Error loading model %d", modelId);
-                return false;
-            }
-        }
-        FLog("TryLoadModel 3");
     }
-    FLog("TryLoadModel 4");
+
+    if (!CStreaming::GetInfo(modelId).IsLoaded()) {
+        pUI->chat()->addDebugMessage("{ff0000} Error loading model %d", modelId);
+        return false;
+    }
     return true;
 }
 
@@ -272,6 +417,9 @@ void CStreaming::InitImageList() {
 void CStreaming::RequestModel(int32 modelId, int32 streamingFlags) {
     CStreamingInfo& info = GetInfo(modelId);
 
+    if (IsModelDFF(modelId) || IsModelIFP(modelId))
+        GetModelCache().Access(modelId);
+
     switch (info.m_nLoadState) {
         case eStreamingLoadState::LOADSTATE_NOT_LOADED:
             break;
@@ -357,8 +505,8 @@ void CStreaming::AddModelsToRequestList(const CVector* point, int32 streamingFla
 }
 
 #include "Textures/TextureDatabaseRuntime.h"
-extern CNetGame *pNetGame;
 void CStreaming::Update() {
+    PROFILE_SCOPE("CStreaming::Update");
 
     if (CTimer::GetIsPaused())
         return;
@@ -369,8 +517,7 @@ void CStreaming::Update() {
     }
     CModelInfo::GetModelInfo(MODEL_MALE01)->m_nRefCount = 999;
 
-    if(CTimer::m_snTimeInMillisecondsNonClipped % 100 == 0)
-        RemoveLeastUsedModel(STREAMING_KEEP_IN_MEMORY);
+    UpdateModelCache();
 
 
     static double previousTime{};
@@ -401,11 +548,18 @@ void CStreaming::Update() {
 //            m_bBoatsNeeded = ThePaths.IsWaterNodeNearby(camPos, 80.0f);
 //        }
 //    }
+    // hands this frame's share of queued models to the streamer and completes the resident ones
+    GetModelRequests().Process(CTimer::m_snTimeInMillisecondsNonClipped);
+
     if(!pNetGame || !pNetGame->GetPlayerPool()->GetLocalPlayer())
         return;
 
     auto pLocalPed = pNetGame->GetPlayerPool()->GetLocalPlayer()->GetPlayerPed()->m_pPed;
     const CVector& playerPos = pLocalPed->GetPosition();
+
+    // models ahead of the player, queued before this frame's loading below
+    if (auto pPrefetch = pNetGame->GetPrefetchService())
+        pPrefetch->Process(CTimer::m_snTimeInMillisecondsNonClipped, playerPos);
 //    if (!ms_disableStreaming
 //        && !CCutsceneMgr::IsCutsceneProcessing()
 //        && CGame::CanSeeOutSideFromCurrArea()
@@ -888,6 +1042,9 @@ void CStreaming::RetryLoadFile(int32 chIdx) {
 }
 
 void CStreaming::MakeSpaceFor(size_t memoryToCleanInBytes) {
+    // least recently used unpinned models first, the old walk takes what's left
+    GetModelCache().Trim(ms_memoryAvailable - memoryToCleanInBytes, MODEL_CACHE_TIME_BUDGET);
+
     auto lastmemused = ms_memoryUsed;
     while (ms_memoryUsed >= ms_memoryAvailable - memoryToCleanInBytes) {
         lastmemused = ms_memoryUsed;
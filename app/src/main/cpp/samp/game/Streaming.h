@@ -12,6 +12,8 @@
 #include "CdStreamInfo.h"
 #include "game/Core/LinkList.h"
 #include "StreamingInfo.h"
+#include "modelrequests.h"
+#include "modelcache.h"
 #include "game/Enums/eAreaCodes.h"
 #include "main.h"
 #include "Timer.h"
@@ -215,7 +217,13 @@ public:
     static void InitImageList();
 
     static char* GetModelCDName(int32 index);
+    // blocking, for callers that need the model right now; entities should use GetModelRequests()
     static bool TryLoadModel(int modelId);
+    // queued non-blocking requests, processed from Update()
+    static CModelRequests& GetModelRequests();
+    // LRU order and pins of resident models, trimmed to a memory budget from Update()
+    static CModelCache& GetModelCache();
+    static void UpdateModelCache();
     static void RemoveModel(int32 modelId);
     static void RemoveTxdModel(int32 modelId);
     static void RequestModel(int32 modelId, int32 flags = STREAMING_GAME_REQUIRED);
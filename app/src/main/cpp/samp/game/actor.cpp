@@ -7,22 +7,23 @@ extern CGame* pGame;
 // 0.3.7
 CActor::CActor(int iSkin, float fX, float fY, float fZ, float fAngle)
 {
-    if (!CStreaming::TryLoadModel(iSkin))
-        throw std::runtime_error("Model not loaded");
-
     if (!IsValidPedModel(iSkin))
     {
         iSkin = 0;
     }
 
-    ScriptCommand(&create_actor, 5, iSkin, fX, fY, fZ, &m_dwGTAId);
+    // CActorPool waits for the model, this loads it for other callers and when that wait timed out
+    if (!CStreaming::TryLoadModel(iSkin))
+        throw std::runtime_error("Model not loaded");
+
+    ScriptCommand<create_actor>(5, iSkin, fX, fY, fZ, &m_dwGTAId);
 
     m_pPed = GamePool_Ped_GetAt(m_dwGTAId);
 
     ForceTargetRotation(fAngle);
     m_pPed->SetPosn(fX, fY, fZ);
 
-    ScriptCommand(&set_actor_can_be_decapitated, m_dwGTAId, 0);
+    ScriptCommand<set_actor_can_be_decapitated>(m_dwGTAId, 0);
 }
 // 0.3.7
 CActor::~CActor()
@@ -53,7 +54,7 @@ void CActor::ForceTargetRotation(float fRotation)
     m_pPed->m_fCurrentRotation = DegToRad(fRotation);
     m_pPed->m_fAimingRotation = DegToRad(fRotation);
 
-    ScriptCommand(&set_actor_z_angle, m_dwGTAId, fRotation);
+    ScriptCommand<set_actor_z_angle>(m_dwGTAId, fRotation);
 }
 // 0.3.7
 void CActor::SetHealth(float fHealth)
@@ -68,10 +69,10 @@ void CActor::SetInvulnerable(bool bInvulnerable)
 	m_bInvulnerable = bInvulnerable;
 
 	if (bInvulnerable) {
-		ScriptCommand(&set_actor_immunities, m_dwGTAId, 1, 1, 1, 1, 1);
+		ScriptCommand<set_actor_immunities>(m_dwGTAId, 1, 1, 1, 1, 1);
 	}
 	else {
-		ScriptCommand(&set_actor_immunities, m_dwGTAId, 0, 0, 0, 0, 0);
+		ScriptCommand<set_actor_immunities>(m_dwGTAId, 0, 0, 0, 0, 0);
 	}
 }
 // 0.3.7 (adapted)
@@ -86,11 +87,11 @@ void CActor::ApplyAnimation(const char* szAnimName, const char* szAnimLib, float
 	if (!pGame->IsAnimationLoaded(szAnimLib)) {
 		pGame->RequestAnimation(szAnimLib);
 
-        ScriptCommand(&apply_animation, m_dwGTAId, szAnimName, szAnimLib, fDelta, bLoop, bLockX, bLockY, bFreeze, iTime);
+        ScriptCommand<apply_animation>(m_dwGTAId, szAnimName, szAnimLib, fDelta, bLoop, bLockX, bLockY, bFreeze, iTime);
 		return;
 	}
 
-	ScriptCommand(&apply_animation, m_dwGTAId, szAnimName, szAnimLib, fDelta, bLoop, bLockX, bLockY, bFreeze, iTime);
+	ScriptCommand<apply_animation>(m_dwGTAId, szAnimName, szAnimLib, fDelta, bLoop, bLockX, bLockY, bFreeze, iTime);
 }
 // 0.3.7
 void CActor::ClearAnimation()
@@ -0,0 +1,9 @@
+#pragma once
+
+// Animation names, "BLOCK:anim", in SA-MP's index order (ApplyAnimation and friends)
+
+// nullptr when idx is out of range
+const char* GetAnimByIdx(int idx);
+// case-insensitive, -1 when the name is unknown
+int GetAnimIdxByName(const char* szName);
+bool GetAnimationIndexFromName(const char* szName);
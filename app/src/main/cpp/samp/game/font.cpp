@@ -72,20 +72,23 @@ void CFont::SetDropShadowPosition(uint8_t pos)
 	return ((void(*)(uint8_t))(g_libGTASA + (VER_x32 ? 0x005A8ADC + 1 : 0x6CC8E8)))(pos);
 }
 
-/*
 void CFont::PrintString(float fX, float fY, const uint16_t* szText)
 {
-	return ((void(*)(float, float, const uint16_t*))(g_libGTASA + 0x5353B4 + 1))(fX, fY, szText);
+	return ((void(*)(float, float, const uint16_t*))(g_libGTASA + (VER_x32 ? 0x005AA200 + 1 : 0x6CDEB0)))(fX, fY, szText);
+}
+
+void CFont::RenderFontBuffer()
+{
+	return ((void (*)())(g_libGTASA + (VER_x32 ? 0x005A9120 + 1 : 0x6CCEA0)))();//53411C ; _DWORD CFont::RenderFontBuffer(CFont *__hidden this)
 }
-*/
 
 void CFont::PrintString(float posX, float posY, const char* string)
 {
 	uint16_t* gxt_string = new uint16_t[0xFF];
 	CFont::AsciiToGxtChar(string, gxt_string);
-	((void (*)(float, float, uint16_t*))(g_libGTASA + (VER_x32 ? 0x005AA200 + 1 : 0x6CDEB0)))(posX, posY, gxt_string);
+	CFont::PrintString(posX, posY, gxt_string);
 	delete gxt_string;
-	((void (*)())(g_libGTASA + (VER_x32 ? 0x005A9120 + 1 : 0x6CCEA0)))();//53411C ; _DWORD CFont::RenderFontBuffer(CFont *__hidden this)
+	CFont::RenderFontBuffer();
 }
 
 void CFont::SetFontStyle(uint8_t style)
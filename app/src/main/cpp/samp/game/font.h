@@ -18,6 +18,9 @@ public:
 	static void SetDropColor(uint32_t* dwColor);
 	static void SetDropShadowPosition(uint8_t pos);
 	static void PrintString(float fX, float fY, const char* szText);
+	// queues an already converted string, drawn by the next RenderFontBuffer()
+	static void PrintString(float fX, float fY, const uint16_t* szText);
+	static void RenderFontBuffer();
 	static void SetFontStyle(uint8_t style);
 	static void SetEdge(uint8_t edge);
 };
@@ -133,14 +133,14 @@ void CGame::EnableClock(bool bEnable)
 // 0.3.7
 void CGame::EnableZoneNames(bool bEnable)
 {
-	ScriptCommand(&enable_zone_names, bEnable);
+	ScriptCommand<enable_zone_names>(bEnable);
 }
 // 0.3.7
 void CGame::SetWorldTime(int iHour, int iMinute)
 {
     *(uint8_t*)(g_libGTASA + (VER_x32 ? 0x00953143 : 0xBBBC1B)) = (uint8_t)iMinute;
     *(uint8_t*)(g_libGTASA + (VER_x32 ? 0x00953142 : 0xBBBC1A)) = (uint8_t)iHour;
-    ScriptCommand(&set_current_time, iHour, iMinute);
+    ScriptCommand<set_current_time>(iHour, iMinute);
 }
 // 0.3.7
 void CGame::GetWorldTime(int *iHour, int *iMinute)
@@ -219,7 +219,7 @@ void CGame::UpdateCheckpoints()
 		CPlayerPed* pPlayerPed = this->FindPlayerPed();
 		if (pPlayerPed) 
 		{
-			ScriptCommand(&is_actor_near_point_3d, pPlayerPed->m_dwGTAId,
+			ScriptCommand<is_actor_near_point_3d>(pPlayerPed->m_dwGTAId,
 				m_vecCheckpointPos.x, m_vecCheckpointPos.y, m_vecCheckpointPos.z,
 				m_vecCheckpointExtent.x, m_vecCheckpointExtent.y, m_vecCheckpointExtent.z, 1);
 
@@ -270,17 +270,17 @@ uint8_t CGame::GetPedSlotsUsed()
 
 void CGame::PlaySound(int iSound, float fX, float fY, float fZ)
 {
-	ScriptCommand(&play_sound, fX, fY, fZ, iSound);
+	ScriptCommand<play_sound>(fX, fY, fZ, iSound);
 }
 // 0.3.7
 void CGame::RefreshStreamingAt(float x, float y)
 {
-	ScriptCommand(&refresh_streaming_at, x, y);
+	ScriptCommand<refresh_streaming_at>(x, y);
 }
 // 0.3.7
 void CGame::DisableTrainTraffic()
 {
-	ScriptCommand(&enable_train_traffic, 0);
+	ScriptCommand<enable_train_traffic>(0);
 }
 // 0.3.7
 void CGame::UpdateGlobalTimer(uint32_t dwTimer)
@@ -325,7 +325,7 @@ uint32_t CGame::CreatePickup(int iModel, int iType, float x, float y, float z, i
     if(dwModelArray[iModel] == nullptr)
         iModel = 18631; // вопросик
 
-    ScriptCommand(&create_pickup, iModel, iType, x, y, z, &hnd);
+    ScriptCommand<create_pickup>(iModel, iType, x, y, z, &hnd);
 
     int lol = 32 * (uint16_t)hnd;
     if(lol) lol /= 32;
@@ -340,7 +340,7 @@ bool CGame::IsModelLoaded(int iModel)
 		return true;
 	}
 	else {
-		return ScriptCommand(&is_model_available, iModel);
+		return ScriptCommand<is_model_available>(iModel);
 	}
 }
 // 0.3.7
@@ -349,12 +349,12 @@ void CGame::RequestModel(uint16_t iModelId, uint8_t iLoadingStream)
 	// CStreaming::RequestModel
 	//(( void (*)(int32_t, int32_t))(g_libGTASA+0x2D292C+1))(iModelId, iLoadingStream);
     //CStreaming::TryLoadModel(iModelId);
-    ScriptCommand(&request_model, iModelId);
+    ScriptCommand<request_model>(iModelId);
 }
 // 0.3.7
 void CGame::LoadRequestedModels()
 {
-	ScriptCommand(&load_requested_models);
+	ScriptCommand<load_requested_models>();
 }
 // 0.3.7
 void CGame::RemoveModel(int iModel, bool bFromStreaming)
@@ -363,14 +363,14 @@ void CGame::RemoveModel(int iModel, bool bFromStreaming)
 	{
 		if (bFromStreaming)
 		{
-			if(ScriptCommand(&is_model_available, iModel))
+			if(ScriptCommand<is_model_available>(iModel))
 				// CStreaming::RemoveModel x64	0000000000391FF0 x32 002D0128
 				((void(*)(int))(g_libGTASA + (VER_x32 ? 0x2D0128 + 1 : 0x391FF0)))(iModel);
 		}
 		else
 		{
-			if (ScriptCommand(&is_model_available, iModel))
-				ScriptCommand(&release_model, iModel);
+			if (ScriptCommand<is_model_available>(iModel))
+				ScriptCommand<release_model>(iModel);
 		}
 	}
 }
@@ -404,7 +404,7 @@ bool CGame::RemovePlayer(CPlayerPed* pPed)
 // 0.3.7
 void CGame::DisableMarker(uint32_t dwMarker)
 {
-	ScriptCommand(&disable_marker, dwMarker);
+	ScriptCommand<disable_marker>(dwMarker);
 }
 // 0.3.7
 uint32_t CGame::CreateRadarMarkerIcon(uint8_t byteType, float fPosX, float fPosY, float fPosZ, uint32_t dwColor, uint8_t byteStyle)
@@ -412,25 +412,25 @@ uint32_t CGame::CreateRadarMarkerIcon(uint8_t byteType, float fPosX, float fPosY
     uintptr dwMarkerID = 0;
 
     if(byteStyle == 1)
-        ScriptCommand(&create_marker_icon, fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
+        ScriptCommand<create_marker_icon>(fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
     else if(byteStyle == 2)
-        ScriptCommand(&create_radar_marker_icon, fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
+        ScriptCommand<create_radar_marker_icon>(fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
     else if(byteStyle == 3)
-        ScriptCommand(&create_icon_marker_sphere, fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
+        ScriptCommand<create_icon_marker_sphere>(fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
     else
-        ScriptCommand(&create_radar_marker_without_sphere, fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
+        ScriptCommand<create_radar_marker_without_sphere>(fPosX, fPosY, fPosZ, byteType, &dwMarkerID);
 
     if(byteType == 0)
     {
         if(dwColor >= 1004)
         {
-            ScriptCommand(&set_marker_color, dwMarkerID, dwColor);
-            ScriptCommand(&show_on_radar, dwMarkerID, 3);
+            ScriptCommand<set_marker_color>(dwMarkerID, dwColor);
+            ScriptCommand<show_on_radar>(dwMarkerID, 3);
         }
         else
         {
-            ScriptCommand(&set_marker_color, dwMarkerID, dwColor);
-            ScriptCommand(&show_on_radar, dwMarkerID, 2);
+            ScriptCommand<set_marker_color>(dwMarkerID, dwColor);
+            ScriptCommand<show_on_radar>(dwMarkerID, 2);
         }
     }
 
@@ -439,18 +439,18 @@ uint32_t CGame::CreateRadarMarkerIcon(uint8_t byteType, float fPosX, float fPosY
 // 0.3.7
 bool CGame::IsAnimationLoaded(const char* szAnimLib)
 {
-	return ScriptCommand(&is_animation_loaded, szAnimLib);
+	return ScriptCommand<is_animation_loaded>(szAnimLib);
 }
 // 0.3.7
 void CGame::RequestAnimation(const char* szAnimLib)
 {
-	ScriptCommand(&request_animation, szAnimLib);
+	ScriptCommand<request_animation>(szAnimLib);
 }
 // 0.3.7
 float CGame::FindGroundZForCoord(float fX, float fY, float fZ)
 {
     float fGroundZ;
-    ScriptCommand(&get_ground_z, fX, fY, fZ, &fGroundZ);
+    ScriptCommand<get_ground_z>(fX, fY, fZ, &fGroundZ);
     return fGroundZ;
 }
 // 0.3.7
@@ -537,7 +537,7 @@ void CGame::MakeRaceCheckpoint()
 {
 	DisableRaceCheckpoint();
 
-	ScriptCommand(&create_racing_checkpoint, (int)m_byteRaceType,
+	ScriptCommand<create_racing_checkpoint>((int)m_byteRaceType,
 		m_vecRaceCheckpointPos.x, m_vecRaceCheckpointPos.y, m_vecRaceCheckpointPos.z,
 		m_vecRaceCheckpointNextPos.x, m_vecRaceCheckpointNextPos.y, m_vecRaceCheckpointNextPos.z,
 		m_fRaceCheckpointRadius, &m_dwRaceCheckpointHandle);
@@ -549,7 +549,7 @@ void CGame::DisableRaceCheckpoint()
 {
 	if (m_dwRaceCheckpointHandle)
 	{
-		ScriptCommand(&destroy_racing_checkpoint, m_dwRaceCheckpointHandle);
+		ScriptCommand<destroy_racing_checkpoint>(m_dwRaceCheckpointHandle);
 		m_dwRaceCheckpointHandle = 0;
 	}
 
@@ -574,7 +574,7 @@ void CGame::EnableStuntBonus(bool bEnable)
 // 0.3.7
 void CGame::DisplayGameText(const char* szStr, int iTime, int iSize)
 {
-    ScriptCommand(&text_clear_all);
+    ScriptCommand<text_clear_all>();
     CFont::AsciiToGxtChar(szStr, szGameTextMessage);
 
     // CMessages::AddBigMesssage
@@ -583,7 +583,7 @@ void CGame::DisplayGameText(const char* szStr, int iTime, int iSize)
 // 0.3.7
 void CGame::AddToLocalMoney(int iAmmount)
 {
-	ScriptCommand(&add_to_player_money, 0, iAmmount);
+	ScriptCommand<add_to_player_money>(0, iAmmount);
 }
 // 0.3.7
 void CGame::ResetLocalMoney()
@@ -775,6 +775,7 @@ void CGame::Process() {
 
         CObjectPool* pObjectPool = pNetGame->GetObjectPool();
         if (pObjectPool) {
+            PROFILE_SCOPE("CObjectPool::Process");
             pObjectPool->Process();
             pObjectPool->ProcessMaterialText();
         }
@@ -226,6 +226,10 @@ void Render2dStuff()
     CHook::CallFunction<void>("_ZN15CTouchInterface7DrawAllEb", false);
 
     if (pUI) pUI->render();
+
+    CJobSystem::EndFrame();
+    CFrameArena::EndFrame();
+    PROFILE_END_FRAME();
 }
 
 /* =============================================================================== */
@@ -936,7 +940,6 @@ void CRenderer__RenderEverythingBarRoads_hook() {
     CRenderer__RenderEverythingBarRoads();
 }
 
-#include "CFPSFix.h"
 #include "ES2VertexBuffer.h"
 #include "RQ_Commands.h"
 #include "Pickups.h"
@@ -947,16 +950,6 @@ void CRenderer__RenderEverythingBarRoads_hook() {
 #include "RealTimeShadowManager.h"
 #include "game/Widgets/WidgetGta.h"
 
-CFPSFix g_fps;
-
-void (*ANDRunThread)(void* a1);
-void ANDRunThread_hook(void* a1)
-{
-    g_fps.PushThread(gettid());
-
-    ANDRunThread(a1);
-}
-
 static constexpr float ar43 = 4.0f/3.0f;
 float *ms_fAspectRatio;
 void (*DrawCrosshair)(uintptr_t* thiz);
@@ -1232,12 +1225,23 @@ void CTaskSimpleUseGun__SetMoveAnim_hook(uintptr_t *thiz, uintptr_t *a2)
     CTaskSimpleUseGun__SetMoveAnim(thiz, a2);
 }
 
-int (*CAnimManager_UncompressAnimation)(int result);
-int CAnimManager_UncompressAnimation_hook(int result)
+#include "game/Animation/AnimLod.h"
+void (*_RpAnimBlendClumpUpdateAnimations)(RpClump* clump, float step, bool onScreen);
+void RpAnimBlendClumpUpdateAnimations_hook(RpClump* clump, float step, bool onScreen)
 {
-    if ( result )
-        return CAnimManager_UncompressAnimation(result);
-    return 0;
+    if (CAnimLod::IsEnabled() && clump)
+    {
+        CCamera& TheCamera = *reinterpret_cast<CCamera*>(g_libGTASA + (VER_x32 ? 0x00951FA8 : 0xBBA8D0));
+        RwFrame* frame = RpClumpGetFrame(clump);
+        if (frame)
+        {
+            const CVector& pos = *(CVector*)&RwFrameGetMatrix(frame)->pos;
+            float fDistance = DistanceBetweenPoints(TheCamera.GetPosition(), pos);
+            if (!CAnimLod::Update(clump, fDistance, onScreen, GetTickCount(), step, step))
+                return;
+        }
+    }
+    _RpAnimBlendClumpUpdateAnimations(clump, step, onScreen);
 }
 
 void readVehiclesAudioSettings();
@@ -1298,7 +1302,6 @@ void InstallCrashFixHooks()
     //CHook::InstallPLT(g_libGTASA + 0x6778B0, (uintptr_t)rxOpenGLDefaultAllInOneRenderCB_hook, (uintptr_t*)&rxOpenGLDefaultAllInOneRenderCB);
     //CHook::InstallPLT(g_libGTASA + 0x677CB4, (uintptr_t)CCustomBuildingDNPipeline__CustomPipeRenderCB_hook, (uintptr_t*)&CCustomBuildingDNPipeline__CustomPipeRenderCB);
     //CHook::InstallPLT(g_libGTASA + 0x66F9E8, (uintptr_t)EmuShader_Select_hook, (uintptr_t*)&EmuShader_Select);
-    CHook::InstallPLT(g_libGTASA + 0x6750D4, (uintptr_t)CAnimManager_UncompressAnimation_hook, (uintptr_t*)&CAnimManager_UncompressAnimation);
     //CHook::InstallPLT(g_libGTASA + 0x670E1C, (uintptr_t)CStreaming__MakeSpaceFor_hook, (uintptr_t*)&CStreaming__MakeSpaceFor);
 }
 
@@ -1976,6 +1979,7 @@ void InstallSpecialHooks()
     CHook::InstallPLT(g_libGTASA + (VER_x32 ? 0x6785FC : 0x84EC20), &StartGameScreen__OnNewGameCheck_hook, &StartGameScreen__OnNewGameCheck);
 
     CHook::InlineHook("_Z10NvUtilInitv", &NvUtilInit_hook, &NvUtilInit);
+    CHook::InlineHook("_Z32RpAnimBlendClumpUpdateAnimationsP7RpClumpfb", &RpAnimBlendClumpUpdateAnimations_hook, &_RpAnimBlendClumpUpdateAnimations);
 
     CHook::RET("_ZN12CCutsceneMgr16LoadCutsceneDataEPKc"); // LoadCutsceneData
     CHook::RET("_ZN12CCutsceneMgr10InitialiseEv");			// CCutsceneMgr::Initialise
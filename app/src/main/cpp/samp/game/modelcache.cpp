@@ -0,0 +1,130 @@
+#include "modelcache.h"
+
+CModelCache::CModelCache(IModelCacheStore* pStore)
+{
+	m_pStore = pStore;
+	m_Cursor = m_Order.end();
+	m_iScanLimit = MODEL_CACHE_SCAN_LIMIT;
+	ResetStats();
+}
+
+void CModelCache::ResetStats()
+{
+	m_Stats = {};
+}
+
+void CModelCache::MakeRecent(Entry_t it)
+{
+	if (it == m_Order.begin()) return;
+
+	// the cursor keeps its place in the walk rather than follow the entry to the front
+	if (it == m_Cursor) m_Cursor = std::prev(m_Cursor);
+	m_Order.splice(m_Order.begin(), m_Order, it);
+}
+
+void CModelCache::Erase(Entry_t it)
+{
+	if (it == m_Cursor) {
+		m_Cursor = (it == m_Order.begin()) ? m_Order.end() : std::prev(it);
+	}
+
+	m_Index.erase(*it);
+	m_Order.erase(it);
+}
+
+void CModelCache::Access(int iModel)
+{
+	bool bResident = m_pStore->IsResident(iModel);
+	if (bResident) m_Stats.dwHits++;
+	else m_Stats.dwMisses++;
+
+	auto it = m_Index.find(iModel);
+	if (it != m_Index.end()) {
+		MakeRecent(it->second);
+		return;
+	}
+
+	// not resident yet, the sweep admits it once it is
+	if (!bResident) return;
+
+	m_Order.push_front(iModel);
+	m_Index.emplace(iModel, m_Order.begin());
+}
+
+void CModelCache::Observe(int iModel, bool bInUse)
+{
+	auto it = m_Index.find(iModel);
+	if (it == m_Index.end())
+	{
+		m_Order.push_front(iModel);
+		m_Index.emplace(iModel, m_Order.begin());
+		return;
+	}
+
+	if (bInUse) MakeRecent(it->second);
+}
+
+void CModelCache::Forget(int iModel)
+{
+	auto it = m_Index.find(iModel);
+	if (it != m_Index.end()) Erase(it->second);
+}
+
+void CModelCache::SetPins(const std::vector<int>& models)
+{
+	m_Pins.clear();
+	m_Pins.insert(models.begin(), models.end());
+}
+
+size_t CModelCache::Trim(size_t budget, uint32_t dwTimeBudget)
+{
+	size_t freed = 0;
+	size_t used = m_pStore->GetMemoryUsed();
+	if (used <= budget || m_Order.empty()) return 0;
+
+	uint64_t qwStart = m_pStore->GetTimeMicros();
+
+	for (int i = 0; i < m_iScanLimit && used > budget && !m_Order.empty(); i++)
+	{
+		if (i > 0 && m_pStore->GetTimeMicros() - qwStart >= dwTimeBudget) break;
+
+		if (m_Cursor == m_Order.end()) m_Cursor = std::prev(m_Order.end());
+		Entry_t it = m_Cursor;
+		int iModel = *it;
+
+		if (!m_pStore->IsResident(iModel)) {
+			Erase(it);
+			continue;
+		}
+
+		m_Cursor = (it == m_Order.begin()) ? m_Order.end() : std::prev(it);
+
+		if (IsPinned(iModel)) {
+			m_Stats.dwPinnedSkips++;
+			continue;
+		}
+
+		if (!m_pStore->CanEvict(iModel)) {
+			m_Stats.dwBusySkips++;
+			continue;
+		}
+
+		m_pStore->Evict(iModel);
+		Erase(it);
+
+		size_t now = m_pStore->GetMemoryUsed();
+		if (now < used) {
+			freed += used - now;
+			m_Stats.qwEvictedBytes += used - now;
+		}
+		used = now;
+		m_Stats.dwEvictions++;
+	}
+
+	return freed;
+}
+
+void CModelCache::GetOrder(std::vector<int>& models) const
+{
+	models.assign(m_Order.begin(), m_Order.end());
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+	Streaming model cache.
+	Keeps resident models in least recently used order and trims them down to a
+	memory budget, a few at a time and within a time budget per call. A model is
+	touched when it is requested or seen in use; models referenced by the SA-MP pools
+	are pinned and never evicted. Eviction resumes where the previous call stopped, so
+	pinned or busy models at the cold end aren't rescanned every frame.
+	The policy only talks to an IModelCacheStore, CStreaming plugs in the game one.
+*/
+
+#define MODEL_CACHE_BUDGET_PERCENT	85		// of the streaming memory, trimmed down to every frame
+#define MODEL_CACHE_TIME_BUDGET		500		// us of eviction per frame
+#define MODEL_CACHE_SCAN_LIMIT		128		// entries examined per Trim() call
+#define MODEL_CACHE_SWEEP			512		// model slots checked for residency and use per frame
+#define MODEL_CACHE_PIN_INTERVAL	500		// ms between pool pin scans
+
+struct MODEL_CACHE_STATS
+{
+	uint32_t	dwHits;			// requested while resident
+	uint32_t	dwMisses;		// requested while not resident
+	uint32_t	dwEvictions;
+	uint64_t	qwEvictedBytes;
+	uint32_t	dwPinnedSkips;	// eviction candidates kept because a pool references them
+	uint32_t	dwBusySkips;	// eviction candidates the store refused (referenced, flagged, queued)
+};
+
+class IModelCacheStore
+{
+public:
+	virtual ~IModelCacheStore() {}
+
+	virtual size_t GetMemoryUsed() = 0;
+	virtual bool IsResident(int iModel) = 0;
+	// resident and nothing in the game holds it
+	virtual bool CanEvict(int iModel) = 0;
+	virtual void Evict(int iModel) = 0;
+	virtual uint64_t GetTimeMicros() = 0;
+};
+
+class CModelCache
+{
+public:
+	CModelCache(IModelCacheStore* pStore);
+
+	// a request for the model, counts a hit or a miss and makes it the most recent
+	void Access(int iModel);
+	// a resident model seen by the sweep, new ones are admitted as most recent
+	void Observe(int iModel, bool bInUse);
+	// the model left memory by other means
+	void Forget(int iModel);
+
+	// replaces the pinned set
+	void SetPins(const std::vector<int>& models);
+	bool IsPinned(int iModel) const { return m_Pins.find(iModel) != m_Pins.end(); }
+
+	// evicts least recently used models until memory is within budget,
+	// the scan limit or the time budget runs out; returns the bytes freed
+	size_t Trim(size_t budget, uint32_t dwTimeBudget);
+
+	void SetScanLimit(int iEntries) { m_iScanLimit = iEntries; }
+
+	const MODEL_CACHE_STATS& GetStats() const { return m_Stats; }
+	void ResetStats();
+	int GetCount() const { return (int)m_Index.size(); }
+	bool IsTracked(int iModel) const { return m_Index.find(iModel) != m_Index.end(); }
+	// tracked models from most to least recently used
+	void GetOrder(std::vector<int>& models) const;
+
+private:
+	typedef std::list<int>::iterator Entry_t;
+
+	void MakeRecent(Entry_t it);
+	void Erase(Entry_t it);
+
+	IModelCacheStore*					m_pStore;
+	std::list<int>						m_Order;		// front is the most recent
+	std::unordered_map<int, Entry_t>	m_Index;
+	std::unordered_set<int>				m_Pins;
+
+	// next eviction candidate, walks from the back to the front, end() starts over
+	Entry_t		m_Cursor;
+	int			m_iScanLimit;
+
+	MODEL_CACHE_STATS	m_Stats;
+};
@@ -0,0 +1,231 @@
+#include "modelrequests.h"
+
+#include <algorithm>
+
+CModelRequests::CModelRequests(IModelLoader* pLoader)
+{
+	m_pLoader = pLoader;
+	m_hNext = 1;
+	m_dwOrder = 0;
+	m_iBudget = MODEL_REQUEST_BUDGET;
+	m_dwTimeout = MODEL_REQUEST_TIMEOUT;
+
+	for (int i = 0; i < MODEL_REQUEST_HISTORY; i++)
+	{
+		m_History[i].hRequest = INVALID_MODEL_REQUEST;
+		m_History[i].iState = MODEL_REQUEST_UNKNOWN;
+	}
+}
+
+MODELREQUEST CModelRequests::Request(int iModel, int iPriority, ModelRequestCallback callback, const void* pOwner)
+{
+	return Request(&iModel, 1, iPriority, std::move(callback), pOwner);
+}
+
+MODELREQUEST CModelRequests::Request(const int* pModels, int iCount, int iPriority, ModelRequestCallback callback, const void* pOwner)
+{
+	MODELREQUEST hRequest = m_hNext++;
+	if (m_hNext == INVALID_MODEL_REQUEST) m_hNext = 1;
+
+	Request_t request;
+	request.iRemaining = 0;
+	request.pOwner = pOwner;
+
+	for (int i = 0; i < iCount; i++)
+	{
+		int iModel = pModels[i];
+		if (std::find(request.Models.begin(), request.Models.end(), iModel) != request.Models.end()) continue;
+		if (m_pLoader->IsModelLoaded(iModel)) continue;
+
+		request.Models.push_back(iModel);
+		request.iRemaining++;
+	}
+
+	if (request.iRemaining == 0)
+	{
+		// fast path, nothing to wait for
+		RememberState(hRequest, MODEL_REQUEST_READY);
+		if (callback) callback(true);
+		return hRequest;
+	}
+
+	for (int iModel : request.Models)
+	{
+		auto it = m_Models.find(iModel);
+		if (it == m_Models.end())
+		{
+			Model_t model;
+			model.iPriority = iPriority;
+			model.dwOrder = m_dwOrder++;
+			model.bIssued = false;
+			model.dwIssueTime = 0;
+			it = m_Models.emplace(iModel, std::move(model)).first;
+		}
+		else if (iPriority > it->second.iPriority) {
+			it->second.iPriority = iPriority;
+		}
+
+		it->second.Waiters.push_back(hRequest);
+	}
+
+	request.Callback = std::move(callback);
+	m_Requests.emplace(hRequest, std::move(request));
+	RememberState(hRequest, MODEL_REQUEST_PENDING);
+
+	return hRequest;
+}
+
+void CModelRequests::DetachRequest(MODELREQUEST hRequest, const Request_t& request)
+{
+	for (int iModel : request.Models)
+	{
+		auto it = m_Models.find(iModel);
+		if (it == m_Models.end()) continue;
+
+		auto& waiters = it->second.Waiters;
+		waiters.erase(std::remove(waiters.begin(), waiters.end(), hRequest), waiters.end());
+
+		// an issued model keeps streaming in, nobody waits for it anymore
+		if (waiters.empty()) m_Models.erase(it);
+	}
+}
+
+void CModelRequests::Cancel(MODELREQUEST hRequest)
+{
+	auto it = m_Requests.find(hRequest);
+	if (it == m_Requests.end()) return;
+
+	DetachRequest(hRequest, it->second);
+	m_Requests.erase(it);
+	RememberState(hRequest, MODEL_REQUEST_UNKNOWN);
+}
+
+void CModelRequests::CancelOwner(const void* pOwner)
+{
+	if (!pOwner) return;
+
+	std::vector<MODELREQUEST> owned;
+	for (auto& request : m_Requests) {
+		if (request.second.pOwner == pOwner) owned.push_back(request.first);
+	}
+
+	for (MODELREQUEST hRequest : owned) {
+		Cancel(hRequest);
+	}
+}
+
+void CModelRequests::Promote(MODELREQUEST hRequest, int iPriority)
+{
+	auto it = m_Requests.find(hRequest);
+	if (it == m_Requests.end()) return;
+
+	for (int iModel : it->second.Models)
+	{
+		auto model = m_Models.find(iModel);
+		if (model != m_Models.end() && iPriority > model->second.iPriority) {
+			model->second.iPriority = iPriority;
+		}
+	}
+}
+
+int CModelRequests::GetState(MODELREQUEST hRequest) const
+{
+	if (hRequest == INVALID_MODEL_REQUEST) return MODEL_REQUEST_UNKNOWN;
+
+	const auto& entry = m_History[hRequest % MODEL_REQUEST_HISTORY];
+	if (entry.hRequest != hRequest) return MODEL_REQUEST_UNKNOWN;
+
+	return entry.iState;
+}
+
+void CModelRequests::RememberState(MODELREQUEST hRequest, int iState)
+{
+	auto& entry = m_History[hRequest % MODEL_REQUEST_HISTORY];
+	entry.hRequest = hRequest;
+	entry.iState = iState;
+}
+
+void CModelRequests::FinishRequest(MODELREQUEST hRequest, bool bLoaded, std::vector<Completion_t>& completions)
+{
+	auto it = m_Requests.find(hRequest);
+	if (it == m_Requests.end()) return;
+
+	Request_t request = std::move(it->second);
+	m_Requests.erase(it);
+
+	// a failed request stops waiting for its other models too
+	if (!bLoaded) DetachRequest(hRequest, request);
+
+	RememberState(hRequest, bLoaded ? MODEL_REQUEST_READY : MODEL_REQUEST_FAILED);
+	if (request.Callback) {
+		completions.push_back({ std::move(request.Callback), bLoaded });
+	}
+}
+
+void CModelRequests::CompleteModel(int iModel, bool bLoaded, std::vector<Completion_t>& completions)
+{
+	auto it = m_Models.find(iModel);
+	if (it == m_Models.end()) return;
+
+	std::vector<MODELREQUEST> waiters = std::move(it->second.Waiters);
+	m_Models.erase(it);
+
+	for (MODELREQUEST hRequest : waiters)
+	{
+		auto request = m_Requests.find(hRequest);
+		if (request == m_Requests.end()) continue;
+
+		if (!bLoaded) {
+			FinishRequest(hRequest, false, completions);
+		}
+		else if (--request->second.iRemaining == 0) {
+			FinishRequest(hRequest, true, completions);
+		}
+	}
+}
+
+void CModelRequests::Process(uint32_t dwNow)
+{
+	if (m_Models.empty()) return;
+
+	std::vector<Completion_t> completions;
+	std::vector<int> done, expired;
+	std::vector<std::pair<const Model_t*, int>> queued;
+
+	for (auto& model : m_Models)
+	{
+		if (m_pLoader->IsModelLoaded(model.first)) {
+			done.push_back(model.first);
+		}
+		else if (model.second.bIssued) {
+			if (dwNow - model.second.dwIssueTime >= m_dwTimeout) expired.push_back(model.first);
+		}
+		else {
+			queued.push_back({ &model.second, model.first });
+		}
+	}
+
+	// the budget goes to the most important and then the oldest models
+	int iIssue = std::min((int)queued.size(), m_iBudget);
+	std::partial_sort(queued.begin(), queued.begin() + iIssue, queued.end(),
+		[](const std::pair<const Model_t*, int>& a, const std::pair<const Model_t*, int>& b) {
+			if (a.first->iPriority != b.first->iPriority) return a.first->iPriority > b.first->iPriority;
+			return a.first->dwOrder < b.first->dwOrder;
+		});
+
+	for (int i = 0; i < iIssue; i++)
+	{
+		Model_t& model = m_Models[queued[i].second];
+		model.bIssued = true;
+		model.dwIssueTime = dwNow;
+		m_pLoader->RequestModel(queued[i].second);
+	}
+
+	for (int iModel : done) CompleteModel(iModel, true, completions);
+	for (int iModel : expired) CompleteModel(iModel, false, completions);
+
+	// callbacks last, they may create entities and queue new requests
+	for (auto& completion : completions) {
+		completion.Callback(completion.bLoaded);
+	}
+}
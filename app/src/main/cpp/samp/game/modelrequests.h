@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/*
+	Asynchronous model loading.
+	A request names one or more models and completes once all of them are resident,
+	or fails if one doesn't load in time. The caller either passes a callback or keeps
+	the handle and polls GetState(). Requests for the same model share one streamer
+	request; at most a budget of models is handed to the streamer per Process() call,
+	higher priorities first.
+	The queue only talks to an IModelLoader, CStreaming plugs in the game one.
+*/
+
+enum eModelRequestPriority
+{
+	MODEL_PRIORITY_LOW = 0,		// prefetch, decorations
+	MODEL_PRIORITY_NORMAL,		// entities streaming in
+	MODEL_PRIORITY_HIGH,		// something the player is looking at right now (skin, weapon)
+};
+
+enum eModelRequestState
+{
+	MODEL_REQUEST_UNKNOWN = 0,	// never issued, cancelled or completed too long ago
+	MODEL_REQUEST_PENDING,
+	MODEL_REQUEST_READY,
+	MODEL_REQUEST_FAILED,
+};
+
+typedef uint32_t MODELREQUEST;
+#define INVALID_MODEL_REQUEST	0
+
+// bLoaded is false if a model wasn't resident before the timeout
+typedef std::function<void(bool bLoaded)> ModelRequestCallback;
+
+#define MODEL_REQUEST_BUDGET		4		// models handed to the streamer per frame
+#define MODEL_REQUEST_TIMEOUT		3000	// ms from handing a model to the streamer
+#define MODEL_REQUEST_HISTORY		256		// completed handles GetState() still knows
+
+class IModelLoader
+{
+public:
+	virtual ~IModelLoader() {}
+
+	virtual bool IsModelLoaded(int iModel) = 0;
+	// called once per queued model, the model is expected to become resident later
+	virtual void RequestModel(int iModel) = 0;
+};
+
+class CModelRequests
+{
+public:
+	CModelRequests(IModelLoader* pLoader);
+
+	// the callback runs before Request() returns if every model is already resident
+	MODELREQUEST Request(int iModel, int iPriority, ModelRequestCallback callback = nullptr, const void* pOwner = nullptr);
+	MODELREQUEST Request(const int* pModels, int iCount, int iPriority, ModelRequestCallback callback = nullptr, const void* pOwner = nullptr);
+
+	// the callback of a cancelled request never runs
+	void Cancel(MODELREQUEST hRequest);
+	// cancels every pending request of pOwner, for objects that go away with requests in flight
+	void CancelOwner(const void* pOwner);
+	// raises the priority of the models a pending request still waits for
+	void Promote(MODELREQUEST hRequest, int iPriority);
+
+	int GetState(MODELREQUEST hRequest) const;
+
+	// completes resident models, fails timed out ones and issues queued ones within the budget
+	void Process(uint32_t dwNow);
+
+	void SetBudget(int iModelsPerFrame) { m_iBudget = iModelsPerFrame; }
+	void SetTimeout(uint32_t dwTimeout) { m_dwTimeout = dwTimeout; }
+
+	int GetPendingCount() const { return (int)m_Requests.size(); }
+	int GetQueuedModelCount() const { return (int)m_Models.size(); }
+	bool IsModelQueued(int iModel) const { return m_Models.find(iModel) != m_Models.end(); }
+
+private:
+	struct Request_t
+	{
+		int						iRemaining;		// models not resident yet
+		std::vector<int>		Models;
+		ModelRequestCallback	Callback;
+		const void*				pOwner;
+	};
+
+	struct Model_t
+	{
+		int							iPriority;
+		uint32_t					dwOrder;		// FIFO among equal priorities
+		bool						bIssued;
+		uint32_t					dwIssueTime;
+		std::vector<MODELREQUEST>	Waiters;
+	};
+
+	struct Completion_t
+	{
+		ModelRequestCallback	Callback;
+		bool					bLoaded;
+	};
+
+	void CompleteModel(int iModel, bool bLoaded, std::vector<Completion_t>& completions);
+	void FinishRequest(MODELREQUEST hRequest, bool bLoaded, std::vector<Completion_t>& completions);
+	void DetachRequest(MODELREQUEST hRequest, const Request_t& request);
+	void RememberState(MODELREQUEST hRequest, int iState);
+
+	IModelLoader*								m_pLoader;
+	std::unordered_map<MODELREQUEST, Request_t>	m_Requests;
+	std::unordered_map<int, Model_t>			m_Models;
+
+	MODELREQUEST	m_hNext;
+	uint32_t		m_dwOrder;
+	int				m_iBudget;
+	uint32_t		m_dwTimeout;
+
+	struct
+	{
+		MODELREQUEST	hRequest;
+		int				iState;
+	} m_History[MODEL_REQUEST_HISTORY];
+};
@@ -34,10 +34,10 @@ CObject::CObject(int iModel, CVector vecPos, CVector vecRot, float fDrawDistance
 	m_vecAttachedRot.z = 0.0f;
 	m_bSyncRotation = true;
 
-	ScriptCommand(&create_object, iModel, vecPos.x, vecPos.y, vecPos.z, &m_dwGTAId);
+	ScriptCommand<create_object>(iModel, vecPos.x, vecPos.y, vecPos.z, &m_dwGTAId);
     if(!m_dwGTAId) return;
 
-    ScriptCommand(&put_object_at, m_dwGTAId, vecPos.x, vecPos.y, vecPos.z);
+    ScriptCommand<put_object_at>(m_dwGTAId, vecPos.x, vecPos.y, vecPos.z);
 
 	m_pEntity = GamePool_Object_GetAt(m_dwGTAId);
 
@@ -82,13 +82,13 @@ CObject::CObject(int iModel, CVector vecPos, CVector vecRot, float fDrawDistance
 CObject::~CObject()
 {
     if(m_pEntity)
-        ScriptCommand(&destroy_object, m_dwGTAId);
+        ScriptCommand<destroy_object>(m_dwGTAId);
     CStreaming::RemoveModelIfNoRefs(m_pEntity->m_nModelIndex);
 
 	for (int i = 0; i < 16; i++)
 	{
 		if (m_szMaterialText[i] != nullptr) {
-			delete m_szMaterialText[i];
+			CMemPool::Free(m_szMaterialText[i]);
 			m_szMaterialText[i] = nullptr;
 		}
 	}
@@ -251,7 +251,7 @@ void CObject::SetRotation(CVector * vecRotation)
 {
 	if (m_pEntity && GamePool_Object_GetAt(m_dwGTAId))
 	{
-		ScriptCommand(&set_object_rotation, m_dwGTAId, vecRotation->x, vecRotation->y, vecRotation->z);
+		ScriptCommand<set_object_rotation>(m_dwGTAId, vecRotation->x, vecRotation->y, vecRotation->z);
 		m_vecRotation.x = vecRotation->x;
 		m_vecRotation.y = vecRotation->y;
 		m_vecRotation.z = vecRotation->z;
@@ -385,13 +385,9 @@ void CObject::SetMaterialText(int index, char* text, int materialSize, char* fon
 	m_dwMaterialColor[index] = 0;
 	m_iMaterialType[index] = MATERIAL_TYPE_TEXT;
 
-	if (m_szMaterialText[index] != nullptr) {
-		delete[] m_szMaterialText[index];
-		m_szMaterialText[index] = nullptr;
-	}
-
-	m_szMaterialText[index] = new char[2048];
-	strcpy(m_szMaterialText[index], text);
+	size_t len = strlen(text) + 1;
+	m_szMaterialText[index] = (char*)CMemPool::Realloc(m_szMaterialText[index], len);
+	memcpy(m_szMaterialText[index], text, len);
 
 	m_iMaterialSize[index] = materialSize;
 	m_iMaterialFontSize[index] = fontSize;
@@ -551,9 +547,8 @@ void CObject::SetAttachedVehicle(uint16_t VehicleID, CVector* vecPos, CVector* v
 void CObject::AttachToVehicle(CVehicle* pVehicle)
 {
     if (GamePool_Object_GetAt(m_dwGTAId)) {
-        if (!ScriptCommand(&is_object_attached, m_dwGTAId)) {
-            ScriptCommand(&attach_object_to_car,
-                          m_dwGTAId,
+        if (!ScriptCommand<is_object_attached>(m_dwGTAId)) {
+            ScriptCommand<attach_object_to_car>(m_dwGTAId,
                           pVehicle->m_dwGTAId,
                           m_vecAttachedPos.x,
                           m_vecAttachedPos.y,
@@ -568,9 +563,8 @@ void CObject::AttachToVehicle(CVehicle* pVehicle)
 void CObject::AttachToObject(CObject* pObject)
 {
     if (GamePool_Object_GetAt(m_dwGTAId)) {
-        if (!ScriptCommand(&is_object_attached, m_dwGTAId)) {
-            ScriptCommand(&attach_object_to_object,
-                          m_dwGTAId,
+        if (!ScriptCommand<is_object_attached>(m_dwGTAId)) {
+            ScriptCommand<attach_object_to_object>(m_dwGTAId,
                           pObject->m_dwGTAId,
                           m_vecAttachedPos.x,
                           m_vecAttachedPos.y,
@@ -614,6 +608,6 @@ void CObject::SetPos(float x, float y, float z)
 {
     if (GamePool_Object_GetAt(m_dwGTAId))
     {
-        ScriptCommand(&put_object_at, m_dwGTAId, x, y, z);
+        ScriptCommand<put_object_at>(m_dwGTAId, x, y, z);
     }
 }
\ No newline at end of file
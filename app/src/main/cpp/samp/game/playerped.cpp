@@ -2,6 +2,7 @@
 #include "game.h"
 #include "../net/netgame.h"
 #include "../vendor/armhook/patch.h"
+#include <algorithm>
 #include <cmath>
 // 0.3.7
 #include "Entity/CPedGTA.h"
@@ -20,8 +21,8 @@ CPlayerPed::CPlayerPed()
 	m_pPed = GamePool_FindPlayerPed();
 	m_bytePlayerNumber = 0;
 	SetPlayerPedPtrRecord(m_bytePlayerNumber, reinterpret_cast<CPedGTA *>(m_pPed));
-	ScriptCommand(&set_actor_weapon_droppable, m_dwGTAId, 1);
-	ScriptCommand(&set_actor_can_be_decapitated, m_dwGTAId, 0);
+	ScriptCommand<set_actor_weapon_droppable>(m_dwGTAId, 1);
+	ScriptCommand<set_actor_can_be_decapitated>(m_dwGTAId, 0);
 
 	m_iCuffedState = 0;
 	m_iCarryState = 0;
@@ -34,6 +35,7 @@ CPlayerPed::CPlayerPed()
 	m_iDanceStyle = -1;
 	m_iCellPhoneEnabled = 0;
 	m_bPissingState = false;
+	m_dwModelRequest = INVALID_MODEL_REQUEST;
 
 	m_stuffData.dwDrunkLevel = 0;
 	m_stuffData.dwObject = 0;
@@ -54,7 +56,7 @@ CPlayerPed::CPlayerPed(int iNum, int iSkin, float fX, float fY, float fZ, float
     m_dwArrow = 0;
     m_bHaveBulletData = false;
 
-    /*if (!ScriptCommand(&create_player, &iPlayerNum, fX, fY, fZ, &m_dwGTAId)) {
+    /*if (!ScriptCommand<create_player>(&iPlayerNum, fX, fY, fZ, &m_dwGTAId)) {
         FLog("Error: Failed to create player!");
         return;
     }*/
@@ -73,7 +75,7 @@ CPlayerPed::CPlayerPed(int iNum, int iSkin, float fX, float fY, float fZ, float
     //((void (*)(ENTITY_TYPE*))(SA_ADDR(0x3C14B0 + 1)))((ENTITY_TYPE*)m_pPed); // CWorld::Add
     CWorld::Add(m_pPed);
 
-	//ScriptCommand(&create_actor_from_player, &iPlayerNum, &m_dwGTAId);
+	//ScriptCommand<create_actor_from_player>(&iPlayerNum, &m_dwGTAId);
 
     m_dwGTAId = GamePool_Ped_GetIndex(m_pPed);
 
@@ -87,14 +89,14 @@ CPlayerPed::CPlayerPed(int iNum, int iSkin, float fX, float fY, float fZ, float
 	SetPlayerPedPtrRecord(iPlayerNum, m_pPed);
 
     m_pPed->bDoesntDropWeaponsWhenDead = true;
-	ScriptCommand(&set_actor_immunities, m_dwGTAId, 0, 0, 1, 0, 0);
-	ScriptCommand(&set_actor_can_be_decapitated, m_dwGTAId, 0);
+	ScriptCommand<set_actor_immunities>(m_dwGTAId, 0, 0, 1, 0, 0);
+	ScriptCommand<set_actor_can_be_decapitated>(m_dwGTAId, 0);
     m_pPed->bNeverEverTargetThisPed = true;
 
 	if (pNetGame)
 	{
-		ScriptCommand(&set_actor_money, m_dwGTAId, 0);
-		ScriptCommand(&set_actor_money, m_dwGTAId, pNetGame->m_pNetSet->iDeathDropMoney);
+		ScriptCommand<set_actor_money>(m_dwGTAId, 0);
+		ScriptCommand<set_actor_money>(m_dwGTAId, pNetGame->m_pNetSet->iDeathDropMoney);
 	}
 
 	m_iCuffedState = 0;
@@ -106,6 +108,7 @@ CPlayerPed::CPlayerPed(int iNum, int iSkin, float fX, float fY, float fZ, float
 	m_iDanceStyle = -1;
 	m_iCellPhoneEnabled = 0;
 	m_bPissingState = false;
+	m_dwModelRequest = INVALID_MODEL_REQUEST;
 
 	iSpecialAction = 0;
 
@@ -132,6 +135,8 @@ CPlayerPed::CPlayerPed(int iNum, int iSkin, float fX, float fY, float fZ, float
 
 CPlayerPed::~CPlayerPed()
 {
+    CStreaming::GetModelRequests().CancelOwner(this);
+
     auto modelId = m_pPed->m_nModelIndex;
 	FLog("Destroying PlayerPed(%d)", m_bytePlayerNumber);
 
@@ -143,8 +148,8 @@ CPlayerPed::~CPlayerPed()
 	{
 		if (m_dwParachuteObject)
 		{
-			ScriptCommand(&disassociate_object, m_dwParachuteObject, 0.0, 0.0, 0.0, 0);
-			ScriptCommand(&destroy_object_with_fade, m_dwParachuteObject);
+			ScriptCommand<disassociate_object>(m_dwParachuteObject, 0.0, 0.0, 0.0, 0);
+			ScriptCommand<destroy_object_with_fade>(m_dwParachuteObject);
 			m_dwParachuteObject = 0;
 		}
 
@@ -233,7 +238,7 @@ void CPlayerPed::SetDead()
 
     uint8_t old = CWorld::PlayerInFocus;
     CWorld::PlayerInFocus = m_bytePlayerNumber;
-    ScriptCommand(&kill_actor, m_dwGTAId);
+    ScriptCommand<kill_actor>(m_dwGTAId);
     CWorld::PlayerInFocus = 0;
 }
 // 0.3.7
@@ -259,14 +264,14 @@ void CPlayerPed::TogglePlayerControllable(bool bControllable)
     if(!bControllable)
     {
         FLog("TogglePlayerControllable5");
-        ScriptCommand(&toggle_player_controllable, m_bytePlayerNumber, 0);
-        ScriptCommand(&lock_actor, m_dwGTAId, 1);
+        ScriptCommand<toggle_player_controllable>(m_bytePlayerNumber, 0);
+        ScriptCommand<lock_actor>(m_dwGTAId, 1);
     }
     else if(bControllable)
     {
         FLog("TogglePlayerControllable6");
-        ScriptCommand(&toggle_player_controllable, m_bytePlayerNumber, 1);
-        ScriptCommand(&lock_actor, m_dwGTAId, 0);
+        ScriptCommand<toggle_player_controllable>(m_bytePlayerNumber, 1);
+        ScriptCommand<lock_actor>(m_dwGTAId, 0);
     }
 }
 // 0.3.7
@@ -504,7 +509,7 @@ void CPlayerPed::SetInitialState()
 // 0.3.7
 void CPlayerPed::RestartIfWastedAt(CVector *vecRestart, float fRotation)
 {
-	ScriptCommand(&restart_if_wasted_at, vecRestart->x, vecRestart->y, vecRestart->z, fRotation, 0);
+	ScriptCommand<restart_if_wasted_at>(vecRestart->x, vecRestart->y, vecRestart->z, fRotation, 0);
 }
 
 bool IsPedModel(unsigned int iModelID)
@@ -527,22 +532,44 @@ void CPlayerPed::SetModelIndex(uint uiModel)
 
     if(m_pPed)
     {
-        auto oldModelId = m_pPed->m_nModelIndex;
+        // the ped keeps its current skin meanwhile, a newer skin replaces a pending one
+        CModelRequests& requests = CStreaming::GetModelRequests();
+        requests.Cancel(m_dwModelRequest);
+        m_dwModelRequest = INVALID_MODEL_REQUEST;
+
+        MODELREQUEST hRequest = requests.Request(uiModel, MODEL_PRIORITY_HIGH, [this, uiModel](bool bLoaded) {
+            m_dwModelRequest = INVALID_MODEL_REQUEST;
+            if (bLoaded) ApplyModelIndex(uiModel);
+        }, this);
+
+        if (requests.GetState(hRequest) == MODEL_REQUEST_PENDING) {
+            m_dwModelRequest = hRequest;
+        }
+    }
+}
 
-        if (!CStreaming::TryLoadModel(uiModel))
-            return;
+void CPlayerPed::ApplyModelIndex(uint uiModel)
+{
+    if(!m_pPed || !GamePool_Ped_GetAt(m_dwGTAId)) return;
 
-        // CEntity::DeleteRwObject();
-        m_pPed->m_nModelIndex = uiModel;
+    auto oldModelId = m_pPed->m_nModelIndex;
 
-        m_pPed->SetModelIndex(uiModel);
+    // CEntity::DeleteRwObject();
+    m_pPed->m_nModelIndex = uiModel;
 
-        CStreaming::RemoveModelIfNoRefs(oldModelId);
-    }
+    m_pPed->SetModelIndex(uiModel);
+
+    CStreaming::RemoveModelIfNoRefs(oldModelId);
 }
 
 void CPlayerPed::ClearWeapons()
 {
+	// a weapon still loading would come back after the clear
+	for (MODELREQUEST hRequest : m_WeaponRequests) {
+		CStreaming::GetModelRequests().Cancel(hRequest);
+	}
+	m_WeaponRequests.clear();
+
 	if (m_pPed == nullptr) return;
 
 	CWorld::PlayerInFocus = m_bytePlayerNumber; // CWorld::PlayerInFocus
@@ -559,8 +586,29 @@ void CPlayerPed::ResetDamageEntity()
 
 void CPlayerPed::GiveWeapon(int iWeaponId, int iAmmo)
 {
-	if(m_pPed)
-        m_pPed->GiveWeapon(iWeaponId, iAmmo);
+	if(!m_pPed) return;
+
+	int iModelID = GameGetWeaponModelIDFromWeaponID(iWeaponId);
+	if (iModelID > 0 && !CStreaming::GetInfo(iModelID).IsLoaded())
+	{
+		// given once the model is resident, without taking the weapon in hand: the
+		// server may have armed another one by then
+		CModelRequests& requests = CStreaming::GetModelRequests();
+		MODELREQUEST hRequest = requests.Request(iModelID, MODEL_PRIORITY_HIGH, [this, iWeaponId, iAmmo](bool bLoaded) {
+			if (bLoaded && m_pPed && GamePool_Ped_GetAt(m_dwGTAId)) m_pPed->GiveWeapon(iWeaponId, iAmmo, false);
+		}, this);
+
+		if (requests.GetState(hRequest) == MODEL_REQUEST_PENDING)
+		{
+			m_WeaponRequests.erase(std::remove_if(m_WeaponRequests.begin(), m_WeaponRequests.end(), [&requests](MODELREQUEST h) {
+				return requests.GetState(h) != MODEL_REQUEST_PENDING;
+			}), m_WeaponRequests.end());
+			m_WeaponRequests.push_back(hRequest);
+		}
+		return;
+	}
+
+	m_pPed->GiveWeapon(iWeaponId, iAmmo);
 }
 
 void CPlayerPed::SetArmedWeapon(uint8_t weapon, bool unk)
@@ -573,7 +621,7 @@ void CPlayerPed::SetTargetRotation(float fRotation)
 	{
 		m_pPed->m_fAimingRotation = DegToRad(fRotation);
 		m_pPed->m_fCurrentRotation = DegToRad(fRotation);
-		ScriptCommand(&set_actor_z_angle, m_dwGTAId, fRotation);
+		ScriptCommand<set_actor_z_angle>(m_dwGTAId, fRotation);
 	}
 }
 // 0.3.7
@@ -581,7 +629,7 @@ void CPlayerPed::SetImmunities(int BP, int FP, int EP, int CP, int MP)
 {
 	if (m_pPed) {
 		if (GamePool_Ped_GetAt(m_dwGTAId)) {
-			ScriptCommand(&set_actor_immunities, m_dwGTAId, BP, FP, EP, CP, MP);
+			ScriptCommand<set_actor_immunities>(m_dwGTAId, BP, FP, EP, CP, MP);
 		}
 	}
 }
@@ -589,13 +637,13 @@ void CPlayerPed::SetImmunities(int BP, int FP, int EP, int CP, int MP)
 void CPlayerPed::ShowMarker(int nIndex)
 {
 	if (m_dwArrow) {
-		ScriptCommand(&disable_marker, m_dwArrow);
+		ScriptCommand<disable_marker>(m_dwArrow);
 		m_dwArrow = 0;
 	}
 
-	ScriptCommand(&create_arrow_above_actor, m_dwGTAId, &m_dwArrow);
-	ScriptCommand(&set_marker_color, m_dwArrow, nIndex);
-	ScriptCommand(&show_on_radar2, m_dwArrow, 2);
+	ScriptCommand<create_arrow_above_actor>(m_dwGTAId, &m_dwArrow);
+	ScriptCommand<set_marker_color>(m_dwArrow, nIndex);
+	ScriptCommand<show_on_radar2>(m_dwArrow, 2);
 }
 
 void CPlayerPed::SetKeys(uint16_t lrAnalog, uint16_t udAnalog, uint16_t wKeys)
@@ -742,7 +790,7 @@ uint16_t CPlayerPed::GetKeys(uint16_t *lrAnalog, uint16_t *udAnalog, bool clear)
 void CPlayerPed::SetFightingStyle(int iStyle)
 {
 	if (m_pPed) {
-		ScriptCommand(&set_fighting_style, m_dwGTAId, iStyle, 6);
+		ScriptCommand<set_fighting_style>(m_dwGTAId, iStyle, 6);
 	}
 }
 
@@ -791,27 +839,27 @@ void CPlayerPed::ApplyAnimation(const char* szAnimName, const char* szAnimLib, f
 	if(!pGame->IsAnimationLoaded(szAnimLib))
 	{
 		pGame->RequestAnimation(szAnimLib);
-        ScriptCommand(&apply_animation, m_dwGTAId, szAnimName, szAnimLib, fT, opt1, opt2, opt3, opt4, iTime);
+        ScriptCommand<apply_animation>(m_dwGTAId, szAnimName, szAnimLib, fT, opt1, opt2, opt3, opt4, iTime);
 	}
 
-	ScriptCommand(&apply_animation, m_dwGTAId, szAnimName, szAnimLib, fT, opt1, opt2, opt3, opt4, iTime);
+	ScriptCommand<apply_animation>(m_dwGTAId, szAnimName, szAnimLib, fT, opt1, opt2, opt3, opt4, iTime);
 }
 
 // 0.3.7
 void CPlayerPed::SetInterior(uint8_t byteInteriorId, bool bRefresh)
 {
 	if (m_pPed && m_bytePlayerNumber != 0) {
-		ScriptCommand(&link_actor_to_interior, m_dwGTAId, byteInteriorId);
+		ScriptCommand<link_actor_to_interior>(m_dwGTAId, byteInteriorId);
 	}
 	else
 	{
-		ScriptCommand(&select_interior, byteInteriorId);
-		ScriptCommand(&link_actor_to_interior, m_dwGTAId, byteInteriorId);
+		ScriptCommand<select_interior>(byteInteriorId);
+		ScriptCommand<link_actor_to_interior>(m_dwGTAId, byteInteriorId);
 		if (bRefresh)
 		{
 			RwMatrix mat;
             mat = m_pPed->GetMatrix().ToRwMatrix();
-			ScriptCommand(&refresh_streaming_at, mat.pos.x, mat.pos.y);
+			ScriptCommand<refresh_streaming_at>(mat.pos.x, mat.pos.y);
 		}
 	}
 }
@@ -878,8 +926,8 @@ void CPlayerPed::CheckVehicleParachute()
 {
 	if (m_dwParachuteObject)
 	{
-		ScriptCommand(&disassociate_object, m_dwParachuteObject, 0.0, 0.0, 0.0, 0);
-		ScriptCommand(&destroy_object, m_dwParachuteObject);
+		ScriptCommand<disassociate_object>(m_dwParachuteObject, 0.0, 0.0, 0.0, 0);
+		ScriptCommand<destroy_object>(m_dwParachuteObject);
 		m_dwParachuteObject = 0;
 	}
 }
@@ -923,11 +971,11 @@ void CPlayerPed::PutDirectlyInVehicle(uint32_t dwVehicleGTAId, uint8_t byteSeatI
 			if (pGtaVehicle && pGtaVehicle->pDriver && pGtaVehicle->pDriver->IsInVehicle()) {
 				return;
 			}
-			ScriptCommand(&put_actor_in_car, m_dwGTAId, dwVehicleGTAId);
+			ScriptCommand<put_actor_in_car>(m_dwGTAId, dwVehicleGTAId);
 		}
 		else
 		{
-			ScriptCommand(&put_actor_in_car2, m_dwGTAId, dwVehicleGTAId, byteSeatID - 1);
+			ScriptCommand<put_actor_in_car2>(m_dwGTAId, dwVehicleGTAId, byteSeatID - 1);
 		}
 
 		if (m_pPed == GamePool_FindPlayerPed())
@@ -948,7 +996,7 @@ void CPlayerPed::PutDirectlyInVehicle(uint32_t dwVehicleGTAId, uint8_t byteSeatI
 					if (pVehicle->IsATrainPart())
 					{
 						if (m_pPed == GamePool_FindPlayerPed()) {
-							ScriptCommand(&camera_on_vehicle, pVehicle->m_dwGTAId, 3, 2);
+							ScriptCommand<camera_on_vehicle>(pVehicle->m_dwGTAId, 3, 2);
 						}
 					}
 				}
@@ -982,17 +1030,17 @@ void CPlayerPed::EnterVehicle(uint32_t dwVehicleGTAId, bool bPassenger)
         if (bPassenger) {
             if (pGtaVehicle->m_nModelIndex != TRAIN_PASSENGER ||
                 m_pPed != GamePool_FindPlayerPed()) {
-                ScriptCommand(&send_actor_to_car_passenger, m_dwGTAId, dwVehicleGTAId, 3000, -1);
+                ScriptCommand<send_actor_to_car_passenger>(m_dwGTAId, dwVehicleGTAId, 3000, -1);
             } else {
-                ScriptCommand(&put_actor_in_car2, m_dwGTAId, dwVehicleGTAId, -1);
+                ScriptCommand<put_actor_in_car2>(m_dwGTAId, dwVehicleGTAId, -1);
             }
         } else {
-            ScriptCommand(&send_actor_to_car_driverseat, m_dwGTAId, dwVehicleGTAId, 3000);
+            ScriptCommand<send_actor_to_car_driverseat>(m_dwGTAId, dwVehicleGTAId, 3000);
         }
     }
 }
 // 0.3.7
-const SCRIPT_COMMAND TASK_LEAVE_ANY_CAR = { 0x0633, "i" };
+constexpr SCRIPT_COMMAND TASK_LEAVE_ANY_CAR = { 0x0633, "i" };
 void CPlayerPed::ExitCurrentVehicle()
 {
     FLog("ExitCurrentVehicle");
@@ -1007,7 +1055,7 @@ void CPlayerPed::ExitCurrentVehicle()
 
     if(m_pPed->bInVehicle)
     {
-        ScriptCommand(&TASK_LEAVE_ANY_CAR, m_dwGTAId);
+        ScriptCommand<TASK_LEAVE_ANY_CAR>(m_dwGTAId);
 
     }
 }
@@ -1325,10 +1373,7 @@ void CPlayerPed::ProcessBulletData(BULLET_DATA *btData)
 						btSync.PlayerID = InstanceID;
 						btSync.byteWeaponID = pLocalPlayerPed->GetCurrentWeapon();
 
-						RakNet::BitStream bsBullet;
-						bsBullet.Write((char)ID_BULLET_SYNC);
-						bsBullet.Write((char*)&btSync, sizeof(BULLET_SYNC_DATA));
-						pNetGame->GetRakClient()->Send(&bsBullet, PacketPriority::HIGH_PRIORITY, PacketReliability::UNRELIABLE_SEQUENCED, 0);
+						pNetGame->SendBulletSync(btSync);
 					}
 				}
 			}
@@ -1601,7 +1646,7 @@ void CPlayerPed::HandsUp()
 	if(!m_pPed || !GamePool_Ped_GetAt(m_dwGTAId) || IsInVehicle() || !m_pPed->IsAdded())
 		return;
 
-	ScriptCommand(&task_hands_up, m_dwGTAId, -1);
+	ScriptCommand<task_hands_up>(m_dwGTAId, -1);
 }
 
 char DanceStyleLibs[4][16] = {"WOP","GFUNK","RUNNINGMAN","STRIP"};
@@ -1735,8 +1780,8 @@ void CPlayerPed::StartPissing()
 		ApplyAnimation("PISS_LOOP", "PAULNMAC", 4.0, 1, 0, 0, 0, -1);
 
 		char *ahaha = "PETROLCAN";
-		ScriptCommand(&attach_particle_to_actor2, ahaha, m_dwGTAId, 0.0f, 0.58f, -0.08f, 0.0f, 0.01f, 0.0f, 1, &m_dwPissParticlesHandle);
-		ScriptCommand(&make_particle_visible, m_dwPissParticlesHandle);
+		ScriptCommand<attach_particle_to_actor2>(ahaha, m_dwGTAId, 0.0f, 0.58f, -0.08f, 0.0f, 0.01f, 0.0f, 1, &m_dwPissParticlesHandle);
+		ScriptCommand<make_particle_visible>(m_dwPissParticlesHandle);
 
 		m_bPissingState = true;
 	}
@@ -1751,7 +1796,7 @@ void CPlayerPed::StopPissing()
 	{
 		if(m_dwPissParticlesHandle)
 		{
-			ScriptCommand(&destroy_particle, m_dwPissParticlesHandle);
+			ScriptCommand<destroy_particle>(m_dwPissParticlesHandle);
 			m_dwPissParticlesHandle = 0;
 		}
 
@@ -1777,7 +1822,7 @@ bool CPlayerPed::IsAnimationPlaying(char* szAnimName)
 	if (!GamePool_Ped_GetAt(m_dwGTAId)) return false;
 	if (!szAnimName || !strlen(szAnimName)) return false;
 
-	if (ScriptCommand(&is_char_playing_anim, m_dwGTAId, szAnimName)) {
+	if (ScriptCommand<is_char_playing_anim>(m_dwGTAId, szAnimName)) {
 		return true;
 	}
 
@@ -1847,27 +1892,27 @@ void CPlayerPed::GiveStuff(eStuffType type)
 	switch(type)
 	{
 		case eStuffType::STUFF_TYPE_BEER:
-			ScriptCommand(&create_object, OBJECT_CJ_BEER_B_2, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
+			ScriptCommand<create_object>(OBJECT_CJ_BEER_B_2, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
 			if(GamePool_Object_GetAt(m_stuffData.dwObject))
-				ScriptCommand(&task_pick_up_object, m_dwGTAId, m_stuffData.dwObject, 0.05000000074505806, 0.02999999932944775, -0.300000011920929, 6, 16, "NULL", "NULL", -1);
+				ScriptCommand<task_pick_up_object>(m_dwGTAId, m_stuffData.dwObject, 0.05000000074505806, 0.02999999932944775, -0.300000011920929, 6, 16, "NULL", "NULL", -1);
 			break;
 
 		case eStuffType::STUFF_TYPE_DYN_BEER:
-			ScriptCommand(&create_object, OBJECT_DYN_BEER_1, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
+			ScriptCommand<create_object>(OBJECT_DYN_BEER_1, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
 			if(GamePool_Object_GetAt(m_stuffData.dwObject))
-				ScriptCommand(&task_pick_up_object, m_dwGTAId, m_stuffData.dwObject, 0.05000000074505806, 0.02999999932944775, -0.05000000074505806, 6, 16, "NULL", "NULL", -1);
+				ScriptCommand<task_pick_up_object>(m_dwGTAId, m_stuffData.dwObject, 0.05000000074505806, 0.02999999932944775, -0.05000000074505806, 6, 16, "NULL", "NULL", -1);
 			break;
 
 		case eStuffType::STUFF_TYPE_PINT_GLASS:
-			ScriptCommand(&create_object, OBJECT_CJ_PINT_GLASS, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
+			ScriptCommand<create_object>(OBJECT_CJ_PINT_GLASS, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
 			if(GamePool_Object_GetAt(m_stuffData.dwObject))
-				ScriptCommand(&task_pick_up_object, m_dwGTAId, m_stuffData.dwObject, 0.03999999910593033, 0.1000000014901161, -0.01999999955296516, 6, 16, "NULL", "NULL", -1);
+				ScriptCommand<task_pick_up_object>(m_dwGTAId, m_stuffData.dwObject, 0.03999999910593033, 0.1000000014901161, -0.01999999955296516, 6, 16, "NULL", "NULL", -1);
 			break;
 
 		case eStuffType::STUFF_TYPE_CIGGI:
-			ScriptCommand(&create_object, OBJECT_CJ_CIGGY, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
+			ScriptCommand<create_object>(OBJECT_CJ_CIGGY, matPlayer.pos.x, matPlayer.pos.y, matPlayer.pos.z, &m_stuffData.dwObject);
 			if(GamePool_Object_GetAt(m_stuffData.dwObject))
-				ScriptCommand(&task_pick_up_object, m_dwGTAId, m_stuffData.dwObject, 0.0, 0.0, 0.0, 6, 16, "NULL", "NULL", -1);
+				ScriptCommand<task_pick_up_object>(m_dwGTAId, m_stuffData.dwObject, 0.0, 0.0, 0.0, 6, 16, "NULL", "NULL", -1);
 			break;
 	}
 
@@ -1881,7 +1926,7 @@ void CPlayerPed::DropStuff()
 
 	if(GamePool_Object_GetAt(m_stuffData.dwObject))
 	{
-		ScriptCommand(&task_pick_up_object, m_dwGTAId, m_stuffData.dwObject, 0.0, 0.0, 0.0, 6, 16, "NULL", "NULL", 0);
+		ScriptCommand<task_pick_up_object>(m_dwGTAId, m_stuffData.dwObject, 0.0, 0.0, 0.0, 6, 16, "NULL", "NULL", 0);
 		m_stuffData.dwObject = 0;
 	}
 
@@ -1910,7 +1955,7 @@ void CPlayerPed::ProcessDrunk()
 		if(iDrunkLevel > 0 && iDrunkLevel <= 2000)
 		{
 			SetDrunkLevel(iDrunkLevel - 1);
-			ScriptCommand(&set_player_drunk_visuals, m_bytePlayerNumber, 0);
+			ScriptCommand<set_player_drunk_visuals>(m_bytePlayerNumber, 0);
 		}
 		else if(iDrunkLevel > 2000 && iDrunkLevel <= 50000)
 		{
@@ -1926,7 +1971,7 @@ void CPlayerPed::ProcessDrunk()
 			}
 
 			SetDrunkLevel(iDrunkLevel - 1);
-			ScriptCommand(&set_player_drunk_visuals, m_bytePlayerNumber, iDrunkVisual);
+			ScriptCommand<set_player_drunk_visuals>(m_bytePlayerNumber, iDrunkVisual);
 
 			if(IsInVehicle() && !IsAPassenger())
 			{
@@ -1968,7 +2013,7 @@ void CPlayerPed::ToggleCellphone(int iOn)
 	if(!m_pPed || !GamePool_Ped_GetAt(m_dwGTAId) || !m_pPed->IsAdded())
 		return;
 
-	ScriptCommand(&toggle_actor_cellphone, m_dwGTAId, iOn);
+	ScriptCommand<toggle_actor_cellphone>(m_dwGTAId, iOn);
 	m_iCellPhoneEnabled = iOn;
 }
 
@@ -2036,7 +2081,7 @@ void CPlayerPed::ClearAllTasks()
 		return;
 	}
 
-	ScriptCommand(&clear_char_tasks, m_dwGTAId);
+	ScriptCommand<clear_char_tasks>(m_dwGTAId);
 }
 
 void CPlayerPed::ProcessSpecialAction(int iAction)
@@ -2205,7 +2250,7 @@ bool CPlayerPed::StartPassengerDriveByMode()
 	}
 
 	SetArmedWeapon(iWeapon, 0);
-	ScriptCommand(&enter_passenger_driveby, m_dwGTAId, -1, -1, 0.0f, 0.0f, 0.0f, 300.0f, 8, 1, 100);
+	ScriptCommand<enter_passenger_driveby>(m_dwGTAId, -1, -1, 0.0f, 0.0f, 0.0f, 300.0f, 8, 1, 100);
 	return true;
 }
 
@@ -4,6 +4,7 @@
 #include "object.h"
 #include "game/Entity/CPedGTA.h"
 #include "aimstuff.h"
+#include "modelrequests.h"
 
 enum eStuffType {
 	STUFF_TYPE_NONE,
@@ -83,6 +84,7 @@ public:
 	void PlayAnimationFromIndex(int iIndex, float fDelta);
 	uint8_t GetCurrentWeapon();
 	void SetInitialState();
+	// the skin is swapped in once it is resident
 	void SetModelIndex(uint uiModel);
 	void ClearWeapons();
 	void ResetDamageEntity();
@@ -237,6 +239,10 @@ public:
 	int m_iCarryState;
     int iSpecialAction;
 private:
+	void ApplyModelIndex(uint uiModel);
+
+	MODELREQUEST m_dwModelRequest;	// skin waiting for the streamer
+	std::vector<MODELREQUEST> m_WeaponRequests;	// weapons waiting for the streamer, dropped by ClearWeapons
 
 	bool m_bHaveBulletData;
 	BULLET_DATA m_bulletData;
@@ -3,79 +3,76 @@
 
 GAME_SCRIPT_THREAD* gst;
 char ScriptBuf[0xFF];
-uintptr_t *pdwParamVars[18];
 
-uint8_t ExecuteScriptBuf()
-{
-    gst->dwScriptIP = (uintptr_t)ScriptBuf;
-    (( void (*)(GAME_SCRIPT_THREAD*))(g_libGTASA + (VER_x32 ? 0x0032B708 + 1 : 0x3F445C)))(gst);
+#define ProcessOneCommand(thread) \
+    (( void (*)(GAME_SCRIPT_THREAD*))(g_libGTASA + (VER_x32 ? 0x0032B708 + 1 : 0x3F445C)))(thread)
 
-    return gst->condResult;
+void ScriptBufferInit(SCRIPT_BUFFER *pBuffer, uint8_t *pData, int iSize)
+{
+    pBuffer->pData = pData;
+    pBuffer->iSize = iSize;
+    pBuffer->iPos = 0;
+    pBuffer->iVars = 0;
 }
 
-int ScriptCommand(const SCRIPT_COMMAND *pScriptCommand, ...)
+bool EncodeScriptCommand(SCRIPT_BUFFER *pBuffer, const SCRIPT_COMMAND *pScriptCommand, va_list ap)
 {
     if (!pScriptCommand || !pScriptCommand->Params) {
         //FLog("Error: Invalid ScriptCommand structure!");
-        return 0;
+        return false;
     }
 
-    va_list ap;
     const char* p = pScriptCommand->Params;
-    va_start(ap, pScriptCommand);
-    memcpy(&ScriptBuf, &pScriptCommand->OpCode, 2);
-    int buf_pos = 2;
-    uint16_t var_pos = 0;
+    uint8_t* buf = pBuffer->pData;
+    int buf_size = pBuffer->iSize;
+    int buf_pos = pBuffer->iPos;
+    uint16_t var_pos = pBuffer->iVars;
 
-    for (int i = 0; i < 18; i++) {
-        gst->dwLocalVar[i] = 0;
-    }
+    if (buf_pos + 2 > buf_size) return false;
+    memcpy(&buf[buf_pos], &pScriptCommand->OpCode, 2);
+    buf_pos += 2;
 
     //FLog("ScriptCommand: OpCode=0x%04x, Params=%s", pScriptCommand->OpCode, pScriptCommand->Params);
 
     while (*p) {
-        if (buf_pos >= sizeof(ScriptBuf)) {
+        if (buf_pos >= buf_size) {
             //FLog("Error: Buffer overflow detected in ScriptBuf!");
-            va_end(ap);
-            return 0;
+            return false;
         }
 
         switch (*p) {
             case 'i': {
                 int i = va_arg(ap, int);
-                if (buf_pos + 5 > sizeof(ScriptBuf)) {
+                if (buf_pos + 5 > buf_size) {
                     //FLog("Error: Buffer overflow detected while processing 'i'!");
-                    va_end(ap);
-                    return 0;
+                    return false;
                 }
-                ScriptBuf[buf_pos++] = 0x01;
-                memcpy(&ScriptBuf[buf_pos], &i, 4);
+                buf[buf_pos++] = SCRIPT_PARAM_INT;
+                memcpy(&buf[buf_pos], &i, 4);
                 buf_pos += 4;
                 break;
             }
             case 'f': {
                 float f = (float)va_arg(ap, double);
-                if (buf_pos + 5 > sizeof(ScriptBuf)) {
+                if (buf_pos + 5 > buf_size) {
                     //FLog("Error: Buffer overflow detected while processing 'f'!");
-                    va_end(ap);
-                    return 0;
+                    return false;
                 }
-                ScriptBuf[buf_pos++] = 0x06;
-                memcpy(&ScriptBuf[buf_pos], &f, 4);
+                buf[buf_pos++] = SCRIPT_PARAM_FLOAT;
+                memcpy(&buf[buf_pos], &f, 4);
                 buf_pos += 4;
                 break;
             }
             case 'v': {
-                if (var_pos >= sizeof(pdwParamVars) / sizeof(pdwParamVars[0])) {
+                if (var_pos >= SCRIPT_MAX_LOCAL_VARS || buf_pos + 3 > buf_size) {
                     //FLog("Error: Too many variables for ScriptCommand!");
-                    va_end(ap);
-                    return 0;
+                    return false;
                 }
                 uintptr *v = va_arg(ap, uintptr*);
-                ScriptBuf[buf_pos++] = 0x03;
-                pdwParamVars[var_pos] = v;
-                gst->dwLocalVar[var_pos] = *v;
-                memcpy(&ScriptBuf[buf_pos], &var_pos, 2);
+                buf[buf_pos++] = SCRIPT_PARAM_LOCALVAR;
+                pBuffer->pVars[var_pos] = v;
+                pBuffer->byteVarSize[var_pos] = sizeof(uintptr);
+                memcpy(&buf[buf_pos], &var_pos, 2);
                 buf_pos += 2;
                 var_pos++;
                 break;
@@ -83,53 +80,105 @@ int ScriptCommand(const SCRIPT_COMMAND *pScriptCommand, ...)
             case 's': {
                 char* sz = va_arg(ap, char*);
                 unsigned char aLen = strlen(sz);
-                if (buf_pos + aLen + 2 > sizeof(ScriptBuf)) {
+                if (buf_pos + aLen + 2 > buf_size) {
                     //FLog("Error: Buffer overflow detected while processing 's'!");
-                    va_end(ap);
-                    return 0;
+                    return false;
                 }
-                ScriptBuf[buf_pos++] = 0x0E;
-                ScriptBuf[buf_pos++] = aLen;
-                memcpy(&ScriptBuf[buf_pos], sz, aLen);
+                buf[buf_pos++] = SCRIPT_PARAM_STRING;
+                buf[buf_pos++] = aLen;
+                memcpy(&buf[buf_pos], sz, aLen);
                 buf_pos += aLen;
                 break;
             }
             case 'z': {
-                if (buf_pos + 1 > sizeof(ScriptBuf)) {
+                if (buf_pos + 1 > buf_size) {
                     //FLog("Error: Buffer overflow detected while processing 'z'!");
-                    va_end(ap);
-                    return 0;
+                    return false;
                 }
-                ScriptBuf[buf_pos++] = 0x00;
+                buf[buf_pos++] = SCRIPT_PARAM_END;
                 break;
             }
             default: {
                 //FLog("Error: Invalid parameter type '%c'", *p);
-                va_end(ap);
-                return 0;
+                return false;
             }
         }
         ++p;
     }
 
-    va_end(ap);
+    pBuffer->iPos = buf_pos;
+    pBuffer->iVars = var_pos;
+    return true;
+}
 
-    //FLog("Executing ScriptBuf...");
-    int result = ExecuteScriptBuf();
-    if (var_pos) {
-        for (int i = 0; i < var_pos; i++) {
-            *pdwParamVars[i] = gst->dwLocalVar[i];
-        }
+int ExecuteScriptBuffer(SCRIPT_BUFFER *pBuffer, int iCommands, bool *pResults)
+{
+    memset(gst->dwLocalVar, 0, sizeof(int32_t) * SCRIPT_MAX_LOCAL_VARS);
+    for (int i = 0; i < pBuffer->iVars; i++) {
+        if (pBuffer->byteVarSize[i] == 4) memcpy(&gst->dwLocalVar[i], pBuffer->pVars[i], 4);
+        else gst->dwLocalVar[i] = *(uintptr*)pBuffer->pVars[i];
+    }
+
+    // every command moves the IP past its own parameters
+    uintptr dwEnd = (uintptr)(pBuffer->pData + pBuffer->iPos);
+    gst->dwScriptIP = (uintptr)pBuffer->pData;
+
+    int result = 0;
+    for (int i = 0; i < iCommands && gst->dwScriptIP < dwEnd; i++)
+    {
+        ProcessOneCommand(gst);
+
+        result = gst->condResult;
+        if (pResults) pResults[i] = gst->condResult;
+    }
+
+    for (int i = 0; i < pBuffer->iVars; i++) {
+        if (pBuffer->byteVarSize[i] == 4) memcpy(pBuffer->pVars[i], &gst->dwLocalVar[i], 4);
+        else *(uintptr*)pBuffer->pVars[i] = gst->dwLocalVar[i];
     }
 
     //FLog("ScriptCommand execution finished with result: %d", result);
     return result;
 }
 
+int ScriptCommand(const SCRIPT_COMMAND *pScriptCommand, ...)
+{
+    SCRIPT_BUFFER buffer;
+    ScriptBufferInit(&buffer, (uint8_t*)ScriptBuf, sizeof(ScriptBuf));
+
+    va_list ap;
+    va_start(ap, pScriptCommand);
+    bool bEncoded = EncodeScriptCommand(&buffer, pScriptCommand, ap);
+    va_end(ap);
+
+    if (!bEncoded) return 0;
+
+    //FLog("Executing ScriptBuf...");
+    return ExecuteScriptBuffer(&buffer);
+}
+
+CScriptBatch::CScriptBatch()
+{
+    Clear();
+}
+
+void CScriptBatch::Clear()
+{
+    ScriptBufferInit(&m_Buffer, m_Data, sizeof(m_Data));
+    m_iCommands = 0;
+    memset(m_bResults, 0, sizeof(m_bResults));
+}
+
+int CScriptBatch::Execute()
+{
+    if (m_iCommands == 0) return 0;
+    return ExecuteScriptBuffer(&m_Buffer, m_iCommands, m_bResults);
+}
+
 void InitScripting()
 {
     FLog("InitScripting");
     gst = new GAME_SCRIPT_THREAD;
     memset(gst, 0, sizeof(GAME_SCRIPT_THREAD));
 
-}
\ No newline at end of file
+}
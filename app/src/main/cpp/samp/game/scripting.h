@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstdarg>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #define MAX_SCRIPT_VARS	16
 
 struct GAME_SCRIPT_THREAD
@@ -52,122 +58,413 @@ struct SCRIPT_COMMAND
 };
 #pragma pack(pop)
 
+/*
+	Encoded command, little endian:
+		uint16	opcode
+		per parameter a type byte followed by the value
+			'i'	0x01 int32
+			'f'	0x06 float
+			'v'	0x03 uint16 local variable index
+			's'	0x0E uint8 length, chars (no terminator)
+			'z'	0x00 (end of a variable argument list)
+*/
+#define SCRIPT_PARAM_INT		0x01
+#define SCRIPT_PARAM_LOCALVAR	0x03
+#define SCRIPT_PARAM_FLOAT		0x06
+#define SCRIPT_PARAM_STRING		0x0E
+#define SCRIPT_PARAM_END		0x00
+
+#define SCRIPT_MAX_LOCAL_VARS	32		// 'v' slots per buffer, dwLocalVar has 42
+
+// destination of the encoders, holds no game state so it can be filled and checked anywhere
+struct SCRIPT_BUFFER
+{
+	uint8_t *pData;
+	int iSize;
+	int iPos;
+	void *pVars[SCRIPT_MAX_LOCAL_VARS];		// caller variable of each local var index
+	uint8_t byteVarSize[SCRIPT_MAX_LOCAL_VARS];	// 4 or 8, handles are often kept in an uintptr
+	int iVars;
+};
+
+void ScriptBufferInit(SCRIPT_BUFFER *pBuffer, uint8_t *pData, int iSize);
+// the generic encoder, the buffer is left untouched when the command doesn't fit
+bool EncodeScriptCommand(SCRIPT_BUFFER *pBuffer, const SCRIPT_COMMAND *pScriptCommand, va_list ap);
+// loads the 'v' variables, runs iCommands commands from the start of the buffer
+// and stores the variables back, returns the condition result of the last one
+int ExecuteScriptBuffer(SCRIPT_BUFFER *pBuffer, int iCommands = 1, bool *pResults = nullptr);
+
 int ScriptCommand(const SCRIPT_COMMAND *pScriptCommand, ...);
 
-const SCRIPT_COMMAND create_player = { 0x0053, "vfffv" };	// 0, x, y, z, PLAYER_CHAR
-const SCRIPT_COMMAND create_actor_from_player				= { 0x01F5, "vv" };		// PLAYER_CHAR, PLAYER_ACTOR
-const SCRIPT_COMMAND set_camera_behind_player				= { 0x0373, "" };
-const SCRIPT_COMMAND restore_camera_jumpcut					= { 0x02EB, "" };
-const SCRIPT_COMMAND request_model							= { 0x0247, "i" };		// (CAR_*|BIKE_*|BOAT_*|WEAPON_*|OBJECT_*)
-const SCRIPT_COMMAND load_requested_models					= { 0x038B, "" };
-const SCRIPT_COMMAND is_model_available						= { 0x0248, "i" };		// #MODEL
-const SCRIPT_COMMAND release_model							= { 0x0249,	"i" };
-const SCRIPT_COMMAND set_actor_weapon_droppable				= { 0x087e, "ii" };
-const SCRIPT_COMMAND set_actor_immunities					= { 0x02ab, "iiiiii" };
-const SCRIPT_COMMAND set_actor_can_be_decapitated			= { 0x0446, "ii" };
-const SCRIPT_COMMAND destroy_object_with_fade				= { 0x09A2, "i" };
-const SCRIPT_COMMAND disassociate_object					= { 0x0682, "ifffi" };
-const SCRIPT_COMMAND remove_actor_from_car_and_put_at		= { 0x0362, "ifff" };
-const SCRIPT_COMMAND set_camera_position					= { 0x015F, "ffffff" };
-const SCRIPT_COMMAND point_camera							= { 0x0160, "fffi" };
-const SCRIPT_COMMAND put_train_at							= { 0x07c7, "ifff" };
-const SCRIPT_COMMAND set_current_time						= { 0x00C0, "ii" };		// Hours, Minutes
-const SCRIPT_COMMAND toggle_player_controllable				= { 0x01B4, "ii" };
-const SCRIPT_COMMAND lock_actor								= { 0x04d7, "ii" };
-const SCRIPT_COMMAND play_sound								= { 0x018c, "fffi" };
-const SCRIPT_COMMAND enable_train_traffic					= { 0x06d7, "i" };
-const SCRIPT_COMMAND refresh_streaming_at					= { 0x04E4, "ff" };
-const SCRIPT_COMMAND restart_if_wasted_at					= { 0x016C, "ffffi" };
-const SCRIPT_COMMAND set_actor_z_angle						= { 0x0173, "if" };
-const SCRIPT_COMMAND enable_zone_names						= { 0x09BA, "i" };
-const SCRIPT_COMMAND link_actor_to_interior					= { 0x0860, "ii" };
-const SCRIPT_COMMAND select_interior						= { 0x04BB, "i" };
-const SCRIPT_COMMAND restore_camera_to_user					= { 0x0925, "" };
-const SCRIPT_COMMAND lock_camera_position					= { 0x0930, "i" };
-const SCRIPT_COMMAND lock_camera_position1 = { 0x0930, "i" };
-const SCRIPT_COMMAND get_active_interior					= { 0x077e, "v" };
-const SCRIPT_COMMAND request_animation						= { 0x04ED, "s" };
-const SCRIPT_COMMAND is_animation_loaded					= { 0x04EE, "s" };
-const SCRIPT_COMMAND text_clear_all							= { 0x00be, "" };
-const SCRIPT_COMMAND set_actor_money						= { 0x03fe, "ii" };
-const SCRIPT_COMMAND disable_marker							= { 0x0164, "i" };
-const SCRIPT_COMMAND create_arrow_above_actor				= { 0x0187, "iv" };
-const SCRIPT_COMMAND set_marker_color						= { 0x0165, "ii" };
-const SCRIPT_COMMAND show_on_radar2							= { 0x018b, "ii" };
-const SCRIPT_COMMAND set_fighting_style						= { 0x07fe, "iii" };
-const SCRIPT_COMMAND apply_animation						= { 0x0812, "issfiiiii" };
-const SCRIPT_COMMAND get_line_of_sight						= { 0x06BD, "ffffffiiiii" }; // x1, y1, z1, x2, y2, z2, solid, vehicle, actor, obj, fx
-const SCRIPT_COMMAND create_explosion_with_radius			= { 0x0948, "fffii" };
-const SCRIPT_COMMAND get_ground_z							= { 0x02ce, "fffv" };	// x, y, z, var_ground_z
-const SCRIPT_COMMAND create_radar_marker_icon				= { 0x0570, "fffiv" };
-const SCRIPT_COMMAND create_icon_marker_sphere				= { 0x02A7, "fffiv" };
-const SCRIPT_COMMAND create_radar_marker_without_sphere		= { 0x04CE, "fffiv" };
-const SCRIPT_COMMAND show_on_radar							= { 0x0168, "ii" };
-const SCRIPT_COMMAND create_marker_icon						= { 0x02A8, "fffiv" };
-const SCRIPT_COMMAND is_actor_near_point_3d					= { 0x00FE, "iffffffi" };
-const SCRIPT_COMMAND create_racing_checkpoint				= { 0x06d5,	"ifffffffv" };
-const SCRIPT_COMMAND destroy_racing_checkpoint				= { 0x06d6,	"i" };
-const SCRIPT_COMMAND camera_on_actor						= { 0x0159, "iii" };
-const SCRIPT_COMMAND camera_on_vehicle						= { 0x0158, "iii" };
-const SCRIPT_COMMAND create_car								= { 0x00A5, "ifffv" };
-const SCRIPT_COMMAND set_car_z_angle						= { 0x0175, "if" };
-const SCRIPT_COMMAND car_gas_tank_explosion					= { 0x09C4, "ii" };
-const SCRIPT_COMMAND set_car_hydraulics						= { 0x07FF,	"ii" };
-const SCRIPT_COMMAND toggle_car_tires_vulnerable			= { 0x053f, "ii" };
-const SCRIPT_COMMAND link_vehicle_to_interior				= { 0x0840, "ii" };
-const SCRIPT_COMMAND destroy_car							= { 0x00A6, "i" };
-const SCRIPT_COMMAND set_car_door_rotation_to				= { 0x08A6, "iif" };
-const SCRIPT_COMMAND destroy_train							= { 0x07bd, "i" };
-const SCRIPT_COMMAND put_actor_in_car						= { 0x036A, "ii" };
-const SCRIPT_COMMAND TASK_WARP_CHAR_INTO_CAR_AS_DRIVER		= { 0x072A, "ii" };
-const SCRIPT_COMMAND put_actor_in_car2						= { 0x0430, "iii" };
-const SCRIPT_COMMAND send_actor_to_car_passenger			= { 0x05CA, "iiii" };
-const SCRIPT_COMMAND send_actor_to_car_driverseat			= { 0x05CB, "iii" };
-const SCRIPT_COMMAND make_actor_leave_car					= { 0x05CD, "ii" };
-const SCRIPT_COMMAND set_car_immunities						= { 0x02ac, "iiiiii" };
-const SCRIPT_COMMAND add_to_player_money					= { 0x0109, "ii" };
-const SCRIPT_COMMAND tie_marker_to_car						= { 0x0161, "iiiv" };
-const SCRIPT_COMMAND has_car_sunk							= { 0x02bf, "i" };
-const SCRIPT_COMMAND set_camera_pos_time_smooth				= { 0x0936, "ffffffii" };
-const SCRIPT_COMMAND point_camera_transverse				= { 0x0920, "ffffffii" };
-const SCRIPT_COMMAND create_object							= { 0x0107, "ifffv" };
-const SCRIPT_COMMAND put_object_at							= { 0x01Bc, "ifff" };
-const SCRIPT_COMMAND destroy_object							= { 0x0108, "i" };
-const SCRIPT_COMMAND set_object_rotation					= { 0x0453, "ifff" };
-const SCRIPT_COMMAND create_pickup							= { 0x0213, "iifffv" };
-const SCRIPT_COMMAND destroy_pickup							= { 0x0215, "i" };
-const SCRIPT_COMMAND is_pickup_picked_up					= { 0x0214, "i" };
-const SCRIPT_COMMAND get_actor_armed_weapon					= { 0x0470, "iv" };
-const SCRIPT_COMMAND lock_camera_target_point				= { 0x092F, "i" };
-const SCRIPT_COMMAND set_actor_armed_weapon					= { 0x01b9, "ii" };
-const SCRIPT_COMMAND create_train							= { 0x06D8, "ifffiv" };
-const SCRIPT_COMMAND change_car_skin						= { 0x06ED,	"ii" };
-const SCRIPT_COMMAND detach_trailer_from_cab				= { 0x07AC, "ii" };
-const SCRIPT_COMMAND add_car_component						= { 0x06E7, "iiv" };	// CAR, COMPONENT, COMPONENT VAR NAME
-const SCRIPT_COMMAND is_component_available					= { 0x06EA, "i" };
-const SCRIPT_COMMAND request_car_component					= { 0x06E9, "i" };
-const SCRIPT_COMMAND put_trailer_on_cab						= { 0x893, "ii" };
-const SCRIPT_COMMAND remove_component						= { 0x06E8, "ii" };
-const SCRIPT_COMMAND attach_object_to_actor					= { 0x069b, "iiffffff" };
-const SCRIPT_COMMAND toggle_widescreen						= { 0x02A3, "i" };		// widescreen(1/0)
-const SCRIPT_COMMAND create_actor							= { 0x009A, "iifffv" };
-const SCRIPT_COMMAND set_actor_decision_marker				= { 0x060B, "ii" };
-const SCRIPT_COMMAND kill_actor								= { 0x0321, "i" };
-const SCRIPT_COMMAND set_engine_state						= { 0x0918, "ii" };
-const SCRIPT_COMMAND is_object_attached						= { 0x0685, "i" };
-const SCRIPT_COMMAND attach_object_to_car					= { 0x0681, "iiffffff" };
-const SCRIPT_COMMAND attach_object_to_object				= { 0x069A, "iiffffff" };
-const SCRIPT_COMMAND is_char_playing_anim					= { 0x0611, "is" };
-const SCRIPT_COMMAND attach_particle_to_actor2				= { 0x066A, "siffffffiv" };
-const SCRIPT_COMMAND destroy_particle						= { 0x650, "i" };
-const SCRIPT_COMMAND make_particle_visible					= { 0x64c, "i" };
-const SCRIPT_COMMAND task_hands_up							= { 0x5c4, "ii" }; // actor handle, time(in ms.)
-const SCRIPT_COMMAND set_player_drunk_visuals				= { 0x052C, "ii" }; // player, severity (0-255)
-const SCRIPT_COMMAND get_player_drunkenness					= { 0x052D, "" };
-const SCRIPT_COMMAND set_player_drunk_handling				= { 0x03FD, "ii" };
-const SCRIPT_COMMAND task_pick_up_object					= { 0x070A, "iifffiissi" };
-const SCRIPT_COMMAND toggle_actor_cellphone					= { 0x0729, "ii" }; // actor handle, start
-const SCRIPT_COMMAND is_actor_colliding_with_car			= { 0x0547, "ii" }; // actor handle, vehicle handle
-const SCRIPT_COMMAND clear_char_tasks 						= { 0x0687, "i" };
-const SCRIPT_COMMAND enter_passenger_driveby   			= { 0x0713, "iiiffffiii" };
-const SCRIPT_COMMAND force_car_lights = { 0x067F, "ii" };
\ No newline at end of file
+/*
+	Precompiled encoder: the opcode, type bytes and value offsets of a descriptor
+	are worked out at compile time, a call copies the template and patches the values.
+	The output is byte for byte what EncodeScriptCommand() produces.
+
+		ScriptCommand<create_car>(iModel, x, y, z, &dwHandle);
+*/
+namespace script_detail
+{
+	constexpr int ParamCount(const char *p)
+	{
+		int n = 0;
+		while (p[n]) n++;
+		return n;
+	}
+
+	// encoded size, strings without their chars
+	constexpr int ParamSize(char c)
+	{
+		switch (c)
+		{
+		case 'i': case 'f': return 5;
+		case 'v': return 3;
+		case 's': return 2;
+		case 'z': return 1;
+		}
+		return -1;
+	}
+
+	constexpr uint8_t ParamType(char c)
+	{
+		switch (c)
+		{
+		case 'i': return SCRIPT_PARAM_INT;
+		case 'f': return SCRIPT_PARAM_FLOAT;
+		case 'v': return SCRIPT_PARAM_LOCALVAR;
+		case 's': return SCRIPT_PARAM_STRING;
+		}
+		return SCRIPT_PARAM_END;
+	}
+
+	struct Layout
+	{
+		int iParams;
+		int iSize;
+		int iArgs;
+		int iVars;
+		bool bStrings;
+		bool bValid;
+		int iOffset[MAX_SCRIPT_VARS];	// of the type byte
+		int iArg[MAX_SCRIPT_VARS];		// argument of each parameter, -1 for 'z'
+		uint8_t Bytes[2 + 5 * MAX_SCRIPT_VARS];
+	};
+
+	template<const SCRIPT_COMMAND &Cmd>
+	constexpr Layout BuildLayout()
+	{
+		Layout l = {};
+		l.iParams = ParamCount(Cmd.Params);
+		l.iSize = 2;
+		l.bValid = true;
+		l.Bytes[0] = Cmd.OpCode & 0xFF;
+		l.Bytes[1] = Cmd.OpCode >> 8;
+
+		for (int i = 0; i < l.iParams; i++)
+		{
+			char c = Cmd.Params[i];
+			if (ParamSize(c) < 0) {
+				l.bValid = false;
+				break;
+			}
+			if (c == 'v') l.iVars++;
+			if (c == 's') l.bStrings = true;
+
+			l.iOffset[i] = l.iSize;
+			l.iArg[i] = (c == 'z') ? -1 : l.iArgs++;
+			l.Bytes[l.iSize] = ParamType(c);
+			l.iSize += ParamSize(c);
+		}
+		return l;
+	}
+}
+
+template<const SCRIPT_COMMAND &Cmd>
+class CScriptCommand
+{
+	static constexpr script_detail::Layout L = script_detail::BuildLayout<Cmd>();
+	static constexpr int NumParams = L.iParams;
+	static_assert(L.bValid, "unknown SCRIPT_COMMAND parameter type");
+	static_assert(L.iVars <= SCRIPT_MAX_LOCAL_VARS, "too many 'v' parameters");
+
+public:
+	// fixed size of the encoded command, without string chars
+	static constexpr int Size = L.iSize;
+
+	template<typename... Args>
+	static bool Encode(SCRIPT_BUFFER *pBuffer, Args... args)
+	{
+		static_assert(sizeof...(Args) == L.iArgs, "argument count doesn't match the SCRIPT_COMMAND parameters");
+
+		if (pBuffer->iVars + L.iVars > SCRIPT_MAX_LOCAL_VARS) return false;
+
+		int iSize = L.iSize;
+		if constexpr (L.bStrings) {
+			iSize += StringsLength(args...);
+		}
+		if (pBuffer->iPos + iSize > pBuffer->iSize) return false;
+
+		uint8_t *p = pBuffer->pData + pBuffer->iPos;
+		if constexpr (!L.bStrings)
+		{
+			// every offset is known, copy the template and patch the values
+			memcpy(p, L.Bytes, L.iSize);
+			int iVar = pBuffer->iVars;
+			PatchAll(p, pBuffer, iVar, std::make_index_sequence<NumParams>(), std::forward_as_tuple(args...));
+			pBuffer->iVars = iVar;
+			pBuffer->iPos += L.iSize;
+		}
+		else
+		{
+			// strings shift whatever follows them, write the parameters one by one
+			memcpy(p, L.Bytes, 2);
+			int iPos = 2;
+			int iVar = pBuffer->iVars;
+			WriteAll(p, iPos, pBuffer, iVar, std::make_index_sequence<NumParams>(), std::forward_as_tuple(args...));
+			pBuffer->iVars = iVar;
+			pBuffer->iPos += iPos;
+		}
+		return true;
+	}
+
+private:
+	static int StringLength(const char *sz) { return (unsigned char)strlen(sz); }
+	template<typename T>
+	static int StringLength(const T &) { return 0; }
+
+	template<typename... Args>
+	static int StringsLength(const Args &... args) { return (0 + ... + StringLength(args)); }
+
+	template<char C, typename T>
+	static void WriteValue(uint8_t *p, SCRIPT_BUFFER *pBuffer, int &iVar, const T &value)
+	{
+		if constexpr (C == 'i') {
+			int32_t i = (int32_t)value;
+			memcpy(p, &i, 4);
+		}
+		else if constexpr (C == 'f') {
+			float f = (float)value;
+			memcpy(p, &f, 4);
+		}
+		else if constexpr (C == 'v') {
+			static_assert(std::is_pointer<T>::value && (sizeof(*value) == 4 || sizeof(*value) == 8),
+				"'v' takes a pointer to a 32 or 64-bit variable");
+			uint16_t wVar = (uint16_t)iVar;
+			pBuffer->pVars[iVar] = (void *)value;
+			pBuffer->byteVarSize[iVar++] = sizeof(*value);
+			memcpy(p, &wVar, 2);
+		}
+	}
+
+	template<size_t... P, typename Tuple>
+	static void PatchAll(uint8_t *p, SCRIPT_BUFFER *pBuffer, int &iVar, std::index_sequence<P...>, Tuple args)
+	{
+		(PatchParam<P>(p, pBuffer, iVar, args), ...);
+	}
+
+	template<size_t P, typename Tuple>
+	static void PatchParam(uint8_t *p, SCRIPT_BUFFER *pBuffer, int &iVar, Tuple &args)
+	{
+		constexpr char c = Cmd.Params[P];
+		if constexpr (c != 'z') {
+			WriteValue<c>(p + L.iOffset[P] + 1, pBuffer, iVar, std::get<L.iArg[P]>(args));
+		}
+	}
+
+	template<size_t... P, typename Tuple>
+	static void WriteAll(uint8_t *p, int &iPos, SCRIPT_BUFFER *pBuffer, int &iVar, std::index_sequence<P...>, Tuple args)
+	{
+		(WriteParam<P>(p, iPos, pBuffer, iVar, args), ...);
+	}
+
+	template<size_t P, typename Tuple>
+	static void WriteParam(uint8_t *p, int &iPos, SCRIPT_BUFFER *pBuffer, int &iVar, Tuple &args)
+	{
+		constexpr char c = Cmd.Params[P];
+		p[iPos++] = script_detail::ParamType(c);
+
+		if constexpr (c == 's') {
+			const char *sz = std::get<L.iArg[P]>(args);
+			unsigned char aLen = strlen(sz);
+			p[iPos++] = aLen;
+			memcpy(p + iPos, sz, aLen);
+			iPos += aLen;
+		}
+		else if constexpr (c != 'z') {
+			WriteValue<c>(p + iPos, pBuffer, iVar, std::get<L.iArg[P]>(args));
+			iPos += script_detail::ParamSize(c) - 1;
+		}
+	}
+};
+
+extern char ScriptBuf[0xFF];
+
+template<const SCRIPT_COMMAND &Cmd, typename... Args>
+int ScriptCommand(Args... args)
+{
+	SCRIPT_BUFFER buffer;
+	ScriptBufferInit(&buffer, (uint8_t *)ScriptBuf, sizeof(ScriptBuf));
+	if (!CScriptCommand<Cmd>::Encode(&buffer, args...)) return 0;
+
+	return ExecuteScriptBuffer(&buffer);
+}
+
+/*
+	Several commands encoded back to back and run in one go: the script thread
+	and its local variables are set up once, then the interpreter steps through
+	the whole buffer. Every command keeps its own condition result.
+*/
+#define SCRIPT_BATCH_SIZE			0x400
+#define SCRIPT_BATCH_MAX_COMMANDS	64
+
+class CScriptBatch
+{
+public:
+	CScriptBatch();
+
+	void Clear();
+
+	// false if the command doesn't fit, the batch is left as it was
+	template<const SCRIPT_COMMAND &Cmd, typename... Args>
+	bool Add(Args... args)
+	{
+		if (m_iCommands >= SCRIPT_BATCH_MAX_COMMANDS) return false;
+		if (!CScriptCommand<Cmd>::Encode(&m_Buffer, args...)) return false;
+
+		m_iCommands++;
+		return true;
+	}
+
+	// condition result of the last command
+	int Execute();
+
+	int GetCount() const { return m_iCommands; }
+	bool GetResult(int iCommand) const { return m_bResults[iCommand]; }
+
+	const uint8_t *GetData() const { return m_Data; }
+	int GetSize() const { return m_Buffer.iPos; }
+
+private:
+	uint8_t m_Data[SCRIPT_BATCH_SIZE];
+	SCRIPT_BUFFER m_Buffer;
+	int m_iCommands;
+	bool m_bResults[SCRIPT_BATCH_MAX_COMMANDS];
+};
+
+constexpr SCRIPT_COMMAND create_player = { 0x0053, "vfffv" };	// 0, x, y, z, PLAYER_CHAR
+constexpr SCRIPT_COMMAND create_actor_from_player				= { 0x01F5, "vv" };		// PLAYER_CHAR, PLAYER_ACTOR
+constexpr SCRIPT_COMMAND set_camera_behind_player				= { 0x0373, "" };
+constexpr SCRIPT_COMMAND restore_camera_jumpcut					= { 0x02EB, "" };
+constexpr SCRIPT_COMMAND request_model							= { 0x0247, "i" };		// (CAR_*|BIKE_*|BOAT_*|WEAPON_*|OBJECT_*)
+constexpr SCRIPT_COMMAND load_requested_models					= { 0x038B, "" };
+constexpr SCRIPT_COMMAND is_model_available						= { 0x0248, "i" };		// #MODEL
+constexpr SCRIPT_COMMAND release_model							= { 0x0249,	"i" };
+constexpr SCRIPT_COMMAND set_actor_weapon_droppable				= { 0x087e, "ii" };
+constexpr SCRIPT_COMMAND set_actor_immunities					= { 0x02ab, "iiiiii" };
+constexpr SCRIPT_COMMAND set_actor_can_be_decapitated			= { 0x0446, "ii" };
+constexpr SCRIPT_COMMAND destroy_object_with_fade				= { 0x09A2, "i" };
+constexpr SCRIPT_COMMAND disassociate_object					= { 0x0682, "ifffi" };
+constexpr SCRIPT_COMMAND remove_actor_from_car_and_put_at		= { 0x0362, "ifff" };
+constexpr SCRIPT_COMMAND set_camera_position					= { 0x015F, "ffffff" };
+constexpr SCRIPT_COMMAND point_camera							= { 0x0160, "fffi" };
+constexpr SCRIPT_COMMAND put_train_at							= { 0x07c7, "ifff" };
+constexpr SCRIPT_COMMAND set_current_time						= { 0x00C0, "ii" };		// Hours, Minutes
+constexpr SCRIPT_COMMAND toggle_player_controllable				= { 0x01B4, "ii" };
+constexpr SCRIPT_COMMAND lock_actor								= { 0x04d7, "ii" };
+constexpr SCRIPT_COMMAND play_sound								= { 0x018c, "fffi" };
+constexpr SCRIPT_COMMAND enable_train_traffic					= { 0x06d7, "i" };
+constexpr SCRIPT_COMMAND refresh_streaming_at					= { 0x04E4, "ff" };
+constexpr SCRIPT_COMMAND restart_if_wasted_at					= { 0x016C, "ffffi" };
+constexpr SCRIPT_COMMAND set_actor_z_angle						= { 0x0173, "if" };
+constexpr SCRIPT_COMMAND enable_zone_names						= { 0x09BA, "i" };
+constexpr SCRIPT_COMMAND link_actor_to_interior					= { 0x0860, "ii" };
+constexpr SCRIPT_COMMAND select_interior						= { 0x04BB, "i" };
+constexpr SCRIPT_COMMAND restore_camera_to_user					= { 0x0925, "" };
+constexpr SCRIPT_COMMAND lock_camera_position					= { 0x0930, "i" };
+constexpr SCRIPT_COMMAND lock_camera_position1 = { 0x0930, "i" };
+constexpr SCRIPT_COMMAND get_active_interior					= { 0x077e, "v" };
+constexpr SCRIPT_COMMAND request_animation						= { 0x04ED, "s" };
+constexpr SCRIPT_COMMAND is_animation_loaded					= { 0x04EE, "s" };
+constexpr SCRIPT_COMMAND text_clear_all							= { 0x00be, "" };
+constexpr SCRIPT_COMMAND set_actor_money						= { 0x03fe, "ii" };
+constexpr SCRIPT_COMMAND disable_marker							= { 0x0164, "i" };
+constexpr SCRIPT_COMMAND create_arrow_above_actor				= { 0x0187, "iv" };
+constexpr SCRIPT_COMMAND set_marker_color						= { 0x0165, "ii" };
+constexpr SCRIPT_COMMAND show_on_radar2							= { 0x018b, "ii" };
+constexpr SCRIPT_COMMAND set_fighting_style						= { 0x07fe, "iii" };
+constexpr SCRIPT_COMMAND apply_animation						= { 0x0812, "issfiiiii" };
+constexpr SCRIPT_COMMAND get_line_of_sight						= { 0x06BD, "ffffffiiiii" }; // x1, y1, z1, x2, y2, z2, solid, vehicle, actor, obj, fx
+constexpr SCRIPT_COMMAND create_explosion_with_radius			= { 0x0948, "fffii" };
+constexpr SCRIPT_COMMAND get_ground_z							= { 0x02ce, "fffv" };	// x, y, z, var_ground_z
+constexpr SCRIPT_COMMAND create_radar_marker_icon				= { 0x0570, "fffiv" };
+constexpr SCRIPT_COMMAND create_icon_marker_sphere				= { 0x02A7, "fffiv" };
+constexpr SCRIPT_COMMAND create_radar_marker_without_sphere		= { 0x04CE, "fffiv" };
+constexpr SCRIPT_COMMAND show_on_radar							= { 0x0168, "ii" };
+constexpr SCRIPT_COMMAND create_marker_icon						= { 0x02A8, "fffiv" };
+constexpr SCRIPT_COMMAND is_actor_near_point_3d					= { 0x00FE, "iffffffi" };
+constexpr SCRIPT_COMMAND create_racing_checkpoint				= { 0x06d5,	"ifffffffv" };
+constexpr SCRIPT_COMMAND destroy_racing_checkpoint				= { 0x06d6,	"i" };
+constexpr SCRIPT_COMMAND camera_on_actor						= { 0x0159, "iii" };
+constexpr SCRIPT_COMMAND camera_on_vehicle						= { 0x0158, "iii" };
+constexpr SCRIPT_COMMAND create_car								= { 0x00A5, "ifffv" };
+constexpr SCRIPT_COMMAND set_car_z_angle						= { 0x0175, "if" };
+constexpr SCRIPT_COMMAND car_gas_tank_explosion					= { 0x09C4, "ii" };
+constexpr SCRIPT_COMMAND set_car_hydraulics						= { 0x07FF,	"ii" };
+constexpr SCRIPT_COMMAND toggle_car_tires_vulnerable			= { 0x053f, "ii" };
+constexpr SCRIPT_COMMAND link_vehicle_to_interior				= { 0x0840, "ii" };
+constexpr SCRIPT_COMMAND destroy_car							= { 0x00A6, "i" };
+constexpr SCRIPT_COMMAND set_car_door_rotation_to				= { 0x08A6, "iif" };
+constexpr SCRIPT_COMMAND destroy_train							= { 0x07bd, "i" };
+constexpr SCRIPT_COMMAND put_actor_in_car						= { 0x036A, "ii" };
+constexpr SCRIPT_COMMAND TASK_WARP_CHAR_INTO_CAR_AS_DRIVER		= { 0x072A, "ii" };
+constexpr SCRIPT_COMMAND put_actor_in_car2						= { 0x0430, "iii" };
+constexpr SCRIPT_COMMAND send_actor_to_car_passenger			= { 0x05CA, "iiii" };
+constexpr SCRIPT_COMMAND send_actor_to_car_driverseat			= { 0x05CB, "iii" };
+constexpr SCRIPT_COMMAND make_actor_leave_car					= { 0x05CD, "ii" };
+constexpr SCRIPT_COMMAND set_car_immunities						= { 0x02ac, "iiiiii" };
+constexpr SCRIPT_COMMAND add_to_player_money					= { 0x0109, "ii" };
+constexpr SCRIPT_COMMAND tie_marker_to_car						= { 0x0161, "iiiv" };
+constexpr SCRIPT_COMMAND has_car_sunk							= { 0x02bf, "i" };
+constexpr SCRIPT_COMMAND set_camera_pos_time_smooth				= { 0x0936, "ffffffii" };
+constexpr SCRIPT_COMMAND point_camera_transverse				= { 0x0920, "ffffffii" };
+constexpr SCRIPT_COMMAND create_object							= { 0x0107, "ifffv" };
+constexpr SCRIPT_COMMAND put_object_at							= { 0x01Bc, "ifff" };
+constexpr SCRIPT_COMMAND destroy_object							= { 0x0108, "i" };
+constexpr SCRIPT_COMMAND set_object_rotation					= { 0x0453, "ifff" };
+constexpr SCRIPT_COMMAND create_pickup							= { 0x0213, "iifffv" };
+constexpr SCRIPT_COMMAND destroy_pickup							= { 0x0215, "i" };
+constexpr SCRIPT_COMMAND is_pickup_picked_up					= { 0x0214, "i" };
+constexpr SCRIPT_COMMAND get_actor_armed_weapon					= { 0x0470, "iv" };
+constexpr SCRIPT_COMMAND lock_camera_target_point				= { 0x092F, "i" };
+constexpr SCRIPT_COMMAND set_actor_armed_weapon					= { 0x01b9, "ii" };
+constexpr SCRIPT_COMMAND create_train							= { 0x06D8, "ifffiv" };
+constexpr SCRIPT_COMMAND change_car_skin						= { 0x06ED,	"ii" };
+constexpr SCRIPT_COMMAND detach_trailer_from_cab				= { 0x07AC, "ii" };
+constexpr SCRIPT_COMMAND add_car_component						= { 0x06E7, "iiv" };	// CAR, COMPONENT, COMPONENT VAR NAME
+constexpr SCRIPT_COMMAND is_component_available					= { 0x06EA, "i" };
+constexpr SCRIPT_COMMAND request_car_component					= { 0x06E9, "i" };
+constexpr SCRIPT_COMMAND put_trailer_on_cab						= { 0x893, "ii" };
+constexpr SCRIPT_COMMAND remove_component						= { 0x06E8, "ii" };
+constexpr SCRIPT_COMMAND attach_object_to_actor					= { 0x069b, "iiffffff" };
+constexpr SCRIPT_COMMAND toggle_widescreen						= { 0x02A3, "i" };		// widescreen(1/0)
+constexpr SCRIPT_COMMAND create_actor							= { 0x009A, "iifffv" };
+constexpr SCRIPT_COMMAND set_actor_decision_marker				= { 0x060B, "ii" };
+constexpr SCRIPT_COMMAND kill_actor								= { 0x0321, "i" };
+constexpr SCRIPT_COMMAND set_engine_state						= { 0x0918, "ii" };
+constexpr SCRIPT_COMMAND is_object_attached						= { 0x0685, "i" };
+constexpr SCRIPT_COMMAND attach_object_to_car					= { 0x0681, "iiffffff" };
+constexpr SCRIPT_COMMAND attach_object_to_object				= { 0x069A, "iiffffff" };
+constexpr SCRIPT_COMMAND is_char_playing_anim					= { 0x0611, "is" };
+constexpr SCRIPT_COMMAND attach_particle_to_actor2				= { 0x066A, "siffffffiv" };
+constexpr SCRIPT_COMMAND destroy_particle						= { 0x650, "i" };
+constexpr SCRIPT_COMMAND make_particle_visible					= { 0x64c, "i" };
+constexpr SCRIPT_COMMAND task_hands_up							= { 0x5c4, "ii" }; // actor handle, time(in ms.)
+constexpr SCRIPT_COMMAND set_player_drunk_visuals				= { 0x052C, "ii" }; // player, severity (0-255)
+constexpr SCRIPT_COMMAND get_player_drunkenness					= { 0x052D, "" };
+constexpr SCRIPT_COMMAND set_player_drunk_handling				= { 0x03FD, "ii" };
+constexpr SCRIPT_COMMAND task_pick_up_object					= { 0x070A, "iifffiissi" };
+constexpr SCRIPT_COMMAND toggle_actor_cellphone					= { 0x0729, "ii" }; // actor handle, start
+constexpr SCRIPT_COMMAND is_actor_colliding_with_car			= { 0x0547, "ii" }; // actor handle, vehicle handle
+constexpr SCRIPT_COMMAND clear_char_tasks 						= { 0x0687, "i" };
+constexpr SCRIPT_COMMAND enter_passenger_driveby   			= { 0x0713, "iiiffffiii" };
+constexpr SCRIPT_COMMAND force_car_lights = { 0x067F, "ii" };
\ No newline at end of file
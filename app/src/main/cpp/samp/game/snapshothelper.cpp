@@ -140,6 +140,8 @@ RwTexture* CSnapShotHelper::CreatePedSnapShot(int iModel, uint32_t dwColor, CVec
 	float posZ = iModel == 162 ? 50.15f : 50.05f;
 	float posY = fZoom * -2.25f;
 	pPed->m_pPed->SetPosn(0.0f, posY, posZ);
+	// the snapshot is taken right away, SetModelIndex() mustn't wait for the streamer
+	CStreaming::TryLoadModel(iModel);
 	pPed->SetModelIndex(iModel);
 	//pPed->m_pPed->SetGravityProcessing(false);
 	pPed->m_pPed->SetCollisionChecking(false);
@@ -13,6 +13,7 @@ extern uintptr_t TextDrawTexture[];
 CTextDraw::CTextDraw(TEXT_DRAW_TRANSMIT* pTextDrawTransmit, const char* szText)
 {
     memset(&m_TextDrawData, 0, sizeof(TEXT_DRAW_DATA));
+    m_Layout.bValid = false;
 
     m_TextDrawData.fLetterWidth = pTextDrawTransmit->fLetterWidth;
     m_TextDrawData.fLetterHeight = pTextDrawTransmit->fLetterHeight;
@@ -125,70 +126,58 @@ uintptr_t LoadFromTxdSlot(const char* szSlot, const char* szTexture)
     return (uintptr_t)tex;
 }
 
-void CTextDraw::Draw()
+// glyph cell in font scale units, on the large side so the layout bounds never come up short
+#define TEXTDRAW_GLYPH_SIZE 40.0f
+
+void CTextDraw::Draw(CTextDrawRenderer* pRenderer)
 {
     if (m_TextDrawData.iTextureSlot != -1) {
-        return DrawTextured();
+        return DrawTextured(pRenderer);
     }
 
     if (m_TextDrawData.dwStyle == 4) {
-        return DrawTextured();
+        return DrawTextured(pRenderer);
     }
 
-    return DrawDefault();
+    return DrawDefault(pRenderer);
 }
 
-void CTextDraw::DrawDefault()
+void CTextDraw::UpdateLayout()
 {
-    if (!m_szText || !strlen(m_szText)) return;
-
-    //CFont::AsciiToGxtChar(m_szText, m_gxtString);
     int iScreenWidth = RsGlobal->maximumWidth;
     int iScreenHeight = RsGlobal->maximumHeight;
-    float fHorizHudScale = 1.0f / 640.0f;
-    float fVertHudScale = 1.0f / 448.0f;
 
-    float fScaleY = (float)iScreenHeight * fVertHudScale * m_TextDrawData.fLetterHeight * 0.5f;
-    float fScaleX = (float)iScreenWidth * fHorizHudScale * m_TextDrawData.fLetterWidth;
+    if (m_Layout.bValid && m_Layout.iScreenWidth == iScreenWidth && m_Layout.iScreenHeight == iScreenHeight)
+        return;
 
-    CFont::SetScale(fScaleX, fScaleY);
+    m_Layout.bValid = true;
+    m_Layout.iScreenWidth = iScreenWidth;
+    m_Layout.iScreenHeight = iScreenHeight;
 
-    if (m_bHovered)
-    {
-        uint32_t dwReversed = __builtin_bswap32(m_dwHoverColor | (0x000000FF));
-        CFont::SetColor(&dwReversed);
-    }
-    else
-    {
-        CFont::SetColor(&m_TextDrawData.dwLetterColor);
-    }
+    float fHorizHudScale = 1.0f / 640.0f;
+    float fVertHudScale = 1.0f / 448.0f;
 
-    CFont::SetJustify(0);
+    TEXT_DRAW_FONT_STATE& state = m_Layout.state;
+    state.fScaleY = (float)iScreenHeight * fVertHudScale * m_TextDrawData.fLetterHeight * 0.5f;
+    state.fScaleX = (float)iScreenWidth * fHorizHudScale * m_TextDrawData.fLetterWidth;
+    state.dwColor = m_TextDrawData.dwLetterColor;
 
-    if (m_TextDrawData.byteAlignRight) CFont::SetOrientation(2);
-    else if (m_TextDrawData.byteCentered) CFont::SetOrientation(0);
-    else CFont::SetOrientation(1);
+    if (m_TextDrawData.byteAlignRight) state.byteOrientation = 2;
+    else if (m_TextDrawData.byteCentered) state.byteOrientation = 0;
+    else state.byteOrientation = 1;
 
     float fLineWidth = iScreenWidth * m_TextDrawData.fLineWidth * fHorizHudScale;
-    CFont::SetWrapX(fLineWidth);
-
     float fLineHeight = iScreenWidth * m_TextDrawData.fLineHeight * fHorizHudScale;
-    CFont::SetCentreSize(fLineHeight);
-
-    CFont::SetBackground(m_TextDrawData.byteBox, 0);
-    CFont::SetBackgroundColor(&m_TextDrawData.dwBoxColor);
-    CFont::SetProportional(m_TextDrawData.byteProportional);
-    CFont::SetDropColor(&m_TextDrawData.dwBackgroundColor);
-
-    if (m_TextDrawData.byteOutline) {
-        CFont::SetEdge(m_TextDrawData.byteOutline);
-    }
-    else {
-        //CFont::SetEdge(m_TextDrawData.byteShadow);
-        CFont::SetDropShadowPosition(m_TextDrawData.byteShadow);
-    }
+    state.fWrapX = fLineWidth;
+    state.fCentreSize = fLineHeight;
 
-    CFont::SetFontStyle(m_TextDrawData.dwStyle);
+    state.byteBox = m_TextDrawData.byteBox;
+    state.dwBoxColor = m_TextDrawData.dwBoxColor;
+    state.byteProportional = m_TextDrawData.byteProportional;
+    state.dwDropColor = m_TextDrawData.dwBackgroundColor;
+    state.byteOutline = m_TextDrawData.byteOutline;
+    state.byteShadow = m_TextDrawData.byteShadow;
+    state.byteStyle = (uint8_t)m_TextDrawData.dwStyle;
 
     if (m_TextDrawData.bHasKeyCode) {
         //  CMessages_InsertPlayerControlKeysInString(m_szString);
@@ -196,9 +185,23 @@ void CTextDraw::DrawDefault()
 
     float fUseY = iScreenHeight - ((448.0 - m_TextDrawData.fY) * (iScreenHeight * fVertHudScale));
     float fUseX = iScreenWidth - ((640.0 - m_TextDrawData.fX) * (iScreenWidth * fHorizHudScale));
-    CFont::PrintString(fUseX, fUseY, (const char*)m_szText);
+    m_Layout.fX = fUseX;
+    m_Layout.fY = fUseY;
+
+    CFont::AsciiToGxtChar(m_szText, m_gxtString);
+    m_Layout.iLength = 0;
+    while (m_gxtString[m_Layout.iLength]) m_Layout.iLength++;
+
+    // full width, and as many lines as the string could wrap into
+    float fGlyphWidth = std::max(state.fScaleX * TEXTDRAW_GLYPH_SIZE, 1.0f);
+    float fGlyphHeight = state.fScaleY * TEXTDRAW_GLYPH_SIZE;
+    float fAvailable = m_TextDrawData.byteCentered ? fLineHeight : fabsf(fLineWidth - fUseX);
+    fAvailable = std::max(fAvailable, fGlyphWidth);
+
+    int iLines = 1 + (int)ceilf(m_Layout.iLength * fGlyphWidth / fAvailable);
+    for (const char* p = strstr(m_szText, "~n~"); p; p = strstr(p + 3, "~n~")) iLines++;
 
-    CFont::SetEdge(0);
+    m_Layout.bounds = CRect(0.0f, fUseY - fGlyphHeight, (float)iScreenWidth, fUseY + (iLines + 1) * fGlyphHeight);
 
     if (m_TextDrawData.byteAlignRight)
     {
@@ -224,7 +227,21 @@ void CTextDraw::DrawDefault()
     m_TextDrawData.bHasRectArea = true;
 }
 
-void CTextDraw::DrawTextured()
+void CTextDraw::DrawDefault(CTextDrawRenderer* pRenderer)
+{
+    if (!m_szText[0]) return;
+
+    UpdateLayout();
+
+    TEXT_DRAW_FONT_STATE state = m_Layout.state;
+    if (m_bHovered) {
+        state.dwColor = __builtin_bswap32(m_dwHoverColor | (0x000000FF));
+    }
+
+    pRenderer->AddText(state, m_Layout.fX, m_Layout.fY, m_gxtString, m_Layout.iLength, m_Layout.bounds);
+}
+
+void CTextDraw::DrawTextured(CTextDrawRenderer* pRenderer)
 {
     float scaleX = (float)(RsGlobal->maximumWidth) * (1.0f / 640.0f);
     float scaleY = (float)(RsGlobal->maximumHeight) * (1.0f / 448.0f);
@@ -247,14 +264,12 @@ void CTextDraw::DrawTextured()
             0.0f, 1.0f,
             1.0f, 1.0f };
 
-    if (m_bHovered) {
-        if(TextDrawTexture[m_TextDrawData.iTextureSlot] != 0)DrawTextureUV(TextDrawTexture[m_TextDrawData.iTextureSlot], &m_rectArea, m_dwHoverColor,
-                                                                           m_TextDrawData.dwStyle == 5 ? uv_reflected : uv_normal);
-    }
-    else {
-        if(TextDrawTexture[m_TextDrawData.iTextureSlot] != 0)DrawTextureUV(TextDrawTexture[m_TextDrawData.iTextureSlot], &m_rectArea, m_TextDrawData.dwLetterColor,
-                                                                           m_TextDrawData.dwStyle == 5 ? uv_reflected : uv_normal);
-    }
+    if (m_TextDrawData.iTextureSlot == -1) return;
+    RwTexture* pTexture = (RwTexture*)TextDrawTexture[m_TextDrawData.iTextureSlot];
+    if (pTexture == nullptr) return;
+
+    pRenderer->AddSprite(pTexture, m_rectArea, m_bHovered ? m_dwHoverColor : m_TextDrawData.dwLetterColor,
+                         m_TextDrawData.dwStyle == 5 ? uv_reflected : uv_normal);
 }
 
 void CTextDraw::SetText(const char* szText)
@@ -262,6 +277,7 @@ void CTextDraw::SetText(const char* szText)
     memset(m_szText, 0, 800);
     strncpy(m_szText, szText, 800);
     m_szText[800] = 0;
+    m_Layout.bValid = false;
 
     if (m_TextDrawData.dwStyle == 4 && m_TextDrawData.iTextureSlot != -1)
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RW/RenderWare.h"
+#include "textdrawrenderer.h"
 
 #define MAX_TEXT_DRAW_LINE 800
 #pragma pack(push, 1)
@@ -73,6 +74,19 @@ typedef struct _TEXT_DRAW_TRANSMIT
     uint16_t wColor2;
 } TEXT_DRAW_TRANSMIT;
 #pragma pack(pop)
+// screen space layout of a text textdraw, rebuilt when the text, the data or the screen size changes
+typedef struct _TEXT_DRAW_LAYOUT
+{
+    bool bValid;
+    int iScreenWidth;
+    int iScreenHeight;
+    TEXT_DRAW_FONT_STATE state;     // dwColor is filled in per frame, it follows the hover
+    float fX;
+    float fY;
+    int iLength;                    // of the gxt string
+    CRect bounds;                   // everything the string and its box can cover
+} TEXT_DRAW_LAYOUT;
+
 #pragma pack(push, 1)
 class CTextDraw
 {
@@ -80,9 +94,12 @@ public:
     CTextDraw(TEXT_DRAW_TRANSMIT* pTextDrawTransmit, const char* szText);
     ~CTextDraw();
 
-    void Draw();
-    void DrawDefault();
-    void DrawTextured();
+    void Draw(CTextDrawRenderer* pRenderer);
+    void DrawDefault(CTextDrawRenderer* pRenderer);
+    void DrawTextured(CTextDrawRenderer* pRenderer);
+
+    // call after changing m_TextDrawData
+    void InvalidateLayout() { m_Layout.bValid = false; }
 
 
     void SetText(const char* szText);
@@ -94,8 +111,11 @@ public:
 
 
 private:
+    void UpdateLayout();
+
     char m_szText[801];
     uint16_t m_gxtString[801];
+    TEXT_DRAW_LAYOUT m_Layout;
 
     RwTexture* m_police;
     RwTexture* m_taxi;
@@ -0,0 +1,294 @@
+#include "../main.h"
+#include "game.h"
+#include "sprite2d.h"
+
+CTextDrawRenderer::CTextDrawRenderer()
+{
+	m_bFontStateValid = false;
+	m_pBoundRaster = nullptr;
+	memset(&m_Stats, 0, sizeof(m_Stats));
+	memset(&m_LastStats, 0, sizeof(m_LastStats));
+}
+
+static bool RectsOverlap(const CRect& a, const CRect& b)
+{
+	return a.left < b.right && b.left < a.right && a.bottom < b.top && b.bottom < a.top;
+}
+
+static void ExtendRect(CRect& rect, const CRect& other)
+{
+	rect.left = std::min(rect.left, other.left);
+	rect.right = std::max(rect.right, other.right);
+	rect.bottom = std::min(rect.bottom, other.bottom);
+	rect.top = std::max(rect.top, other.top);
+}
+
+void CTextDrawRenderer::Begin()
+{
+	m_Items.clear();
+	m_Batches.clear();
+	memset(&m_Stats, 0, sizeof(m_Stats));
+
+	// the HUD and the chat use CFont between our frames
+	m_bFontStateValid = false;
+	m_pBoundRaster = nullptr;
+}
+
+int CTextDrawRenderer::FindBatch(int iKind, RwTexture* pTexture, const CRect& bounds)
+{
+	int iBatch = (int)m_Batches.size() - 1;
+	for (; iBatch >= 0; iBatch--)
+	{
+		const Batch_t& batch = m_Batches[iBatch];
+		if (batch.iKind == iKind && batch.pTexture == pTexture) break;
+	}
+	if (iBatch < 0) return -1;
+
+	// moving it back into that batch puts it under everything drawn since
+	for (int i = iBatch + 1; i < (int)m_Batches.size(); i++)
+	{
+		if (RectsOverlap(bounds, m_Batches[i].bounds)) return -1;
+	}
+
+	return iBatch;
+}
+
+void CTextDrawRenderer::Add(int iKind, RwTexture* pTexture, Item_t& item)
+{
+	int iBatch = FindBatch(iKind, pTexture, item.bounds);
+	if (iBatch == -1)
+	{
+		Batch_t batch;
+		batch.iKind = iKind;
+		batch.pTexture = pTexture;
+		batch.bounds = item.bounds;
+		batch.iCount = 0;
+		m_Batches.push_back(batch);
+		iBatch = (int)m_Batches.size() - 1;
+	}
+	else {
+		ExtendRect(m_Batches[iBatch].bounds, item.bounds);
+	}
+
+	m_Batches[iBatch].iCount++;
+	item.iBatch = iBatch;
+	m_Items.push_back(item);
+}
+
+void CTextDrawRenderer::AddText(const TEXT_DRAW_FONT_STATE& state, float fX, float fY, const uint16_t* pText, int iLength, const CRect& bounds)
+{
+	if (iLength <= 0) return;
+
+	Item_t item;
+	item.bounds = bounds;
+	item.state = state;
+	item.fX = fX;
+	item.fY = fY;
+	item.pText = pText;
+	item.iLength = iLength;
+
+	Add(ITEM_TEXT, nullptr, item);
+	m_Stats.iTexts++;
+}
+
+void CTextDrawRenderer::AddSprite(RwTexture* pTexture, const CRect& rect, uint32_t dwColor, const float* uv)
+{
+	if (!pTexture) return;
+
+	Item_t item;
+	// the textdraw rect runs from bottom (smaller y) to top
+	item.bounds = CRect(std::min(rect.left, rect.right), std::min(rect.bottom, rect.top),
+		std::max(rect.left, rect.right), std::max(rect.bottom, rect.top));
+	item.rect = rect;
+	item.dwColor = dwColor;
+	memcpy(item.uv, uv, sizeof(item.uv));
+
+	Add(ITEM_SPRITE, pTexture, item);
+	m_Stats.iSprites++;
+}
+
+void CTextDrawRenderer::End()
+{
+	// items grouped by batch, submission order inside a batch
+	std::vector<int> first(m_Batches.size() + 1, 0);
+	for (const Item_t& item : m_Items) first[item.iBatch + 1]++;
+	for (size_t i = 1; i < first.size(); i++) first[i] += first[i - 1];
+
+	m_Order.resize(m_Items.size());
+	std::vector<int> next(first.begin(), first.end() - 1);
+	for (int i = 0; i < (int)m_Items.size(); i++) {
+		m_Order[next[m_Items[i].iBatch]++] = i;
+	}
+
+	for (int i = 0; i < (int)m_Batches.size(); i++)
+	{
+		const Batch_t& batch = m_Batches[i];
+		if (batch.iKind == ITEM_SPRITE) DrawSprites(batch, &m_Order[first[i]], batch.iCount);
+		else DrawTexts(&m_Order[first[i]], batch.iCount);
+	}
+	m_Stats.iBatches = (int)m_Batches.size();
+
+	if (m_bFontStateValid) {
+		CFont::SetEdge(0);
+	}
+	if (m_pBoundRaster) {
+		RwRenderStateSet(rwRENDERSTATETEXTURERASTER, (void*)nullptr);
+	}
+
+	m_LastStats = m_Stats;
+}
+
+void CTextDrawRenderer::DrawSprites(const Batch_t& batch, const int* pItems, int iCount)
+{
+	RwRaster* pRaster = RwTextureGetRaster(batch.pTexture);
+	if (pRaster != m_pBoundRaster)
+	{
+		if (m_pBoundRaster == nullptr)
+		{
+			RwRenderStateSet(rwRENDERSTATETEXTUREFILTER, (void*)rwFILTERLINEAR);
+			RwRenderStateSet(rwRENDERSTATEVERTEXALPHAENABLE, (void*)true);
+		}
+		RwRenderStateSet(rwRENDERSTATETEXTURERASTER, (void*)pRaster);
+		m_pBoundRaster = pRaster;
+		m_Stats.iStateChanges++;
+	}
+
+	for (int iStart = 0; iStart < iCount; iStart += TEXTDRAW_BATCH_MAX_QUADS)
+	{
+		int iQuads = std::min(iCount - iStart, TEXTDRAW_BATCH_MAX_QUADS);
+		m_Vertices.resize(iQuads * 4);
+		m_Indices.resize(iQuads * 6);
+
+		for (int q = 0; q < iQuads; q++)
+		{
+			const Item_t& item = m_Items[pItems[iStart + q]];
+			CRGBA color(item.dwColor & 0xFF, (item.dwColor >> 8) & 0xFF, (item.dwColor >> 16) & 0xFF, item.dwColor >> 24);
+
+			// same corners and uv order as CSprite2d::SetVertices
+			const float corners[4][2] = {
+				{ item.rect.left, item.rect.bottom },
+				{ item.rect.right, item.rect.bottom },
+				{ item.rect.right, item.rect.top },
+				{ item.rect.left, item.rect.top } };
+			const int uvs[4] = { 0, 1, 3, 2 };
+
+			RwIm2DVertex* pVertex = &m_Vertices[q * 4];
+			for (int v = 0; v < 4; v++)
+			{
+				RwIm2DVertexSetScreenX(&pVertex[v], corners[v][0]);
+				RwIm2DVertexSetScreenY(&pVertex[v], corners[v][1]);
+				RwIm2DVertexSetScreenZ(&pVertex[v], CSprite2d::NearScreenZ);
+				RwIm2DVertexSetRecipCameraZ(&pVertex[v], CSprite2d::RecipNearClip);
+				RwIm2DVertexSetU(&pVertex[v], item.uv[uvs[v] * 2], CSprite2d::RecipNearClip);
+				RwIm2DVertexSetV(&pVertex[v], item.uv[uvs[v] * 2 + 1], CSprite2d::RecipNearClip);
+				RwIm2DVertexSetIntRGBA(&pVertex[v], color.r, color.g, color.b, color.a);
+			}
+
+			uint16_t* pIndex = &m_Indices[q * 6];
+			uint16_t wBase = (uint16_t)(q * 4);
+			pIndex[0] = wBase; pIndex[1] = wBase + 1; pIndex[2] = wBase + 2;
+			pIndex[3] = wBase; pIndex[4] = wBase + 2; pIndex[5] = wBase + 3;
+		}
+
+		RwIm2DRenderIndexedPrimitive(rwPRIMTYPETRILIST, m_Vertices.data(), iQuads * 4,
+			(RwImVertexIndex*)m_Indices.data(), iQuads * 6);
+		m_Stats.iDrawCalls++;
+	}
+}
+
+void CTextDrawRenderer::ApplyFontState(const TEXT_DRAW_FONT_STATE& state)
+{
+	TEXT_DRAW_FONT_STATE& cur = m_FontState;
+	bool bAll = !m_bFontStateValid;
+
+	if (bAll) {
+		CFont::SetJustify(0);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.fScaleX != state.fScaleX || cur.fScaleY != state.fScaleY) {
+		CFont::SetScale(state.fScaleX, state.fScaleY);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.dwColor != state.dwColor) {
+		uint32_t dwColor = state.dwColor;
+		CFont::SetColor(&dwColor);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.byteOrientation != state.byteOrientation) {
+		CFont::SetOrientation(state.byteOrientation);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.fWrapX != state.fWrapX) {
+		CFont::SetWrapX(state.fWrapX);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.fCentreSize != state.fCentreSize) {
+		CFont::SetCentreSize(state.fCentreSize);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.byteBox != state.byteBox) {
+		CFont::SetBackground(state.byteBox, 0);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.dwBoxColor != state.dwBoxColor) {
+		uint32_t dwColor = state.dwBoxColor;
+		CFont::SetBackgroundColor(&dwColor);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.byteProportional != state.byteProportional) {
+		CFont::SetProportional(state.byteProportional);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.dwDropColor != state.dwDropColor) {
+		uint32_t dwColor = state.dwDropColor;
+		CFont::SetDropColor(&dwColor);
+		m_Stats.iStateChanges++;
+	}
+	// edge and drop shadow share the same font field, one resets the other
+	if (bAll || cur.byteOutline != state.byteOutline || (!state.byteOutline && cur.byteShadow != state.byteShadow)) {
+		if (state.byteOutline) CFont::SetEdge(state.byteOutline);
+		else CFont::SetDropShadowPosition(state.byteShadow);
+		m_Stats.iStateChanges++;
+	}
+	if (bAll || cur.byteStyle != state.byteStyle) {
+		CFont::SetFontStyle(state.byteStyle);
+		m_Stats.iStateChanges++;
+	}
+
+	cur = state;
+	m_bFontStateValid = true;
+}
+
+void CTextDrawRenderer::DrawTexts(const int* pItems, int iCount)
+{
+	int iQueued = 0;
+
+	for (int i = 0; i < iCount; i++)
+	{
+		const Item_t& item = m_Items[pItems[i]];
+
+		int iCost = item.iLength + TEXTDRAW_FONT_STRING_COST;
+		if (iQueued > 0 && iQueued + iCost > TEXTDRAW_FONT_BUFFER_CHARS)
+		{
+			FlushFontBuffer();
+			iQueued = 0;
+		}
+
+		ApplyFontState(item.state);
+		CFont::PrintString(item.fX, item.fY, item.pText);
+		iQueued += iCost;
+	}
+
+	if (iQueued > 0) {
+		FlushFontBuffer();
+	}
+}
+
+void CTextDrawRenderer::FlushFontBuffer()
+{
+	CFont::RenderFontBuffer();
+	m_Stats.iDrawCalls++;
+
+	// the font binds its own raster and render states, the next sprite batch sets them again
+	m_pBoundRaster = nullptr;
+}
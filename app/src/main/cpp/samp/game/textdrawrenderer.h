@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+
+// Draws a frame of textdraws as few batches as possible.
+// Textdraws are submitted in id order; a sprite joins the last batch of its texture and
+// a string the last font batch, unless something submitted after that batch overlaps it,
+// so the picture is the same as drawing them one by one. Sprite batches are one indexed
+// triangle list, font batches one RenderFontBuffer(); CFont setters are skipped when the
+// value is already set.
+
+#define TEXTDRAW_BATCH_MAX_QUADS	512		// quads per triangle list, indices are 16 bit
+#define TEXTDRAW_FONT_BUFFER_CHARS	512		// glyphs queued before the font buffer is flushed
+#define TEXTDRAW_FONT_STRING_COST	32		// font buffer space a string takes besides its glyphs
+
+// everything CFont needs for a string besides its position
+typedef struct _TEXT_DRAW_FONT_STATE
+{
+	float fScaleX;
+	float fScaleY;
+	uint32_t dwColor;
+	uint8_t byteOrientation;
+	float fWrapX;
+	float fCentreSize;
+	uint8_t byteBox;
+	uint32_t dwBoxColor;
+	uint8_t byteProportional;
+	uint32_t dwDropColor;
+	uint8_t byteOutline;		// edge if set, drop shadow otherwise
+	uint8_t byteShadow;
+	uint8_t byteStyle;
+} TEXT_DRAW_FONT_STATE;
+
+typedef struct _TEXT_DRAW_RENDER_STATS
+{
+	int iTexts;
+	int iSprites;
+	int iBatches;
+	int iDrawCalls;			// triangle lists and font buffer flushes
+	int iStateChanges;		// CFont setters and texture binds actually issued
+} TEXT_DRAW_RENDER_STATS;
+
+class CTextDrawRenderer
+{
+public:
+	CTextDrawRenderer();
+
+	void Begin();
+	// the renderer keeps pointers to pText until End()
+	void AddText(const TEXT_DRAW_FONT_STATE& state, float fX, float fY, const uint16_t* pText, int iLength, const CRect& bounds);
+	void AddSprite(RwTexture* pTexture, const CRect& rect, uint32_t dwColor, const float* uv);
+	void End();
+
+	// counters of the last finished frame
+	const TEXT_DRAW_RENDER_STATS& GetStats() const { return m_LastStats; }
+
+private:
+	enum { ITEM_TEXT, ITEM_SPRITE };
+
+	struct Item_t
+	{
+		int iBatch;
+		CRect bounds;
+		// text
+		TEXT_DRAW_FONT_STATE state;
+		float fX, fY;
+		const uint16_t* pText;
+		int iLength;
+		// sprite
+		CRect rect;
+		uint32_t dwColor;
+		float uv[8];
+	};
+
+	struct Batch_t
+	{
+		int iKind;
+		RwTexture* pTexture;
+		CRect bounds;
+		int iCount;
+	};
+
+	int FindBatch(int iKind, RwTexture* pTexture, const CRect& bounds);
+	void Add(int iKind, RwTexture* pTexture, Item_t& item);
+	void DrawSprites(const Batch_t& batch, const int* pItems, int iCount);
+	void DrawTexts(const int* pItems, int iCount);
+	void FlushFontBuffer();
+	void ApplyFontState(const TEXT_DRAW_FONT_STATE& state);
+
+	std::vector<Item_t> m_Items;
+	std::vector<Batch_t> m_Batches;
+	std::vector<int> m_Order;
+	std::vector<RwIm2DVertex> m_Vertices;
+	std::vector<uint16_t> m_Indices;
+
+	// what CFont is set to, valid only after the first string of the frame
+	TEXT_DRAW_FONT_STATE m_FontState;
+	bool m_bFontStateValid;
+	RwRaster* m_pBoundRaster;
+
+	TEXT_DRAW_RENDER_STATS m_Stats;
+	TEXT_DRAW_RENDER_STATS m_LastStats;
+};
@@ -87,8 +87,7 @@ uint32_t GetUpperCaseKey(const char* szUpper);
 
 RwMatrix* mat_invert(RwMatrix *dst, const RwMatrix *src);
 
-const char* GetAnimByIdx(int idx);
-int GetAnimIdxByName(const char* szName);
+#include "animnames.h"
 
 bool IsGameEntityArePlaceable(CEntityGTA *pEntity);
 
@@ -102,8 +101,6 @@ uintptr_t LoadTexture(const char* texname);
 RpAtomic* ObjectMaterialCallBack(RpAtomic* rpAtomic, CObject* pObject);
 RpAtomic* ObjectMaterialTextCallBack(RpAtomic* rpAtomic, CObject* pObject);
 
-bool GetAnimationIndexFromName(const char* szName);
-
 void SetScissorRect(void* pRect);
 
 bool IsValidGamePed(CPedGTA* pPed);
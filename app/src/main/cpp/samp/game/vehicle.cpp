@@ -27,11 +27,11 @@ CVehicle::CVehicle(int iType, float fX, float fY, float fZ, float fRotation, boo
         if (!CStreaming::TryLoadModel(iType))
             throw std::runtime_error("Model not loaded");
 
-		ScriptCommand(&create_car, iType, fX, fY, fZ, &m_dwGTAId);
-		ScriptCommand(&set_car_z_angle, m_dwGTAId, fRotation);
-		ScriptCommand(&car_gas_tank_explosion, m_dwGTAId, 0);
-		ScriptCommand(&set_car_hydraulics, m_dwGTAId, 0);
-		ScriptCommand(&toggle_car_tires_vulnerable, m_dwGTAId, 0);
+		ScriptCommand<create_car>(iType, fX, fY, fZ, &m_dwGTAId);
+		ScriptCommand<set_car_z_angle>(m_dwGTAId, fRotation);
+		ScriptCommand<car_gas_tank_explosion>(m_dwGTAId, 0);
+		ScriptCommand<set_car_hydraulics>(m_dwGTAId, 0);
+		ScriptCommand<toggle_car_tires_vulnerable>(m_dwGTAId, 0);
 
 		m_pVehicle = GamePool_Vehicle_GetAt(m_dwGTAId);
 
@@ -83,7 +83,7 @@ CVehicle::CVehicle(int iType, float fX, float fY, float fZ, float fRotation, boo
         if (!CStreaming::TryLoadModel(TRAIN_TRAM))
             throw std::runtime_error("Model not loaded");
 
-		ScriptCommand(&create_train, iType, fX, fY, fZ, dwDirection, &m_dwGTAId);
+		ScriptCommand<create_train>(iType, fX, fY, fZ, dwDirection, &m_dwGTAId);
 		m_pVehicle = GamePool_Vehicle_GetAt(m_dwGTAId);
 
 		pCreatedTrain = m_pVehicle;
@@ -121,8 +121,30 @@ CVehicle::CVehicle(int iType, float fX, float fY, float fZ, float fRotation, boo
 	memset(m_szPlateText, 0, sizeof(m_szPlateText));
 }
 
+int CVehicle::GetRequiredModels(int iType, int* pModels)
+{
+	if ((iType != TRAIN_PASSENGER_LOCO) &&
+		(iType != TRAIN_FREIGHT_LOCO) &&
+		(iType != TRAIN_PASSENGER) &&
+		(iType != TRAIN_FREIGHT) &&
+		(iType != TRAIN_TRAM)) {
+		pModels[0] = iType;
+		return 1;
+	}
+
+	// every part of a train needs the whole set, the carriages follow the loco
+	pModels[0] = TRAIN_PASSENGER_LOCO;
+	pModels[1] = TRAIN_PASSENGER;
+	pModels[2] = TRAIN_FREIGHT_LOCO;
+	pModels[3] = TRAIN_FREIGHT;
+	pModels[4] = TRAIN_TRAM;
+	return 5;
+}
+
 CVehicle::~CVehicle()
 {
+	CStreaming::GetModelRequests().CancelOwner(this);
+
 	m_pVehicle = GamePool_Vehicle_GetAt(m_dwGTAId);
 
 	if (m_pVehicle) {
@@ -145,11 +167,11 @@ CVehicle::~CVehicle()
 		int iModel = m_pVehicle->m_nModelIndex;
 		if (iModel == 538 || iModel == 537)
 		{
-			ScriptCommand(&destroy_train, m_dwGTAId);
+			ScriptCommand<destroy_train>(m_dwGTAId);
 		}
 		else
 		{
-			ScriptCommand(&destroy_car, m_dwGTAId);
+			ScriptCommand<destroy_car>(m_dwGTAId);
 		}
 
         CStreaming::RemoveModelIfNoRefs(modelId);
@@ -207,15 +229,21 @@ void CVehicle::AddComponent(int iComponentID)
 	if (!m_pVehicle || !GamePool_Vehicle_GetAt(m_dwGTAId)) return;
 	if (GetVehicleSubtype() != VEHICLE_SUBTYPE_CAR) return;
 
-    if (!CStreaming::TryLoadModel(iComponentID))
-        throw std::runtime_error("Model not loaded");
+	// attached once the component is resident, the request goes away with the vehicle
+	if (!CStreaming::GetInfo(iComponentID).IsLoaded())
+	{
+		CStreaming::GetModelRequests().Request(iComponentID, MODEL_PRIORITY_NORMAL, [this, iComponentID](bool bLoaded) {
+			if (bLoaded) AddComponent(iComponentID);
+		}, this);
+		return;
+	}
 
-	if (!ScriptCommand(&is_component_available, iComponentID)) {
+	if (!ScriptCommand<is_component_available>(iComponentID)) {
 		return;
 	}
 
 	uint32_t dwRet;
-	ScriptCommand(&add_car_component, m_dwGTAId, iComponentID, &dwRet);
+	ScriptCommand<add_car_component>(m_dwGTAId, iComponentID, &dwRet);
 }
 // 0.3.7
 void CVehicle::SetPaintJob(uint8_t bytePaintJobID)
@@ -225,7 +253,7 @@ void CVehicle::SetPaintJob(uint8_t bytePaintJobID)
 		if (GetVehicleSubtype() == VEHICLE_SUBTYPE_CAR)
 		{
 			if (bytePaintJobID <= 3) {
-                if (m_dwGTAId) ScriptCommand(&change_car_skin, m_dwGTAId, bytePaintJobID);
+                if (m_dwGTAId) ScriptCommand<change_car_skin>(m_dwGTAId, bytePaintJobID);
 			}
 		}
 	}
@@ -252,7 +280,7 @@ void CVehicle::DetachTrailer()
 		if (m_dwGTAId && GamePool_Vehicle_GetAt(m_dwGTAId))
 		{
 			if (m_pTrailer->m_pVehicle)
-				ScriptCommand(&detach_trailer_from_cab, m_pTrailer->m_dwGTAId, m_dwGTAId);
+				ScriptCommand<detach_trailer_from_cab>(m_pTrailer->m_dwGTAId, m_dwGTAId);
 		}
 	}
 }
@@ -429,7 +457,7 @@ void CVehicle::SetComponentOpenState(int iDoor, int iComponent, float fDoorOpenR
 {
 	if (GetVehicleSubtype() == VEHICLE_SUBTYPE_CAR)
 	{
-		ScriptCommand(&set_car_door_rotation_to, m_dwGTAId, iDoor, iComponent, fDoorOpenRatio);
+		ScriptCommand<set_car_door_rotation_to>(m_dwGTAId, iDoor, fDoorOpenRatio);
 	
 	}
 }
@@ -451,7 +479,7 @@ void CVehicle::CloseWindow(uint8_t component)
 void CVehicle::AttachTrailer()
 {
 	if (m_pTrailer) {
-		ScriptCommand(&put_trailer_on_cab, m_pTrailer->m_dwGTAId, m_dwGTAId);
+		ScriptCommand<put_trailer_on_cab>(m_pTrailer->m_dwGTAId, m_dwGTAId);
 	}
 }
 // 0.3.7
@@ -460,13 +488,13 @@ void CVehicle::RemoveComponent(int iComponentID)
 	if (!m_pVehicle || !GamePool_Vehicle_GetAt(m_dwGTAId))
 		return;
 
-	ScriptCommand(&remove_component, m_dwGTAId, iComponentID);
+	ScriptCommand<remove_component>(m_dwGTAId, iComponentID);
 }
 // 0.3.7
 void CVehicle::SetZAngle(float fAngle)
 {
 	if (GamePool_Vehicle_GetAt(m_dwGTAId)) {
-		ScriptCommand(&set_car_z_angle, m_dwGTAId, fAngle);
+		ScriptCommand<set_car_z_angle>(m_dwGTAId, fAngle);
 	}
 }
 // 0.3.7
@@ -484,14 +512,14 @@ void CVehicle::SetInvulnerable(bool bInv)
 	{
 		if (bInv)
 		{
-			ScriptCommand(&set_car_immunities, m_dwGTAId, 1, 1, 1, 1, 1);
-			ScriptCommand(&toggle_car_tires_vulnerable, m_dwGTAId, 0);
+			ScriptCommand<set_car_immunities>(m_dwGTAId, 1, 1, 1, 1, 1);
+			ScriptCommand<toggle_car_tires_vulnerable>(m_dwGTAId, 0);
 			m_bIsInvulnerable = true;
 		}
 		else
 		{
-			ScriptCommand(&set_car_immunities, m_dwGTAId, 0, 0, 0, 0, 0);
-			ScriptCommand(&toggle_car_tires_vulnerable, m_dwGTAId, 1);
+			ScriptCommand<set_car_immunities>(m_dwGTAId, 0, 0, 0, 0, 0);
+			ScriptCommand<toggle_car_tires_vulnerable>(m_dwGTAId, 1);
 			m_bIsInvulnerable = false;
 		}
 	}
@@ -500,7 +528,7 @@ void CVehicle::SetInvulnerable(bool bInv)
 bool CVehicle::HasSunk()
 {
 	if (m_pVehicle) {
-		return ScriptCommand(&has_car_sunk, m_dwGTAId);
+		return ScriptCommand<has_car_sunk>(m_dwGTAId);
 	}
 
 	return false;
@@ -555,9 +583,9 @@ void CVehicle::ProcessMarkers()
 				m_dwMarkerID = 0;
 			}
 
-			ScriptCommand(&tie_marker_to_car, m_dwGTAId, 1, 3, &m_dwMarkerID);
-			ScriptCommand(&set_marker_color, m_dwMarkerID, 1006);
-			ScriptCommand(&show_on_radar, m_dwMarkerID, 3);
+			ScriptCommand<tie_marker_to_car>(m_dwGTAId, 1, 3, &m_dwMarkerID);
+			ScriptCommand<set_marker_color>(m_dwMarkerID, 1006);
+			ScriptCommand<show_on_radar>(m_dwMarkerID, 3);
 			m_bSpecialMarkerEnabled = true;
 		}
 
@@ -580,8 +608,8 @@ void CVehicle::ProcessMarkers()
 	{
 		if(!m_dwMarkerID)
 		{
-			ScriptCommand(&tie_marker_to_car, m_dwGTAId, 1, 2, &m_dwMarkerID);
-			ScriptCommand(&set_marker_color, m_dwMarkerID, 1004);
+			ScriptCommand<tie_marker_to_car>(m_dwGTAId, 1, 2, &m_dwMarkerID);
+			ScriptCommand<set_marker_color>(m_dwMarkerID, 1004);
 		}
 	}
 
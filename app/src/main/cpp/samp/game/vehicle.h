@@ -8,6 +8,9 @@ public:
 	CVehicle(int iType, float fX, float fY, float fZ, float fRotation, bool bPreloaded, bool bSiren);
 	virtual ~CVehicle();
 
+	// models that must be resident before the constructor runs, returns the count
+	static int GetRequiredModels(int iType, int* pModels);
+
 	int GetVehicleSubtype();
 	void AddComponent(int iComponentID);
 	void RemoveComponent(int iComponentID);
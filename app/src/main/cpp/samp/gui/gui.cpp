@@ -121,6 +121,8 @@ bool UI::initialize()
 
 void UI::render()
 {
+    PROFILE_SCOPE("UI::render");
+
     ImGuiWrapper::render();
 
     renderDebug();
@@ -155,6 +157,11 @@ void UI::drawList()
     if (pNetGame && pNetGame->GetPlayerBubblePool()) pNetGame->GetPlayerBubblePool()->Render(renderer());
 
     draw(renderer());
+
+#if PROFILER_ENABLED
+    if (m_bShowProfiler) renderProfiler(renderer());
+#endif
+    if (m_bShowNetStats && pNetGame) renderNetStats(renderer());
 }
 
 void UI::touchEvent(const ImVec2& pos, TouchType type)
@@ -294,6 +301,92 @@ void UI::renderDebug()
     label4->setPosition(pos);
 }
 
+#if PROFILER_ENABLED
+void UI::renderProfiler(ImGuiRenderer* renderer)
+{
+    PROFILE_STAT stats[16];
+    int iCount = CProfiler::GetStats(stats, 16);
+
+    float fontSize = UISettings::fontSize() / 2;
+    float lineHeight = fontSize * 1.2f;
+    ImVec2 pos = ImVec2(ScaleX(40.0f), ScaleY(200.0f));
+
+    renderer->drawRect(pos - ImVec2(ScaleX(8.0f), ScaleY(8.0f)),
+        pos + ImVec2(fontSize * 24.0f, lineHeight * iCount) + ImVec2(ScaleX(8.0f), ScaleY(8.0f)),
+        ImColor(0.0f, 0.0f, 0.0f, 0.6f), true);
+
+    char szLine[128];
+    for (int i = 0; i < iCount; i++)
+    {
+        const PROFILE_STAT& stat = stats[i];
+        if (i == 0) {
+            snprintf(szLine, sizeof(szLine), "Frame %.2f ms (avg %.2f, max %.2f)", stat.fLastMs, stat.fAvgMs, stat.fMaxMs);
+        }
+        else {
+            snprintf(szLine, sizeof(szLine), "%s [%s] %.2f / %.2f ms x%d", stat.szName, stat.szThread, stat.fAvgMs, stat.fMaxMs, stat.iCalls);
+        }
+
+        // anything over a 60 fps frame stands out
+        ImColor color = stat.fAvgMs > 16.6f && i > 0 ? ImColor(1.0f, 0.4f, 0.4f) : ImColor(1.0f, 1.0f, 1.0f);
+        renderer->drawText(pos + ImVec2(0.0f, lineHeight * i), color, szLine, true, fontSize);
+    }
+}
+#endif
+
+void UI::renderNetStats(ImGuiRenderer* renderer)
+{
+    CNetTelemetry* pTelemetry = pNetGame->GetTelemetry();
+    if (!pTelemetry) return;
+
+    NET_REPORT report;
+    pTelemetry->GetReport(report);
+
+    const ImColor white(1.0f, 1.0f, 1.0f);
+    const ImColor red(1.0f, 0.4f, 0.4f);
+
+    char szLines[6 + NET_SYNC_COUNT][128];
+    ImColor colors[6 + NET_SYNC_COUNT];
+    int iCount = 0;
+
+    snprintf(szLines[iCount], sizeof(szLines[0]), "Net %.0fs: RTT %d ms (avg %.0f, %d-%d), jitter %.1f ms",
+        report.fWindowSec, report.iRttMs, report.fRttAvgMs, report.iRttMinMs, report.iRttMaxMs, report.fRttJitterMs);
+    colors[iCount++] = report.fRttJitterMs > 50.0f ? red : white;
+
+    snprintf(szLines[iCount], sizeof(szLines[0]), "Loss in %.1f%% out %.1f%%, %.1f / %.1f kbit/s",
+        report.fLossInPercent, report.fLossOutPercent, report.fKbitInPerSec, report.fKbitOutPerSec);
+    colors[iCount++] = report.fLossInPercent > 5.0f || report.fLossOutPercent > 5.0f ? red : white;
+
+    snprintf(szLines[iCount], sizeof(szLines[0]), "Queued resend %u reassembly %u, late %u dup %u",
+        report.dwResendQueue, report.dwReassemblyQueue, report.dwOutOfOrder, report.dwDuplicates);
+    colors[iCount++] = white;
+
+    // a long poll is the client stalling, not the network
+    snprintf(szLines[iCount], sizeof(szLines[0]), "Poll %.1f ms (max %u)", report.fPollAvgMs, report.dwPollMaxMs);
+    colors[iCount++] = report.dwPollMaxMs > 250 ? red : white;
+
+    for (int i = 0; i < NET_SYNC_COUNT; i++)
+    {
+        const NET_SYNC_REPORT& sync = report.sync[i];
+        if (sync.dwPackets == 0) continue;
+
+        snprintf(szLines[iCount], sizeof(szLines[0]), "%s %.1f/s %.1f kbit/s, jitter %.1f ms, loss ~%.1f%%",
+            CNetTelemetry::GetSyncTypeName((eNetSyncType)i), sync.fPacketsPerSec, sync.fKbitPerSec, sync.fJitterMs, sync.fLossPercent);
+        colors[iCount++] = sync.fLossPercent > 5.0f || sync.fJitterMs > 50.0f ? red : white;
+    }
+
+    float fontSize = UISettings::fontSize() / 2;
+    float lineHeight = fontSize * 1.2f;
+    ImVec2 pos = ImVec2(ScaleX(1380.0f), ScaleY(200.0f));
+
+    renderer->drawRect(pos - ImVec2(ScaleX(8.0f), ScaleY(8.0f)),
+        pos + ImVec2(fontSize * 26.0f, lineHeight * iCount) + ImVec2(ScaleX(8.0f), ScaleY(8.0f)),
+        ImColor(0.0f, 0.0f, 0.0f, 0.6f), true);
+
+    for (int i = 0; i < iCount; i++) {
+        renderer->drawText(pos + ImVec2(0.0f, lineHeight * i), colors[i], szLines[i], true, fontSize);
+    }
+}
+
 void UI::PushToBufferedQueueTextDrawPressed(uint16_t textdrawId)
 {
     BUFFERED_COMMAND_TEXTDRAW* pCmd = m_BufferedCommandTextdraws.WriteLock();
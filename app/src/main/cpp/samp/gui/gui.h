@@ -3,9 +3,11 @@
 #define DEBUG_GUI 0
 
 #include "../vendor/encoding/encoding.h"
+#include "../profiler.h"
 
 #include "imguiwrapper.h"
 #include "uisettings.h"
+#include "ringbuffer.h"
 
 #include "widget.h"
 #include "widgets/layout.h"
@@ -96,6 +98,18 @@ public:
 
     void renderDebug();
 
+#if PROFILER_ENABLED
+    // rolling per-scope times of the frame profiler, toggled with /profiler
+    void showProfiler(bool bShow) { m_bShowProfiler = bShow; }
+    bool profilerVisible() const { return m_bShowProfiler; }
+    void renderProfiler(ImGuiRenderer* renderer);
+#endif
+
+    // connection health from CNetTelemetry, toggled with /netstat
+    void showNetStats(bool bShow) { m_bShowNetStats = bShow; }
+    bool netStatsVisible() const { return m_bShowNetStats; }
+    void renderNetStats(ImGuiRenderer* renderer);
+
     void DrawServerTexture();
 
     void ProcessPushedTextdraws();
@@ -123,5 +137,10 @@ private:
 
 	bool m_bNeedClearMousePos = false;
 
+#if PROFILER_ENABLED
+    bool m_bShowProfiler = false;
+#endif
+    bool m_bShowNetStats = false;
+
     DataStructures::SingleProducerConsumer<BUFFERED_COMMAND_TEXTDRAW> m_BufferedCommandTextdraws;
 };
\ No newline at end of file
@@ -2,10 +2,11 @@
 #include "imguirenderer.h"
 #include "uisettings.h"
 
-ImGuiRenderer::ImGuiRenderer(ImDrawList* draw_list, ImFont* font)
+ImGuiRenderer::ImGuiRenderer(ImDrawList* draw_list, ImFont* font, ImFont* outline_font)
 {
 	m_drawList = draw_list;
 	m_font = font;
+	m_outlineFont = outline_font;
 }
 
 void ImGuiRenderer::drawLine(const ImVec2& a, const ImVec2& b, const ImColor& color, float thickness)
@@ -42,6 +43,13 @@ void ImGuiRenderer::drawText(const ImVec2& pos, const ImColor& color,
 {
 	float sz_font = font_size == 0.0f ? m_font->FontSize : font_size;
 
+	// one quad per glyph, the outline comes from the atlas
+	if (outline && m_outlineFont)
+	{
+		m_drawList->AddText(m_outlineFont, sz_font, pos, color, begin, end);
+		return;
+	}
+
 	if (outline)
 	{
 		ImVec2 outlined = pos;
@@ -99,20 +107,20 @@ void ImGuiRenderer::drawText(const ImVec2& pos, const ImColor& color,
 	m_drawList->AddText(m_font, sz_font, pos, color, begin, end);
 }
 
-void ImGuiRenderer::drawText(const ImVec2& pos, const ImColor& color, const std::string& text, bool outlined, float font_size)
+void ImGuiRenderer::drawText(const ImVec2& pos, const ImColor& color, std::string_view text, bool outlined, float font_size)
 {
 	if (text.empty()) return;
 
 	float sz_font = font_size == 0.0f ? m_font->FontSize : font_size;
 
-	const char* text_start = text.c_str();
-	const char* text_cur = text.c_str();
-	const char* text_end = text.c_str() + text.length();
+	const char* text_start = text.data();
+	const char* text_cur = text.data();
+	const char* text_end = text.data() + text.length();
 
 	ImVec2 pos_cur = pos;
 	ImColor color_cur = color;
 
-	while (*text_cur)
+	while (text_cur < text_end && *text_cur)
 	{
 		if (*text_cur == '{' && ((&text_cur[7] < text_end) && text_cur[7] == '}'))
 		{
@@ -167,7 +175,7 @@ void ImGuiRenderer::drawText(const ImVec2& pos, const ImColor& color, const std:
 	}
 }
 
-ImVec2 ImGuiRenderer::calculateTextSize(const std::string& text, float font_size)
+ImVec2 ImGuiRenderer::calculateTextSize(std::string_view text, float font_size)
 {
 	ImVec2 text_size = { 0.0f, 0.0f };
 	if (text.empty()) return text_size;
@@ -175,11 +183,11 @@ ImVec2 ImGuiRenderer::calculateTextSize(const std::string& text, float font_size
 	ImVec2 cur_size = { 0.0f, 0.0f };
 	if (font_size == 0.0f) font_size = m_font->FontSize;
 	
-	const char* text_start = text.c_str();
-	const char* text_cur = text.c_str();
-	const char* text_end = text.c_str() + text.length();
+	const char* text_start = text.data();
+	const char* text_cur = text.data();
+	const char* text_end = text.data() + text.length();
 
-	while (*text_cur)
+	while (text_cur < text_end && *text_cur)
 	{
 		if (*text_cur == '{' && ((&text_cur[7] < text_end) && text_cur[7] == '}'))
 		{
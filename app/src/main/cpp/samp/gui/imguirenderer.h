@@ -4,6 +4,7 @@
 #include "../vendor/imgui/imgui.h"
 #include "../vendor/imgui/imgui_internal.h"
 #include <string>
+#include <string_view>
 
 /*
 	  ImGui
@@ -12,7 +13,7 @@
 class ImGuiRenderer
 {
 public:
-	ImGuiRenderer(ImDrawList* draw_list, ImFont* font);
+	ImGuiRenderer(ImDrawList* draw_list, ImFont* font, ImFont* outline_font = nullptr);
 	virtual ~ImGuiRenderer() {};
 
 	void drawLine(const ImVec2& a, const ImVec2& b, const ImColor& color, float thickness = 1.0f);
@@ -22,13 +23,13 @@ public:
 		const ImColor& col_bot_right, const ImColor& col_bot_left);
 	void drawTriangle(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImColor& color, bool fill = false, float thickness = 1.0f);
 	void drawConvexPolyFilled(ImVec2* points, int num_points	, const ImColor& color);
-	void drawText(const ImVec2& pos, const ImColor& color, const std::string& text, bool outlined = false, float font_size = 0.0f);
+	void drawText(const ImVec2& pos, const ImColor& color, std::string_view text, bool outlined = false, float font_size = 0.0f);
 	void drawImage(const ImVec2& a, const ImVec2& b, ImTextureID texture);
 
 	void pushClipRect(const ImVec2& min, const ImVec2& max, bool intersect = false);
 	void popClipRect();
 
-	ImVec2 calculateTextSize(const std::string& text, float font_size = 0.0f);
+	ImVec2 calculateTextSize(std::string_view text, float font_size = 0.0f);
 
 	ImColor RenderTextAndGetLastColor(const float font_size, uint8_t outline, ImVec2 pos, ImColor col, const char *szStr);
 	ImVec2 CalcTextSizeWithoutTags(const float font_size, const char* szStr);
@@ -42,4 +43,5 @@ private:
 private:
 	ImDrawList* m_drawList;
 	ImFont* m_font;
+	ImFont* m_outlineFont; // same glyphs with the outline baked into the atlas
 };
\ No newline at end of file
@@ -20,6 +20,7 @@ ImGuiWrapper::ImGuiWrapper(const ImVec2& display_size, const std::string& font_p
 	m_displaySize = display_size;
 	m_renderer = 0;
 	m_fontRaster = nullptr;
+	m_outlineFont = nullptr;
 	m_fontPath = font_path;
 
 	m_vertexBuffer = nullptr;
@@ -57,6 +58,9 @@ bool ImGuiWrapper::initialize()
 		0
     };
 	
+	// leave room for the outline baked around the second glyph set
+	io.Fonts->TexGlyphPadding = (int)ceilf(UISettings::outlineSize()) * 2 + 1;
+
 	ImFont* font = io.Fonts->AddFontFromFileTTF(m_fontPath.c_str(),
 		UISettings::fontSize(), &fontCfg, ranges);
 
@@ -66,9 +70,21 @@ bool ImGuiWrapper::initialize()
 		return false;
 	}
 
+	// Outlined text (chat, name tags, labels, voice list) is drawn at fontSize() / 2,
+	// so the outline glyph set is rasterized at that size and maps 1:1 there;
+	// ImGui scales the same glyphs for any other font_size.
+	// Half the extra spacing keeps advances identical to the main font once scaled.
+	ImFontConfig outlineCfg;
+	outlineCfg.GlyphExtraSpacing.x = UISettings::outlineSize() / 2;
+	outlineCfg.OversampleH = 1;
+	outlineCfg.OversampleV = 1;
+
+	m_outlineFont = io.Fonts->AddFontFromFileTTF(m_fontPath.c_str(),
+		UISettings::fontSize() / 2, &outlineCfg, ranges);
+
 	createFontTexture();
 
-	m_renderer = new ImGuiRenderer(ImGui::GetBackgroundDrawList(), font);
+	m_renderer = new ImGuiRenderer(ImGui::GetBackgroundDrawList(), font, m_outlineFont);
 
 	// voice 
 	/*for (const auto& deviceInitCallback : Render::deviceInitCallbacks) {
@@ -241,6 +257,10 @@ bool ImGuiWrapper::createFontTexture()
 	int width, height, bytes_per_pixel;
 	io.Fonts->GetTexDataAsRGBA32(&pxs, &width, &height, &bytes_per_pixel);
 
+	if (m_outlineFont) {
+		bakeOutlineGlyphs(pxs, width, height, UISettings::outlineSize());
+	}
+
 	RwImage* font_img = RwImageCreate(width, height, bytes_per_pixel * 8);
 	RwImageAllocatePixels(font_img);
 
@@ -287,4 +307,76 @@ void ImGuiWrapper::destroyFontTexture()
 		io.Fonts->TexID = (ImTextureID)0;
 	}
 
-}
\ No newline at end of file
+}
+
+void ImGuiWrapper::bakeOutlineGlyphs(unsigned char* pixels, int width, int height, float radius)
+{
+	Log::traceLastFunc("ImGuiWrapper::bakeOutlineGlyphs");
+
+	const int border = (int)ceilf(radius);
+	std::vector<unsigned char> glyph_alpha;
+
+	for (int g = 0; g < m_outlineFont->Glyphs.Size; g++)
+	{
+		ImFontGlyph& glyph = m_outlineFont->Glyphs[g];
+
+		int x0 = (int)(glyph.U0 * width + 0.5f);
+		int y0 = (int)(glyph.V0 * height + 0.5f);
+		int x1 = (int)(glyph.U1 * width + 0.5f);
+		int y1 = (int)(glyph.V1 * height + 0.5f);
+		if (x1 <= x0 || y1 <= y0) continue;
+
+		// copy the glyph coverage first, the loop below writes over it
+		int gw = x1 - x0;
+		int gh = y1 - y0;
+		glyph_alpha.resize(gw * gh);
+		for (int y = 0; y < gh; y++)
+			for (int x = 0; x < gw; x++)
+				glyph_alpha[y * gw + x] = pixels[((y0 + y) * width + (x0 + x)) * 4 + 3];
+
+		for (int y = y0 - border; y < y1 + border; y++)
+		{
+			for (int x = x0 - border; x < x1 + border; x++)
+			{
+				if (x < 0 || y < 0 || x >= width || y >= height) continue;
+
+				// anti-aliased dilation of the coverage by 'radius' texels
+				float fill = 0.0f;
+				float rim = 0.0f;
+				for (int sy = ImMax(y - border, y0); sy <= ImMin(y + border, y1 - 1); sy++)
+				{
+					for (int sx = ImMax(x - border, x0); sx <= ImMin(x + border, x1 - 1); sx++)
+					{
+						float a = glyph_alpha[(sy - y0) * gw + (sx - x0)] / 255.0f;
+						if (a <= 0.0f) continue;
+
+						if (sx == x && sy == y) fill = a;
+
+						float dx = (float)(sx - x);
+						float dy = (float)(sy - y);
+						float weight = ImClamp(radius + 0.5f - sqrtf(dx * dx + dy * dy), 0.0f, 1.0f);
+						rim = ImMax(rim, a * weight);
+					}
+				}
+
+				// white fill composited over the black rim
+				float alpha = fill + (1.0f - fill) * rim;
+				unsigned char lum = alpha > 0.0f ? (unsigned char)(fill / alpha * 255.0f + 0.5f) : 0;
+
+				unsigned char* px = &pixels[(y * width + x) * 4];
+				px[0] = px[1] = px[2] = lum;
+				px[3] = (unsigned char)(alpha * 255.0f + 0.5f);
+			}
+		}
+
+		// grow the quad so the rim is drawn too
+		glyph.X0 -= border;
+		glyph.Y0 -= border;
+		glyph.X1 += border;
+		glyph.Y1 += border;
+		glyph.U0 -= border / (float)width;
+		glyph.V0 -= border / (float)height;
+		glyph.U1 += border / (float)width;
+		glyph.V1 += border / (float)height;
+	}
+}
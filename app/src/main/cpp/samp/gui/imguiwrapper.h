@@ -63,6 +63,12 @@ private:
 		  
 	*/
 	void destroyFontTexture();
+	/*
+		Bakes a black outline around every glyph of the outline font straight into
+		the RGBA atlas: white fill over a black rim, so the vertex colour tints only
+		the fill and outlined text costs one quad per glyph
+	*/
+	void bakeOutlineGlyphs(unsigned char* pixels, int width, int height, float radius);
 
 private:
 	ImVec2 m_displaySize;
@@ -70,6 +76,7 @@ private:
 
 	ImGuiRenderer* m_renderer;
 	RwRaster* m_fontRaster;
+	ImFont* m_outlineFont;
 
 	RwIm2DVertex* m_vertexBuffer;
 	int m_vertexBufferSize;
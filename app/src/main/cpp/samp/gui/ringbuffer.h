@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+
+/*
+	Fixed-capacity ring buffer: once full, push() recycles the oldest slot,
+	so appending never shifts or reallocates
+*/
+template <typename T>
+class RingBuffer
+{
+public:
+	RingBuffer(int capacity = 1) { setCapacity(capacity); }
+
+	void setCapacity(int capacity)
+	{
+		m_data.clear();
+		m_data.resize(capacity > 0 ? capacity : 1);
+		m_head = 0;
+		m_size = 0;
+	}
+
+	int capacity() const { return (int)m_data.size(); }
+	int size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+	void clear() { m_head = 0; m_size = 0; }
+
+	/* returns the slot for a new element, evicting the oldest one when full */
+	T& push()
+	{
+		int slot = (m_head + m_size) % capacity();
+
+		if (m_size < capacity()) m_size++;
+		else m_head = (m_head + 1) % capacity();
+
+		return m_data[slot];
+	}
+
+	/* 0 is the oldest element */
+	T& operator[](int index) { return m_data[(m_head + index) % capacity()]; }
+	const T& operator[](int index) const { return m_data[(m_head + index) % capacity()]; }
+
+private:
+	std::vector<T> m_data;
+	int m_head;
+	int m_size;
+};
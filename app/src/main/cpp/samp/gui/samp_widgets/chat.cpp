@@ -5,6 +5,8 @@
 #include <algorithm>
 #include "../settings.h"
 #include "java/jniutil.h"
+#include "../../game/Animation/AnimManager.h"
+#include "../../game/Animation/AnimLod.h"
 
 extern UI* pUI;
 extern CGame* pGame;
@@ -16,7 +18,7 @@ bool g_bChatVisible = true;
 
 Chat::Chat() : ListBox()
 {
-
+	m_messages.setCapacity(UISettings::chatMaxMessages());
 }
 
 void Chat::addChatMessage(const std::string& message, const std::string& nick, const ImColor& nick_color)
@@ -55,25 +57,27 @@ void Chat::addClientMessage(const std::string& message, const ImColor& color)
 
 void Chat::addMessage(const std::string& message, const ImColor& color)
 {
-	if (this->itemsCount() > UISettings::chatMaxMessages())
-	{
-		this->removeItem(0);
-	}
+	Message& msg = m_messages.push();
+	msg.nick.clear();
+	msg.text = message;
+	msg.color = color;
+	msg.nick_width = -1.0f;
+	msg.height = 0.0f;
 
-	MessageItem* item = new MessageItem(message, color);
-	this->addItem(item);
+	this->rowsChanged();
 	/*if(!active())*/ this->setScrollY(1.0f);
 }
 
 void Chat::addPlayerMessage(const std::string& message, const std::string& nick, const ImColor& nick_color)
 {
-	if (this->itemsCount() > UISettings::chatMaxMessages())
-	{
-		this->removeItem(0);
-	}
+	Message& msg = m_messages.push();
+	msg.nick = nick;
+	msg.text = ": " + message;
+	msg.color = nick_color;
+	msg.nick_width = -1.0f;
+	msg.height = 0.0f;
 
-	PlayerMessageItem* item = new PlayerMessageItem(message, nick, nick_color);
-	this->addItem(item);
+	this->rowsChanged();
 	/*if(!active())*/ this->setScrollY(1.0f);
 }
 
@@ -82,6 +86,30 @@ void Chat::draw(ImGuiRenderer* renderer)
 	ListBox::draw(renderer);
 }
 
+void Chat::drawRow(ImGuiRenderer* renderer, int row, const ImVec2& pos, const ImVec2& size, bool selected)
+{
+	Message& msg = m_messages[row];
+	float font_size = UISettings::fontSize() / 2;
+
+	// measured once, the first time the line scrolls into view
+	if (msg.nick_width < 0.0f)
+	{
+		msg.nick_width = msg.nick.empty() ? 0.0f : renderer->calculateTextSize(msg.nick, font_size).x;
+		msg.height = renderer->calculateTextSize(msg.text, font_size).y;
+	}
+
+	ImVec2 text_pos = ImVec2(pos.x + msg.nick_width, pos.y + (size.y - msg.height) / 2);
+
+	if (msg.nick.empty())
+	{
+		renderer->drawText(text_pos, msg.color, msg.text, true, font_size);
+		return;
+	}
+
+	renderer->drawText(ImVec2(pos.x, text_pos.y), msg.color, msg.nick, true, font_size);
+	renderer->drawText(text_pos, ImColor(1.0f, 1.0f, 1.0f), msg.text, true, font_size);
+}
+
 void Chat::activateEvent(bool active)
 {
 	if (active)
@@ -124,5 +152,105 @@ bool Chat::commandClient(const std::string& command) //--
 		return true;
 	}
 
+	// debug builds only: in release they would swallow server commands
+#if PROFILER_ENABLED
+	if (command == "/lod" && pNetGame)
+	{
+		const char* szPool[] = { "players", "vehicles" };
+		const CUpdateScheduler* pScheduler[] = {
+			&pNetGame->GetPlayerPool()->GetUpdateScheduler(),
+			&pNetGame->GetVehiclePool()->GetUpdateScheduler()
+		};
+
+		for (int i = 0; i < 2; i++)
+		{
+			const LOD_STATS& stats = pScheduler[i]->GetStats();
+			pUI->chat()->addDebugMessage("%s: near %d/%d mid %d/%d far %d/%d deferred %d, %.0f/%.0f us",
+				szPool[i],
+				stats.iUpdated[LOD_TIER_NEAR], stats.iSlots[LOD_TIER_NEAR],
+				stats.iUpdated[LOD_TIER_MID], stats.iSlots[LOD_TIER_MID],
+				stats.iUpdated[LOD_TIER_FAR], stats.iSlots[LOD_TIER_FAR],
+				stats.iDeferred, stats.fSpent, stats.fBudget);
+		}
+		return true;
+	}
+
+	if (command == "/animlod")
+	{
+		CAnimLod::SetEnabled(!CAnimLod::IsEnabled());
+		const ANIM_LOD_STATS& stats = CAnimLod::GetStats();
+		pUI->chat()->addDebugMessage("anim lod %s: ran %u skipped %u tracking %u",
+			CAnimLod::IsEnabled() ? "on" : "off", stats.nRun, stats.nSkipped, stats.nTracked);
+		pUI->chat()->addDebugMessage("anim cache: hits %u misses %u evictions %u",
+			CAnimManager::ms_nCacheHits, CAnimManager::ms_nCacheMisses, CAnimManager::ms_nCacheEvictions);
+		CAnimLod::ResetStats();
+		return true;
+	}
+
+	if (command == "/threads")
+	{
+		const CPU_TOPOLOGY& topology = CThreadPlacement::GetTopology();
+		pUI->chat()->addDebugMessage("cpus: %d big (0x%x) %d little (0x%x)",
+			topology.iBigCount, topology.dwBigMask, topology.iLittleCount, topology.dwLittleMask);
+
+		THREAD_PLACEMENT placements[THREAD_MAX_PLACED];
+		int iCount = CThreadPlacement::GetPlacements(placements, THREAD_MAX_PLACED);
+		for (int i = 0; i < iCount; i++)
+		{
+			const THREAD_PLACEMENT& placement = placements[i];
+			pUI->chat()->addDebugMessage("%d %s: mask 0x%x%s nice %d%s", placement.tid,
+				CThreadPlacement::GetRoleName(placement.role),
+				placement.dwMask, placement.bAffinitySet ? "" : " (refused)",
+				placement.iNice, placement.bNiceSet ? "" : " (refused)");
+		}
+		return true;
+	}
+
+	if (command == "/netstat")
+	{
+		pUI->showNetStats(!pUI->netStatsVisible());
+		return true;
+	}
+
+	if (command == "/jobs")
+	{
+		JOB_STATS stats = CJobSystem::GetStats();
+		pUI->chat()->addDebugMessage("jobs: %d workers, submitted %u executed %u stolen %u helped %u completions %u queued %d",
+			CJobSystem::GetWorkerCount(), stats.dwSubmitted, stats.dwExecuted, stats.dwStolen, stats.dwHelped,
+			stats.dwCompletions, stats.iQueued);
+		return true;
+	}
+#endif
+
+#if MEMSTATS_ENABLED
+	if (command == "/mem")
+	{
+		FRAME_ARENA_STATS arena = CFrameArena::GetStats();
+		MEMPOOL_STATS pool = CMemPool::GetStats();
+		pUI->chat()->addDebugMessage("frame arena: %d chunks, high water %u KB", arena.iChunks, (uint32_t)(arena.highWater / 1024));
+		pUI->chat()->addDebugMessage("frame arena: %u allocs last frame, %u oversized", arena.dwLastAllocs, arena.dwOversized);
+		pUI->chat()->addDebugMessage("pool: %u slabs, allocs %u frees %u live %d large %u",
+			pool.dwSlabs, pool.dwAllocs, pool.dwFrees, pool.iLive, pool.dwLarge);
+		return true;
+	}
+#endif
+
+#if PROFILER_ENABLED
+	if (command == "/profiler")
+	{
+		pUI->showProfiler(!pUI->profilerVisible());
+		return true;
+	}
+
+	if (command == "/profiler dump")
+	{
+		char szPath[0xFF];
+		snprintf(szPath, sizeof(szPath), "%s/samp_trace.json", g_pszStorage);
+		if (CProfiler::ExportChromeTrace(szPath)) pUI->chat()->addDebugMessage("Trace saved: %s", szPath);
+		else pUI->chat()->addDebugMessage("Can't write %s", szPath);
+		return true;
+	}
+#endif
+
     return false;
 }
\ No newline at end of file
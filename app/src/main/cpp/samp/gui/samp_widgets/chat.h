@@ -24,47 +24,19 @@ private:
 	void addMessage(const std::string& messsage, const ImColor& color = ImColor(1.0f, 1.0f, 1.0f));
 	void addPlayerMessage(const std::string& message, const std::string& nick, const ImColor& nick_color);
 
-	class MessageItem : public ListBoxItem
-	{
-	public:
-		MessageItem(const std::string& message, const ImColor& color)
-		{
-			m_text = new Label(message, color, true, UISettings::fontSize() / 2);
-			this->addChild(m_text);
-		}
-
-		void performLayout() override
-		{
-			m_text->performLayout();
-			m_text->setPosition(ImVec2(0.0f, (height() - m_text->height()) / 2));
-		}
-
-	private:
-		Label* m_text;
-	};
+	virtual int rowCount() const override { return m_messages.size(); }
+	virtual int rowItemIndex(int row) const override { return -1; }
+	virtual void drawRow(ImGuiRenderer* renderer, int row, const ImVec2& pos, const ImVec2& size, bool selected) override;
 
-	class PlayerMessageItem : public ListBoxItem
+	/* pre-parsed chat line, the slot is recycled once the ring buffer is full */
+	struct Message
 	{
-	public:
-		PlayerMessageItem(const std::string& message, const std::string& nick, const ImColor& nick_color)
-		{
-			m_nick = new Label(nick, nick_color, true, UISettings::fontSize() / 2);
-			m_text = new Label(": " + message, ImColor(1.0f, 1.0f, 1.0f), true, UISettings::fontSize() / 2);
-			this->addChild(m_nick);
-			this->addChild(m_text);
-		}
-
-		void performLayout() override
-		{
-			m_nick->performLayout();
-			m_nick->setPosition(ImVec2(0.0f, (height() - m_nick->height()) / 2));
-
-			m_text->performLayout();
-			m_text->setPosition(ImVec2(m_nick->position().x + m_nick->width(), (height() - m_text->height()) / 2));
-		}
-
-	private:
-		Label* m_nick;
-		Label* m_text;
+		std::string nick;		// empty for client/info messages
+		std::string text;
+		ImColor color;			// nick colour, or the whole line's without a nick
+		float nick_width;		// cached on first draw, -1 until then
+		float height;
 	};
+
+	RingBuffer<Message> m_messages;
 };
\ No newline at end of file
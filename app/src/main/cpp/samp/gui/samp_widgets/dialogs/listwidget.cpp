@@ -2,6 +2,9 @@
 #include "../../gui.h"
 
 #include <sstream>
+#include <algorithm>
+
+extern UI* pUI;
 
 /* ListWidget */
 
@@ -20,7 +23,8 @@ void ListWidget::performLayout()
 
 void ListWidget::assemble(const std::string& data)
 {
-	std::vector < std::vector<Label*> > vRows;
+	float font_size = UISettings::fontSize() / 2;
+	std::vector<float> vColumnsWidth;
 
 	/*   */
 	std::stringstream ss_data(data);
@@ -29,84 +33,51 @@ void ListWidget::assemble(const std::string& data)
 	{
 		if (s_row.length() == 0) continue;
 
-		std::vector<Label*> vRowItems;
+		RowData row;
+		row.height = 0.0f;
 
-		/*    */
+		/*   ,     */
 		std::stringstream ss_row(s_row);
 		std::string s_item;
 		while (std::getline(ss_row, s_item, '\t'))
 		{
-			Label* label = new Label(s_item, ImColor(1.0f, 1.0f, 1.0f), false, UISettings::fontSize() / 2);
-			label->performLayout();
-			vRowItems.push_back(label);
-		}
-
-		vRows.push_back(vRowItems);
-	}
+			ImVec2 sz = pUI->renderer()->calculateTextSize(s_item, font_size);
+			int c_idx = row.cells.size();
 
-	/*       */
-	std::vector<float> vColumnsWidth;
-	for (int r_idx = 0; r_idx < vRows.size(); r_idx++)
-	{
-		for (int c_idx = 0; c_idx < vRows[r_idx].size(); c_idx++)
-		{
 			if (vColumnsWidth.size() < (c_idx + 1)) {
 				vColumnsWidth.push_back(0.0f);
 			}
 
-			vColumnsWidth[c_idx] = std::max(vColumnsWidth[c_idx], vRows[r_idx][c_idx]->width());
+			vColumnsWidth[c_idx] = std::max(vColumnsWidth[c_idx], sz.x);
+			row.height = std::max(row.height, sz.y);
+			row.cells.push_back(s_item);
 		}
+
+		m_rows.push_back(std::move(row));
 	}
 
-	float max_width = 0.0f;
-	for (int r_idx = 0; r_idx < vRows.size(); r_idx++)
+	/*        */
+	float pos_x = UISettings::padding();
+	for (int c_idx = 0; c_idx < vColumnsWidth.size(); c_idx++)
 	{
-		ItemWidget* item = new ItemWidget();
-		this->addItem(item);
-
-		float pos_x = UISettings::padding();
-		for (int c_idx = 0; c_idx < vRows[r_idx].size(); c_idx++)
-		{
-			Label* l = vRows[r_idx][c_idx];
-			item->add(l, pos_x);
-			pos_x += vColumnsWidth[c_idx] + UISettings::padding() * 5;
-			max_width = std::max(max_width, pos_x);
-		}
+		m_columnsPos.push_back(pos_x);
+		pos_x += vColumnsWidth[c_idx] + UISettings::padding() * 5;
 	}
 
-	m_itemSize.x = max_width;
+	m_itemSize.x = pos_x;
+	this->rowsChanged();
 }
 
-/* ListWidget::ItemWidget */
-ListWidget::ItemWidget::ItemWidget()
+void ListWidget::drawRow(ImGuiRenderer* renderer, int row, const ImVec2& pos, const ImVec2& size, bool selected)
 {
+	if (selected) renderer->drawRect(pos, pos + size, ImColor(0xF5, 0x91, 0x32)/*ImColor(0.7f, 0.1f, 0.1f)*/, true);
 
-}
+	const RowData& data = m_rows[row];
+	float pos_y = pos.y + (size.y - data.height) / 2;
 
-void ListWidget::ItemWidget::performLayout()
-{
-	for (auto item : m_itemsData)
+	for (int c_idx = 0; c_idx < data.cells.size(); c_idx++)
 	{
-		Label* l = item.label;
-		l->setPosition(ImVec2(
-			item.pos_x,
-			(height() - l->height()) / 2)
-		);
+		renderer->drawText(ImVec2(pos.x + m_columnsPos[c_idx], pos_y),
+			ImColor(1.0f, 1.0f, 1.0f), data.cells[c_idx], false, UISettings::fontSize() / 2);
 	}
 }
-
-void ListWidget::ItemWidget::draw(ImGuiRenderer* renderer)
-{
-	if (this->selected()) renderer->drawRect(absolutePosition(), absolutePosition() + size(), ImColor(0xF5, 0x91, 0x32)/*ImColor(0.7f, 0.1f, 0.1f)*/, true);
-	ListBoxItem::draw(renderer);
-}
-
-void ListWidget::ItemWidget::add(Label* label, float pos_x)
-{
-	ItemData data;
-	data.label = label;
-	data.pos_x = pos_x;
-	m_itemsData.push_back(data);
-
-	this->addChild(label);
-}
\ No newline at end of file
@@ -1,9 +1,10 @@
 #include "../../../main.h"
 #include "../../gui.h"
 
-#include <sstream>
 #include <algorithm>
 
+extern UI* pUI;
+
 /* ListWidget */
 
 TabListWidget::TabListWidget()
@@ -21,94 +22,72 @@ void TabListWidget::performLayout()
 
 void TabListWidget::assemble(const std::string& data)
 {
-	std::vector < std::vector<Label*> > vRows;
+	assemble(data.data(), data.length());
+}
+
+void TabListWidget::assemble(const char* data, size_t length)
+{
+	float font_size = UISettings::fontSize() / 2;
+	FrameVector<float> vColumnsWidth;
 
 	/*   */
-	std::stringstream ss_data(data);
-	std::string s_row;
-	while (std::getline(ss_data, s_row, '\n'))
+	const char* end = data + length;
+	for (const char* row_begin = data; row_begin < end; )
 	{
-		if (s_row.length() == 0) continue;
+		const char* row_end = std::find(row_begin, end, '\n');
+		if (row_end == row_begin) {
+			row_begin = row_end + 1;
+			continue;
+		}
 
-		std::vector<Label*> vRowItems;
+		RowData row;
+		row.height = 0.0f;
 
-		/*    */
-		std::stringstream ss_row(s_row);
-		std::string s_item;
-		while (std::getline(ss_row, s_item, '\t'))
+		/*   ,     */
+		for (const char* item_begin = row_begin; item_begin < row_end; )
 		{
-			Label* label = new Label(s_item, ImColor(1.0f, 1.0f, 1.0f), false, UISettings::fontSize() / 2);
-			label->performLayout();
-			vRowItems.push_back(label);
-		}
+			const char* item_end = std::find(item_begin, row_end, '\t');
+			row.cells.emplace_back(item_begin, item_end);
 
-		vRows.push_back(vRowItems);
-	}
+			ImVec2 sz = pUI->renderer()->calculateTextSize(row.cells.back(), font_size);
+			int c_idx = row.cells.size() - 1;
 
-	/*       */
-	std::vector<float> vColumnsWidth;
-	for (int r_idx = 0; r_idx < vRows.size(); r_idx++)
-	{
-		for (int c_idx = 0; c_idx < vRows[r_idx].size(); c_idx++)
-		{
 			if (vColumnsWidth.size() < (c_idx + 1)) {
 				vColumnsWidth.push_back(0.0f);
 			}
 
-			vColumnsWidth[c_idx] = std::max(vColumnsWidth[c_idx], vRows[r_idx][c_idx]->width());
+			vColumnsWidth[c_idx] = std::max(vColumnsWidth[c_idx], sz.x);
+			row.height = std::max(row.height, sz.y);
+
+			item_begin = item_end + 1;
 		}
+
+		m_rows.push_back(std::move(row));
+		row_begin = row_end + 1;
 	}
 
-	float max_width = 0.0f;
-	for (int r_idx = 0; r_idx < vRows.size(); r_idx++)
+	/*        */
+	float pos_x = UISettings::padding();
+	for (int c_idx = 0; c_idx < vColumnsWidth.size(); c_idx++)
 	{
-		ItemWidget* item = new ItemWidget(r_idx == 0 ? false : true);
-		this->addItem(item);
-
-		float pos_x = UISettings::padding();
-		for (int c_idx = 0; c_idx < vRows[r_idx].size(); c_idx++)
-		{
-			Label* l = vRows[r_idx][c_idx];
-			item->add(l, pos_x);
-			pos_x += vColumnsWidth[c_idx] + UISettings::padding() * 5;
-			max_width = std::max(max_width, pos_x);
-		}
+		m_columnsPos.push_back(pos_x);
+		pos_x += vColumnsWidth[c_idx] + UISettings::padding() * 5;
 	}
 
-	m_itemSize.x = max_width;
+	m_itemSize.x = pos_x;
+	this->rowsChanged();
 }
 
-/* ListWidget::ItemWidget */
-TabListWidget::ItemWidget::ItemWidget(bool selectable)
-	: ListBoxItem(selectable)
+void TabListWidget::drawRow(ImGuiRenderer* renderer, int row, const ImVec2& pos, const ImVec2& size, bool selected)
 {
+	if (selected) renderer->drawRect(pos, pos + size, ImColor(0x64, 0x95, 0xED)/*ImColor(0.7f, 0.1f, 0.1f)*/, true);
 
-}
+	const RowData& data = m_rows[row];
+	float pos_y = pos.y + (size.y - data.height) / 2;
 
-void TabListWidget::ItemWidget::performLayout()
-{
-	for (auto item : m_itemsData)
+	for (int c_idx = 0; c_idx < data.cells.size(); c_idx++)
 	{
-		Label* l = item.label;
-		l->setPosition(ImVec2(
-			item.pos_x,
-			(height() - l->height()) / 2)
-		);
+		renderer->drawText(ImVec2(pos.x + m_columnsPos[c_idx], pos_y),
+			ImColor(1.0f, 1.0f, 1.0f), data.cells[c_idx], false, UISettings::fontSize() / 2);
 	}
 }
-
-void TabListWidget::ItemWidget::draw(ImGuiRenderer* renderer)
-{
-	if (this->selected()) renderer->drawRect(absolutePosition(), absolutePosition() + size(), ImColor(0x64, 0x95, 0xED)/*ImColor(0.7f, 0.1f, 0.1f)*/, true);
-	ListBoxItem::draw(renderer);
-}
-
-void TabListWidget::ItemWidget::add(Label* label, float pos_x)
-{
-	ItemData data;
-	data.label = label;
-	data.pos_x = pos_x;
-	m_itemsData.push_back(data);
-
-	this->addChild(label);
-}
\ No newline at end of file
@@ -8,29 +8,22 @@ public:
 	virtual void performLayout() override;
 
 	void assemble(const std::string& data);
+	// rows split by '\n', cells by '\t'
+	void assemble(const char* data, size_t length);
+
+	virtual int rowCount() const override { return m_rows.size(); }
+	virtual int rowItemIndex(int row) const override { return row == 0 ? -1 : row - 1; }
+	virtual void drawRow(ImGuiRenderer* renderer, int row, const ImVec2& pos, const ImVec2& size, bool selected) override;
 
 private:
-	class ItemWidget : public ListBoxItem
+	struct RowData
 	{
-	public:
-		struct ItemData
-		{
-			Label* label;
-			float pos_x;
-		};
-
-	public:
-		ItemWidget(bool selectable = true);
-
-		void add(Label* label, float pos_x);
-
-		void performLayout() override;
-		virtual void draw(ImGuiRenderer* renderer) override;
-
-	private:
-		std::vector<ItemData> m_itemsData;
+		std::vector<std::string> cells;
+		float height;
 	};
 
 private:
 	ImVec2 m_itemSize;
+	std::vector<RowData> m_rows;
+	std::vector<float> m_columnsPos;
 };
\ No newline at end of file
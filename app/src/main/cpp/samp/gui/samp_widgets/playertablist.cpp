@@ -4,8 +4,6 @@
 #include "../../main.h"
 
 
-#include <iomanip>
-
 extern UI* pUI;
 extern CGame* pGame;
 extern CNetGame* pNetGame;
@@ -62,11 +60,20 @@ void PlayerTabList::hide()
 	setVisible(false);
 }
 
-std::string int_to_hex(int val)
+// "{RRGGBB}"
+static void FormatColorTag(char* szTag, size_t size, const ImColor& color)
+{
+	snprintf(szTag, size, "{%02X%02X%02X}",
+		(int)(color.Value.x * 255.0f), (int)(color.Value.y * 255.0f), (int)(color.Value.z * 255.0f));
+}
+
+// id, name, score and ping as one row, each cell with the player's color
+static void AppendPlayerRow(FrameString& data, const char* szColorTag, int iPlayerID, const char* szName, int iScore, int iPing)
 {
-	char hex[20];
-	sprintf(hex, "%02X", val);
-	return std::string(hex);
+	char szRow[256];
+	snprintf(szRow, sizeof(szRow), "%s%d\t%s%s\t%s%d\t%s%d\n",
+		szColorTag, iPlayerID, szColorTag, szName, szColorTag, iScore, szColorTag, iPing);
+	data += szRow;
 }
 
 void PlayerTabList::assemble()
@@ -74,60 +81,37 @@ void PlayerTabList::assemble()
 	CPlayerPool* pPlayerPool = pNetGame->GetPlayerPool();
 	CLocalPlayer* pLocalPlayer = pPlayerPool->GetLocalPlayer();
 
-	std::stringstream ss;
-	ss << "Players: " << pPlayerPool->GetTotalPlayers();
+	char szTotal[64];
+	snprintf(szTotal, sizeof(szTotal), "Players: %d", pPlayerPool->GetTotalPlayers());
 
 	/*  */
 	m_lServerName->setText(Encoding::cp2utf(pNetGame->m_szHostName));
-	m_lTotalPlayers->setText(ss.str());
+	m_lTotalPlayers->setText(szTotal);
 
-	std::stringstream data;
+	// gone at the end of the frame, the tab list keeps its own copy of the cells
+	FrameString data;
+	data.reserve(64 * (pPlayerPool->GetTotalPlayers() + 2));
 	/* head */
-	data << "ID\tNickname\tScore\tPing\n";
+	data += "ID\tNickname\tScore\tPing\n";
 
 	/* local player */
-	ImColor lc = UI::fixcolor(pLocalPlayer->GetPlayerColorAsRGBA());
-	std::string localColorTag = "{" +
-		int_to_hex((int)(lc.Value.x * 255.0f)) +
-		int_to_hex((int)(lc.Value.y * 255.0f)) +
-		int_to_hex((int)(lc.Value.z * 255.0f)) + "}";
-
-	data <<
-		/* playerid */
-		localColorTag << pPlayerPool->GetLocalPlayerID() << "\t" <<
-		/* name */
-		localColorTag << pPlayerPool->GetLocalPlayerName() << "\t" <<
-		/* score */
-		localColorTag << pPlayerPool->GetLocalPlayerScore() << "\t" <<
-		/* ping */
-		localColorTag << pPlayerPool->GetLocalPlayerPing() << "\n";
-
-	std::string remoteColorTag;
+	char szColorTag[16];
+	FormatColorTag(szColorTag, sizeof(szColorTag), UI::fixcolor(pLocalPlayer->GetPlayerColorAsRGBA()));
+	AppendPlayerRow(data, szColorTag, pPlayerPool->GetLocalPlayerID(), pPlayerPool->GetLocalPlayerName(),
+		pPlayerPool->GetLocalPlayerScore(), pPlayerPool->GetLocalPlayerPing());
 
 	for (int i = 0; i < MAX_PLAYERS; i++)
 	{
 		// remote player активен 
 		if (pPlayerPool->GetAt(i) && !pPlayerPool->IsPlayerNPC(i))
 		{
-			ImColor rc = UI::fixcolor(pPlayerPool->GetAt(i)->GetPlayerColor());
-			remoteColorTag = "{" +
-				int_to_hex((int)(rc.Value.x * 255.0f)) +
-				int_to_hex((int)(rc.Value.y * 255.0f)) +
-				int_to_hex((int)(rc.Value.z * 255.0f)) + "}";
-
-			data <<
-				/* playerid */
-				remoteColorTag << i << "\t" <<
-				/* name */
-				remoteColorTag << pPlayerPool->GetPlayerName(i) << "\t" <<
-				/* score */
-				remoteColorTag << pPlayerPool->GetPlayerScore(i) << "\t" <<
-				/* ping */
-				remoteColorTag << pPlayerPool->GetPlayerPing(i) << "\n";
+			FormatColorTag(szColorTag, sizeof(szColorTag), UI::fixcolor(pPlayerPool->GetAt(i)->GetPlayerColor()));
+			AppendPlayerRow(data, szColorTag, i, pPlayerPool->GetPlayerName(i),
+				pPlayerPool->GetPlayerScore(i), pPlayerPool->GetPlayerPing(i));
 		}
 	}
 
-	m_tabList->assemble(data.str());
+	m_tabList->assemble(data.data(), data.length());
 }
 
 void PlayerTabList::performLayout()
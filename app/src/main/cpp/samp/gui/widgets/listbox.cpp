@@ -13,14 +13,9 @@ void ListBox::setItemSize(const ImVec2& size)
 	m_panel->setItemSize(size);
 }
 
-void ListBox::addItem(ListBoxItem* item)
+void ListBox::rowsChanged()
 {
-	m_panel->addItem(item);
-}
-
-void ListBox::removeItem(int index)
-{
-	m_panel->removeItem(index);
+	m_panel->performLayout();
 }
 
 /* ListBox::Panel */
@@ -29,84 +24,52 @@ ListBox::Panel::Panel()
 {
 	m_itemSize = ImVec2(0.0f, 0.0f);
 	m_activeItemIndex = -1;
-	m_itemsCount = 0;
 }
 
 void ListBox::Panel::performLayout()
 {
-	/*    */
-	for (auto c : children())
-	{
-		c->setFixedSize(m_itemSize);
-		c->performLayout();
-	}
+	/*   ,      O(1) */
+	this->setSize(ImVec2(m_itemSize.x, m_itemSize.y * listBox()->rowCount()));
+}
+
+void ListBox::Panel::draw(ImGuiRenderer* renderer)
+{
+	int count = listBox()->rowCount();
+	if (count == 0 || m_itemSize.y <= 0.0f) return;
 
-	/*   */
-	ImVec2 item_pos = ImVec2(0.0f, 0.0f);
+	/*   ,     */
+	float offset = parent()->absolutePosition().y - absolutePosition().y;
 
-	for (auto c : children())
+	int first = ImMax(0, (int)(offset / m_itemSize.y));
+	int last = ImMin(count - 1, (int)((offset + parent()->height()) / m_itemSize.y));
+
+	for (int row = first; row <= last; row++)
 	{
-		c->setPosition(item_pos);
-		item_pos += ImVec2(0.0f, c->height());
-	}
+		ImVec2 pos = absolutePosition() + ImVec2(0.0f, m_itemSize.y * row);
+		int index = listBox()->rowItemIndex(row);
 
-	this->setSize(ImVec2(m_itemSize.x, item_pos.y));
+		listBox()->drawRow(renderer, row, pos, m_itemSize, index != -1 && index == m_activeItemIndex);
+	}
 }
 
-void ListBox::Panel::draw(ImGuiRenderer* renderer)
+void ListBox::Panel::touchEvent(const ImVec2& pos, TouchType type)
 {
-	float boxPosY1 = parent()->absolutePosition().y - m_itemSize.y;
-	float boxPosY2 = parent()->absolutePosition().y + parent()->height();
-
-	for (auto item : children())
+	/*    :       */
+	if (type == TouchType::pop && focused() && visible() &&
+		contains(pos) && parent()->contains(pos) && m_itemSize.y > 0.0f)
 	{
-		float posY = item->absolutePosition().y;
-		if (posY >= boxPosY1 && posY <= boxPosY2)
+		int row = (int)((pos.y - absolutePosition().y) / m_itemSize.y);
+		if (row >= 0 && row < listBox()->rowCount())
 		{
-			item->draw(renderer);
+			int index = listBox()->rowItemIndex(row);
+			if (index != -1) m_activeItemIndex = index;
 		}
 	}
+
+	Widget::touchEvent(pos, type);
 }
 
 void ListBox::Panel::setItemSize(const ImVec2& size)
 {
 	m_itemSize = size;
 }
-
-void ListBox::Panel::addItem(ListBoxItem* item)
-{
-	if(item->selectable()) 
-		item->setIndex(m_itemsCount++);
-
-	this->addChild(item);
-	this->performLayout();
-}
-
-void ListBox::Panel::removeItem(int index)
-{
-	this->removeChild(index);
-	this->performLayout();
-}
-
-/* ListBoxItem */
-
-ListBoxItem::ListBoxItem(bool selectable)
-{
-	m_index = -1;
-	m_selectable = selectable;
-}
-
-void ListBoxItem::activateEvent(bool active)
-{
-	if (!m_selectable) return;
-
-	if (active) {
-		dynamic_cast<ListBox::Panel*>(parent())->setActiveItemIndex(m_index);
-	}
-}
-
-bool ListBoxItem::selected()
-{
-	if (!m_selectable) return false;
-	return dynamic_cast<ListBox::Panel*>(parent())->activeItemIndex() == m_index;
-}
\ No newline at end of file
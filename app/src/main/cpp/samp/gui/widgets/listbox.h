@@ -1,21 +1,10 @@
 #pragma once
 
-class ListBoxItem : public Widget
-{
-public:
-	ListBoxItem(bool selectable = true);
-
-	void setIndex(int index) { m_index = index; }
-	virtual void activateEvent(bool active);
-	bool selected();
-
-	bool selectable() { return m_selectable; }
-
-private:
-	int m_index;
-	bool m_selectable;
-};
-
+/*
+	Virtualized list: rows are plain records owned by the subclass, not child
+	widgets. The panel only knows the row count and item size, and asks the
+	subclass to draw the rows that intersect the visible area.
+*/
 class ListBox : public ScrollPanel
 {
 public:
@@ -24,12 +13,19 @@ public:
 	void setItemSize(const ImVec2& size);
 	const ImVec2& itemSize() { return m_panel->itemSize(); }
 
-	void addItem(ListBoxItem* item);
-	void removeItem(int index);
-
-	int itemsCount() { return m_panel->itemsCount(); }
+	int itemsCount() const { return rowCount(); }
 	int activeItemIndex() const { return m_panel->activeItemIndex(); }
 
+	/* row source */
+	virtual int rowCount() const { return 0; }
+	/* index reported by activeItemIndex(), -1 if the row can't be selected */
+	virtual int rowItemIndex(int row) const { return row; }
+	virtual void drawRow(ImGuiRenderer* renderer, int row, const ImVec2& pos, const ImVec2& size, bool selected) {}
+
+protected:
+	/* must be called after rows were added or removed */
+	void rowsChanged();
+
 public:
 	class Panel : public Widget
 	{
@@ -39,24 +35,23 @@ public:
 		void setItemSize(const ImVec2& size);
 		const ImVec2& itemSize() { return m_itemSize; }
 
-		void addItem(ListBoxItem* item);
-		void removeItem(int index);
-
-		int itemsCount() { return children().size(); }
-
 		int activeItemIndex() const { return m_activeItemIndex; }
 		void setActiveItemIndex(int index) { m_activeItemIndex = index; }
 
+		virtual void touchEvent(const ImVec2& pos, TouchType type) override;
+
 		virtual void performLayout() override;
 		virtual void draw(ImGuiRenderer* renderer) override;
 
+	private:
+		ListBox* listBox() const { return static_cast<ListBox*>(parent()); }
+
 	private:
 		ImVec2 m_itemSize;
 		int m_activeItemIndex;
-		int m_itemsCount;
 	};
 
 private:
 	bool m_headed;
 	Panel* m_panel;
-};
\ No newline at end of file
+};
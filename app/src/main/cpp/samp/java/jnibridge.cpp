@@ -0,0 +1,21 @@
+#include "jnibridge.h"
+
+#include <cstring>
+
+CJavaBridge::CJavaBridge(IJavaBridgeSink* pSink)
+{
+	m_pSink = pSink;
+	memset(&m_LastHud, 0, sizeof(m_LastHud));
+	m_bHudValid = false;
+}
+
+bool CJavaBridge::UpdateHudInfo(const HudInfo& info)
+{
+	if (m_bHudValid && info == m_LastHud) return false;
+
+	m_LastHud = info;
+	m_bHudValid = true;
+
+	if (m_pSink) m_pSink->PushHudInfo(info);
+	return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+// JNI-free half of the Java bridge: decides what has to cross JNI.
+// CJavaWrapper is the Android sink; anything implementing IJavaBridgeSink can be
+// plugged in instead, so the diff logic runs on a desktop build without a JVM.
+
+struct HudInfo
+{
+	int iHealth;
+	int iArmour;
+	int iWeaponId;
+	int iAmmo;
+	int iAmmoInClip;
+	int iMoney;
+	int iWanted;
+
+	bool operator==(const HudInfo& other) const {
+		return iHealth == other.iHealth && iArmour == other.iArmour &&
+			iWeaponId == other.iWeaponId && iAmmo == other.iAmmo &&
+			iAmmoInClip == other.iAmmoInClip && iMoney == other.iMoney &&
+			iWanted == other.iWanted;
+	}
+	bool operator!=(const HudInfo& other) const { return !(*this == other); }
+};
+
+class IJavaBridgeSink
+{
+public:
+	virtual ~IJavaBridgeSink() {}
+
+	virtual void PushHudInfo(const HudInfo& info) = 0;
+};
+
+class CJavaBridge
+{
+public:
+	CJavaBridge(IJavaBridgeSink* pSink);
+
+	// forwards the values only if one of them changed since the last push
+	bool UpdateHudInfo(const HudInfo& info);
+	// the next UpdateHudInfo() is pushed even if nothing changed (HUD rebuilt on the Java side)
+	void InvalidateHud() { m_bHudValid = false; }
+
+private:
+	IJavaBridgeSink*		m_pSink;
+
+	HudInfo					m_LastHud;
+	bool					m_bHudValid;
+};
@@ -1,8 +1,53 @@
 #include "jniutil.h"
 #include "game/game.h"
+#include <pthread.h>
 extern CGame *pGame;
 
+static pthread_key_t g_jniDetachKey;
+static pthread_once_t g_jniDetachOnce = PTHREAD_ONCE_INIT;
+
+static void DetachThreadOnExit(void*)
+{
+    if (javaVM) javaVM->DetachCurrentThread();
+}
+
+static void CreateDetachKey()
+{
+    pthread_key_create(&g_jniDetachKey, DetachThreadOnExit);
+}
+
+bool GetJNIEnvSafe(JNIEnv** env)
+{
+    *env = nullptr;
+
+    if (!javaVM) {
+        LOGE("GetJNIEnvSafe: javaVM is null");
+        return false;
+    }
+
+    jint result = javaVM->GetEnv((void**)env, JNI_VERSION_1_6);
+
+    if (result == JNI_OK) {
+        return true;  // Thread ja estava anexada
+    }
+
+    if (result == JNI_EDETACHED) {
+        // Thread nativa nao anexada - anexar uma vez e desanexar so quando ela terminar
+        if (javaVM->AttachCurrentThread(env, nullptr) == JNI_OK) {
+            pthread_once(&g_jniDetachOnce, CreateDetachKey);
+            pthread_setspecific(g_jniDetachKey, (void*)1);
+            return true;
+        }
+        LOGE("GetJNIEnvSafe: AttachCurrentThread failed");
+    } else {
+        LOGE("GetJNIEnvSafe: GetEnv failed with %d", result);
+    }
+
+    return false;
+}
+
 CJavaWrapper::CJavaWrapper(JNIEnv *env, jobject activity)
+    : m_Bridge(this)
 {
     this->activity = env->NewGlobalRef(activity);
 
@@ -44,84 +89,73 @@ CJavaWrapper::CJavaWrapper(JNIEnv *env, jobject activity)
 void CJavaWrapper::ShowKeyboard()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ShowKeyboard: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_showInputLayout);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::HideKeyboard()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("HideKeyboard: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_hideInputLayout);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::ShowLoadingScreen()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ShowLoadingScreen: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_showLoadingScreen);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::HideLoadingScreen()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("HideLoadingScreen: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_hideLoadingScreen);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::SetPauseState(bool pause)
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("SetPauseState: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_setPauseState, pause);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::SetTab(int id, char* names, int score, int pings)
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("SetTab: Failed to get JNIEnv");
         return;
     }
@@ -129,7 +163,6 @@ void CJavaWrapper::SetTab(int id, char* names, int score, int pings)
 	jclass strClass = env->FindClass("java/lang/String"); 
 	if (!strClass) {
 		LOGE("SetTab: FindClass failed");
-		DETACH_IF_NEEDED(needsDetach);
 		return;
 	}
 	
@@ -148,61 +181,52 @@ void CJavaWrapper::SetTab(int id, char* names, int score, int pings)
     env->DeleteLocalRef(str1);
     env->DeleteLocalRef(encoding);
     env->DeleteLocalRef(strClass);
-    
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::ShowTab()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ShowTab: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_showTab);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::HideTab()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("HideTab: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_hideTab);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::ClearTab()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ClearTab: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(activity, s_clearTab);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::ShowDialog(int dialogStyle, int dialogID, char* title, char* text, char* button1, char* button2)
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ShowDialog: Failed to get JNIEnv");
         return;
     }
@@ -226,92 +250,90 @@ void CJavaWrapper::ShowDialog(int dialogStyle, int dialogID, char* title, char*
 	if (jstrButton1) env->DeleteLocalRef(jstrButton1);
 	if (jstrButton2) env->DeleteLocalRef(jstrButton2);
 	
-	DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::UpdateHudInfo(int health, int armour, int weaponid, int ammo, int ammoinclip, int money, int wanted)
+{
+    HudInfo info = { health, armour, weaponid, ammo, ammoinclip, money, wanted };
+
+    // chamado todo frame, so cruza o JNI quando algum valor mudou
+    m_Bridge.UpdateHudInfo(info);
+}
+
+void CJavaWrapper::PushHudInfo(const HudInfo& info)
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("UpdateHudInfo: Failed to get JNIEnv");
         return;
     }
 
-    env->CallVoidMethod(this->activity, this->s_updateHudInfo, health, armour, weaponid, ammo, ammoinclip, money, wanted);
+    env->CallVoidMethod(this->activity, this->s_updateHudInfo, info.iHealth, info.iArmour, info.iWeaponId,
+        info.iAmmo, info.iAmmoInClip, info.iMoney, info.iWanted);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::ShowHud()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ShowHud: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(this->activity, this->s_showHud);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
+    // o HUD pode ter sido recriado, reenvia os valores no proximo update
+    m_Bridge.InvalidateHud();
 }
 
 void CJavaWrapper::HideHud()
 {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("HideHud: Failed to get JNIEnv");
         return;
     }
     
     env->CallVoidMethod(this->activity, this->s_hideHud);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::exitGame() {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("exitGame: Failed to get JNIEnv");
         return;
     }
 
     env->CallVoidMethod(this->activity, this->s_exitGame);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::ShowEditObject() {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("ShowEditObject: Failed to get JNIEnv");
         return;
     }
 
     env->CallVoidMethod(this->activity, this->s_showEditObject);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
 
 void CJavaWrapper::HideEditObject() {
     JNIEnv* env;
-    bool needsDetach;
     
-    if (!GetJNIEnvSafe(&env, &needsDetach)) {
+    if (!GetJNIEnvSafe(&env)) {
         LOGE("HideEditObject: Failed to get JNIEnv");
         return;
     }
 
     env->CallVoidMethod(this->activity, this->s_hideEditObject);
     EXCEPTION_CHECK(env);
-    DETACH_IF_NEEDED(needsDetach);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "main.h"
+#include "jnibridge.h"
 
 // Macro para verificar exceções JNI (não retorna, apenas limpa)
 #define EXCEPTION_CHECK(env) \
@@ -11,43 +12,11 @@
 
 // Helper para obter JNIEnv de forma segura, anexando a thread se necessário
 // Retorna true se obteve env válido
-// needsDetach será true se a thread foi anexada e precisa ser desanexada depois
-static inline bool GetJNIEnvSafe(JNIEnv** env, bool* needsDetach) {
-	*needsDetach = false;
-	*env = nullptr;
-	
-	if (!javaVM) {
-		LOGE("GetJNIEnvSafe: javaVM is null");
-		return false;
-	}
-	
-	jint result = javaVM->GetEnv((void**)env, JNI_VERSION_1_6);
-	
-	if (result == JNI_OK) {
-		return true;  // Thread já estava anexada
-	}
-	
-	if (result == JNI_EDETACHED) {
-		// Thread nativa não anexada - anexar agora
-		if (javaVM->AttachCurrentThread(env, nullptr) == JNI_OK) {
-			*needsDetach = true;
-			return true;
-		}
-		LOGE("GetJNIEnvSafe: AttachCurrentThread failed");
-	} else {
-		LOGE("GetJNIEnvSafe: GetEnv failed with %d", result);
-	}
-	
-	return false;
-}
+// A thread anexada aqui continua anexada até terminar (o attach custa mais que a
+// própria chamada), então quem chama nunca precisa desanexar
+bool GetJNIEnvSafe(JNIEnv** env);
 
-// Macro para desanexar thread se necessário
-#define DETACH_IF_NEEDED(needsDetach) \
-	if (needsDetach) { \
-		javaVM->DetachCurrentThread(); \
-	}
-
-class CJavaWrapper
+class CJavaWrapper : public IJavaBridgeSink
 {
 public:
     CJavaWrapper(JNIEnv *env, jobject activity);
@@ -86,6 +55,11 @@ public:
 	void ShowEditObject();
 	void HideEditObject();
 
+    // IJavaBridgeSink
+    void PushHudInfo(const HudInfo& info) override;
+
+    CJavaBridge m_Bridge;
+
     jobject activity;
     jmethodID s_setPauseState;
     jmethodID s_showLoadingScreen;
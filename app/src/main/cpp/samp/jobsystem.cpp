@@ -0,0 +1,285 @@
+#include "jobsystem.h"
+#include "profiler.h"
+#include "threadplacement.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define JOB_WAIT_TIMEOUT	1	// ms a waiting thread sleeps before it looks for jobs again
+
+struct Job
+{
+	JobFunc		fn;
+	JobFunc		fnComplete;
+	CJobFence*	pFence;
+};
+
+struct JobQueue
+{
+	std::mutex		mutex;
+	std::deque<Job>	jobs[JOB_PRIORITY_COUNT];
+};
+
+static JobQueue* g_pJobQueues = nullptr;		// one per worker, one in total without workers
+static int g_iJobQueueCount = 0;
+static std::vector<std::thread> g_JobWorkers;
+
+static std::atomic<bool> g_bJobRunning(false);
+static std::atomic<int> g_iJobQueued(0);
+static std::atomic<uint32_t> g_dwJobNextQueue(0);
+
+// workers sleep on this while there's nothing queued, waiters until a fence is done
+static std::mutex g_JobSleepMutex;
+static std::condition_variable g_JobWorkCv;
+static std::condition_variable g_JobFenceCv;
+
+static std::mutex g_JobCompletionMutex;
+static std::vector<JobFunc> g_JobCompletions;
+
+static CJobFence g_JobFrameFence;
+static std::thread::id g_JobMainThread;
+
+static std::atomic<uint32_t> g_dwJobSubmitted(0);
+static std::atomic<uint32_t> g_dwJobExecuted(0);
+static std::atomic<uint32_t> g_dwJobStolen(0);
+static std::atomic<uint32_t> g_dwJobHelped(0);
+static std::atomic<uint32_t> g_dwJobCompletions(0);
+
+static thread_local int t_iJobWorker = -1;
+
+// highest priority first; from the own queue the newest job, from the others the oldest
+bool CJobSystem::PopJob(int iOwn, Job& job)
+{
+	for (int iPriority = 0; iPriority < JOB_PRIORITY_COUNT; iPriority++)
+	{
+		for (int i = 0; i < g_iJobQueueCount; i++)
+		{
+			int iQueue = iOwn < 0 ? i : (iOwn + i) % g_iJobQueueCount;
+			JobQueue& queue = g_pJobQueues[iQueue];
+			std::deque<Job>& jobs = queue.jobs[iPriority];
+
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (jobs.empty()) continue;
+
+			if (iQueue == iOwn) {
+				job = std::move(jobs.back());
+				jobs.pop_back();
+			}
+			else {
+				job = std::move(jobs.front());
+				jobs.pop_front();
+				if (iOwn >= 0) g_dwJobStolen.fetch_add(1, std::memory_order_relaxed);
+			}
+			g_iJobQueued.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+void CJobSystem::RunJob(Job& job)
+{
+	job.fn();
+	g_dwJobExecuted.fetch_add(1, std::memory_order_relaxed);
+
+	if (job.fnComplete) PostToMain(std::move(job.fnComplete));
+
+	if (job.pFence && job.pFence->m_iPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		// taking the mutex orders this against a waiter that's about to sleep
+		std::lock_guard<std::mutex> lock(g_JobSleepMutex);
+		g_JobFenceCv.notify_all();
+	}
+}
+
+void CJobSystem::WorkerThread(int iWorker)
+{
+	PROFILE_THREAD("Job");
+	CThreadPlacement::Register(THREAD_ROLE_WORKER);
+	t_iJobWorker = iWorker;
+
+	Job job;
+	while (true)
+	{
+		if (PopJob(iWorker, job)) {
+			PROFILE_SCOPE("Job");
+			RunJob(job);
+			job = Job();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(g_JobSleepMutex);
+		g_JobWorkCv.wait(lock, []() {
+			return g_iJobQueued.load(std::memory_order_relaxed) > 0 || !g_bJobRunning.load(std::memory_order_relaxed);
+		});
+		if (!g_bJobRunning.load(std::memory_order_relaxed) && g_iJobQueued.load(std::memory_order_relaxed) == 0) return;
+	}
+}
+
+int CJobSystem::GetDefaultWorkerCount()
+{
+	return std::clamp(CThreadPlacement::GetWorkerCount(CThreadPlacement::GetTopology()), 1, JOB_MAX_WORKERS);
+}
+
+void CJobSystem::Initialise(int iWorkers)
+{
+	if (g_pJobQueues) return;
+
+	iWorkers = std::clamp(iWorkers, 0, JOB_MAX_WORKERS);
+	g_JobMainThread = std::this_thread::get_id();
+	g_iJobQueueCount = std::max(iWorkers, 1);
+	g_pJobQueues = new JobQueue[g_iJobQueueCount];
+	g_bJobRunning = true;
+
+	for (int i = 0; i < iWorkers; i++) {
+		g_JobWorkers.emplace_back(WorkerThread, i);
+	}
+}
+
+void CJobSystem::Shutdown()
+{
+	if (!g_pJobQueues) return;
+
+	{
+		std::lock_guard<std::mutex> lock(g_JobSleepMutex);
+		g_bJobRunning = false;
+	}
+	g_JobWorkCv.notify_all();
+	for (auto& worker : g_JobWorkers) worker.join();
+	g_JobWorkers.clear();
+
+	// without workers nobody ran them yet
+	Job job;
+	while (PopJob(-1, job)) RunJob(job);
+	ProcessCompletions();
+
+	delete[] g_pJobQueues;
+	g_pJobQueues = nullptr;
+	g_iJobQueueCount = 0;
+}
+
+int CJobSystem::GetWorkerCount()
+{
+	return (int)g_JobWorkers.size();
+}
+
+bool CJobSystem::IsMainThread()
+{
+	return std::this_thread::get_id() == g_JobMainThread;
+}
+
+void CJobSystem::Submit(JobFunc fn, int iPriority, CJobFence* pFence, JobFunc fnComplete)
+{
+	iPriority = std::clamp(iPriority, 0, JOB_PRIORITY_COUNT - 1);
+	if (pFence) pFence->m_iPending.fetch_add(1, std::memory_order_relaxed);
+	g_dwJobSubmitted.fetch_add(1, std::memory_order_relaxed);
+
+	if (!g_pJobQueues)
+	{
+		// not initialised (or shut down): run it right here
+		Job job = { std::move(fn), std::move(fnComplete), pFence };
+		RunJob(job);
+		return;
+	}
+
+	// a worker keeps its own jobs, everyone else spreads them round robin
+	int iQueue = t_iJobWorker >= 0 ? t_iJobWorker : (int)(g_dwJobNextQueue.fetch_add(1, std::memory_order_relaxed) % g_iJobQueueCount);
+	JobQueue& queue = g_pJobQueues[iQueue];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs[iPriority].push_back({ std::move(fn), std::move(fnComplete), pFence });
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(g_JobSleepMutex);
+		g_iJobQueued.fetch_add(1, std::memory_order_relaxed);
+	}
+	g_JobWorkCv.notify_one();
+}
+
+void CJobSystem::SubmitFrame(JobFunc fn, JobFunc fnComplete)
+{
+	Submit(std::move(fn), JOB_PRIORITY_HIGH, &g_JobFrameFence, std::move(fnComplete));
+}
+
+void CJobSystem::Wait(CJobFence& fence)
+{
+	bool bHelp = g_pJobQueues && (t_iJobWorker >= 0 || IsMainThread());
+
+	Job job;
+	while (!fence.IsDone())
+	{
+		if (bHelp && PopJob(t_iJobWorker, job)) {
+			g_dwJobHelped.fetch_add(1, std::memory_order_relaxed);
+			RunJob(job);
+			job = Job();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(g_JobSleepMutex);
+		if (fence.IsDone()) break;
+		// woken by the fence, or by the timeout to look for jobs again
+		g_JobFenceCv.wait_for(lock, std::chrono::milliseconds(JOB_WAIT_TIMEOUT));
+	}
+}
+
+void CJobSystem::PostToMain(JobFunc fn)
+{
+	std::lock_guard<std::mutex> lock(g_JobCompletionMutex);
+	g_JobCompletions.push_back(std::move(fn));
+}
+
+int CJobSystem::ProcessCompletions()
+{
+	static std::vector<JobFunc> completions;
+	{
+		std::lock_guard<std::mutex> lock(g_JobCompletionMutex);
+		if (g_JobCompletions.empty()) return 0;
+		completions.swap(g_JobCompletions);
+	}
+
+	// a completion may post more, those wait for the next call
+	int iCount = (int)completions.size();
+	for (auto& fn : completions) fn();
+	completions.clear();
+
+	g_dwJobCompletions.fetch_add(iCount, std::memory_order_relaxed);
+	return iCount;
+}
+
+void CJobSystem::EndFrame()
+{
+	PROFILE_SCOPE("CJobSystem::EndFrame");
+
+	if (!g_pJobQueues) return;
+
+	if (g_JobWorkers.empty())
+	{
+		// run everything here, the frame's jobs can't be told apart from the rest in the queue
+		Job job;
+		while (PopJob(-1, job)) {
+			RunJob(job);
+			job = Job();
+		}
+	}
+	else Wait(g_JobFrameFence);
+
+	ProcessCompletions();
+}
+
+JOB_STATS CJobSystem::GetStats()
+{
+	JOB_STATS stats;
+	stats.dwSubmitted = g_dwJobSubmitted.load(std::memory_order_relaxed);
+	stats.dwExecuted = g_dwJobExecuted.load(std::memory_order_relaxed);
+	stats.dwStolen = g_dwJobStolen.load(std::memory_order_relaxed);
+	stats.dwHelped = g_dwJobHelped.load(std::memory_order_relaxed);
+	stats.dwCompletions = g_dwJobCompletions.load(std::memory_order_relaxed);
+	stats.iQueued = g_iJobQueued.load(std::memory_order_relaxed);
+	return stats;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <functional>
+
+// Job system.
+// A fixed set of worker threads, each with its own queue per priority. A worker takes
+// its newest job first and steals the oldest from the others when it runs dry, higher
+// priorities before lower ones everywhere; idle workers sleep until something is
+// submitted. A job may have a completion that runs on the main thread afterwards, in
+// ProcessCompletions(), so results can be handed to the game without locks.
+// Fences count unfinished jobs; a thread that waits on one runs queued jobs meanwhile.
+// Jobs submitted with SubmitFrame() are done before EndFrame() returns.
+// With no workers the jobs run on the main thread when they're waited on or at the end
+// of the frame, by priority and then in submission order, which makes the schedule
+// deterministic.
+// Jobs must not block for long: a blocked worker takes its whole share of the pool with it,
+// and a thread waiting on a fence may pick the blocking job up itself. Network I/O belongs
+// on its own thread.
+
+#define JOB_MAX_WORKERS			8
+
+#define JOB_PRIORITY_HIGH		0		// the current frame waits for it
+#define JOB_PRIORITY_NORMAL		1
+#define JOB_PRIORITY_LOW		2		// streaming, file I/O
+#define JOB_PRIORITY_COUNT		3
+
+typedef std::function<void()> JobFunc;
+
+struct Job;
+
+class CJobFence
+{
+public:
+	bool IsDone() const { return m_iPending.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class CJobSystem;
+
+	std::atomic<int>	m_iPending{0};
+};
+
+struct JOB_STATS
+{
+	uint32_t	dwSubmitted;
+	uint32_t	dwExecuted;
+	uint32_t	dwStolen;		// taken from another worker's queue
+	uint32_t	dwHelped;		// run by a thread waiting on a fence
+	uint32_t	dwCompletions;	// run on the main thread
+	int			iQueued;		// right now
+};
+
+class CJobSystem
+{
+public:
+	// one per core that the game and render threads don't already keep busy
+	static int GetDefaultWorkerCount();
+
+	// from the main thread
+	static void Initialise(int iWorkers);
+	// runs what's still queued and joins the workers
+	static void Shutdown();
+
+	static int GetWorkerCount();
+	static bool IsMainThread();
+
+	// fnComplete, if any, runs on the main thread after fn; pFence, if any, is done after both are queued
+	static void Submit(JobFunc fn, int iPriority = JOB_PRIORITY_NORMAL, CJobFence* pFence = nullptr, JobFunc fnComplete = nullptr);
+	// fenced by the current frame
+	static void SubmitFrame(JobFunc fn, JobFunc fnComplete = nullptr);
+
+	// any thread: the main thread and workers run queued jobs until the fence is done, others sleep
+	static void Wait(CJobFence& fence);
+
+	// queues fn for the main thread, from any thread
+	static void PostToMain(JobFunc fn);
+	// main thread: runs the queued completions, returns how many
+	static int ProcessCompletions();
+
+	// main thread, once a frame: waits for the frame's jobs and runs the completions
+	static void EndFrame();
+
+	static JOB_STATS GetStats();
+
+private:
+	static bool PopJob(int iOwn, Job& job);
+	static void RunJob(Job& job);
+	static void WorkerThread(int iWorker);
+};
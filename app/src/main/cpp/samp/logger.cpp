@@ -0,0 +1,205 @@
+#include "main.h"
+#include "crashlytics.h"
+
+#include <cstdarg>
+#include <mutex>
+#include <thread>
+
+std::atomic<bool> CLogger::m_bSynchronous(false);
+
+static CLogRing* g_pLogRings[LOG_MAX_THREADS];
+static std::atomic<int> g_iLogRingCount(0);
+static std::once_flag g_LogWriterOnce;
+
+// serializes consumers: the writer thread and a crashing thread may both drain
+static std::atomic_flag g_LogDrainLock = ATOMIC_FLAG_INIT;
+static std::mutex g_LogOutputMutex;
+static FILE* g_flLog = nullptr;
+
+// set while this thread drains: if it faults in there, the crash path leaves the rings alone
+static thread_local bool t_bLogDraining = false;
+
+#define LOG_WRITER_IDLE_SLEEP	5000	// us
+
+// hands the ring back when the thread exits, so threads that come and go don't use up the slots
+struct LogRingOwner
+{
+	CLogRing* pRing = nullptr;
+	~LogRingOwner() {
+		if (pRing) pRing->Release();
+	}
+};
+
+static CLogRing* AcquireLogRing()
+{
+	// records don't say which thread wrote them, so any ring a thread left behind will do
+	int iCount = g_iLogRingCount.load(std::memory_order_acquire);
+	if (iCount > LOG_MAX_THREADS) iCount = LOG_MAX_THREADS;
+
+	for (int i = 0; i < iCount; i++)
+	{
+		CLogRing* pRing = __atomic_load_n(&g_pLogRings[i], __ATOMIC_ACQUIRE);
+		if (pRing && pRing->TryAcquire()) return pRing;
+	}
+
+	if (iCount >= LOG_MAX_THREADS) return nullptr;
+
+	int iSlot = g_iLogRingCount.fetch_add(1, std::memory_order_relaxed);
+	if (iSlot >= LOG_MAX_THREADS) return nullptr;
+
+	CLogRing* pRing = new CLogRing();
+	// published before the writer can see the new count
+	__atomic_store_n(&g_pLogRings[iSlot], pRing, __ATOMIC_RELEASE);
+	return pRing;
+}
+
+CLogRing* CLogger::GetThreadRing()
+{
+	static thread_local CLogRing* t_pRing = nullptr;
+	static thread_local bool t_bRegistered = false;
+	static thread_local LogRingOwner t_RingOwner;
+
+	if (!t_bRegistered)
+	{
+		t_bRegistered = true;
+		t_pRing = AcquireLogRing();
+		t_RingOwner.pRing = t_pRing;
+
+		std::call_once(g_LogWriterOnce, []() {
+			std::thread(WriterThread).detach();
+		});
+	}
+
+	return t_pRing;
+}
+
+// a crashing thread may be the one holding the mutex, so the crash path only tries
+static bool LockLogOutput(std::unique_lock<std::mutex>& lock, bool bSynchronous)
+{
+	if (bSynchronous) return lock.try_lock();
+	lock.lock();
+	return true;
+}
+
+void CLogger::Output(int iLevel, const char* szLine, bool bFlush)
+{
+	std::unique_lock<std::mutex> lock(g_LogOutputMutex, std::defer_lock);
+	bool bLocked = LockLogOutput(lock, m_bSynchronous.load(std::memory_order_relaxed));
+
+	// open the file only once the storage path is known
+	const char* pszStorage = g_pszStorage;
+	if (g_flLog == nullptr && pszStorage != nullptr && pszStorage[0] != '\0')
+	{
+		char szPath[0xFF];
+		snprintf(szPath, sizeof(szPath), "%s/samp_log.txt", pszStorage);
+		g_flLog = fopen(szPath, "a");
+	}
+
+	// always goes to logcat and crashlytics
+	switch (iLevel)
+	{
+	case LOG_LEVEL_WARN: LOGW("%s", szLine); break;
+	case LOG_LEVEL_ERROR: LOGE("%s", szLine); break;
+	default: LOGI("%s", szLine); break;
+	}
+
+	// whoever holds the mutex may be inside crashlytics or the file's stdio lock
+	if (!bLocked) return;
+
+	firebase::crashlytics::Log(szLine);
+
+	if (g_flLog == nullptr) return;
+	fprintf(g_flLog, "%s\n", szLine);
+	if (bFlush) fflush(g_flLog);
+}
+
+bool CLogger::Drain()
+{
+	bool bWritten = false;
+	char szLine[LOG_LINE_SIZE];
+
+	t_bLogDraining = true;
+
+	int iCount = g_iLogRingCount.load(std::memory_order_acquire);
+	if (iCount > LOG_MAX_THREADS) iCount = LOG_MAX_THREADS;
+
+	for (int i = 0; i < iCount; i++)
+	{
+		CLogRing* pRing = __atomic_load_n(&g_pLogRings[i], __ATOMIC_ACQUIRE);
+		if (!pRing) continue;
+
+		while (LogRecord* pRecord = pRing->Front())
+		{
+			pRecord->pFormat(pRecord->payload, szLine, sizeof(szLine));
+			Output(pRecord->byteLevel, szLine);
+			pRing->Pop();
+			bWritten = true;
+		}
+	}
+
+	if (bWritten)
+	{
+		std::unique_lock<std::mutex> lock(g_LogOutputMutex, std::defer_lock);
+		if (LockLogOutput(lock, m_bSynchronous.load(std::memory_order_relaxed)) && g_flLog) fflush(g_flLog);
+	}
+
+	t_bLogDraining = false;
+	return bWritten;
+}
+
+void CLogger::WriterThread()
+{
+	CThreadPlacement::Register(THREAD_ROLE_BACKGROUND);
+
+	while (true)
+	{
+		bool bWritten = false;
+
+		if (!g_LogDrainLock.test_and_set(std::memory_order_acquire))
+		{
+			bWritten = Drain();
+			g_LogDrainLock.clear(std::memory_order_release);
+		}
+
+		if (!bWritten) usleep(LOG_WRITER_IDLE_SLEEP);
+	}
+}
+
+void CLogger::Flush()
+{
+	// the writer holds the lock for one drain at most, don't wait forever on a crash;
+	// without the lock the rings stay as they are, two consumers would break them
+	bool bLocked = !g_LogDrainLock.test_and_set(std::memory_order_acquire);
+	for (int i = 0; i < 1000 && !bLocked; i++) {
+		usleep(100);
+		bLocked = !g_LogDrainLock.test_and_set(std::memory_order_acquire);
+	}
+	if (!bLocked) return;
+
+	Drain();
+	g_LogDrainLock.clear(std::memory_order_release);
+}
+
+void CLogger::BeginCrash()
+{
+	// first, so every lock below is only tried
+	m_bSynchronous.store(true, std::memory_order_relaxed);
+
+	// faulted while draining: the drain lock is ours and the record at the front is the
+	// one that faulted, formatting it again would only fault again
+	if (t_bLogDraining) return;
+
+	Flush();
+}
+
+void FLog(const char* fmt, ...)
+{
+	char buffer[LOG_LINE_SIZE];
+
+	va_list arg;
+	va_start(arg, fmt);
+	vsnprintf(buffer, sizeof(buffer), fmt, arg);
+	va_end(arg);
+
+	CLogger::WriteText(LOG_LEVEL_INFO, buffer);
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+// Asynchronous FLog backend.
+// Every thread gets its own single-producer ring of fixed-size records; a call
+// copies the format string and arguments into the next record and returns.
+// Formatting and the logcat/crashlytics/file output happen on a writer thread.
+// Signal handlers switch the logger to synchronous mode, see CLogger::BeginCrash().
+
+#define LOG_LEVEL_DEBUG		0
+#define LOG_LEVEL_INFO		1
+#define LOG_LEVEL_WARN		2
+#define LOG_LEVEL_ERROR		3
+
+// calls below this level are compiled out
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL	LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE		512		// records per thread, power of two
+#define LOG_RECORD_SIZE		256		// format string + arguments + copied strings
+#define LOG_MAX_THREADS		32		// threads alive at once past this log synchronously
+#define LOG_LINE_SIZE		0xFF	// formatted line, same limit as the old FLog
+
+typedef int (*LogFormatFunc)(const uint8_t* pPayload, char* szOut, size_t size);
+
+struct LogRecord
+{
+	LogFormatFunc	pFormat;
+	uint8_t			byteLevel;
+	alignas(8) uint8_t payload[LOG_RECORD_SIZE];
+};
+
+class CLogRing
+{
+public:
+	CLogRing() : m_bOwned(true), m_dwHead(0), m_dwTail(0) {}
+
+	// the thread exited; what it left is still drained, the next thread to log takes it over
+	void Release() { m_bOwned.store(false, std::memory_order_release); }
+	bool TryAcquire() {
+		bool bOwned = false;
+		return m_bOwned.compare_exchange_strong(bOwned, true, std::memory_order_acquire);
+	}
+
+	// producer side, nullptr when the ring is full
+	LogRecord* Reserve() {
+		uint32_t dwHead = m_dwHead.load(std::memory_order_relaxed);
+		if (dwHead - m_dwTail.load(std::memory_order_acquire) >= LOG_RING_SIZE) return nullptr;
+		return &m_Records[dwHead & (LOG_RING_SIZE - 1)];
+	}
+	void Commit() { m_dwHead.store(m_dwHead.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+	// consumer side
+	LogRecord* Front() {
+		uint32_t dwTail = m_dwTail.load(std::memory_order_relaxed);
+		if (dwTail == m_dwHead.load(std::memory_order_acquire)) return nullptr;
+		return &m_Records[dwTail & (LOG_RING_SIZE - 1)];
+	}
+	void Pop() { m_dwTail.store(m_dwTail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+private:
+	LogRecord				m_Records[LOG_RING_SIZE];
+	std::atomic<bool>		m_bOwned;
+	std::atomic<uint32_t>	m_dwHead;
+	std::atomic<uint32_t>	m_dwTail;
+};
+
+namespace logger_detail
+{
+	// where the payload builder puts variable-length data (format, strings)
+	struct Cursor
+	{
+		uint8_t*	pBase;
+		size_t		offset;
+		bool		bTruncated;
+
+		uint16_t Append(const char* sz) {
+			size_t avail = offset < LOG_RECORD_SIZE ? LOG_RECORD_SIZE - offset : 0;
+			size_t len = strlen(sz);
+
+			if (len + 1 > avail) {
+				bTruncated = true;
+				if (avail == 0) return LOG_RECORD_SIZE - 1; // the terminator of the last string
+				len = avail - 1;
+			}
+
+			uint16_t start = (uint16_t)offset;
+			memcpy(pBase + offset, sz, len);
+			pBase[offset + len] = '\0';
+			offset += len + 1;
+			return start;
+		}
+	};
+
+	// how an argument is kept inside a record until the writer formats it
+	template<typename T>
+	struct Arg
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "FLog arguments must be trivially copyable");
+		typedef T Stored;
+		static Stored Store(T value, Cursor&) { return value; }
+		static T Load(const Stored& value, const uint8_t*) { return value; }
+	};
+
+	// strings are copied, the caller's buffer may be gone by the time it's formatted
+	template<>
+	struct Arg<const char*>
+	{
+		typedef int32_t Stored;
+		static Stored Store(const char* sz, Cursor& cursor) { return sz ? cursor.Append(sz) : -1; }
+		static const char* Load(Stored offset, const uint8_t* pBase) {
+			return offset < 0 ? "(null)" : (const char*)pBase + offset;
+		}
+	};
+
+	template<>
+	struct Arg<char*> : Arg<const char*> {};
+
+	template<typename... Args>
+	struct Payload
+	{
+		typedef std::tuple<typename Arg<Args>::Stored...> Tuple;
+
+		static_assert(sizeof(Tuple) < LOG_RECORD_SIZE, "too many FLog arguments");
+
+		static int Format(const uint8_t* pPayload, char* szOut, size_t size)
+		{
+			const Tuple& args = *reinterpret_cast<const Tuple*>(pPayload);
+			const char* szFormat = (const char*)pPayload + sizeof(Tuple);
+
+			return std::apply([&](const auto&... value) {
+				return snprintf(szOut, size, szFormat, Arg<Args>::Load(value, pPayload)...);
+			}, args);
+		}
+	};
+}
+
+class CLogger
+{
+public:
+	template<typename... Args>
+	static void Write(int iLevel, const char* szFormat, Args... args)
+	{
+		if (m_bSynchronous.load(std::memory_order_relaxed)) {
+			WriteNow(iLevel, szFormat, args...);
+			return;
+		}
+
+		CLogRing* pRing = GetThreadRing();
+		if (!pRing) {
+			WriteNow(iLevel, szFormat, args...);
+			return;
+		}
+
+		LogRecord* pRecord = pRing->Reserve();
+		if (!pRecord)
+		{
+			// burst faster than the writer: drain here rather than drop or reorder lines
+			Flush();
+			pRecord = pRing->Reserve();
+			if (!pRecord) {
+				WriteNow(iLevel, szFormat, args...);
+				return;
+			}
+		}
+
+		typedef logger_detail::Payload<Args...> Payload;
+
+		logger_detail::Cursor cursor = { pRecord->payload, sizeof(typename Payload::Tuple), false };
+		cursor.Append(szFormat);
+		if (cursor.bTruncated) {
+			// a cut format string could split a conversion, format it here instead
+			WriteNow(iLevel, szFormat, args...);
+			return;
+		}
+
+		new (pRecord->payload) typename Payload::Tuple(logger_detail::Arg<Args>::Store(args, cursor)...);
+
+		pRecord->pFormat = &Payload::Format;
+		pRecord->byteLevel = (uint8_t)iLevel;
+		pRing->Commit();
+	}
+
+	// queues an already formatted line
+	static void WriteText(int iLevel, const char* szText) { Write(iLevel, "%s", szText); }
+
+	// called from the signal handlers: drains every ring and writes synchronously from now on
+	static void BeginCrash();
+	// drains every ring on the calling thread
+	static void Flush();
+
+private:
+	template<typename... Args>
+	static void WriteNow(int iLevel, const char* szFormat, Args... args)
+	{
+		char szLine[LOG_LINE_SIZE];
+		snprintf(szLine, sizeof(szLine), szFormat, args...);
+		Output(iLevel, szLine, true);
+	}
+
+	static CLogRing* GetThreadRing();
+	static void Output(int iLevel, const char* szLine, bool bFlush = false);
+	static bool Drain();
+	static void WriterThread();
+
+	static std::atomic<bool> m_bSynchronous;
+};
+
+// the C-variadic overload stays for code that only declares it (StackTrace.h) and
+// for plain strings; it formats on the calling thread and queues the result
+void FLog(const char* fmt, ...);
+
+template<typename Arg, typename... Args>
+inline void FLog(const char* fmt, Arg arg, Args... args)
+{
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+	CLogger::Write(LOG_LEVEL_INFO, fmt, arg, args...);
+#endif
+}
+
+template<typename... Args>
+inline void FLogDebug(const char* fmt, Args... args)
+{
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+	CLogger::Write(LOG_LEVEL_DEBUG, fmt, args...);
+#endif
+}
+
+template<typename... Args>
+inline void FLogWarn(const char* fmt, Args... args)
+{
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARN
+	CLogger::Write(LOG_LEVEL_WARN, fmt, args...);
+#endif
+}
+
+template<typename... Args>
+inline void FLogError(const char* fmt, Args... args)
+{
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+	CLogger::Write(LOG_LEVEL_ERROR, fmt, args...);
+#endif
+}
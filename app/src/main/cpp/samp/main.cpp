@@ -161,6 +161,7 @@ void handler(int signum, siginfo_t *info, void* contextPtr)
 
 	if(info->si_signo == SIGSEGV)
 	{
+		CLogger::BeginCrash();
 		FLog("SIGSEGV | Fault address: 0x%x", info->si_addr);
 
 		PRINT_CRASH_STATES(context);
@@ -182,6 +183,7 @@ void handler1(int signum, siginfo_t *info, void* contextPtr)
 
 	if(info->si_signo == SIGABRT)
 	{
+		CLogger::BeginCrash();
 		FLog("SIGABRT | Fault address: 0x%x", info->si_addr);
 
 		PRINT_CRASH_STATES(context);
@@ -203,6 +205,7 @@ void handler2(int signum, siginfo_t *info, void* contextPtr)
 
 	if(info->si_signo == SIGFPE)
 	{
+		CLogger::BeginCrash();
 		FLog("SIGFPE | Fault address: 0x%x", info->si_addr);
 
 		PRINT_CRASH_STATES(context);
@@ -224,6 +227,7 @@ void handler3(int signum, siginfo_t *info, void* contextPtr)
 
 	if(info->si_signo == SIGBUS)
 	{
+		CLogger::BeginCrash();
 		FLog("SIGBUS | Fault address: 0x%x", info->si_addr);
 
 		PRINT_CRASH_STATES(context);
@@ -236,6 +240,8 @@ void handler3(int signum, siginfo_t *info, void* contextPtr)
 
 void DoInitStuff() {
     if (bGameInited == false) {
+        CJobSystem::Initialise(CJobSystem::GetDefaultWorkerCount());
+
         pPlayerTags = new CPlayerTags();
         pSnapShotHelper = new CSnapShotHelper();
         pMaterialTextGenerator = new MaterialTextGenerator();
@@ -416,6 +422,9 @@ void MainLoop()
 {
 	if (pGame->bIsGameExiting) return;
 
+	PROFILE_THREAD("Main");
+	CThreadPlacement::Register(THREAD_ROLE_GAME);
+
 	DoInitStuff();
 
 	if (bDebug) {
@@ -564,39 +573,6 @@ uint32_t GetTickCount()
     return CTimer::m_snTimeInMillisecondsNonClipped;
 }	
 
-void FLog(const char* fmt, ...)
-{
-	char buffer[0xFF];
-	static FILE* flLog = nullptr;
-	const char* pszStorage = g_pszStorage;
-
-
-	// Tenta abrir arquivo apenas se o path for válido (não NULL e não vazio)
-	if (flLog == nullptr && pszStorage != nullptr && pszStorage[0] != '\0')
-	{
-		sprintf(buffer, "%s/samp_log.txt", pszStorage);
-		flLog = fopen(buffer, "a");
-	}
-
-	memset(buffer, 0, sizeof(buffer));
-
-	va_list arg;
-	va_start(arg, fmt);
-	vsnprintf(buffer, sizeof(buffer), fmt, arg);
-	va_end(arg);
-
-	// Sempre envia para logcat e crashlytics (fallback garantido)
-	LOGI("%s", buffer);
-	firebase::crashlytics::Log(buffer);
-
-	// Se arquivo não está disponível, apenas retorna (log já foi para logcat)
-	if (flLog == nullptr) return;
-	fprintf(flLog, "%s\n", buffer);
-	fflush(flLog);
-
-	return;
-}
-
 void ChatLog(const char* fmt, ...)
 {
 	char buffer[0xFF];
@@ -8,6 +8,11 @@
 #include <sstream>
 #include <unistd.h>
 #include "log.h"
+#include "logger.h"
+#include "profiler.h"
+#include "jobsystem.h"
+#include "framearena.h"
+#include "threadplacement.h"
 #include <jni.h>
 #include <cstring>
 #include "game/common.h"
@@ -42,7 +47,6 @@ extern JavaVM* javaVM;
 uint32_t GetTickCount();
 void LogVoice(const char* fmt, ...);
 
-void FLog(const char* fmt, ...);
 void MyLog(const char* fmt, ...);
 void MyLog2(const char* fmt, ...);
 void ChatLog(const char* fmt, ...);
@@ -1,6 +1,7 @@
 #include "../main.h"
 #include "../game/game.h"
 #include "netgame.h"
+#include "../game/Streaming.h"
 
 // 0.3.7
 CActorPool::CActorPool()
@@ -10,11 +11,14 @@ CActorPool::CActorPool()
 		m_pActors[ActorID] = nullptr;
 		m_bActorSlotState[ActorID] = false;
 		m_pGtaPed[ActorID] = nullptr;
+		m_dwModelRequest[ActorID] = INVALID_MODEL_REQUEST;
 	}
 }
 // 0.3.7
 CActorPool::~CActorPool()
 {
+	CStreaming::GetModelRequests().CancelOwner(this);
+
 	for (PLAYERID ActorID = 0; ActorID < MAX_ACTORS; ActorID++)
 	{
 		Delete(ActorID);
@@ -23,12 +27,34 @@ CActorPool::~CActorPool()
 // 0.3.7
 void CActorPool::New(NEW_ACTOR* pNewActor)
 {
-	if (m_pActors[pNewActor->ActorID])
+	if (m_pActors[pNewActor->ActorID] || IsPending(pNewActor->ActorID))
 	{
 		//if (gui) gui->chat()->addDebugMessage("Warning: actor %u was not deleted", pNewActor->ActorID);
 		Delete(pNewActor->ActorID);
 	}
 
+	int iSkin = IsValidPedModel(pNewActor->iSkin) ? pNewActor->iSkin : 0;
+
+	NEW_ACTOR info = *pNewActor;
+	MODELREQUEST hRequest = CStreaming::GetModelRequests().Request(iSkin, MODEL_PRIORITY_NORMAL,
+		[this, info](bool bLoaded) mutable {
+			m_dwModelRequest[info.ActorID] = INVALID_MODEL_REQUEST;
+
+			// the streamer fell behind: CActor loads the skin blocking like before rather
+			// than lose an actor the server created
+			if (!bLoaded) FLog("Actor %d: skin %d not streamed in time, loading it now", info.ActorID, info.iSkin);
+
+			Create(&info);
+			ApplyDeferred(info.ActorID);
+		}, this);
+
+	if (CStreaming::GetModelRequests().GetState(hRequest) == MODEL_REQUEST_PENDING) {
+		m_dwModelRequest[pNewActor->ActorID] = hRequest;
+	}
+}
+
+void CActorPool::Create(NEW_ACTOR* pNewActor)
+{
 	CActor* pActor = new CActor(pNewActor->iSkin,
 		pNewActor->vecPos.x,
 		pNewActor->vecPos.y,
@@ -50,9 +76,44 @@ void CActorPool::New(NEW_ACTOR* pNewActor)
 		pActor->SetInvulnerable(false);
 	}
 }
+bool CActorPool::Apply(PLAYERID ActorID, std::function<void(CActor*)> fn)
+{
+	if (IsPending(ActorID)) {
+		m_Deferred[ActorID].push_back(std::move(fn));
+		return true;
+	}
+
+	if (ActorID >= MAX_ACTORS || !m_bActorSlotState[ActorID] || !m_pActors[ActorID]) return false;
+
+	fn(m_pActors[ActorID]);
+	return true;
+}
+
+void CActorPool::ApplyDeferred(PLAYERID ActorID)
+{
+	auto it = m_Deferred.find(ActorID);
+	if (it == m_Deferred.end()) return;
+
+	std::vector<std::function<void(CActor*)>> deferred = std::move(it->second);
+	m_Deferred.erase(it);
+
+	for (auto& fn : deferred)
+	{
+		// one of them may have taken the actor away
+		if (!m_bActorSlotState[ActorID] || !m_pActors[ActorID]) break;
+		fn(m_pActors[ActorID]);
+	}
+}
+
 // 0.3.7
 void CActorPool::Delete(PLAYERID ActorID)
 {
+	if (IsPending(ActorID)) {
+		CStreaming::GetModelRequests().Cancel(m_dwModelRequest[ActorID]);
+		m_dwModelRequest[ActorID] = INVALID_MODEL_REQUEST;
+	}
+	m_Deferred.erase(ActorID);
+
 	CActor* pActor = GetAt(ActorID);
 	if (pActor) {
 		m_bActorSlotState[ActorID] = false;
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "../game/modelrequests.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
 #pragma pack(push, 1)
 typedef struct _NEW_ACTOR
 {
@@ -18,8 +24,12 @@ public:
 	CActorPool();
 	~CActorPool();
 
+	// creation waits for the skin, the slot stays empty until then
 	void New(NEW_ACTOR* pNewActor);
 	void Delete(PLAYERID ActorID);
+	bool IsPending(PLAYERID ActorID) { return ActorID < MAX_ACTORS && m_dwModelRequest[ActorID] != INVALID_MODEL_REQUEST; }
+	// runs fn on the actor, or once it's created if it's still pending; false if there's neither
+	bool Apply(PLAYERID ActorID, std::function<void(CActor*)> fn);
 
 	CActor* GetAt(PLAYERID ActorID) {
 		if (ActorID < MAX_ACTORS && m_bActorSlotState[ActorID]) {
@@ -42,7 +52,13 @@ public:
 	}
 
 private:
+	void Create(NEW_ACTOR* pNewActor);
+	void ApplyDeferred(PLAYERID ActorID);
+
 	CActor* m_pActors[MAX_ACTORS];
 	bool m_bActorSlotState[MAX_ACTORS];
     CPedGTA* m_pGtaPed[MAX_ACTORS];
+	MODELREQUEST m_dwModelRequest[MAX_ACTORS];
+	// what RPCs did to pending actors, in the order they came
+	std::unordered_map<PLAYERID, std::vector<std::function<void(CActor*)>>> m_Deferred;
 };
\ No newline at end of file
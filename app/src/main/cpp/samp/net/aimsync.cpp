@@ -0,0 +1,145 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define AIM_VELOCITY_SMOOTHING	0.3f	// weight of the newest frame in the angular velocity
+
+static float Dot(const CVector& a, const CVector& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static float Length(const CVector& a) { return sqrtf(Dot(a, a)); }
+
+static float AngleBetween(const CVector& a, const CVector& b)
+{
+	CVector c(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+	return atan2f(Length(c), Dot(a, b));
+}
+
+// how far the aim turned from a to b, the camera front and Z-aim together
+static float AimDelta(const AIM_SAMPLE& a, const AIM_SAMPLE& b)
+{
+	return AngleBetween(a.vecAimf, b.vecAimf) + fabsf(b.fAimZ - a.fAimZ);
+}
+
+CAimShaper::CAimShaper()
+{
+	Reset();
+}
+
+void CAimShaper::Reset()
+{
+	m_bSent = false;
+	m_dwLastSent = 0;
+	m_bHaveLast = false;
+	m_dwLastUpdate = 0;
+	m_fVelocity = 0.0f;
+}
+
+bool CAimShaper::Update(uint32_t dwNow, const AIM_SAMPLE& aim, bool bForce, uint32_t dwMinInterval)
+{
+	if (m_bHaveLast && dwNow != m_dwLastUpdate)
+	{
+		float fVelocity = AimDelta(m_Last, aim) * 1000.0f / (float)(dwNow - m_dwLastUpdate);
+		m_fVelocity += (fVelocity - m_fVelocity) * AIM_VELOCITY_SMOOTHING;
+	}
+	m_Last = aim;
+	m_dwLastUpdate = dwNow;
+	m_bHaveLast = true;
+
+	bool bSend = !m_bSent || bForce;
+	if (!bSend)
+	{
+		uint32_t dwElapsed = dwNow - m_dwLastSent;
+		if (dwElapsed < dwMinInterval) return false;
+
+		float fDelta = AngleBetween(m_Sent.vecAimf, aim.vecAimf);
+		float fDeltaZ = fabsf(aim.fAimZ - m_Sent.fAimZ);
+		float fDeltaPos = Length(aim.vecAimPos - m_Sent.vecAimPos);
+
+		if (dwElapsed >= AIM_KEEPALIVE)
+			bSend = true;
+		else if (fDelta <= AIM_DEADBAND_ANGLE && fDeltaZ <= AIM_DEADBAND_Z && fDeltaPos <= AIM_DEADBAND_POS)
+			bSend = false;
+		else if (fDelta + fDeltaZ >= AIM_STEP_ANGLE)
+			bSend = true;	// a flick is sent at once
+		else
+		{
+			// a steady turn is sent every AIM_STEP_ANGLE, a drifting one at least every AIM_MAX_INTERVAL
+			float fInterval = m_fVelocity > 0.0f ? AIM_STEP_ANGLE * 1000.0f / m_fVelocity : (float)AIM_MAX_INTERVAL;
+			bSend = dwElapsed >= std::min(fInterval, (float)AIM_MAX_INTERVAL);
+		}
+	}
+
+	if (bSend)
+	{
+		m_Sent = aim;
+		m_dwLastSent = dwNow;
+		m_bSent = true;
+	}
+	return bSend;
+}
+
+CAimInterpolator::CAimInterpolator()
+{
+	Reset();
+}
+
+void CAimInterpolator::Reset()
+{
+	m_dwArrival = 0;
+	m_dwDuration = 0;
+	m_bHasSample = false;
+	m_bSettled = true;
+}
+
+void CAimInterpolator::Push(uint32_t dwNow, const AIM_SAMPLE& aim, bool bSnap)
+{
+	uint32_t dwGap = dwNow - m_dwArrival;
+
+	if (!m_bHasSample || bSnap)
+	{
+		m_From = aim;
+	}
+	else
+	{
+		// turn on from wherever the aim is displayed now
+		Get(dwNow, m_From);
+		if (AimDelta(m_From, aim) > AIM_SNAP_ANGLE)
+			m_From = aim;
+	}
+
+	m_To = aim;
+	m_dwArrival = dwNow;
+	// the sender spaces its packets by how fast the aim turns, the gap since the last one
+	// is how long this one stands for; a pause ended by a flick is caught up quickly
+	m_dwDuration = dwGap > AIM_INTERP_MAX ? AIM_INTERP_RESUME : std::max<uint32_t>(dwGap, AIM_INTERP_MIN);
+	m_bHasSample = true;
+	m_bSettled = false;
+}
+
+void CAimInterpolator::Get(uint32_t dwNow, AIM_SAMPLE& out)
+{
+	if (!m_bHasSample) return;
+
+	float t = (float)(dwNow - m_dwArrival) / (float)m_dwDuration;
+	if (t >= 1.0f)
+	{
+		out = m_To;
+		m_bSettled = true;
+		return;
+	}
+
+	// the front is a direction, keep its length while it turns
+	CVector vecAimf = Lerp(m_From.vecAimf, m_To.vecAimf, t);
+	float fLength = Length(vecAimf);
+	if (fLength > 1e-6f)
+	{
+		float fWanted = Length(m_From.vecAimf) + (Length(m_To.vecAimf) - Length(m_From.vecAimf)) * t;
+		vecAimf = vecAimf * (fWanted / fLength);
+	}
+
+	out.vecAimf = vecAimf;
+	out.vecAimPos = Lerp(m_From.vecAimPos, m_To.vecAimPos, t);
+	out.fAimZ = m_From.fAimZ + (m_To.fAimZ - m_From.fAimZ) * t;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+
+// Shapes aim sync on both ends. CAimShaper decides when the local aim is worth a packet:
+// the camera front and Z-aim have to leave a dead-band around what was sent last, and the
+// packet interval shrinks with the aim's angular velocity so a turn is sent in steps of
+// about AIM_STEP_ANGLE while a still camera only sends a keepalive. CAimInterpolator plays
+// the received samples back, turning from the displayed aim to the newest one over the
+// time the sender took between them. Both only see samples and times.
+
+#define AIM_DEADBAND_ANGLE		0.01f	// rad of camera front change that isn't sent
+#define AIM_DEADBAND_Z			0.01f	// Z-aim change that isn't sent
+#define AIM_DEADBAND_POS		0.05f	// camera position change that isn't sent
+#define AIM_STEP_ANGLE			0.05f	// rad a turning aim moves between packets
+#define AIM_MAX_INTERVAL		500		// ms between packets while the aim moves at all
+#define AIM_KEEPALIVE			1000	// ms after which the aim is sent anyway
+#define AIM_INTERP_MIN			20		// ms a received sample is turned to at least
+#define AIM_INTERP_MAX			250		// ms a received sample is turned to at most
+#define AIM_INTERP_RESUME		50		// ms, after a longer gap the aim had paused
+#define AIM_SNAP_ANGLE			1.5f	// rad, a jump this large isn't interpolated
+
+struct AIM_SAMPLE
+{
+	CVector	vecAimf;	// camera front
+	CVector	vecAimPos;	// camera position
+	float	fAimZ;
+};
+
+class CAimShaper
+{
+public:
+	CAimShaper();
+
+	void Reset();
+
+	// once a frame with the current aim; bForce when a field outside the sample changed.
+	// true when the aim should be sent now, it's then taken as the last sent one
+	bool Update(uint32_t dwNow, const AIM_SAMPLE& aim, bool bForce, uint32_t dwMinInterval);
+
+	// rad/s, smoothed
+	float GetAngularVelocity() const { return m_fVelocity; }
+
+private:
+	AIM_SAMPLE	m_Sent;
+	uint32_t	m_dwLastSent;
+	bool		m_bSent;
+
+	AIM_SAMPLE	m_Last;
+	uint32_t	m_dwLastUpdate;
+	bool		m_bHaveLast;
+	float		m_fVelocity;
+};
+
+class CAimInterpolator
+{
+public:
+	CAimInterpolator();
+
+	void Reset();
+
+	// a received sample; bSnap when it shouldn't be turned to (camera mode changed)
+	void Push(uint32_t dwNow, const AIM_SAMPLE& aim, bool bSnap);
+	bool HasSample() const { return m_bHasSample; }
+	// true until the newest sample has been returned by Get
+	bool IsInterpolating() const { return m_bHasSample && !m_bSettled; }
+
+	void Get(uint32_t dwNow, AIM_SAMPLE& out);
+
+private:
+	AIM_SAMPLE	m_From;
+	AIM_SAMPLE	m_To;
+	uint32_t	m_dwArrival;
+	uint32_t	m_dwDuration;
+	bool		m_bHasSample;
+	bool		m_bSettled;
+};
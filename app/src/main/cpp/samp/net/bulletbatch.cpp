@@ -0,0 +1,282 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+
+#include <cmath>
+
+// record: version, count, reference origin (3 floats), then per shot a flags byte and
+// whatever the flags say follows
+#define BULLET_FLAG_HITTYPE		0x07	// BULLET_HIT_TYPE_*
+#define BULLET_FLAG_WEAPON		0x08	// weapon byte follows, else the previous shot's
+#define BULLET_FLAG_ORIGIN		0x10	// origin follows, else the previous shot's
+#define BULLET_FLAG_FLOAT		0x20	// origin and hit position are plain floats
+#define BULLET_FLAG_OFFSET		0xC0	// one of BULLET_OFFSET_*
+#define BULLET_OFFSET_SHIFT		6
+
+#define BULLET_OFFSET_ZERO		0
+#define BULLET_OFFSET_SHORT		1
+#define BULLET_OFFSET_HITPOS	2		// the offset is the hit position, as for world hits
+#define BULLET_OFFSET_FLOAT		3
+
+#define BULLET_ORIGIN_SCALE		256.0f	// origin to the reference, +-128 units
+#define BULLET_HITPOS_SCALE		64.0f	// hit position to its origin, +-512 units
+#define BULLET_OFFSET_SCALE		1024.0f	// offset on the hit entity, +-32 units
+
+static bool Quantize(const CVector& vec, float fScale, int16_t* pOut)
+{
+	float f[3] = { vec.x, vec.y, vec.z };
+	for (int i = 0; i < 3; i++)
+	{
+		float fValue = roundf(f[i] * fScale);
+		if (!(fValue >= -32768.0f && fValue <= 32767.0f)) return false;	// NaN too
+		pOut[i] = (int16_t)fValue;
+	}
+	return true;
+}
+
+static CVector Dequantize(const int16_t* pIn, float fScale)
+{
+	return CVector(pIn[0] / fScale, pIn[1] / fScale, pIn[2] / fScale);
+}
+
+class CRecordWriter
+{
+public:
+	CRecordWriter(uint8_t* pBuffer, int iSize) : m_pBuffer(pBuffer), m_iSize(iSize), m_iPos(0) {}
+
+	void Write(const void* pData, int iLength)
+	{
+		if (m_iPos + iLength > m_iSize) { m_iPos = m_iSize + 1; return; }
+		memcpy(m_pBuffer + m_iPos, pData, iLength);
+		m_iPos += iLength;
+	}
+	void WriteByte(uint8_t byteValue) { Write(&byteValue, 1); }
+	void WriteShorts(const int16_t* pValues) { Write(pValues, 3 * sizeof(int16_t)); }
+	void WriteVector(const CVector& vec) { float f[3] = { vec.x, vec.y, vec.z }; Write(f, sizeof(f)); }
+
+	uint8_t* At(int iPos) { return m_pBuffer + iPos; }
+	int GetPos() const { return m_iPos; }
+	bool IsOverflow() const { return m_iPos > m_iSize; }
+
+private:
+	uint8_t*	m_pBuffer;
+	int			m_iSize;
+	int			m_iPos;
+};
+
+class CRecordReader
+{
+public:
+	CRecordReader(const uint8_t* pData, int iLength) : m_pData(pData), m_iLength(iLength), m_iPos(0) {}
+
+	bool Read(void* pOut, int iLength)
+	{
+		if (m_iPos + iLength > m_iLength) return false;
+		memcpy(pOut, m_pData + m_iPos, iLength);
+		m_iPos += iLength;
+		return true;
+	}
+	bool ReadShorts(int16_t* pValues) { return Read(pValues, 3 * sizeof(int16_t)); }
+	bool ReadVector(CVector& vec)
+	{
+		float f[3];
+		if (!Read(f, sizeof(f))) return false;
+		vec = CVector(f[0], f[1], f[2]);
+		return true;
+	}
+
+private:
+	const uint8_t*	m_pData;
+	int				m_iLength;
+	int				m_iPos;
+};
+
+CBulletBatcher::CBulletBatcher()
+{
+	m_iCount = 0;
+	m_dwFirstShot = 0;
+	m_bEnabled = false;
+}
+
+void CBulletBatcher::SetEnabled(bool bEnabled)
+{
+	m_bEnabled = bEnabled;
+	if (!bEnabled) Clear();
+}
+
+bool CBulletBatcher::Add(uint32_t dwNow, const BULLET_SYNC_DATA& shot)
+{
+	if (m_iCount >= BULLET_BATCH_MAX) return true;
+
+	if (m_iCount == 0) m_dwFirstShot = dwNow;
+	m_Shots[m_iCount++] = shot;
+
+	return m_iCount >= BULLET_BATCH_MAX;
+}
+
+bool CBulletBatcher::IsDue(uint32_t dwNow) const
+{
+	return m_iCount && dwNow - m_dwFirstShot >= BULLET_BATCH_WINDOW;
+}
+
+int CBulletBatcher::Encode(uint8_t* pBuffer, int iSize)
+{
+	if (!m_iCount) return 0;
+
+	CRecordWriter writer(pBuffer, iSize);
+	CVector vecRef = m_Shots[0].vecOrigin;
+
+	writer.WriteByte(BULLET_BATCH_VERSION);
+	writer.WriteByte((uint8_t)m_iCount);
+	writer.WriteVector(vecRef);
+
+	int16_t sPrevOrigin[3];
+	bool bHavePrevOrigin = false;
+	uint8_t bytePrevWeapon = 0;
+
+	for (int i = 0; i < m_iCount; i++)
+	{
+		const BULLET_SYNC_DATA& shot = m_Shots[i];
+		int iFlagsPos = writer.GetPos();
+		uint8_t byteFlags = shot.byteHitType & BULLET_FLAG_HITTYPE;
+		writer.WriteByte(0);
+
+		if (i == 0 || shot.byteWeaponID != bytePrevWeapon)
+		{
+			byteFlags |= BULLET_FLAG_WEAPON;
+			writer.WriteByte(shot.byteWeaponID);
+			bytePrevWeapon = shot.byteWeaponID;
+		}
+
+		if (shot.byteHitType != BULLET_HIT_TYPE_NONE)
+			writer.Write(&shot.PlayerID, sizeof(uint16_t));
+
+		// the hit position is taken relative to the origin as the receiver rebuilds it
+		int16_t sOrigin[3], sHitPos[3];
+		bool bShort = Quantize(shot.vecOrigin - vecRef, BULLET_ORIGIN_SCALE, sOrigin);
+		CVector vecOrigin = vecRef + Dequantize(sOrigin, BULLET_ORIGIN_SCALE);
+		bShort = bShort && Quantize(shot.vecPos - vecOrigin, BULLET_HITPOS_SCALE, sHitPos);
+
+		CVector vecHitPos;
+		if (bShort)
+		{
+			if (!bHavePrevOrigin || memcmp(sOrigin, sPrevOrigin, sizeof(sOrigin)))
+			{
+				byteFlags |= BULLET_FLAG_ORIGIN;
+				writer.WriteShorts(sOrigin);
+				memcpy(sPrevOrigin, sOrigin, sizeof(sOrigin));
+				bHavePrevOrigin = true;
+			}
+			writer.WriteShorts(sHitPos);
+			vecHitPos = vecOrigin + Dequantize(sHitPos, BULLET_HITPOS_SCALE);
+		}
+		else
+		{
+			byteFlags |= BULLET_FLAG_FLOAT | BULLET_FLAG_ORIGIN;
+			writer.WriteVector(shot.vecOrigin);
+			writer.WriteVector(shot.vecPos);
+			bHavePrevOrigin = false;
+			vecHitPos = shot.vecPos;
+		}
+
+		int16_t sOffset[3];
+		int iOffsetMode;
+		if (shot.vecOffset.x == 0.0f && shot.vecOffset.y == 0.0f && shot.vecOffset.z == 0.0f)
+			iOffsetMode = BULLET_OFFSET_ZERO;
+		else if ((shot.vecOffset - shot.vecPos).Magnitude() < 0.001f && (vecHitPos - shot.vecPos).Magnitude() < 0.01f)
+			iOffsetMode = BULLET_OFFSET_HITPOS;
+		else if (Quantize(shot.vecOffset, BULLET_OFFSET_SCALE, sOffset))
+			iOffsetMode = BULLET_OFFSET_SHORT;
+		else
+			iOffsetMode = BULLET_OFFSET_FLOAT;
+
+		if (iOffsetMode == BULLET_OFFSET_SHORT) writer.WriteShorts(sOffset);
+		else if (iOffsetMode == BULLET_OFFSET_FLOAT) writer.WriteVector(shot.vecOffset);
+		byteFlags |= iOffsetMode << BULLET_OFFSET_SHIFT;
+
+		if (!writer.IsOverflow()) *writer.At(iFlagsPos) = byteFlags;
+	}
+
+	m_iCount = 0;
+	return writer.IsOverflow() ? 0 : writer.GetPos();
+}
+
+int CBulletBatcher::Decode(const uint8_t* pData, int iLength, BULLET_SYNC_DATA* pShots, int iMaxShots)
+{
+	CRecordReader reader(pData, iLength);
+
+	uint8_t byteVersion, byteCount;
+	CVector vecRef;
+	if (!reader.Read(&byteVersion, 1) || byteVersion != BULLET_BATCH_VERSION) return -1;
+	if (!reader.Read(&byteCount, 1) || byteCount > iMaxShots) return -1;
+	if (!reader.ReadVector(vecRef)) return -1;
+
+	CVector vecOrigin(0.0f, 0.0f, 0.0f);
+	bool bHaveOrigin = false;
+	bool bHaveWeapon = false;
+	uint8_t byteWeapon = 0;
+
+	for (int i = 0; i < byteCount; i++)
+	{
+		BULLET_SYNC_DATA& shot = pShots[i];
+		uint8_t byteFlags;
+		if (!reader.Read(&byteFlags, 1)) return -1;
+
+		shot.byteHitType = byteFlags & BULLET_FLAG_HITTYPE;
+		if (shot.byteHitType > BULLET_HIT_TYPE_PLAYER_OBJECT) return -1;
+
+		if (byteFlags & BULLET_FLAG_WEAPON)
+		{
+			if (!reader.Read(&byteWeapon, 1)) return -1;
+			bHaveWeapon = true;
+		}
+		if (!bHaveWeapon) return -1;
+		shot.byteWeaponID = byteWeapon;
+
+		uint16_t wHitId = 0;
+		if (shot.byteHitType != BULLET_HIT_TYPE_NONE && !reader.Read(&wHitId, sizeof(uint16_t))) return -1;
+		shot.PlayerID = wHitId;
+
+		if (byteFlags & BULLET_FLAG_FLOAT)
+		{
+			if (!reader.ReadVector(shot.vecOrigin) || !reader.ReadVector(shot.vecPos)) return -1;
+			vecOrigin = shot.vecOrigin;
+			bHaveOrigin = false;	// a float origin is never repeated
+		}
+		else
+		{
+			int16_t sValues[3];
+			if (byteFlags & BULLET_FLAG_ORIGIN)
+			{
+				if (!reader.ReadShorts(sValues)) return -1;
+				vecOrigin = vecRef + Dequantize(sValues, BULLET_ORIGIN_SCALE);
+				bHaveOrigin = true;
+			}
+			if (!bHaveOrigin) return -1;
+
+			if (!reader.ReadShorts(sValues)) return -1;
+			shot.vecOrigin = vecOrigin;
+			shot.vecPos = vecOrigin + Dequantize(sValues, BULLET_HITPOS_SCALE);
+		}
+
+		int16_t sOffset[3];
+		switch ((byteFlags & BULLET_FLAG_OFFSET) >> BULLET_OFFSET_SHIFT)
+		{
+			case BULLET_OFFSET_ZERO:
+				shot.vecOffset = CVector(0.0f, 0.0f, 0.0f);
+				break;
+			case BULLET_OFFSET_SHORT:
+				if (!reader.ReadShorts(sOffset)) return -1;
+				shot.vecOffset = Dequantize(sOffset, BULLET_OFFSET_SCALE);
+				break;
+			case BULLET_OFFSET_HITPOS:
+				shot.vecOffset = shot.vecPos;
+				break;
+			case BULLET_OFFSET_FLOAT:
+				if (!reader.ReadVector(shot.vecOffset)) return -1;
+				break;
+		}
+	}
+
+	return byteCount;
+}
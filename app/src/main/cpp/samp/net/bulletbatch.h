@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+// Coalesces the local player's BULLET_SYNC_DATA into one record per window instead of
+// one ID_BULLET_SYNC datagram per shot. Positions are quantized relative to the first
+// shot of the batch: origins to 1/256 unit, hit positions relative to their origin to
+// 1/64 unit, offsets to 1/1024 unit; whatever doesn't fit is sent as floats. A server
+// advertises that it reads the record with CUSTOM_RPC_BULLET_BATCH, until then every
+// shot goes out as the standard packet. CBulletBatcher only sees shots and times;
+// CNetGame sends what it encodes.
+
+#define BULLET_BATCH_VERSION	1
+#define BULLET_BATCH_MAX		8		// shots per record
+#define BULLET_BATCH_WINDOW		50		// ms the first shot of a record waits at most
+#define BULLET_BATCH_MAX_BYTES	512		// a full record of unquantizable shots fits
+
+class CBulletBatcher
+{
+public:
+	CBulletBatcher();
+
+	void SetEnabled(bool bEnabled);
+	bool IsEnabled() const { return m_bEnabled; }
+
+	// queues a shot; true when the record is full and should be sent now
+	bool Add(uint32_t dwNow, const BULLET_SYNC_DATA& shot);
+	// true when there are shots and the first one has waited out the window
+	bool IsDue(uint32_t dwNow) const;
+	int GetCount() const { return m_iCount; }
+	void Clear() { m_iCount = 0; }
+
+	// writes the queued shots as one record and empties the queue; returns the size or 0
+	int Encode(uint8_t* pBuffer, int iSize);
+	// reads a record back; returns the number of shots or -1 when it's malformed
+	static int Decode(const uint8_t* pData, int iLength, BULLET_SYNC_DATA* pShots, int iMaxShots);
+
+private:
+	BULLET_SYNC_DATA	m_Shots[BULLET_BATCH_MAX];
+	int					m_iCount;
+	uint32_t			m_dwFirstShot;
+	bool				m_bEnabled;
+};
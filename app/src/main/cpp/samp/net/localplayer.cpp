@@ -65,7 +65,6 @@ CLocalPlayer::CLocalPlayer()
 	m_dwLastSendSyncTick = GetTickCount();
     count = GetTickCount();
 	m_dwLastUpdateInCarData = GetTickCount();
-	m_dwLastSendAimSyncTick = GetTickCount();
 	m_dwLastStatsUpdateTick = GetTickCount();
 	m_dwLastPerformStuffAnimTick = GetTickCount();
 	m_dwLastUpdateOnFootData = GetTickCount();
@@ -237,11 +236,7 @@ bool CLocalPlayer::Process()
 			MoveHeadWithCamera();
 			ProcessInCarWorldBounds();
 
-			if ((dwThisTick - m_dwLastSendAimSyncTick) > 500)
-			{
-				m_dwLastSendAimSyncTick = dwThisTick;
-				SendAimSyncData();
-			}
+			SendAimSyncData(NETMODE_AIM_SLOW_SENDRATE);
 
 			CVehiclePool *pVehiclePool = pNetGame->GetVehiclePool();
 			CVehicle *pVehicle = nullptr;
@@ -315,29 +310,9 @@ bool CLocalPlayer::Process()
             if((dwThisTick - m_dwLastSendTick) < 1000)
             {
                 if(IS_TARGETING(m_pPlayerPed->m_pPed) && IS_FIRING(m_pPlayerPed->m_pPed))
-                {
-                    if(g_iLagCompensationMode == 2)
-                    {
-                        if((dwThisTick - m_dwLastSendAimSyncTick) > iNetModeFiringSendRate)
-                        {
-                            SendAimSyncData();
-                            m_dwLastSendAimSyncTick = dwThisTick;
-                        }
-                    }
-                    else if((dwThisTick - m_dwLastSendAimSyncTick) > 500)
-                    {
-                        SendAimSyncData();
-                        m_dwLastSendAimSyncTick = dwThisTick;
-                    }
-                }
+                    SendAimSyncData(g_iLagCompensationMode == 2 ? iNetModeFiringSendRate : NETMODE_AIM_SLOW_SENDRATE);
                 else
-                {
-                    if((dwThisTick - m_dwLastSendAimSyncTick) > 1000)
-                    {
-                        SendAimSyncData();
-                        m_dwLastSendAimSyncTick = dwThisTick;
-                    }
-                }
+                    SendAimSyncData(NETMODE_AIM_IDLE_SENDRATE);
             }
 
 			m_bPassengerDriveByMode = false;
@@ -453,6 +428,7 @@ void CLocalPlayer::ResetAllSyncAttributes()
 	memset(&m_TrailerData, 0, sizeof(TRAILER_SYNC_DATA));
 	memset(&m_psSync, 0, sizeof(PASSENGER_SYNC_DATA));
 	memset(&m_aimSync, 0, sizeof(AIM_SYNC_DATA));
+	m_AimShaper.Reset();
 
 	m_dwAnimation = 0;
 	m_dwLastWeaponsUpdateTick = GetTickCount();
@@ -510,11 +486,7 @@ void CLocalPlayer::ProcessSpectating()
 		bsSpectatorSync.Write((char*)&spSync, sizeof(SPECTATOR_SYNC_DATA));
 		pNetGame->GetRakClient()->Send(&bsSpectatorSync, HIGH_PRIORITY, UNRELIABLE, 0);
 
-		if ((GetTickCount() - m_dwLastSendAimSyncTick) > (GetOptimumOnFootSendRate() * 2))
-		{
-			m_dwLastSendAimSyncTick = GetTickCount();
-			SendAimSyncData();
-		}
+		SendAimSyncData(GetOptimumOnFootSendRate() * 2);
 	}
 
 	pGame->DisplayHUD(false);
@@ -960,7 +932,7 @@ void CLocalPlayer::SendPassengerFullSyncData()
 	if(m_bPassengerDriveByMode)	SendAimSyncData();
 }
 // 0.3.7
-void CLocalPlayer::SendAimSyncData()
+void CLocalPlayer::SendAimSyncData(uint32_t dwMinInterval)
 {
 	AIM_SYNC_DATA aimSync;
 
@@ -983,9 +955,19 @@ void CLocalPlayer::SendAimSyncData()
 	else
 		aimSync.byteWeaponState = (pwstWeapon->dwAmmoInClip > 1) ? WEAPONSTATE_FIRING : pwstWeapon->dwAmmoInClip;
 
-	if ((GetTickCount() - m_dwLastSendSyncTick) > 500 || memcmp(&m_aimSync, &aimSync, sizeof(AIM_SYNC_DATA)))
+	// the camera is shaped, anything else is sent as soon as it changes
+	bool bForce = aimSync.byteCamMode != m_aimSync.byteCamMode ||
+		aimSync.byteCamExtZoom != m_aimSync.byteCamExtZoom ||
+		aimSync.byteWeaponState != m_aimSync.byteWeaponState ||
+		aimSync.aspect_ratio != m_aimSync.aspect_ratio;
+
+	AIM_SAMPLE aim;
+	aim.vecAimf = aimSync.vecAimf;
+	aim.vecAimPos = aimSync.vecAimPos;
+	aim.fAimZ = aimSync.fAimZ;
+
+	if (m_AimShaper.Update(GetTickCount(), aim, bForce, dwMinInterval))
 	{
-		m_dwLastSendSyncTick = GetTickCount();
 		RakNet::BitStream bsAimSync;
 		bsAimSync.Write((char)ID_AIM_SYNC);
 		bsAimSync.Write((char*)&aimSync, sizeof(AIM_SYNC_DATA));
@@ -1066,7 +1048,7 @@ void CLocalPlayer::ProcessSurfing() {
 				CVehicle* pVeh = pNetGame->GetVehiclePool()->GetAt(vehicleId);
 				if(pVeh && (pVeh->HasADriver() || pVeh->m_pVehicle->GetModelId() == 569 || pVeh->m_pVehicle->GetModelId() == 570)
 						   && pVeh->m_pVehicle->GetDistanceFromLocalPlayerPed() < 30.0){
-					/*bool onFootObject = ScriptCommand(&is_char_touching_vehicle, m_pPlayerPed->m_dwGTAId, pVeh->m_dwGTAId);
+					/*bool onFootObject = ScriptCommand<is_char_touching_vehicle>(m_pPlayerPed->m_dwGTAId, pVeh->m_dwGTAId);
                     if(onFootObject){*/
 					if(m_surfData.bIsActive){
 						return;
@@ -1097,7 +1079,7 @@ void CLocalPlayer::ProcessSurfing() {
 					if(objectId && objectId != INVALID_OBJECT_ID){
 						CObject* pObject = pNetGame->GetObjectPool()->GetAt(objectId);
 						if(pObject){
-							//bool onFootObject = ScriptCommand(&is_char_touching_object, m_pPlayerPed->m_dwGTAId, pObject->m_dwGTAId);
+							//bool onFootObject = ScriptCommand<is_char_touching_object>(m_pPlayerPed->m_dwGTAId, pObject->m_dwGTAId);
 							//if(onFootObject) {
 							if(m_surfData.bIsActive){
 								return;
@@ -1951,12 +1933,12 @@ void CLocalPlayer::SendBulletSyncData(PLAYERID byteHitID, uint8_t byteHitType, C
     //uint8_t byteCurrWeapon = m_pPlayerPed->GetCurrentWeapon(), byteShotWeapon;
 
     RwMatrix matPlayer;
-    BULLET_SYNC blSync;
+    BULLET_SYNC_DATA blSync;
 
     matPlayer = m_pPlayerPed->m_pPed->GetMatrix().ToRwMatrix();
 
-    blSync.hitId = byteHitID;
-    blSync.hitType = byteHitType;
+    blSync.PlayerID = byteHitID;
+    blSync.byteHitType = byteHitType;
 
     if (byteHitType == BULLET_HIT_TYPE_PLAYER)
     {
@@ -1970,23 +1952,13 @@ void CLocalPlayer::SendBulletSyncData(PLAYERID byteHitID, uint8_t byteHitType, C
     {
         byteShotWeapon = m_pPlayerPed->GetCurrentWeapon();
     }
-    blSync.weapId = byteShotWeapon;
-
-    blSync.hitPos[0] = vecHitPos.x;
-    blSync.hitPos[1] = vecHitPos.y;
-    blSync.hitPos[2] = vecHitPos.z;
-
-    blSync.offsets[0] = 0.0f;
-    blSync.offsets[1] = 0.0f;
-    blSync.offsets[2] = 0.0f;
+    blSync.byteWeaponID = byteShotWeapon;
 
-	FLog("SendBulletSync: %d, %d, %d, %f, %f, %f, %f, %f, %f", blSync.hitId, blSync.hitType, blSync.weapId,
-		 blSync.hitPos[0], blSync.hitPos[1], blSync.hitPos[2], blSync.offsets[0], blSync.offsets[1], blSync.offsets[2]);
+    blSync.vecOrigin = matPlayer.pos;
+    blSync.vecPos = vecHitPos;
+    blSync.vecOffset = CVector(0.0f, 0.0f, 0.0f);
 
-    RakNet::BitStream bsBulletSync;
-    bsBulletSync.Write((uint8_t)ID_BULLET_SYNC);
-    bsBulletSync.Write((const char*)& blSync, sizeof(BULLET_SYNC));
-    pNetGame->GetRakClient()->Send(&bsBulletSync, HIGH_PRIORITY, UNRELIABLE_SEQUENCED, 0);
+    pNetGame->SendBulletSync(blSync);
 }
 
 int CLocalPlayer::GetOptimumUnoccupiedSendRate()
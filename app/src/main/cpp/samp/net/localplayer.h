@@ -227,7 +227,7 @@ public:
 	void SendOnFootFullSyncData();
 	void SendInCarFullSyncData();
 	void SendPassengerFullSyncData();
-	void SendAimSyncData();
+	void SendAimSyncData(uint32_t dwMinInterval = NETMODE_AIM_SENDRATE);
 
 	bool IsNeedSyncDataSend(const void* data1, const void* data2, size_t size);
 
@@ -302,6 +302,7 @@ private:
 	INCAR_SYNC_DATA		m_icSync;
 	PASSENGER_SYNC_DATA	m_psSync;
 	AIM_SYNC_DATA		m_aimSync;
+	CAimShaper			m_AimShaper;
 	TRAILER_SYNC_DATA 	m_TrailerData;
 	UNOCCUPIED_SYNC_DATA m_UnoccupiedData;
 
@@ -311,7 +312,6 @@ private:
 	uint32_t			m_dwLastStatsUpdateTick;
 	uint32_t			m_dwLastSendTick;
 	uint32_t    		m_dwLastUpdateOnFootData;
-	uint32_t			m_dwLastSendAimSyncTick;
 	uint32_t			m_dwLastSendSyncTick;
 	uint32_t			m_dwLastUpdateInCarData;
 	uint32_t			m_dwLastSendSpecTick;
@@ -9,6 +9,7 @@
 #include "../voice_new/SpeakerList.h"
 #include "../voice_new/Network.h"
 #include "java/jniutil.h"
+#include "../game/World.h"
 
 //#define AUTH_BS "39FB2DEEDB49ACFB8D4EECE6953D2507988CCCF4410"//main
 #define AUTH_BS "E02262CF28BC542486C558D4BE9EFB716592AFAF8B"
@@ -63,8 +64,27 @@ CNetGame::CNetGame(const char* szHostOrIp, int iPort, const char *szPlayerName,
 	m_iPort = iPort;
 
 	m_pRakClient = RakNetworkFactory::GetRakClientInterface();
+	m_pVisibility = nullptr;
+	m_pPrefetch = nullptr;
+	m_pBulletBatch = new CBulletBatcher();
 	InitializePools();
 
+	m_pVisibility = new CVisibilityService([](const CVector& vecFrom, const CVector& vecTo) {
+		return CWorld::GetIsLineOfSightClear(vecFrom, vecTo, true, false, false, true, false, false, false);
+	});
+	m_pPrefetch = new CPrefetchService();
+
+	m_pTelemetry = new CNetTelemetry();
+	m_pTelemetry->SetSyncType(ID_PLAYER_SYNC, NET_SYNC_PLAYER);
+	m_pTelemetry->SetSyncType(ID_VEHICLE_SYNC, NET_SYNC_VEHICLE);
+	m_pTelemetry->SetSyncType(ID_PASSENGER_SYNC, NET_SYNC_PASSENGER);
+	m_pTelemetry->SetSyncType(ID_AIM_SYNC, NET_SYNC_AIM);
+	m_pTelemetry->SetSyncType(ID_BULLET_SYNC, NET_SYNC_BULLET);
+	m_pTelemetry->SetSyncType(ID_UNOCCUPIED_SYNC, NET_SYNC_UNOCCUPIED);
+	m_pTelemetry->SetSyncType(ID_TRAILER_SYNC, NET_SYNC_TRAILER);
+	m_pTelemetry->SetSyncType(ID_MARKERS_SYNC, NET_SYNC_MARKERS);
+	m_pTelemetry->SetSyncType(Network::kRaknetPacketId, NET_SYNC_VOICE);
+
 	GetPlayerPool()->SetLocalPlayerName(szPlayerName);
 
 	RegisterRPCs(m_pRakClient);
@@ -115,6 +135,26 @@ CNetGame::~CNetGame()
 
 	UninitializePools();
 
+	if (m_pVisibility) {
+		delete m_pVisibility;
+		m_pVisibility = nullptr;
+	}
+
+	if (m_pPrefetch) {
+		delete m_pPrefetch;
+		m_pPrefetch = nullptr;
+	}
+
+	if (m_pTelemetry) {
+		delete m_pTelemetry;
+		m_pTelemetry = nullptr;
+	}
+
+	if (m_pBulletBatch) {
+		delete m_pBulletBatch;
+		m_pBulletBatch = nullptr;
+	}
+
 	if (m_pNetSet) {
 		delete m_pNetSet;
 		m_pNetSet = nullptr;
@@ -202,6 +242,8 @@ void CNetGame::UninitializePools()
 
 void CNetGame::Process()
 {
+	PROFILE_SCOPE("CNetGame::Process");
+
 	static uint32_t time = GetTickCount();
 	bool bProcess = false;
 	if (GetTickCount() - time >= 1000 / 30)
@@ -210,6 +252,8 @@ void CNetGame::Process()
 		time = GetTickCount();
 		bProcess = true;
 	}
+	m_pVisibility->Process(GetTickCount());
+
 	if (m_pNetSet->byteHoldTime) {
 		pGame->SetWorldTime(m_pNetSet->byteWorldTime_Hour, m_pNetSet->byteWorldTime_Minute);
 	}
@@ -218,6 +262,7 @@ void CNetGame::Process()
 
 	if (GetGameState() == GAMESTATE_CONNECTED) {
 		ProcessPools();
+		ProcessBulletSync();
 	}
 	else {
 		ProcessLoadingScreen();
@@ -228,15 +273,70 @@ void CNetGame::Process()
 	}
 }
 
+// the player a sync packet is about, read the way its handler reads it
+static uint16_t GetSyncSender(Packet* pkt, unsigned char packetIdentifier)
+{
+	switch (packetIdentifier)
+	{
+	case ID_PLAYER_SYNC:
+	case ID_VEHICLE_SYNC:
+	case ID_PASSENGER_SYNC:
+	case ID_AIM_SYNC:
+	case ID_BULLET_SYNC:
+	case ID_UNOCCUPIED_SYNC:
+	case ID_TRAILER_SYNC:
+		break;
+
+	default:
+		return NET_TELEMETRY_NO_SENDER;
+	}
+
+	RakNet::BitStream bsData(pkt->data, pkt->length, false);
+	PLAYERID playerId;
+	bsData.IgnoreBits(8);
+	if (!bsData.Read(playerId)) return NET_TELEMETRY_NO_SENDER;
+	return playerId;
+}
+
+void CNetGame::SampleTelemetry(uint32_t dwNow)
+{
+	// GetStatistics would walk lists the RakNet thread is changing; the snapshot is its copy
+	RakNetStatisticsStruct stats;
+	if (!m_pRakClient->GetStatisticsSnapshot(&stats)) return;
+
+	NET_COUNTERS counters;
+	counters.dwMessagesSent = 0;
+	for (int i = 0; i < NUMBER_OF_PRIORITIES; i++) counters.dwMessagesSent += stats.messagesSent[i];
+	counters.dwMessageResends = stats.messageResends;
+	counters.dwSequencedInOrder = stats.sequencedMessagesInOrder;
+	counters.dwSequencedSkipped = stats.sequencedMessagesSkipped;
+	counters.dwMessagesReceived = stats.messagesReceived;
+	counters.dwDuplicatesReceived = stats.duplicateMessagesReceived;
+	counters.dwOutOfOrder = stats.sequencedMessagesOutOfOrder + stats.orderedMessagesOutOfOrder;
+	counters.dwBitsSent = stats.totalBitsSent;
+	counters.dwBitsReceived = stats.bitsReceived;
+	counters.dwResendQueue = stats.messagesOnResendQueue;
+	counters.dwReassemblyQueue = stats.messagesWaitingForReassembly;
+	counters.iPing = m_pRakClient->GetLastPing();
+
+	m_pTelemetry->Sample(counters, dwNow);
+}
+
 void CNetGame::UpdateNetwork()
 {
+	PROFILE_SCOPE("CNetGame::UpdateNetwork");
+
 	bool breakStatus = false;
 	Packet *pkt = nullptr;
 	unsigned char packetIdentifier;
 
+	uint32_t dwNow = GetTickCount();
+	SampleTelemetry(dwNow);
+
 	while (pkt = m_pRakClient->Receive())
 	{
 		packetIdentifier = GetPacketID(pkt);
+		m_pTelemetry->OnPacket(packetIdentifier, pkt->length, GetSyncSender(pkt, packetIdentifier), dwNow);
 
 		switch (packetIdentifier) {
             case ID_AUTH_KEY:
@@ -314,7 +414,7 @@ void CNetGame::UpdateNetwork()
                 break;
             }
 
-            case 251:
+            case ID_CUSTOM_RPC:
                 Packet_CustomRPC(pkt);
                 break;
         }
@@ -337,7 +437,7 @@ void CNetGame::Packet_CustomRPC(Packet *p) {
     bs.Read(rpcID);
 
     switch (rpcID) {
-        case 99: {
+        case CUSTOM_RPC_CHECK_CASH: {
             FLog("RPC_CHECK_CASH");
             uint8_t bLen, bLen1;
             uint16_t bVersion;
@@ -372,8 +472,8 @@ void CNetGame::Packet_CustomRPC(Packet *p) {
 
             RakNet::BitStream bsParams;
 
-            bsParams.Write((uint8_t) 251);
-            bsParams.Write((uint32_t) 99);
+            bsParams.Write((uint8_t) ID_CUSTOM_RPC);
+            bsParams.Write((uint32_t) CUSTOM_RPC_CHECK_CASH);
 
             bsParams.Write(iVersion);
 
@@ -383,9 +483,52 @@ void CNetGame::Packet_CustomRPC(Packet *p) {
 //			m_pRakClient->RPC(&RPC_CustomHash, &bsParams, HIGH_PRIORITY, RELIABLE, 0, false, UNASSIGNED_NETWORK_ID, NULL);
             break;
         }
+        case CUSTOM_RPC_BULLET_BATCH: {
+            uint8_t byteEnabled = 1;
+            bs.Read(byteEnabled);
+            FLog("Bullet batching %s", byteEnabled ? "enabled" : "disabled");
+
+            FlushBulletSync();
+            m_pBulletBatch->SetEnabled(byteEnabled != 0);
+            break;
+        }
     }
 }
 
+void CNetGame::SendBulletSync(const BULLET_SYNC_DATA& shot)
+{
+	if (!m_pBulletBatch->IsEnabled())
+	{
+		RakNet::BitStream bsBullet;
+		bsBullet.Write((uint8_t)ID_BULLET_SYNC);
+		bsBullet.Write((const char*)&shot, sizeof(BULLET_SYNC_DATA));
+		m_pRakClient->Send(&bsBullet, HIGH_PRIORITY, UNRELIABLE_SEQUENCED, 0);
+		return;
+	}
+
+	if (m_pBulletBatch->Add(GetTickCount(), shot))
+		FlushBulletSync();
+}
+
+void CNetGame::ProcessBulletSync()
+{
+	if (m_pBulletBatch->IsDue(GetTickCount()))
+		FlushBulletSync();
+}
+
+void CNetGame::FlushBulletSync()
+{
+	uint8_t byteRecord[BULLET_BATCH_MAX_BYTES];
+	int iLength = m_pBulletBatch->Encode(byteRecord, sizeof(byteRecord));
+	if (!iLength) return;
+
+	RakNet::BitStream bsBatch;
+	bsBatch.Write((uint8_t)ID_CUSTOM_RPC);
+	bsBatch.Write((uint32_t)CUSTOM_RPC_BULLET_BATCH);
+	bsBatch.Write((const char*)byteRecord, iLength);
+	m_pRakClient->Send(&bsBatch, HIGH_PRIORITY, UNRELIABLE_SEQUENCED, 0);
+}
+
 // 0.3.7
 void CNetGame::ShutdownForGameModeRestart()
 {
@@ -422,6 +565,9 @@ void CNetGame::ShutdownForGameModeRestart()
 	ResetPickupPool();
 	ResetObjectPool();
 	ResetMenuPool();
+	m_pVisibility->Clear();
+	m_pPrefetch->Clear();
+	m_pBulletBatch->Clear();
 
 	m_pNetSet->bDisableInteriorEnterExits = false;
 	m_pNetSet->fNameTagDrawDistance = 70.0f;
@@ -461,14 +607,17 @@ int iVehiclePoolProcessFlag = 0;
 void CNetGame::ProcessPools()
 {
 	if (GetPlayerPool()) {
+		PROFILE_SCOPE("CPlayerPool::Process");
 		GetPlayerPool()->Process();
 	}
 
 	if(GetVehiclePool()) {
+		PROFILE_SCOPE("CVehiclePool::Process");
 		GetVehiclePool()->Process();
 	}
 
 	if (GetPickupPool()) {
+		PROFILE_SCOPE("CPickupPool::Process");
 		GetPickupPool()->Process();
 	}
 }	
@@ -570,6 +719,8 @@ void CNetGame::Packet_DisconnectionNotification(Packet *pkt)
 // 0.3.7
 void CNetGame::Packet_ConnectionSucceeded(Packet *pkt)
 {
+	m_pTelemetry->Reset();
+
 	RakNet::BitStream bsSuccAuth(pkt->data, pkt->length, true);
 	PLAYERID MyPlayerID;
 	unsigned int uiChallenge;
@@ -1010,7 +1161,7 @@ void CNetGame::SetMapIcon(uint8_t byteIconID, float fPosX, float fPosY, float fP
 // 0.3.7
 void CNetGame::DisableMapIcon(uint8_t byteIconID)
 {
-	ScriptCommand(&disable_marker, m_dwMapIcon[byteIconID]);
+	ScriptCommand<disable_marker>(m_dwMapIcon[byteIconID]);
 	m_dwMapIcon[byteIconID] = 0;
 }
 // 0.3.7
@@ -1064,7 +1215,7 @@ void CNetGame::ResetMapIcons()
 	for (int i = 0; i < MAX_MAP_ICONS; i++)
 	{
 		if (m_dwMapIcon[i]) {
-			ScriptCommand(&disable_marker, m_dwMapIcon[i]);
+			ScriptCommand<disable_marker>(m_dwMapIcon[i]);
 			m_dwMapIcon[i] = 0;
 		}
 	}
@@ -35,6 +35,8 @@ typedef unsigned short OBJECTID;
 #define NETMODE_NORMAL_INCAR_SENDRATE	30
 #define NETMODE_HEADSYNC_SENDRATE		1000
 #define NETMODE_AIM_SENDRATE			100
+#define NETMODE_AIM_SLOW_SENDRATE		500		// driving, or firing without lag compensation mode 2
+#define NETMODE_AIM_IDLE_SENDRATE		1000	// on foot and not firing
 #define NETMODE_FIRING_SENDRATE			30
 #define LANMODE_IDLE_ONFOOT_SENDRATE	20
 #define LANMODE_NORMAL_ONFOOT_SENDRATE	15
@@ -43,7 +45,19 @@ typedef unsigned short OBJECTID;
 #define NETMODE_SEND_MULTIPLIER			2
 #define STATS_UPDATE_TICKS 1000 // 1 second
 
+// packet 251 carries a uint32 custom rpc id
+#define ID_CUSTOM_RPC				251
+#define CUSTOM_RPC_CHECK_CASH		99
+#define CUSTOM_RPC_BULLET_BATCH		100	// server -> client: batches are read; client -> server: a batch
+
+#include "spatialgrid.h"
+#include "updatescheduler.h"
+#include "visibilityservice.h"
+#include "prefetchservice.h"
+#include "nettelemetry.h"
+#include "aimsync.h"
 #include "localplayer.h"
+#include "bulletbatch.h"
 #include "remoteplayer.h"
 #include "playerpool.h"
 #include "vehiclepool.h"
@@ -118,6 +132,9 @@ public:
 	CActorPool* GetActorPool() { return m_pPools->pActorPool; }
 	CMenuPool* GetMenuPool() { return m_pPools->pMenuPool; }
 	CPlayerBubblePool* GetPlayerBubblePool() { return m_pPools->pPlayerBubblePool; }
+	CVisibilityService* GetVisibilityService() { return m_pVisibility; }
+	CPrefetchService* GetPrefetchService() { return m_pPrefetch; }
+	CNetTelemetry* GetTelemetry() { return m_pTelemetry; }
 
 	void SendDialogResponse(uint16_t wDialogID, uint8_t byteButtonID, uint16_t wListBoxItem, const char* szInput);
 	void SendChatMessage(const char* szMsg);
@@ -127,12 +144,17 @@ public:
 	void SendSpawn();
 	void SendNextClass();
 
+	void SendBulletSync(const BULLET_SYNC_DATA& shot);
+	void ProcessBulletSync();
+	void FlushBulletSync();
+
     void Packet_CustomRPC(Packet *p);
 
 private:
 	void InitializePools();
 	void UninitializePools();
 	void UpdateNetwork();
+	void SampleTelemetry(uint32_t dwNow);
 	void ProcessPools();
 	void ProcessLoadingScreen();
 	void ProcessConnecting();
@@ -169,6 +191,10 @@ private:
 	void ResetMenuPool();
 
 	RakClientInterface *m_pRakClient;
+	CVisibilityService *m_pVisibility;
+	CPrefetchService *m_pPrefetch;
+	CNetTelemetry *m_pTelemetry;
+	CBulletBatcher *m_pBulletBatch;
 
 	bool		m_bNameTagStatus;
 	int			m_iGameState;
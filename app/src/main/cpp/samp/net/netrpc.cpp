@@ -1091,23 +1091,19 @@ void DamageVehicle(RPCParameters *rpcParams)
 
 	VEHICLEID vehId;
 	bsData.Read(vehId);
-	if (pNetGame->GetVehiclePool()->GetSlotState(vehId))
-	{
-		uint32_t dwPanelStatus, dwDoorStatus;
-		uint8_t byteLightStatus, byteTireStatus;
 
-		bsData.Read(dwPanelStatus);
-		bsData.Read(dwDoorStatus);
-		bsData.Read(byteLightStatus);
-		bsData.Read(byteTireStatus);
+	uint32_t dwPanelStatus, dwDoorStatus;
+	uint8_t byteLightStatus, byteTireStatus;
 
-		CVehicle* pVehicle = pNetGame->GetVehiclePool()->GetAt(vehId);
-		if (pVehicle)
-		{
-			pVehicle->SetWheelPoppedStatus(byteTireStatus);
-			pVehicle->UpdateDamageStatus(dwPanelStatus, dwDoorStatus, byteLightStatus);
-		}
-	}
+	bsData.Read(dwPanelStatus);
+	bsData.Read(dwDoorStatus);
+	bsData.Read(byteLightStatus);
+	bsData.Read(byteTireStatus);
+
+	pNetGame->GetVehiclePool()->Apply(vehId, [=](CVehicle* pVehicle) {
+		pVehicle->SetWheelPoppedStatus(byteTireStatus);
+		pVehicle->UpdateDamageStatus(dwPanelStatus, dwDoorStatus, byteLightStatus);
+	});
 }
 
 void SetVehicleTireStatus(RPCParameters* rpcParams)
@@ -1128,9 +1124,9 @@ void SetVehicleTireStatus(RPCParameters* rpcParams)
 	CVehiclePool *pVehiclePool = pNetGame->GetVehiclePool();
 	if(pVehiclePool)
 	{
-		CVehicle *pVehicle = pVehiclePool->GetAt(vehicleId);
-		if(pVehicle)
+		pVehiclePool->Apply(vehicleId, [byteTire](CVehicle* pVehicle) {
 			pVehicle->SetWheelPoppedStatus(byteTire);
+		});
 	}
 }
 
@@ -1185,26 +1181,8 @@ void ExitVehicle(RPCParameters* rpcParams)
 			pRemotePlayer->ExitVehicle();
 	}
 }
-// 0.3.7
-void VehicleParamsEx(RPCParameters* rpcParams)
+static void ApplyVehicleParamsEx(CVehicle* pVehicle, const VEHICLE_PARAMS_EX& vehParamsEx)
 {
-	Log::traceLastFunc("[RPC-IN] VehicleParamsEx");
-
-	unsigned char* Data = reinterpret_cast<unsigned char*>(rpcParams->input);
-	int iBitLength = rpcParams->numberOfBitsOfData;
-
-	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
-	if (!pVehiclePool) return;
-
-	VEHICLEID VehicleID;
-	VEHICLE_PARAMS_EX vehParamsEx;
-	RakNet::BitStream bsData(Data, (iBitLength / 8) + 1, false);
-	bsData.Read(VehicleID);
-	bsData.Read((char*)& vehParamsEx, sizeof(VEHICLE_PARAMS_EX));
-
-	CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-	if (!pVehicle) return;
-
 	pVehicle->ApplyEngineState(vehParamsEx.byteEngine);
 
 	pVehicle->ApplyLightState(vehParamsEx.byteLight);
@@ -1354,6 +1332,27 @@ void VehicleParamsEx(RPCParameters* rpcParams)
 	}
 }
 // 0.3.7
+void VehicleParamsEx(RPCParameters* rpcParams)
+{
+	Log::traceLastFunc("[RPC-IN] VehicleParamsEx");
+
+	unsigned char* Data = reinterpret_cast<unsigned char*>(rpcParams->input);
+	int iBitLength = rpcParams->numberOfBitsOfData;
+
+	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
+	if (!pVehiclePool) return;
+
+	VEHICLEID VehicleID;
+	VEHICLE_PARAMS_EX vehParamsEx;
+	RakNet::BitStream bsData(Data, (iBitLength / 8) + 1, false);
+	bsData.Read(VehicleID);
+	bsData.Read((char*)& vehParamsEx, sizeof(VEHICLE_PARAMS_EX));
+
+	pVehiclePool->Apply(VehicleID, [vehParamsEx](CVehicle* pVehicle) {
+		ApplyVehicleParamsEx(pVehicle, vehParamsEx);
+	});
+}
+// 0.3.7
 void ShowActor(RPCParameters* rpcParams)
 {
 	Log::traceLastFunc("[RPC-IN] Show actor");
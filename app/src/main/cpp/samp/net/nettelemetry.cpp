@@ -0,0 +1,323 @@
+#include "nettelemetry.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#define NET_TELEMETRY_MEAN_WEIGHT	0.125f	// of the newest interval in a stream's mean
+#define NET_TELEMETRY_EARLY_RATIO	0.5f	// of the mean; a packet sooner than this came bunched up
+#define NET_TELEMETRY_POLL_SLACK	0.5f	// of the poll interval, taken off an interval before looking for gaps
+
+static const char* g_szSyncTypeNames[NET_SYNC_COUNT] = {
+	"player", "vehicle", "passenger", "aim", "bullet", "unoccupied", "trailer", "markers", "voice"
+};
+
+// a counter that went down belongs to a new connection
+static inline uint32_t CounterDelta(uint32_t dwNow, uint32_t dwLast)
+{
+	return dwNow >= dwLast ? dwNow - dwLast : dwNow;
+}
+
+CNetTelemetry::CNetTelemetry()
+{
+	m_pBuckets = new BUCKET[NET_TELEMETRY_BUCKETS];
+	m_pStreams = new STREAM[NET_SYNC_COUNT * NET_TELEMETRY_MAX_SENDERS];
+	memset(m_SyncType, NET_SYNC_NONE, sizeof(m_SyncType));
+
+	Reset();
+}
+
+CNetTelemetry::~CNetTelemetry()
+{
+	delete[] m_pBuckets;
+	delete[] m_pStreams;
+}
+
+void CNetTelemetry::SetSyncType(uint8_t byteId, eNetSyncType type)
+{
+	m_SyncType[byteId] = (int8_t)type;
+}
+
+void CNetTelemetry::ClearBucket(BUCKET& bucket)
+{
+	memset(&bucket, 0, sizeof(BUCKET));
+	bucket.iRttMin = -1;
+	bucket.iRttMax = -1;
+}
+
+void CNetTelemetry::Reset()
+{
+	for (int i = 0; i < NET_TELEMETRY_BUCKETS; i++) ClearBucket(m_pBuckets[i]);
+	memset(m_pStreams, 0, NET_SYNC_COUNT * NET_TELEMETRY_MAX_SENDERS * sizeof(STREAM));
+
+	m_iBucket = 0;
+	m_iFilled = 0;
+	m_dwBucketStart = 0;
+	m_dwNow = 0;
+	m_bStarted = false;
+
+	memset(&m_LastCounters, 0, sizeof(m_LastCounters));
+	m_LastCounters.iPing = -1;
+	m_bHaveCounters = false;
+	m_dwLastPoll = 0;
+	m_dwPollInterval = 0;
+	m_iLastPing = -1;
+}
+
+void CNetTelemetry::Advance(uint32_t dwNow)
+{
+	if (!m_bStarted)
+	{
+		m_bStarted = true;
+		m_dwBucketStart = dwNow;
+		m_dwNow = dwNow;
+		m_iFilled = 1;
+		return;
+	}
+
+	// the clock doesn't go back
+	if ((int32_t)(dwNow - m_dwNow) < 0) return;
+	m_dwNow = dwNow;
+
+	uint32_t dwSteps = (dwNow - m_dwBucketStart) / NET_TELEMETRY_BUCKET_MS;
+	if (dwSteps == 0) return;
+
+	if (dwSteps >= NET_TELEMETRY_BUCKETS)
+	{
+		// nothing in the window is recent any more
+		for (int i = 0; i < NET_TELEMETRY_BUCKETS; i++) ClearBucket(m_pBuckets[i]);
+		m_iBucket = 0;
+		m_iFilled = 1;
+	}
+	else
+	{
+		for (uint32_t i = 0; i < dwSteps; i++)
+		{
+			m_iBucket = (m_iBucket + 1) % NET_TELEMETRY_BUCKETS;
+			ClearBucket(m_pBuckets[m_iBucket]);
+		}
+		m_iFilled = std::min(m_iFilled + (int)dwSteps, NET_TELEMETRY_BUCKETS);
+	}
+	m_dwBucketStart += dwSteps * NET_TELEMETRY_BUCKET_MS;
+}
+
+void CNetTelemetry::OnPacket(uint8_t byteId, uint32_t dwBytes, uint16_t wSender, uint32_t dwNow)
+{
+	Advance(dwNow);
+	dwNow = m_dwNow;
+
+	BUCKET& bucket = m_pBuckets[m_iBucket];
+	bucket.dwPackets[byteId]++;
+	bucket.dwBytes[byteId] += dwBytes;
+
+	int iType = m_SyncType[byteId];
+	if (iType < 0 || wSender >= NET_TELEMETRY_MAX_SENDERS) return;
+
+	STREAM& stream = m_pStreams[iType * NET_TELEMETRY_MAX_SENDERS + wSender];
+	uint32_t dwInterval = dwNow - stream.dwLast;
+
+	if (!stream.bActive || dwInterval > NET_TELEMETRY_STREAM_TIMEOUT)
+	{
+		// the player just came into range, or came back
+		memset(&stream, 0, sizeof(STREAM));
+		stream.bActive = true;
+		stream.dwLast = dwNow;
+		return;
+	}
+
+	if (stream.bHaveInterval)
+	{
+		bucket.dwSyncJitterSum[iType] += (uint32_t)std::abs((int)dwInterval - (int)stream.dwInterval);
+		bucket.dwSyncIntervals[iType]++;
+	}
+
+	if (stream.fMeanInterval <= 0.0f)
+	{
+		stream.fMeanInterval = (float)dwInterval;
+	}
+	else
+	{
+		float fRatio = dwInterval / stream.fMeanInterval;
+		// the poll held the packet back by up to a poll interval; that much of it is no gap
+		float fSlack = std::min(m_dwPollInterval, dwInterval) * NET_TELEMETRY_POLL_SLACK;
+		int iGaps = (int)((dwInterval - fSlack) / stream.fMeanInterval + 0.5f);
+
+		if (fRatio < NET_TELEMETRY_EARLY_RATIO)
+		{
+			// came with the one before: makes up for the last gap, or the next one
+			if (stream.bytePending) stream.bytePending--;
+			else if (stream.byteEarly < NET_TELEMETRY_MAX_GAP) stream.byteEarly++;
+		}
+		else
+		{
+			bucket.dwSyncMissed[iType] += stream.bytePending;
+			stream.bytePending = 0;
+
+			if (iGaps >= 2 && iGaps <= NET_TELEMETRY_MAX_GAP)
+			{
+				int iMissed = iGaps - 1;
+				int iMadeUp = std::min(iMissed, (int)stream.byteEarly);
+				stream.byteEarly -= iMadeUp;
+				stream.bytePending = (uint8_t)(iMissed - iMadeUp);
+			}
+			else stream.byteEarly = 0;
+		}
+
+		if (iGaps > NET_TELEMETRY_MAX_GAP) stream.fMeanInterval = (float)dwInterval;
+		else stream.fMeanInterval += (dwInterval - stream.fMeanInterval) * NET_TELEMETRY_MEAN_WEIGHT;
+	}
+
+	stream.dwInterval = dwInterval;
+	stream.bHaveInterval = true;
+	stream.dwLast = dwNow;
+}
+
+void CNetTelemetry::Sample(const NET_COUNTERS& counters, uint32_t dwNow)
+{
+	Advance(dwNow);
+	dwNow = m_dwNow;
+
+	BUCKET& bucket = m_pBuckets[m_iBucket];
+
+	if (m_bHaveCounters)
+	{
+		bucket.dwMessagesSent += CounterDelta(counters.dwMessagesSent, m_LastCounters.dwMessagesSent);
+		bucket.dwResends += CounterDelta(counters.dwMessageResends, m_LastCounters.dwMessageResends);
+		bucket.dwSequencedInOrder += CounterDelta(counters.dwSequencedInOrder, m_LastCounters.dwSequencedInOrder);
+		bucket.dwSequencedSkipped += CounterDelta(counters.dwSequencedSkipped, m_LastCounters.dwSequencedSkipped);
+		bucket.dwDuplicates += CounterDelta(counters.dwDuplicatesReceived, m_LastCounters.dwDuplicatesReceived);
+		bucket.dwOutOfOrder += CounterDelta(counters.dwOutOfOrder, m_LastCounters.dwOutOfOrder);
+		bucket.dwBitsSent += CounterDelta(counters.dwBitsSent, m_LastCounters.dwBitsSent);
+		bucket.dwBitsReceived += CounterDelta(counters.dwBitsReceived, m_LastCounters.dwBitsReceived);
+
+		uint32_t dwPoll = dwNow - m_dwLastPoll;
+		m_dwPollInterval = dwPoll;
+		bucket.dwPollSum += dwPoll;
+		bucket.dwPolls++;
+		bucket.dwPollMax = std::max(bucket.dwPollMax, dwPoll);
+	}
+
+	if (counters.iPing >= 0)
+	{
+		bucket.dwRttSum += counters.iPing;
+		bucket.dwRttSamples++;
+		bucket.iRttMin = bucket.iRttMin < 0 ? counters.iPing : std::min(bucket.iRttMin, counters.iPing);
+		bucket.iRttMax = std::max(bucket.iRttMax, counters.iPing);
+
+		// RakNet pings every few seconds; the same value again is the same ping
+		if (m_iLastPing >= 0 && counters.iPing != m_iLastPing)
+		{
+			bucket.dwRttJitterSum += std::abs(counters.iPing - m_iLastPing);
+			bucket.dwRttChanges++;
+		}
+		m_iLastPing = counters.iPing;
+	}
+
+	m_LastCounters = counters;
+	m_bHaveCounters = true;
+	m_dwLastPoll = dwNow;
+}
+
+void CNetTelemetry::GetReport(NET_REPORT& report) const
+{
+	memset(&report, 0, sizeof(NET_REPORT));
+	report.iRttMs = m_LastCounters.iPing;
+	report.iRttMinMs = -1;
+	report.iRttMaxMs = -1;
+	report.dwResendQueue = m_LastCounters.dwResendQueue;
+	report.dwReassemblyQueue = m_LastCounters.dwReassemblyQueue;
+	if (!m_bStarted) return;
+
+	uint32_t dwWindow = (m_iFilled - 1) * NET_TELEMETRY_BUCKET_MS + (m_dwNow - m_dwBucketStart);
+	float fWindowSec = std::max(dwWindow, 1u) / 1000.0f;
+	report.fWindowSec = fWindowSec;
+
+	uint32_t dwSent = 0, dwResends = 0, dwBitsSent = 0, dwBitsReceived = 0;
+	uint32_t dwSequenced = 0, dwSkipped = 0;
+	uint32_t dwRttSum = 0, dwRttSamples = 0, dwRttJitterSum = 0, dwRttChanges = 0;
+	uint32_t dwPollSum = 0, dwPolls = 0;
+
+	uint32_t dwSyncBytes[NET_SYNC_COUNT] = {};
+	uint32_t dwSyncJitterSum[NET_SYNC_COUNT] = {};
+	uint32_t dwSyncIntervals[NET_SYNC_COUNT] = {};
+	uint32_t dwSyncMissed[NET_SYNC_COUNT] = {};
+
+	for (int i = 0; i < NET_TELEMETRY_BUCKETS; i++)
+	{
+		const BUCKET& bucket = m_pBuckets[i];
+
+		dwSent += bucket.dwMessagesSent;
+		dwResends += bucket.dwResends;
+		dwSequenced += bucket.dwSequencedInOrder;
+		dwSkipped += bucket.dwSequencedSkipped;
+		dwBitsSent += bucket.dwBitsSent;
+		dwBitsReceived += bucket.dwBitsReceived;
+		report.dwOutOfOrder += bucket.dwOutOfOrder;
+		report.dwDuplicates += bucket.dwDuplicates;
+
+		dwRttSum += bucket.dwRttSum;
+		dwRttSamples += bucket.dwRttSamples;
+		dwRttJitterSum += bucket.dwRttJitterSum;
+		dwRttChanges += bucket.dwRttChanges;
+		if (bucket.iRttMin >= 0) {
+			report.iRttMinMs = report.iRttMinMs < 0 ? bucket.iRttMin : std::min(report.iRttMinMs, bucket.iRttMin);
+			report.iRttMaxMs = std::max(report.iRttMaxMs, bucket.iRttMax);
+		}
+
+		dwPollSum += bucket.dwPollSum;
+		dwPolls += bucket.dwPolls;
+		report.dwPollMaxMs = std::max(report.dwPollMaxMs, bucket.dwPollMax);
+
+		for (int id = 0; id < 256; id++)
+		{
+			int iType = m_SyncType[id];
+			if (iType < 0) continue;
+			report.sync[iType].dwPackets += bucket.dwPackets[id];
+			dwSyncBytes[iType] += bucket.dwBytes[id];
+		}
+
+		for (int t = 0; t < NET_SYNC_COUNT; t++)
+		{
+			dwSyncJitterSum[t] += bucket.dwSyncJitterSum[t];
+			dwSyncIntervals[t] += bucket.dwSyncIntervals[t];
+			dwSyncMissed[t] += bucket.dwSyncMissed[t];
+		}
+	}
+
+	report.fLossOutPercent = dwSent ? dwResends * 100.0f / dwSent : 0.0f;
+	report.fLossInPercent = dwSequenced + dwSkipped ? dwSkipped * 100.0f / (dwSequenced + dwSkipped) : 0.0f;
+	report.fKbitInPerSec = dwBitsReceived / fWindowSec / 1000.0f;
+	report.fKbitOutPerSec = dwBitsSent / fWindowSec / 1000.0f;
+	report.fRttAvgMs = dwRttSamples ? (float)dwRttSum / dwRttSamples : 0.0f;
+	report.fRttJitterMs = dwRttChanges ? (float)dwRttJitterSum / dwRttChanges : 0.0f;
+	report.fPollAvgMs = dwPolls ? (float)dwPollSum / dwPolls : 0.0f;
+
+	for (int t = 0; t < NET_SYNC_COUNT; t++)
+	{
+		NET_SYNC_REPORT& sync = report.sync[t];
+		sync.fPacketsPerSec = sync.dwPackets / fWindowSec;
+		sync.fKbitPerSec = dwSyncBytes[t] * 8 / fWindowSec / 1000.0f;
+		sync.fJitterMs = dwSyncIntervals[t] ? (float)dwSyncJitterSum[t] / dwSyncIntervals[t] : 0.0f;
+		uint32_t dwExpected = sync.dwPackets + dwSyncMissed[t];
+		sync.fLossPercent = dwExpected ? dwSyncMissed[t] * 100.0f / dwExpected : 0.0f;
+	}
+}
+
+uint32_t CNetTelemetry::GetPacketCount(uint8_t byteId) const
+{
+	uint32_t dwCount = 0;
+	for (int i = 0; i < NET_TELEMETRY_BUCKETS; i++) dwCount += m_pBuckets[i].dwPackets[byteId];
+	return dwCount;
+}
+
+uint32_t CNetTelemetry::GetPacketBytes(uint8_t byteId) const
+{
+	uint32_t dwBytes = 0;
+	for (int i = 0; i < NET_TELEMETRY_BUCKETS; i++) dwBytes += m_pBuckets[i].dwBytes[byteId];
+	return dwBytes;
+}
+
+const char* CNetTelemetry::GetSyncTypeName(eNetSyncType type)
+{
+	return type >= 0 && type < NET_SYNC_COUNT ? g_szSyncTypeNames[type] : "?";
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstdint>
+
+// Network telemetry.
+// UpdateNetwork feeds every received packet and, once a poll, RakNet's cumulative
+// statistics and the last ping into one-second buckets; the report folds the last
+// NET_TELEMETRY_BUCKETS of them into rates, so it always covers the recent past.
+// Connection wide: RTT and its jitter (mean change between pings), outgoing loss as the
+// share of sent messages RakNet had to resend, incoming loss as the share of the server's
+// sequenced messages that never made it, bandwidth both ways, the resend and reassembly
+// queues, and how long the game went between polls, which tells a client stall from
+// the network. Per sync type: packets and bandwidth, the jitter of the arrival interval
+// of each sender's stream, and loss estimated from the gaps in that stream: sync comes
+// at a steady rate per player, a gap of n intervals counts n - 1 packets missing, less
+// the packets that come bunched up in one poll next to it. Half a poll interval is
+// taken off each gap first, so it errs low rather than calling the poll loss.
+// Arrival times are taken when UpdateNetwork polls, so jitter below the poll interval
+// doesn't show. The clock is the caller's, which keeps it testable with a fake one.
+
+#define NET_TELEMETRY_BUCKET_MS		1000
+#define NET_TELEMETRY_BUCKETS		30			// the window
+#define NET_TELEMETRY_MAX_SENDERS	1024
+#define NET_TELEMETRY_NO_SENDER		0xFFFF
+#define NET_TELEMETRY_STREAM_TIMEOUT	2000	// ms of silence after which a stream starts over
+#define NET_TELEMETRY_MAX_GAP		4			// intervals; a longer gap is a rate change, not loss
+
+enum eNetSyncType
+{
+	NET_SYNC_NONE = -1,			// not broken down, still in the per-ID counters
+
+	NET_SYNC_PLAYER,
+	NET_SYNC_VEHICLE,
+	NET_SYNC_PASSENGER,
+	NET_SYNC_AIM,
+	NET_SYNC_BULLET,
+	NET_SYNC_UNOCCUPIED,
+	NET_SYNC_TRAILER,
+	NET_SYNC_MARKERS,
+	NET_SYNC_VOICE,
+
+	NET_SYNC_COUNT
+};
+
+// cumulative, as RakNetStatistics counts them, except where noted
+struct NET_COUNTERS
+{
+	uint32_t	dwMessagesSent;			// all priorities
+	uint32_t	dwMessageResends;
+	uint32_t	dwSequencedInOrder;
+	uint32_t	dwSequencedSkipped;		// never arrived, or too late
+	uint32_t	dwMessagesReceived;
+	uint32_t	dwDuplicatesReceived;
+	uint32_t	dwOutOfOrder;			// sequenced and ordered
+	uint32_t	dwBitsSent;
+	uint32_t	dwBitsReceived;
+	uint32_t	dwResendQueue;			// right now
+	uint32_t	dwReassemblyQueue;		// right now
+	int			iPing;					// ms, the last one; -1 for none yet
+};
+
+struct NET_SYNC_REPORT
+{
+	uint32_t	dwPackets;				// in the window
+	float		fPacketsPerSec;
+	float		fKbitPerSec;
+	float		fJitterMs;				// mean change of the arrival interval
+	float		fLossPercent;			// estimated from the gaps
+};
+
+struct NET_REPORT
+{
+	float		fWindowSec;
+
+	int			iRttMs;					// last
+	int			iRttMinMs;
+	int			iRttMaxMs;
+	float		fRttAvgMs;
+	float		fRttJitterMs;
+	float		fLossOutPercent;		// resent of sent
+	float		fLossInPercent;			// skipped of the sequenced messages (sync) the server sent
+	float		fKbitInPerSec;
+	float		fKbitOutPerSec;
+	uint32_t	dwOutOfOrder;
+	uint32_t	dwDuplicates;
+	uint32_t	dwResendQueue;			// right now
+	uint32_t	dwReassemblyQueue;		// right now
+
+	float		fPollAvgMs;
+	uint32_t	dwPollMaxMs;
+
+	NET_SYNC_REPORT sync[NET_SYNC_COUNT];
+};
+
+class CNetTelemetry
+{
+public:
+	CNetTelemetry();
+	~CNetTelemetry();
+
+	// which sync type a packet ID counts as
+	void SetSyncType(uint8_t byteId, eNetSyncType type);
+
+	// wSender: the player the packet is about, NET_TELEMETRY_NO_SENDER when there's none
+	void OnPacket(uint8_t byteId, uint32_t dwBytes, uint16_t wSender, uint32_t dwNow);
+	// once per UpdateNetwork
+	void Sample(const NET_COUNTERS& counters, uint32_t dwNow);
+	// on a new connection: the counters start over
+	void Reset();
+
+	void GetReport(NET_REPORT& report) const;
+	// in the window
+	uint32_t GetPacketCount(uint8_t byteId) const;
+	uint32_t GetPacketBytes(uint8_t byteId) const;
+
+	static const char* GetSyncTypeName(eNetSyncType type);
+
+private:
+	struct BUCKET
+	{
+		uint32_t	dwPackets[256];
+		uint32_t	dwBytes[256];
+
+		uint32_t	dwSyncJitterSum[NET_SYNC_COUNT];		// ms
+		uint32_t	dwSyncIntervals[NET_SYNC_COUNT];
+		uint32_t	dwSyncMissed[NET_SYNC_COUNT];
+
+		uint32_t	dwMessagesSent;
+		uint32_t	dwResends;
+		uint32_t	dwSequencedInOrder;
+		uint32_t	dwSequencedSkipped;
+		uint32_t	dwDuplicates;
+		uint32_t	dwOutOfOrder;
+		uint32_t	dwBitsSent;
+		uint32_t	dwBitsReceived;
+
+		uint32_t	dwRttSum;
+		uint32_t	dwRttSamples;
+		int			iRttMin;
+		int			iRttMax;
+		uint32_t	dwRttJitterSum;
+		uint32_t	dwRttChanges;
+
+		uint32_t	dwPollSum;
+		uint32_t	dwPolls;
+		uint32_t	dwPollMax;
+	};
+
+	struct STREAM
+	{
+		bool		bActive;		// a packet came within NET_TELEMETRY_STREAM_TIMEOUT
+		bool		bHaveInterval;
+		uint8_t		byteEarly;		// packets the poll bunched up that a later gap makes up for
+		uint8_t		bytePending;	// missing by the last gap, unless packets bunched up right after
+		uint32_t	dwLast;			// arrival of the last packet
+		uint32_t	dwInterval;		// between the last two
+		float		fMeanInterval;	// running
+	};
+
+	void Advance(uint32_t dwNow);
+	void ClearBucket(BUCKET& bucket);
+
+	BUCKET*		m_pBuckets;
+	int			m_iBucket;			// the current one
+	int			m_iFilled;			// buckets with data, the current one too
+	uint32_t	m_dwBucketStart;
+	uint32_t	m_dwNow;
+	bool		m_bStarted;
+
+	int8_t		m_SyncType[256];
+	STREAM*		m_pStreams;			// [NET_SYNC_COUNT][NET_TELEMETRY_MAX_SENDERS]
+
+	NET_COUNTERS m_LastCounters;	// the last sample, for the deltas and what's right now
+	bool		m_bHaveCounters;
+	uint32_t	m_dwLastPoll;
+	uint32_t	m_dwPollInterval;	// the last one
+	int			m_iLastPing;		// the last one there was
+};
@@ -0,0 +1,77 @@
+#include "pickupevents.h"
+
+#include <algorithm>
+
+CPickupEventFilter::CPickupEventFilter(int iCapacity)
+{
+	m_Contacts.resize(iCapacity);
+	Clear();
+}
+
+void CPickupEventFilter::Clear()
+{
+	for (auto& contact : m_Contacts) contact = {};
+
+	// frame 0 is the "never" of dwFrame
+	m_dwFrame = 1;
+	m_dwNow = 0;
+	m_dwLastRefill = 0;
+	m_fTokens = PICKUP_RATE_BURST;
+
+	m_iSent = 0;
+	m_iSuppressed = 0;
+	m_iDeferred = 0;
+}
+
+void CPickupEventFilter::Forget(int iPickup)
+{
+	if (iPickup < 0 || iPickup >= (int)m_Contacts.size()) return;
+	m_Contacts[iPickup] = {};
+}
+
+void CPickupEventFilter::BeginFrame(uint32_t dwNow)
+{
+	m_dwFrame++;
+
+	if (m_dwLastRefill == 0) m_dwLastRefill = dwNow;
+	float fRefill = (float)(dwNow - m_dwLastRefill) * PICKUP_RATE_PER_SECOND / 1000.0f;
+	m_fTokens = std::min(m_fTokens + fRefill, (float)PICKUP_RATE_BURST);
+	m_dwLastRefill = dwNow;
+	m_dwNow = dwNow;
+}
+
+bool CPickupEventFilter::OnContact(int iPickup)
+{
+	if (iPickup < 0 || iPickup >= (int)m_Contacts.size()) return false;
+	Contact_t& contact = m_Contacts[iPickup];
+
+	// a new contact unless it was touching on the previous frame too
+	if (contact.dwFrame + 1 != m_dwFrame && contact.dwFrame != m_dwFrame) {
+		contact.bReported = false;
+	}
+	contact.dwFrame = m_dwFrame;
+
+	if (contact.bReported) return false;
+
+	if (contact.bHasEvent && m_dwNow - contact.dwLastEvent < PICKUP_RESEND_INTERVAL)
+	{
+		// stepping off and back on right away, same pickup
+		contact.bReported = true;
+		m_iSuppressed++;
+		return false;
+	}
+
+	if (m_fTokens < 1.0f)
+	{
+		// over the rate, tried again next frame if still in contact
+		m_iDeferred++;
+		return false;
+	}
+
+	m_fTokens -= 1.0f;
+	contact.bReported = true;
+	contact.bHasEvent = true;
+	contact.dwLastEvent = m_dwNow;
+	m_iSent++;
+	return true;
+}
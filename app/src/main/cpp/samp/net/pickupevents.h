@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Turns per-frame pickup contact into pickup events.
+// A pickup fires once when the local player comes into contact with it; staying in
+// contact doesn't fire again, and neither does touching it again within the resend
+// interval. Events past the rate limit stay pending and fire on a later frame while
+// the contact lasts. Only pickup ids and times go in, so a trace drives it the same way.
+
+#define PICKUP_RESEND_INTERVAL	500		// ms before the same pickup can fire again
+#define PICKUP_RATE_PER_SECOND	10		// events sent per second at most
+#define PICKUP_RATE_BURST		4		// events that can go out at once
+
+class CPickupEventFilter
+{
+public:
+	CPickupEventFilter(int iCapacity);
+
+	// once per frame, before the contacts of that frame
+	void BeginFrame(uint32_t dwNow);
+	// the player touches iPickup this frame, true if the event should be sent now
+	bool OnContact(int iPickup);
+	// the pickup slot was destroyed or reused
+	void Forget(int iPickup);
+	void Clear();
+
+	int GetSentCount() const { return m_iSent; }
+	int GetSuppressedCount() const { return m_iSuppressed; }
+	int GetDeferredCount() const { return m_iDeferred; }
+
+private:
+	struct Contact_t
+	{
+		uint32_t	dwFrame;		// last frame in contact
+		uint32_t	dwLastEvent;
+		bool		bHasEvent;		// dwLastEvent is valid
+		bool		bReported;		// the current contact was handled
+	};
+
+	std::vector<Contact_t>	m_Contacts;
+	uint32_t				m_dwFrame;
+	uint32_t				m_dwNow;
+	uint32_t				m_dwLastRefill;
+	float					m_fTokens;
+
+	int		m_iSent;
+	int		m_iSuppressed;
+	int		m_iDeferred;
+};
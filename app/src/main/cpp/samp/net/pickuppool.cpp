@@ -1,12 +1,13 @@
 #include "../main.h"
 #include "../game/game.h"
 #include "netgame.h"
+#include "../game/Pickups.h"
 
 extern CGame *pGame;
 extern CNetGame *pNetGame;
 
 // 0.3.7
-CPickupPool::CPickupPool()
+CPickupPool::CPickupPool() : m_Grid(MAX_PICKUPS), m_Events(MAX_PICKUPS)
 {
 	memset(m_Pickups, 0, sizeof(m_Pickups));
 	m_iPickupCount = 0;
@@ -14,7 +15,6 @@ CPickupPool::CPickupPool()
 	for (int i = 0; i < MAX_PICKUPS; i++)
 	{
 		m_dwHnd[i] = 0;
-		m_iTimer[i] = 0;
 		m_dwGTAId[i] = 0xFFFFFFFF;
 	}
 }
@@ -24,48 +24,75 @@ CPickupPool::~CPickupPool()
 	for (int i = 0; i < MAX_PICKUPS; i++)
 	{
 		if (m_dwHnd[i] != 0) {
-			ScriptCommand(&destroy_pickup, m_dwHnd[i]);
+			ScriptCommand<destroy_pickup>(m_dwHnd[i]);
 		}
 	}
 }
 // 0.3.7
 void CPickupPool::Process()
 {
-	for (int i = 0; i < MAX_PICKUPS; i++)
+	m_Events.BeginFrame(GetTickCount());
+
+	// collection needs contact, so only pickups right around the local player can fire
+	CPlayerPed* pPlayerPed = pGame->FindPlayerPed();
+	if (!pPlayerPed || !pPlayerPed->m_pPed || m_Grid.GetCount() == 0) return;
+
+	CPedGTA* pPed = pPlayerPed->m_pPed;
+	const CVector& vecPed = pPed->GetPosition();
+	const CVector* pVehiclePos = (pPed->IsInVehicle() && pPed->pVehicle) ? &pPed->pVehicle->GetPosition() : nullptr;
+
+	static int iNearby[MAX_PICKUPS];
+	int iCount = m_Grid.Query(pVehiclePos ? *pVehiclePos : vecPed,
+		std::max(PICKUP_CONTACT_RADIUS, PICKUP_VEHICLE_CONTACT_RADIUS), iNearby, MAX_PICKUPS);
+
+	for (int n = 0; n < iCount; n++)
 	{
-		if (m_dwHnd[i] != 0)
-		{
-			if (m_droppedWeapon[i].bDroppedWeapon || m_Pickups[i].iType == 14)
-			{
-				if (ScriptCommand(&is_pickup_picked_up, m_dwHnd[i]))
-				{
-					RakNet::BitStream bsPickup;
-					if (m_droppedWeapon[i].bDroppedWeapon == false)
-					{
-						bsPickup.Write(i);
-						pNetGame->GetRakClient()->RPC(&RPC_PickedUpPickup, &bsPickup, HIGH_PRIORITY, RELIABLE_SEQUENCED, 0, false, UNASSIGNED_NETWORK_ID, nullptr);
-					}
-					else
-					{
-						bsPickup.Write(m_droppedWeapon[i].PlayerID); 
-						pNetGame->GetRakClient()->RPC(&RPC_PickedUpPickup, &bsPickup, HIGH_PRIORITY, RELIABLE_SEQUENCED, 0, false, UNASSIGNED_NETWORK_ID, nullptr);
-					}
-				}
-			}
-			else if(m_iTimer[i] > 0)
-			{
-				m_iTimer[i]--;
-			}
+		int i = iNearby[n];
+		if (m_dwHnd[i] == 0) continue;
+
+		if (IsInContact(i, vecPed, pVehiclePos) && m_Events.OnContact(i)) {
+			SendPickedUp(i);
 		}
 	}
 }
+
+bool CPickupPool::IsInContact(int iPickup, const CVector& vecPed, const CVector* pVehiclePos)
+{
+	// the game pickup is gone or waiting to regenerate
+	CPickup* pPickup = CPickups::GetPickup(m_dwGTAId[iPickup]);
+	if (pPickup && (pPickup->m_nPickupType == PICKUP_NONE || pPickup->m_nFlags.bDisabled)) return false;
+
+	const CVector& vecPickup = m_Grid.GetPosition(iPickup);
+
+	if (m_Pickups[iPickup].iType == PICKUP_TYPE_VEHICLE)
+	{
+		if (!pVehiclePos) return false;
+		return DistanceBetweenPoints(vecPickup, *pVehiclePos) < PICKUP_VEHICLE_CONTACT_RADIUS;
+	}
+
+	return DistanceBetweenPoints(vecPickup, vecPed) < PICKUP_CONTACT_RADIUS;
+}
+
+void CPickupPool::SendPickedUp(int iPickup)
+{
+	// every pickup event has to arrive, a dropped weapon only needs the latest
+	RakNet::BitStream bsPickup;
+	if (m_droppedWeapon[iPickup].bDroppedWeapon == false) {
+		bsPickup.Write(iPickup);
+		pNetGame->GetRakClient()->RPC(&RPC_PickedUpPickup, &bsPickup, HIGH_PRIORITY, RELIABLE_ORDERED, 0, false, UNASSIGNED_NETWORK_ID, nullptr);
+	}
+	else {
+		bsPickup.Write(m_droppedWeapon[iPickup].PlayerID);
+		pNetGame->GetRakClient()->RPC(&RPC_PickedUpPickup, &bsPickup, HIGH_PRIORITY, RELIABLE_SEQUENCED, 0, false, UNASSIGNED_NETWORK_ID, nullptr);
+	}
+}
 // 0.3.7
 void CPickupPool::New(PICKUP *pPickup, int iPickup)
 {
 	if (m_iPickupCount >= MAX_PICKUPS || iPickup < 0 || iPickup >= MAX_PICKUPS) return;
 
 	if (m_dwHnd[iPickup] != 0) {
-		ScriptCommand(&destroy_pickup, m_dwHnd[iPickup]);
+		ScriptCommand<destroy_pickup>(m_dwHnd[iPickup]);
 	}
 
 	memcpy(&m_Pickups[iPickup], pPickup, sizeof(PICKUP));
@@ -76,6 +103,9 @@ void CPickupPool::New(PICKUP *pPickup, int iPickup)
 		pPickup->fX, pPickup->fY, pPickup->fZ, &dwGTAId);
 	m_dwGTAId[iPickup] = dwGTAId;
 	m_iPickupCount++;
+
+	m_Events.Forget(iPickup);
+	m_Grid.Update(iPickup, CVector(pPickup->fX, pPickup->fY, pPickup->fZ));
 }
 // 0.3.7
 void CPickupPool::Destroy(int iPickup)
@@ -84,36 +114,12 @@ void CPickupPool::Destroy(int iPickup)
 
 	if (m_dwHnd[iPickup])
 	{
-		ScriptCommand(&destroy_pickup, m_dwHnd[iPickup]);
+		ScriptCommand<destroy_pickup>(m_dwHnd[iPickup]);
 		m_dwHnd[iPickup] = 0;
-		m_iTimer[iPickup] = 0;
 		m_dwGTAId[iPickup] = 0xFFFFFFFF;
 		m_iPickupCount--;
-	}
-}
-// 0.3.7
-int CPickupPool::GetIDFromGTAId(int dwGTAId)
-{
-	for (int i = 0; i < MAX_PICKUPS; i++)
-	{
-		if (m_dwGTAId[i] == dwGTAId) {
-			return i;
-		}
-	}
-
-	return -1;
-}
-// 0.3.7
-void CPickupPool::PickedUp(int dwGTAId)
-{
-	int PickupID = GetIDFromGTAId(dwGTAId);
-	if (PickupID != 0xFFFFFFFF && m_dwHnd[PickupID] != 0 && m_iTimer[PickupID] == 0)
-	{
-		if (m_droppedWeapon[PickupID].bDroppedWeapon) return;
 
-		RakNet::BitStream bsPickup;
-		bsPickup.Write(PickupID);
-		pNetGame->GetRakClient()->RPC(&RPC_PickedUpPickup, &bsPickup, HIGH_PRIORITY, RELIABLE_ORDERED, 0, false, UNASSIGNED_NETWORK_ID, nullptr);
-		m_iTimer[PickupID] = 15;
+		m_Events.Forget(iPickup);
+		m_Grid.Remove(iPickup);
 	}
 }
\ No newline at end of file
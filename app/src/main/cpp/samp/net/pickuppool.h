@@ -1,5 +1,7 @@
 #pragma once
 
+#include "pickupevents.h"
+
 #pragma pack(push, 1)
 typedef struct _PICKUP
 {
@@ -19,6 +21,11 @@ typedef struct _DROPPED_WEAPON
 } DROPPED_WEAPON;
 #pragma pack(pop)
 
+// contact distances of the collection test, the grid is queried with the larger one
+#define PICKUP_CONTACT_RADIUS			0.9f	// from the ped, same as CPickup::Update
+#define PICKUP_VEHICLE_CONTACT_RADIUS	1.0f	// from the vehicle, vehicle-only pickups (type 14), same as CPickup::Update
+#define PICKUP_TYPE_VEHICLE				14
+
 class CPickupPool
 {
 public:
@@ -29,16 +36,20 @@ public:
 
 	void New(PICKUP *pPickup, int iPickup);
 	void Destroy(int iPickup);
-	void PickedUp(int dwGTAId);
+
+	const CPickupEventFilter& GetEvents() const { return m_Events; }
 
 private:
-	int GetIDFromGTAId(int dwGTAId);
+	bool IsInContact(int iPickup, const CVector& vecPed, const CVector* pVehiclePos);
+	void SendPickedUp(int iPickup);
 
 private:
 	int				m_iPickupCount;
 	uintptr_t		m_dwHnd[MAX_PICKUPS];
 	int				m_dwGTAId[MAX_PICKUPS];
-	int				m_iTimer[MAX_PICKUPS];
 	DROPPED_WEAPON	m_droppedWeapon[MAX_PICKUPS];
 	PICKUP			m_Pickups[MAX_PICKUPS];
+
+	CSpatialGrid		m_Grid;
+	CPickupEventFilter	m_Events;
 };
\ No newline at end of file
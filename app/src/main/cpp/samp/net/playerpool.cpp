@@ -3,7 +3,11 @@
 #include "netgame.h"
 #include "playerpool.h"
 
-CPlayerPool::CPlayerPool()
+#include <chrono>
+
+extern CNetGame* pNetGame;
+
+CPlayerPool::CPlayerPool() : m_Grid(MAX_PLAYERS), m_Scheduler(MAX_PLAYERS, PLAYER_LOD_BUDGET)
 {
 	for (PLAYERID playerId = 0; playerId < MAX_PLAYERS; playerId++) {
 		m_bPlayerSlotState[playerId] = false;
@@ -30,10 +34,54 @@ CPlayerPool::~CPlayerPool()
 // 0.3.7
 void CPlayerPool::Process()
 {
+	static CCamera& TheCamera = *reinterpret_cast<CCamera*>(g_libGTASA + (VER_x32 ? 0x00951FA8 : 0xBBA8D0));
+	const CVector& vecCamPos = TheCamera.GetPosition();
+	const CVector& vecCamForward = TheCamera.GetForward();
+
+	CVehicleGTA* pLocalVehicle = nullptr;
+	if (m_pLocalPlayer && m_pLocalPlayer->GetPlayerPed()) {
+		pLocalVehicle = m_pLocalPlayer->GetPlayerPed()->GetGtaVehicle();
+	}
+
+	// far and off-screen players tick less often, the ones sharing our vehicle always
+	m_Scheduler.BeginFrame(GetTickCount());
+	for (PLAYERID playerId = 0; playerId < MAX_PLAYERS; playerId++)
+	{
+		if (m_bPlayerSlotState[playerId] == false) continue;
+
+		CPlayerPed* pPlayerPed = m_pPlayers[playerId]->GetPlayerPed();
+		if (pPlayerPed && pPlayerPed->m_pPed && pPlayerPed->m_pPed->IsAdded()) {
+			const CVector& vecPos = pPlayerPed->m_pPed->GetPosition();
+			bool bForceNear = pLocalVehicle && pPlayerPed->GetGtaVehicle() == pLocalVehicle;
+			m_Scheduler.Classify(playerId, (vecPos - vecCamPos).Magnitude(),
+				CSpatialGrid::IsInViewCone(vecCamPos, vecCamForward, vecPos, 3.0f), bForceNear);
+		}
+		else {
+			// spawning or being removed, that's up to its own logic
+			m_Scheduler.Classify(playerId, 0.0f, true, true);
+		}
+	}
+	m_Scheduler.Schedule();
+
 	for (PLAYERID playerId = 0; playerId < MAX_PLAYERS; playerId++)
 	{
 		if (m_bPlayerSlotState[playerId] == true) {
-			m_pPlayers[playerId]->Process();
+			if (m_Scheduler.IsScheduled(playerId)) {
+				auto start = std::chrono::steady_clock::now();
+				m_pPlayers[playerId]->Process();
+				m_Scheduler.ReportCost(playerId, std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+			}
+			else {
+				m_pPlayers[playerId]->ProcessInterpolation();
+			}
+
+			CPlayerPed* pPlayerPed = m_pPlayers[playerId]->GetPlayerPed();
+			if (pPlayerPed && pPlayerPed->m_pPed && pPlayerPed->m_pPed->IsAdded()) {
+				m_Grid.Update(playerId, pPlayerPed->m_pPed->GetPosition());
+			}
+			else {
+				m_Grid.Remove(playerId);
+			}
 		}
 	}
 
@@ -92,6 +140,11 @@ bool CPlayerPool::Delete(PLAYERID playerId, uint8_t byteReason)
 		m_pLocalPlayer->ToggleSpectating(false);
 	}
 	m_bPlayerSlotState[playerId] = false;
+	m_Grid.Remove(playerId);
+	m_Scheduler.Remove(playerId);
+	if (pNetGame && pNetGame->GetVisibilityService()) {
+		pNetGame->GetVisibilityService()->Forget(LOS_KEY_PLAYER(playerId));
+	}
 
 	if (m_pPlayers[playerId]) {
 		delete m_pPlayers[playerId];
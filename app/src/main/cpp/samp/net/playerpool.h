@@ -1,5 +1,7 @@
 #pragma once
 
+#define PLAYER_LOD_BUDGET		1500.0f		// us of mid and far remote player ticks per frame
+
 class CPlayerPool
 {
 public:
@@ -78,6 +80,10 @@ public:
 	void ApplyCollisionChecking();
 	void ResetCollisionChecking();
 
+	// streamed-in remote peds, refreshed every Process()
+	const CSpatialGrid& GetSpatialGrid() { return m_Grid; }
+	const CUpdateScheduler& GetUpdateScheduler() { return m_Scheduler; }
+
 private:
 	void FindLastPlayerID();
 
@@ -97,4 +103,7 @@ private:
 	char			m_szPlayerNames[MAX_PLAYERS][MAX_PLAYER_NAME+1];
 	int				m_iPlayerScores[MAX_PLAYERS];
 	uint32_t		m_dwPlayerPings[MAX_PLAYERS];
+
+	CSpatialGrid	m_Grid;
+	CUpdateScheduler m_Scheduler;
 };
\ No newline at end of file
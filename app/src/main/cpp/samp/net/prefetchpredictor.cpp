@@ -0,0 +1,219 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// seconds ahead of each predicted point
+static const float g_fPrefetchHorizons[] = { 0.5f, 1.0f, 2.0f, 3.0f };
+
+static float WrapAngle(float fAngle)
+{
+	while (fAngle > M_PI) fAngle -= 2.0f * M_PI;
+	while (fAngle < -M_PI) fAngle += 2.0f * M_PI;
+	return fAngle;
+}
+
+static float Distance(const CVector& a, const CVector& b)
+{
+	float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+	return sqrtf(dx * dx + dy * dy + dz * dz);
+}
+
+CStreamingPredictor::CStreamingPredictor()
+{
+	Reset();
+}
+
+void CStreamingPredictor::Reset()
+{
+	m_bHaveSample = false;
+	m_dwTime = 0;
+	m_vecPos = CVector(0.0f, 0.0f, 0.0f);
+	m_vecVelocity = CVector(0.0f, 0.0f, 0.0f);
+	m_bHaveHeading = false;
+	m_fHeading = 0.0f;
+	m_fTurnRate = 0.0f;
+
+	m_bTeleport = false;
+	m_dwTeleportTime = 0;
+	m_vecTeleport = CVector(0.0f, 0.0f, 0.0f);
+}
+
+float CStreamingPredictor::GetSpeed2D() const
+{
+	return sqrtf(m_vecVelocity.x * m_vecVelocity.x + m_vecVelocity.y * m_vecVelocity.y);
+}
+
+void CStreamingPredictor::AddSample(uint32_t dwTime, const CVector& vecPos)
+{
+	if (m_bTeleport && Distance(vecPos, m_vecTeleport) < PREFETCH_TELEPORT_REACHED) {
+		m_bTeleport = false;
+	}
+
+	if (!m_bHaveSample || Distance(vecPos, m_vecPos) > PREFETCH_TELEPORT_DIST)
+	{
+		// first sample or a teleport, the old motion says nothing about the new place
+		m_bHaveSample = true;
+		m_dwTime = dwTime;
+		m_vecPos = vecPos;
+		m_vecVelocity = CVector(0.0f, 0.0f, 0.0f);
+		m_bHaveHeading = false;
+		m_fTurnRate = 0.0f;
+		return;
+	}
+
+	float dt = (float)(dwTime - m_dwTime) / 1000.0f;
+	if (dt <= 0.0f) return;
+
+	CVector vecVelocity(
+		(vecPos.x - m_vecPos.x) / dt,
+		(vecPos.y - m_vecPos.y) / dt,
+		(vecPos.z - m_vecPos.z) / dt);
+
+	float fAlpha = 1.0f - expf(-dt / PREFETCH_VELOCITY_TAU);
+	m_vecVelocity.x += (vecVelocity.x - m_vecVelocity.x) * fAlpha;
+	m_vecVelocity.y += (vecVelocity.y - m_vecVelocity.y) * fAlpha;
+	m_vecVelocity.z += (vecVelocity.z - m_vecVelocity.z) * fAlpha;
+
+	if (GetSpeed2D() >= PREFETCH_MIN_SPEED)
+	{
+		float fHeading = atan2f(m_vecVelocity.y, m_vecVelocity.x);
+		if (m_bHaveHeading)
+		{
+			float fTurnRate = WrapAngle(fHeading - m_fHeading) / dt;
+			m_fTurnRate += (fTurnRate - m_fTurnRate) * fAlpha;
+			m_fTurnRate = std::clamp(m_fTurnRate, -PREFETCH_MAX_TURN_RATE, PREFETCH_MAX_TURN_RATE);
+		}
+		m_fHeading = fHeading;
+		m_bHaveHeading = true;
+	}
+	else
+	{
+		m_bHaveHeading = false;
+		m_fTurnRate = 0.0f;
+	}
+
+	m_dwTime = dwTime;
+	m_vecPos = vecPos;
+}
+
+void CStreamingPredictor::AddTeleport(uint32_t dwTime, const CVector& vecTarget)
+{
+	m_bTeleport = true;
+	m_dwTeleportTime = dwTime;
+	m_vecTeleport = vecTarget;
+}
+
+int CStreamingPredictor::Predict(uint32_t dwNow, PREFETCH_POINT* pPoints, int iMaxPoints) const
+{
+	int iCount = 0;
+
+	if (m_bTeleport && dwNow - m_dwTeleportTime < PREFETCH_TELEPORT_HOLD && iCount < iMaxPoints)
+	{
+		pPoints[iCount].vecPos = m_vecTeleport;
+		pPoints[iCount].fTime = 0.0f;
+		iCount++;
+	}
+
+	if (!m_bHaveSample || !m_bHaveHeading) return iCount;
+
+	float fSpeed = GetSpeed2D();
+	if (fSpeed < PREFETCH_MIN_SPEED) return iCount;
+
+	for (float fHorizon : g_fPrefetchHorizons)
+	{
+		if (iCount >= iMaxPoints) break;
+
+		// constant speed along an arc of constant turn rate
+		float dx, dy;
+		float fTurn = m_fTurnRate * fHorizon;
+		if (fabsf(m_fTurnRate) > 0.01f)
+		{
+			float r = fSpeed / m_fTurnRate;
+			dx = r * (sinf(m_fHeading + fTurn) - sinf(m_fHeading));
+			dy = -r * (cosf(m_fHeading + fTurn) - cosf(m_fHeading));
+		}
+		else
+		{
+			dx = fSpeed * cosf(m_fHeading) * fHorizon;
+			dy = fSpeed * sinf(m_fHeading) * fHorizon;
+		}
+
+		pPoints[iCount].vecPos = CVector(m_vecPos.x + dx, m_vecPos.y + dy, m_vecPos.z + m_vecVelocity.z * fHorizon);
+		pPoints[iCount].fTime = fHorizon;
+		iCount++;
+	}
+
+	return iCount;
+}
+
+CPrefetchQueue::CPrefetchQueue()
+{
+	m_iPoints = 0;
+	m_fSpeed = 0.0f;
+}
+
+void CPrefetchQueue::Begin(const PREFETCH_POINT* pPoints, int iCount, float fSpeed)
+{
+	m_iPoints = std::min(iCount, PREFETCH_MAX_POINTS);
+	std::copy(pPoints, pPoints + m_iPoints, m_Points);
+	m_fSpeed = std::max(fSpeed, PREFETCH_WALK_SPEED);
+	m_Candidates.clear();
+}
+
+float CPrefetchQueue::GetEta(const CVector& vecPos) const
+{
+	float fBest = -1.0f;
+
+	for (int i = 0; i < m_iPoints; i++)
+	{
+		float fDist = Distance(vecPos, m_Points[i].vecPos);
+		if (fDist > PREFETCH_RADIUS) continue;
+
+		float fEta = m_Points[i].fTime + fDist / m_fSpeed;
+		if (fBest < 0.0f || fEta < fBest) fBest = fEta;
+	}
+
+	return fBest;
+}
+
+void CPrefetchQueue::Consider(int iModel, const CVector& vecPos)
+{
+	float fEta = GetEta(vecPos);
+	if (fEta < 0.0f) return;
+
+	auto it = m_Candidates.find(iModel);
+	if (it == m_Candidates.end()) m_Candidates.emplace(iModel, fEta);
+	else if (fEta < it->second) it->second = fEta;
+}
+
+int CPrefetchQueue::Pop(int* pModels, int iMax)
+{
+	if (iMax <= 0 || m_Candidates.empty()) return 0;
+
+	std::vector<std::pair<float, int>> order;
+	order.reserve(m_Candidates.size());
+	for (auto& candidate : m_Candidates) {
+		order.push_back({ candidate.second, candidate.first });
+	}
+
+	int iCount = std::min(iMax, (int)order.size());
+	std::partial_sort(order.begin(), order.begin() + iCount, order.end());
+
+	for (int i = 0; i < iCount; i++)
+	{
+		pModels[i] = order[i].second;
+		m_Candidates.erase(order[i].second);
+	}
+
+	return iCount;
+}
+
+void CPrefetchQueue::Clear()
+{
+	m_iPoints = 0;
+	m_Candidates.clear();
+}
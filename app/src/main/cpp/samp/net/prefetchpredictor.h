@@ -0,0 +1,81 @@
+#pragma once
+
+#include <unordered_map>
+
+// Where the local player is going to be, so the streamer can start on it early.
+// CStreamingPredictor turns the position trace into a few predicted points along
+// the current path (constant speed and turn rate), plus a pending teleport target.
+// CPrefetchQueue orders candidate models by how soon the player reaches them.
+// Both only see positions and model ids, a recorded trace drives them the same way.
+
+#define PREFETCH_MAX_POINTS			5
+#define PREFETCH_MIN_SPEED			3.0f	// units/s, slower than this there's nothing to predict
+#define PREFETCH_TELEPORT_DIST		50.0f	// a jump longer than this between samples is a teleport
+#define PREFETCH_TELEPORT_HOLD		3000	// ms a teleport target stays a prediction point
+#define PREFETCH_TELEPORT_REACHED	10.0f	// the target is dropped once the player is this close
+#define PREFETCH_VELOCITY_TAU		0.25f	// s, smoothing of velocity and turn rate
+#define PREFETCH_MAX_TURN_RATE		1.5f	// rad/s
+#define PREFETCH_RADIUS				120.0f	// candidates further than this from every point are ignored
+#define PREFETCH_WALK_SPEED			6.0f	// units/s used for the eta of candidates off the path
+
+struct PREFETCH_POINT
+{
+	CVector	vecPos;
+	float	fTime;		// seconds until the player gets there
+};
+
+class CStreamingPredictor
+{
+public:
+	CStreamingPredictor();
+
+	void Reset();
+
+	void AddSample(uint32_t dwTime, const CVector& vecPos);
+	// a position the server is about to move the player to
+	void AddTeleport(uint32_t dwTime, const CVector& vecTarget);
+
+	int Predict(uint32_t dwNow, PREFETCH_POINT* pPoints, int iMaxPoints) const;
+
+	const CVector& GetVelocity() const { return m_vecVelocity; }
+	float GetSpeed2D() const;
+	float GetTurnRate() const { return m_fTurnRate; }
+
+private:
+	bool		m_bHaveSample;
+	uint32_t	m_dwTime;
+	CVector		m_vecPos;
+	CVector		m_vecVelocity;	// units/s
+	bool		m_bHaveHeading;
+	float		m_fHeading;		// rad, of the horizontal velocity
+	float		m_fTurnRate;	// rad/s
+
+	bool		m_bTeleport;
+	uint32_t	m_dwTeleportTime;
+	CVector		m_vecTeleport;
+};
+
+class CPrefetchQueue
+{
+public:
+	CPrefetchQueue();
+
+	// starts a new scan against the given points, drops the previous candidates
+	void Begin(const PREFETCH_POINT* pPoints, int iCount, float fSpeed);
+	// keeps the smallest eta per model
+	void Consider(int iModel, const CVector& vecPos);
+	// the iMax most urgent models, removed from the queue
+	int Pop(int* pModels, int iMax);
+
+	void Clear();
+	int GetCount() const { return (int)m_Candidates.size(); }
+
+	// seconds until the player is at vecPos, negative if it is off every predicted point
+	float GetEta(const CVector& vecPos) const;
+
+private:
+	PREFETCH_POINT					m_Points[PREFETCH_MAX_POINTS];
+	int								m_iPoints;
+	float							m_fSpeed;
+	std::unordered_map<int, float>	m_Candidates;
+};
@@ -0,0 +1,113 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "../game/Streaming.h"
+#include "netgame.h"
+
+#include <algorithm>
+
+extern CNetGame* pNetGame;
+
+CPrefetchService::CPrefetchService()
+{
+	m_dwLastScan = 0;
+}
+
+CPrefetchService::~CPrefetchService()
+{
+	CStreaming::GetModelRequests().CancelOwner(this);
+}
+
+void CPrefetchService::Clear()
+{
+	CStreaming::GetModelRequests().CancelOwner(this);
+	m_Requests.clear();
+	m_Predictor.Reset();
+	m_Queue.Clear();
+	m_dwLastScan = 0;
+}
+
+void CPrefetchService::Process(uint32_t dwNow, const CVector& vecPlayerPos)
+{
+	m_Predictor.AddSample(dwNow, vecPlayerPos);
+
+	if (dwNow - m_dwLastScan >= PREFETCH_SCAN_INTERVAL)
+	{
+		m_dwLastScan = dwNow;
+
+		PREFETCH_POINT points[PREFETCH_MAX_POINTS];
+		int iCount = m_Predictor.Predict(dwNow, points, PREFETCH_MAX_POINTS);
+
+		if (iCount > 0) Scan(points, iCount);
+		else m_Queue.Clear();
+	}
+
+	Issue();
+}
+
+void CPrefetchService::NotifyTeleport(uint32_t dwNow, const CVector& vecTarget)
+{
+	m_Predictor.AddTeleport(dwNow, vecTarget);
+
+	PREFETCH_POINT point = { vecTarget, 0.0f };
+	Scan(&point, 1);
+	Issue();
+}
+
+void CPrefetchService::Scan(const PREFETCH_POINT* pPoints, int iCount)
+{
+	m_Queue.Begin(pPoints, iCount, m_Predictor.GetSpeed2D());
+
+	// map models: the same sector request the game does around the camera
+	for (int i = 0; i < iCount; i++) {
+		CStreaming::AddModelsToRequestList(&pPoints[i].vecPos, 0);
+	}
+
+	if (!pNetGame) return;
+
+	CObjectPool* pObjectPool = pNetGame->GetObjectPool();
+	if (pObjectPool)
+	{
+		for (OBJECTID i = 0; i < MAX_OBJECTS; i++)
+		{
+			CObject* pObject = pObjectPool->GetAt(i);
+			if (!pObject || !pObject->m_pEntity) continue;
+
+			int iModel = pObject->m_pEntity->m_nModelIndex;
+			if (CStreaming::GetInfo(iModel).IsLoaded()) continue;
+
+			m_Queue.Consider(iModel, pObject->m_pEntity->GetPosition());
+		}
+	}
+
+	// vehicles ahead that are still waiting for their model go first
+	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
+	if (pVehiclePool)
+	{
+		for (VEHICLEID i = 0; i < MAX_VEHICLES; i++)
+		{
+			MODELREQUEST hRequest = pVehiclePool->GetPendingRequest(i);
+			if (hRequest == INVALID_MODEL_REQUEST) continue;
+
+			if (m_Queue.GetEta(pVehiclePool->GetPendingPos(i)) >= 0.0f) {
+				CStreaming::GetModelRequests().Promote(hRequest, MODEL_PRIORITY_HIGH);
+			}
+		}
+	}
+}
+
+void CPrefetchService::Issue()
+{
+	CModelRequests& requests = CStreaming::GetModelRequests();
+
+	m_Requests.erase(std::remove_if(m_Requests.begin(), m_Requests.end(), [&](MODELREQUEST hRequest) {
+		return requests.GetState(hRequest) != MODEL_REQUEST_PENDING;
+	}), m_Requests.end());
+
+	int iModels[PREFETCH_MAX_IN_FLIGHT];
+	int iCount = m_Queue.Pop(iModels, PREFETCH_MAX_IN_FLIGHT - (int)m_Requests.size());
+
+	// low priority: whatever the game itself is waiting for keeps the budget
+	for (int i = 0; i < iCount; i++) {
+		m_Requests.push_back(requests.Request(iModels[i], MODEL_PRIORITY_LOW, nullptr, this));
+	}
+}
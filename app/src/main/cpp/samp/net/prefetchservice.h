@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+#include "prefetchpredictor.h"
+
+// Feeds the streamer ahead of the local player: map sectors around the predicted
+// points, SA-MP objects near them whose models aren't resident, and vehicles still
+// waiting for their model there get to the front of the model queue.
+
+#define PREFETCH_SCAN_INTERVAL		250		// ms between candidate scans
+#define PREFETCH_MAX_IN_FLIGHT		8		// low priority requests outstanding at once
+
+class CPrefetchService
+{
+public:
+	CPrefetchService();
+	~CPrefetchService();
+
+	// once per frame from CStreaming::Update
+	void Process(uint32_t dwNow, const CVector& vecPlayerPos);
+	// from the SetPlayerPos RPCs, streams around the target right away
+	void NotifyTeleport(uint32_t dwNow, const CVector& vecTarget);
+	void Clear();
+
+	const CStreamingPredictor& GetPredictor() const { return m_Predictor; }
+	int GetInFlight() const { return (int)m_Requests.size(); }
+
+private:
+	void Scan(const PREFETCH_POINT* pPoints, int iCount);
+	void Issue();
+
+	CStreamingPredictor			m_Predictor;
+	CPrefetchQueue				m_Queue;
+	std::vector<MODELREQUEST>	m_Requests;
+	uint32_t					m_dwLastScan;
+};
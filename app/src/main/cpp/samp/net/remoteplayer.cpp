@@ -182,6 +182,9 @@ void CRemotePlayer::Process()
 		}
 
 		// ------ PROCESSED FOR ALL FRAMES ----- 
+		if (m_AimInterp.IsInterpolating())
+			UpdateAim();
+
 		if (GetState() == PLAYER_STATE_ONFOOT && !m_pPlayerPed->IsInVehicle())
 		{
 			InterpolateAndRotate();
@@ -197,7 +200,7 @@ void CRemotePlayer::Process()
 
                 m_ofSync.byteCurrentWeapon = m_byteWeaponShotID;
                 m_pPlayerPed->SetCurrentWeapon(m_byteWeaponShotID);
-                //ScriptCommand(&task_shoot_at_coord, m_pPlayerPed->m_dwGTAId, localMat.pos.x, localMat.pos.y, localMat.pos.z, 10);
+                //ScriptCommand<task_shoot_at_coord>(m_pPlayerPed->m_dwGTAId, localMat.pos.x, localMat.pos.y, localMat.pos.z, 10);
                 m_pPlayerPed->SetCurrentAim(pGame->FindPlayerPed()->GetCurrentAim());
                 m_pPlayerPed->SetKeys(m_ofSync.lrAnalog, m_ofSync.udAnalog, (uint16_t)4);
 
@@ -348,6 +351,28 @@ void CRemotePlayer::Process()
 		}
 	}
 }
+void CRemotePlayer::ProcessInterpolation()
+{
+	if (!IsActive()) return;
+
+	if (GetState() == PLAYER_STATE_ONFOOT && !m_pPlayerPed->IsInVehicle())
+	{
+		InterpolateAndRotate();
+	}
+	else if (GetState() == PLAYER_STATE_DRIVER && m_pPlayerPed->IsInVehicle())
+	{
+		if (m_pCurrentVehicle && GamePool_Vehicle_GetAt(m_pCurrentVehicle->m_dwGTAId) &&
+			m_pCurrentVehicle->m_pVehicle->GetModelId() != 538 &&
+			m_pCurrentVehicle->m_pVehicle->GetModelId() != 537 &&
+			m_pCurrentVehicle->m_pVehicle->GetModelId() != 449)
+		{
+			UpdateVehicleRotation();
+		}
+	}
+
+	if (m_AimInterp.IsInterpolating())
+		UpdateAim();
+}
 // 0.3.7
 void CRemotePlayer::InterpolateAndRotate()
 {
@@ -472,6 +497,8 @@ void CRemotePlayer::ResetAllSyncAttributes()
 	memset(&m_ofSync, 0, sizeof(ONFOOT_SYNC_DATA));
 	memset(&m_icSync, 0, sizeof(INCAR_SYNC_DATA));
 	memset(&m_psSync, 0, sizeof(PASSENGER_SYNC_DATA));
+	memset(&m_aimSync, 0, sizeof(AIM_SYNC_DATA));
+	m_AimInterp.Reset();
 	// memset(&field_8E
 	// memset(&field_1D5
 
@@ -633,7 +660,7 @@ void CRemotePlayer::StoreInCarFullSyncData(INCAR_SYNC_DATA* picSync, uint32_t dw
 
         if(!m_pPlayerPed->m_pPed->IsInVehicle())
         {
-            ScriptCommand(&put_actor_in_car, m_pPlayerPed->m_dwGTAId, m_pCurrentVehicle->m_dwGTAId);
+            ScriptCommand<put_actor_in_car>(m_pPlayerPed->m_dwGTAId, m_pCurrentVehicle->m_dwGTAId);
         }
         if (m_pPlayerPed->GetCurrentVehicle() != m_pCurrentVehicle) {
             m_pPlayerPed->RemoveFromVehicleAndPutAt(picSync->vecPos.x, picSync->vecPos.y, picSync->vecPos.z);
@@ -657,12 +684,44 @@ float DecompressAspectRatio(char v)
 void CRemotePlayer::StoreAimFullSyncData(AIM_SYNC_DATA* paimSync)
 {
 	if (!m_pPlayerPed) return;
+
+	// a new camera mode is taken as is, within one the aim turns to the sample
+	bool bSnap = paimSync->byteCamMode != m_aimSync.byteCamMode;
 	m_pPlayerPed->SetCameraMode(paimSync->byteCamMode);
+	memcpy(&m_aimSync, paimSync, sizeof(AIM_SYNC_DATA));
+
+	AIM_SAMPLE aim;
+	aim.vecAimf = paimSync->vecAimf;
+	aim.vecAimPos = paimSync->vecAimPos;
+	aim.fAimZ = paimSync->fAimZ;
+	m_AimInterp.Push(GetTickCount(), aim, bSnap);
+	UpdateAim();
+
+	float fExtZoom = DecompressCameraExtZoom(paimSync->byteCamExtZoom);
+	float fAspect = DecompressAspectRatio(paimSync->aspect_ratio);
+
+	m_pPlayerPed->SetCameraZoomAndAspect(fExtZoom, fAspect);
+
+    CWeapon* pwstWeapon = m_pPlayerPed->GetCurrentWeaponSlot();
+	if (paimSync->byteWeaponState == WEAPONSTATE_RELOADING)
+		pwstWeapon->dwState = (eWeaponState)2;		// Reloading
+	else
+		if (paimSync->byteWeaponState != WEAPONSTATE_FIRING)
+			pwstWeapon->dwAmmoInClip = (uint32_t)paimSync->byteWeaponState;
+		else
+			if (pwstWeapon->dwAmmoInClip < 2)
+				pwstWeapon->dwAmmoInClip = 2;
+}
+
+void CRemotePlayer::UpdateAim()
+{
+	AIM_SAMPLE aim;
+	m_AimInterp.Get(GetTickCount(), aim);
 
 	CAMERA_AIM Aim;
-	Aim.f1x = paimSync->vecAimf.x;
-	Aim.f1y = paimSync->vecAimf.y;
-	Aim.f1z = paimSync->vecAimf.z;
+	Aim.f1x = aim.vecAimf.x;
+	Aim.f1y = aim.vecAimf.y;
+	Aim.f1z = aim.vecAimf.z;
 
 	CVector vec1, vec2;
 	vec1.x = Aim.f1x;
@@ -676,30 +735,15 @@ void CRemotePlayer::StoreAimFullSyncData(AIM_SYNC_DATA* paimSync)
 	Aim.f2y = vec2.y;
 	Aim.f2z = vec2.z;
 
-	Aim.pos1x = paimSync->vecAimPos.x;
-	Aim.pos1y = paimSync->vecAimPos.y;
-	Aim.pos1z = paimSync->vecAimPos.z;
+	Aim.pos1x = aim.vecAimPos.x;
+	Aim.pos1y = aim.vecAimPos.y;
+	Aim.pos1z = aim.vecAimPos.z;
 	Aim.pos2x = Aim.pos1x;
 	Aim.pos2y = Aim.pos1y;
 	Aim.pos2z = Aim.pos1z;
 	m_pPlayerPed->SetCurrentAim(&Aim);
 
-	m_pPlayerPed->SetAimZ(paimSync->fAimZ);
-
-	float fExtZoom = DecompressCameraExtZoom(paimSync->byteCamExtZoom);
-	float fAspect = DecompressAspectRatio(paimSync->aspect_ratio);
-
-	m_pPlayerPed->SetCameraZoomAndAspect(fExtZoom, fAspect);
-
-    CWeapon* pwstWeapon = m_pPlayerPed->GetCurrentWeaponSlot();
-	if (paimSync->byteWeaponState == WEAPONSTATE_RELOADING)
-		pwstWeapon->dwState = (eWeaponState)2;		// Reloading
-	else
-		if (paimSync->byteWeaponState != WEAPONSTATE_FIRING)
-			pwstWeapon->dwAmmoInClip = (uint32_t)paimSync->byteWeaponState;
-		else
-			if (pwstWeapon->dwAmmoInClip < 2)
-				pwstWeapon->dwAmmoInClip = 2;
+	m_pPlayerPed->SetAimZ(aim.fAimZ);
 }
 // 0.3.7
 void CRemotePlayer::StorePassengerFullSyncData(PASSENGER_SYNC_DATA* psSync)
@@ -730,7 +774,7 @@ void CRemotePlayer::StorePassengerFullSyncData(PASSENGER_SYNC_DATA* psSync)
 
     if(!m_pPlayerPed->m_pPed->IsInVehicle()){
         m_byteSeatID--;
-        ScriptCommand(&put_actor_in_car2, m_pPlayerPed->m_dwGTAId, m_pCurrentVehicle->m_dwGTAId, m_byteSeatID);
+        ScriptCommand<put_actor_in_car2>(m_pPlayerPed->m_dwGTAId, m_pCurrentVehicle->m_dwGTAId, m_byteSeatID);
 //		m_byteSeatID = CCarEnterExit::ComputeTargetDoorToEnterAsPassenger(m_pCurrentVehicle->m_pVehicle, m_byteSeatID);
 //		CCarEnterExit::SetPedInCarDirect(m_pPlayerPed->m_pPed, m_pCurrentVehicle->m_pVehicle, m_byteSeatID);
     }
@@ -1250,65 +1294,12 @@ void CRemotePlayer::StoreUnoccupiedSyncData(UNOCCUPIED_SYNC_DATA *unocSync)
 	VEHICLEID UnocID = unocSync->vehicleId;
 	if (!UnocID || UnocID == INVALID_VEHICLE_ID) return;
 
+	// the vehicle pool blends it in over the next frames
 	CVehiclePool *pVehiclePool = pNetGame->GetVehiclePool();
-	CVehicle *pVehicle = NULL;
 	if (pVehiclePool) {
-		pVehicle = pVehiclePool->GetAt(UnocID);
+		pVehiclePool->StoreUnoccupiedSync(unocSync);
 		//pVehiclePool->SetLastUndrivenID(UnocID, m_PlayerID);
 	}
-
-	if(pVehicle && !pVehicle->HasADriver())
-	{
-		RwMatrix matWorld = pVehicle->m_pVehicle->GetMatrix().ToRwMatrix();
-
-		DecompressNormalVector(&matWorld.up, unocSync->vecDirection);
-		DecompressNormalVector(&matWorld.right, unocSync->vecRoll);
-
-		// if we're pretty already there.. no translation.
-		if( (FloatOffset(unocSync->vecPos.x,matWorld.pos.x) <= 0.1f) &&
-			(FloatOffset(unocSync->vecPos.y,matWorld.pos.y) <= 0.1f) &&
-			(FloatOffset(unocSync->vecPos.z,matWorld.pos.z) <= 0.1f) )
-		{
-			return;
-		}
-
-		// if difference is over 8 units, direct translation
-		if( !pVehicle->m_pVehicle->IsAdded() ||
-			(FloatOffset(unocSync->vecPos.x,matWorld.pos.x) > 8.0f) ||
-			(FloatOffset(unocSync->vecPos.y,matWorld.pos.y) > 8.0f) ||
-			(FloatOffset(unocSync->vecPos.z,matWorld.pos.z) > 8.0f) ) {
-
-			matWorld.pos.x = unocSync->vecPos.x;
-			matWorld.pos.y = unocSync->vecPos.y;
-			matWorld.pos.z = unocSync->vecPos.z;
-
-			pVehicle->m_pVehicle->SetMatrix((CMatrix&)matWorld);
-			pVehicle->m_pVehicle->SetVelocity(unocSync->vecMoveSpeed);
-			pVehicle->m_pVehicle->SetTurnSpeed(unocSync->vecTurnSpeed);
-			return;
-		}
-
-		// gradually increase/decrease velocities towards the target
-		pVehicle->m_pVehicle->SetMatrix((CMatrix&)matWorld);							// rotation
-		pVehicle->m_pVehicle->SetVelocity(unocSync->vecMoveSpeed);	// move velocity
-		pVehicle->m_pVehicle->SetTurnSpeed(unocSync->vecTurnSpeed);	// turn velocity
-
-		CVector vec = {0.0f, 0.0f, 0.0f};
-        vec = pVehicle->m_pVehicle->GetMoveSpeed();
-
-		if( FloatOffset(unocSync->vecPos.x,matWorld.pos.x) > 0.05 ) {
-			vec.x += (unocSync->vecPos.x - matWorld.pos.x) * 0.05f;
-		}
-		if( FloatOffset(unocSync->vecPos.y,matWorld.pos.y) > 0.05 ) {
-			vec.y += (unocSync->vecPos.y - matWorld.pos.y) * 0.05f;
-		}
-		if( FloatOffset(unocSync->vecPos.z,matWorld.pos.z) > 0.05 ) {
-			vec.z += (unocSync->vecPos.z - matWorld.pos.z) * 0.05f;
-		}
-
-		pVehicle->m_pVehicle->SetVelocity(vec);
-		//pVehicle->m_bRemoteUnocSync = true;
-	}
 	/*VEHICLEID vehicleId = unocSync->vehicleId;
 	if(vehicleId < 0 || vehicleId >= MAX_VEHICLES)
 		return;
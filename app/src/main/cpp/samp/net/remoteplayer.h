@@ -49,6 +49,8 @@ public:
 	uint32_t GetPlayerColor();
 
 	void Process();
+	// the frames a far player's logic doesn't tick, keeps its motion smooth
+	void ProcessInterpolation();
 	bool Spawn(uint8_t byteTeam, int iSkin, CVector* vecPos, float fRotation,
 		uint32_t dwColor, uint8_t byteFightingStyle);
 	void Remove();
@@ -64,6 +66,7 @@ public:
 	void StoreOnFootFullSyncData(ONFOOT_SYNC_DATA *ofSync, uint32_t dwTime);
 	void StoreInCarFullSyncData(INCAR_SYNC_DATA* picSync, uint32_t dwTime);
 	void StoreAimFullSyncData(AIM_SYNC_DATA* aimSync);
+	void UpdateAim();
 	void StorePassengerFullSyncData(PASSENGER_SYNC_DATA* psSync);
 	void StoreBulletFullSyncData(BULLET_SYNC_DATA* btSync);
 	void StoreTrailerFullSyncData(TRAILER_SYNC_DATA *trSync);
@@ -143,6 +146,8 @@ private:
 	ONFOOT_SYNC_DATA		m_ofSync;
 	INCAR_SYNC_DATA			m_icSync;
 	PASSENGER_SYNC_DATA		m_psSync;
+	AIM_SYNC_DATA			m_aimSync;
+	CAimInterpolator		m_AimInterp;
 
 
 	uint32_t		m_dwLastRecvTick;
@@ -790,10 +790,9 @@ void ScrSetVehicleHealth(RPCParameters* rpcParams)
 	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
 	if (pVehiclePool)
 	{
-		CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-		if (pVehicle) {
+		pVehiclePool->Apply(VehicleID, [fHealth](CVehicle* pVehicle) {
 			pVehicle->SetHealth(fHealth);
-		}
+		});
 	}
 }
 // 0.3.7
@@ -904,7 +903,7 @@ void ScrCreateExplosion(RPCParameters* rpcParams)
 	bsData.Read(dwType);
 	bsData.Read(fRadius);
 
-	ScriptCommand(&create_explosion_with_radius, fX, fY, fZ, dwType, fRadius);
+	ScriptCommand<create_explosion_with_radius>(fX, fY, fZ, dwType, fRadius);
 }
 // 0.3.7
 void ScrSetVehicleNumberPlate(RPCParameters* rpcParams)
@@ -926,10 +925,10 @@ void ScrSetVehicleNumberPlate(RPCParameters* rpcParams)
 	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
 	if (!pVehiclePool) return;
 
-	CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-	if (!pVehicle) return;
-
-	pVehicle->SetPlateText(szPlateName);
+	std::string strPlate(szPlateName);
+	pVehiclePool->Apply(VehicleID, [strPlate](CVehicle* pVehicle) {
+		pVehicle->SetPlateText(strPlate.c_str());
+	});
 }
 
 #define SPECTATE_TYPE_NORMAL	1
@@ -1007,10 +1006,9 @@ void ScrRemoveVehicleComponent(RPCParameters* rpcParams)
 	bsData.Read(VehicleID);
 	bsData.Read(wComponent);
 
-	CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-	if (!pVehicle) return;
-
-	pVehicle->RemoveComponent(wComponent);
+	pVehiclePool->Apply(VehicleID, [wComponent](CVehicle* pVehicle) {
+		pVehicle->RemoveComponent(wComponent);
+	});
 }
 // 0.3.7
 void ScrAttachObjectToPlayer(RPCParameters* rpcParams)
@@ -1043,8 +1041,7 @@ void ScrAttachObjectToPlayer(RPCParameters* rpcParams)
 	if (pPlayerPool->GetLocalPlayerID() == PlayerID)
 	{
 		CLocalPlayer* pLocalPlayer = pPlayerPool->GetLocalPlayer();
-		ScriptCommand(&attach_object_to_actor,
-			pObject->m_dwGTAId,
+		ScriptCommand<attach_object_to_actor>(pObject->m_dwGTAId,
 			pLocalPlayer->GetPlayerPed()->m_dwGTAId,
 			offsetX, offsetY, offsetZ,
 			rX, rY, rZ);
@@ -1052,8 +1049,7 @@ void ScrAttachObjectToPlayer(RPCParameters* rpcParams)
 	else
 	{
 		CRemotePlayer* pRemotePlayer = pPlayerPool->GetAt(PlayerID);
-		ScriptCommand(&attach_object_to_actor,
-			pObject->m_dwGTAId,
+		ScriptCommand<attach_object_to_actor>(pObject->m_dwGTAId,
 			pRemotePlayer->GetPlayerPed()->m_dwGTAId,
 			offsetX, offsetY, offsetZ,
 			rX, rY, rZ);
@@ -1202,7 +1198,7 @@ void ScrToggleWidescreen(RPCParameters* rpcParams)
 	RakNet::BitStream bsData(Data, (iBitLength / 8) + 1, false);
 	bsData.Read(byteToggle);
 	//if (gui) gui->chat()->addDebugMessage("Widescreen = %d", byteToggle);
-	ScriptCommand(&toggle_widescreen, byteToggle);
+	ScriptCommand<toggle_widescreen>(byteToggle);
 }
 // 0.3.7
 void ScrSetVehicleTireDamageStatus(RPCParameters* rpcParams)
@@ -1219,10 +1215,9 @@ void ScrSetVehicleTireDamageStatus(RPCParameters* rpcParams)
 	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
 	if (!pVehiclePool) return;
 
-	CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-	if (!pVehicle) return;
-
-	pVehicle->SetTireDamageStatus(byteTireDamageStatus);
+	pVehiclePool->Apply(VehicleID, [byteTireDamageStatus](CVehicle* pVehicle) {
+		pVehicle->SetTireDamageStatus(byteTireDamageStatus);
+	});
 }
 // 0.3.7
 void ScrSetPlayerTeam(RPCParameters* rpcParams)
@@ -1301,6 +1296,10 @@ void ScrSetPlayerPos(RPCParameters* rpcParams)
 	CLocalPlayer* pLocalPlayer = pPlayerPool->GetLocalPlayer();
 	if (!pLocalPlayer) return;
 
+	if (pNetGame->GetPrefetchService()) {
+		pNetGame->GetPrefetchService()->NotifyTeleport(CTimer::m_snTimeInMillisecondsNonClipped, vecPos);
+	}
+
     pLocalPlayer->DisableSurf();
 
     if(pLocalPlayer->GetPlayerPed()->m_pPed->IsInVehicle())
@@ -1327,6 +1326,9 @@ void ScrSetPlayerPosFindZ(RPCParameters* rpcParams)
 	if (!pLocalPlayer) return;
 
 	vecPos.z = pGame->FindGroundZForCoord(vecPos.x, vecPos.y, vecPos.z) + 1.5f;
+	if (pNetGame->GetPrefetchService()) {
+		pNetGame->GetPrefetchService()->NotifyTeleport(CTimer::m_snTimeInMillisecondsNonClipped, vecPos);
+	}
     pLocalPlayer->DisableSurf();
 	pLocalPlayer->GetPlayerPed()->m_pPed->SetPosn(vecPos.x, vecPos.y, vecPos.z);
 }
@@ -1345,26 +1347,27 @@ void ScrPutPlayerInVehicle(RPCParameters* rpcParams)
 	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
 	if (!pVehiclePool) return;
 
-    CPlayerPed *pPed = pGame->FindPlayerPed();
-    if(!pPed)return;
+    // a vehicle that's still loading takes the player once it's there
+    pVehiclePool->Apply(VehicleID, [byteSeatID](CVehicle* pVehicle) mutable {
+        CPlayerPed *pPed = pGame->FindPlayerPed();
+        if(!pPed)return;
 
-    //if(vehicleid == pPed->GetCurrentSampVehicleID()) return;
+        //if(vehicleid == pPed->GetCurrentSampVehicleID()) return;
 
-    if(pPed->m_pPed->IsInVehicle()) {
-        pPed->m_pPed->RemoveFromVehicle();
-    }
-    CVehicle *pVehicle = pVehiclePool->GetAt(VehicleID);
-    if(!pVehicle)return;
-    //   DLOG("seatid = %d", vehicleid);
-    if(byteSeatID == 0) {
-        ScriptCommand(&put_actor_in_car, pPed->m_dwGTAId, pVehicle->m_dwGTAId);
-        //	CCarEnterExit::SetPedInCarDirect(pPed->m_pPed, pVehicle->m_pVehicle, 0, true);
-    } else {
-        byteSeatID --;
-        ScriptCommand(&put_actor_in_car2, pPed->m_dwGTAId, pVehicle->m_dwGTAId, byteSeatID);
+        if(pPed->m_pPed->IsInVehicle()) {
+            pPed->m_pPed->RemoveFromVehicle();
+        }
+        //   DLOG("seatid = %d", vehicleid);
+        if(byteSeatID == 0) {
+            ScriptCommand<put_actor_in_car>(pPed->m_dwGTAId, pVehicle->m_dwGTAId);
+            //	CCarEnterExit::SetPedInCarDirect(pPed->m_pPed, pVehicle->m_pVehicle, 0, true);
+        } else {
+            byteSeatID --;
+            ScriptCommand<put_actor_in_car2>(pPed->m_dwGTAId, pVehicle->m_dwGTAId, byteSeatID);
 //		seatid = CCarEnterExit::ComputeTargetDoorToEnterAsPassenger(pVehicle->m_pVehicle, seatid);
 //		CCarEnterExit::SetPedInCarDirect(pPed->m_pPed, pVehicle->m_pVehicle, seatid);
-    }
+        }
+    });
 }
 // 0.3.7
 void ScrRemovePlayerFromVehicle(RPCParameters* rpcParams)
@@ -1449,10 +1452,9 @@ void ScrSetVehiclePos(RPCParameters* rpcParams)
 	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
 	if (!pVehiclePool) return;
 
-	CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-	if (!pVehicle) return;
-
-	pVehicle->m_pVehicle->SetPosn(fX, fY, fZ);
+	pVehiclePool->Apply(VehicleID, [fX, fY, fZ](CVehicle* pVehicle) {
+		pVehicle->m_pVehicle->SetPosn(fX, fY, fZ);
+	});
 }
 // 0.3.7
 void ScrSetVehicleZAngle(RPCParameters* rpcParams)
@@ -1469,10 +1471,9 @@ void ScrSetVehicleZAngle(RPCParameters* rpcParams)
 	CVehiclePool* pVehiclePool = pNetGame->GetVehiclePool();
 	if (!pVehiclePool) return;
 
-	CVehicle* pVehicle = pVehiclePool->GetAt(VehicleID);
-	if (!pVehicle) return;
-
-	pVehicle->SetZAngle(fAngle);
+	pVehiclePool->Apply(VehicleID, [fAngle](CVehicle* pVehicle) {
+		pVehicle->SetZAngle(fAngle);
+	});
 }
 // 0.3.7
 void ScrSetVehicleParams(RPCParameters* rpcParams)
@@ -1764,10 +1765,10 @@ void ScrApplyActorAnimation(RPCParameters* rpcParams)
 	szAnimLib[byteAnimLibLen] = '\0';
 	szAnimName[byteAnimNameLen] = '\0';
 
-	CActor* pActor = pActorPool->GetAt(ActorID);
-	if (pActor) {
-		pActor->ApplyAnimation(szAnimName, szAnimLib, fDelta, bLoop, bLockX, bLockY, bFreeze, iTime);
-	}
+	std::string strAnimName(szAnimName), strAnimLib(szAnimLib);
+	pActorPool->Apply(ActorID, [=](CActor* pActor) {
+		pActor->ApplyAnimation(strAnimName.c_str(), strAnimLib.c_str(), fDelta, bLoop, bLockX, bLockY, bFreeze, iTime);
+	});
 }
 // 0.3.7
 void ScrClearActorAnimation(RPCParameters* rpcParams)
@@ -1782,10 +1783,9 @@ void ScrClearActorAnimation(RPCParameters* rpcParams)
 	RakNet::BitStream bsData(Data, (iBitLength / 8) + 1, false);
 	bsData.Read(ActorID);
 
-	CActor* pActor = pActorPool->GetAt(ActorID);
-	if (pActor) {
+	pActorPool->Apply(ActorID, [](CActor* pActor) {
 		pActor->ClearAnimation();
-	}
+	});
 }
 // 0.3.7
 void ScrSetActorFacingAngle(RPCParameters* rpcParams)
@@ -1802,10 +1802,9 @@ void ScrSetActorFacingAngle(RPCParameters* rpcParams)
 	bsData.Read(ActorID);
 	bsData.Read(fAngle);
 
-	CActor* pActor = pActorPool->GetAt(ActorID);
-	if (pActor) {
+	pActorPool->Apply(ActorID, [fAngle](CActor* pActor) {
 		pActor->SetFacingAngle(fAngle);
-	}
+	});
 }
 // 0.3.7
 void ScrSetActorPos(RPCParameters* rpcParams)
@@ -1824,10 +1823,9 @@ void ScrSetActorPos(RPCParameters* rpcParams)
 	bsData.Read(vecPos.y);
 	bsData.Read(vecPos.z);
 
-	CActor* pActor = pActorPool->GetAt(ActorID);
-	if (pActor) {
+	pActorPool->Apply(ActorID, [vecPos](CActor* pActor) {
 		pActor->m_pPed->SetPosn(vecPos.x, vecPos.y, vecPos.z);
-	}
+	});
 }
 // 0.3.7
 void ScrSetActorHealth(RPCParameters* rpcParams)
@@ -1844,10 +1842,9 @@ void ScrSetActorHealth(RPCParameters* rpcParams)
 	bsData.Read(ActorID);
 	bsData.Read(fHealth);
 
-	CActor* pActor = pActorPool->GetAt(ActorID);
-	if (pActor) {
+	pActorPool->Apply(ActorID, [fHealth](CActor* pActor) {
 		pActor->SetHealth(fHealth);
-	}
+	});
 }
 
 void ScrPlayAudioStream(RPCParameters* rpcParams)
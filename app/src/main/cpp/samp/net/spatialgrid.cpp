@@ -0,0 +1,220 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+
+CSpatialGrid::CSpatialGrid(int iCapacity)
+{
+	m_iCapacity = iCapacity;
+	m_pCell = new int[iCapacity];
+	m_pNext = new int[iCapacity];
+	m_pPrev = new int[iCapacity];
+	m_pRadius = new float[iCapacity];
+	m_pPos = new CVector[iCapacity];
+
+	Clear();
+}
+
+CSpatialGrid::~CSpatialGrid()
+{
+	delete[] m_pCell;
+	delete[] m_pNext;
+	delete[] m_pPrev;
+	delete[] m_pRadius;
+	delete[] m_pPos;
+}
+
+void CSpatialGrid::Clear()
+{
+	for (int i = 0; i < SPATIAL_GRID_DIM * SPATIAL_GRID_DIM; i++) {
+		m_iCellHead[i] = SPATIAL_GRID_INVALID;
+	}
+
+	for (int i = 0; i < m_iCapacity; i++) {
+		m_pCell[i] = SPATIAL_GRID_INVALID;
+		m_pNext[i] = SPATIAL_GRID_INVALID;
+		m_pPrev[i] = SPATIAL_GRID_INVALID;
+		m_pRadius[i] = 0.0f;
+	}
+
+	m_iCount = 0;
+	m_fMaxRadius = 0.0f;
+	m_iMaxRadiusCount = 0;
+}
+
+int CSpatialGrid::GetCellCoord(float fCoord)
+{
+	int iCoord = (int)((fCoord - SPATIAL_GRID_WORLD_MIN) / SPATIAL_GRID_CELL_SIZE);
+
+	// anything outside the map lands in the border cells
+	if (iCoord < 0) return 0;
+	if (iCoord >= SPATIAL_GRID_DIM) return SPATIAL_GRID_DIM - 1;
+	return iCoord;
+}
+
+void CSpatialGrid::Link(int iSlot, int iCell)
+{
+	m_pCell[iSlot] = iCell;
+	m_pPrev[iSlot] = SPATIAL_GRID_INVALID;
+	m_pNext[iSlot] = m_iCellHead[iCell];
+
+	if (m_iCellHead[iCell] != SPATIAL_GRID_INVALID) {
+		m_pPrev[m_iCellHead[iCell]] = iSlot;
+	}
+
+	m_iCellHead[iCell] = iSlot;
+}
+
+void CSpatialGrid::Unlink(int iSlot)
+{
+	int iCell = m_pCell[iSlot];
+
+	if (m_pPrev[iSlot] != SPATIAL_GRID_INVALID) {
+		m_pNext[m_pPrev[iSlot]] = m_pNext[iSlot];
+	}
+	else {
+		m_iCellHead[iCell] = m_pNext[iSlot];
+	}
+
+	if (m_pNext[iSlot] != SPATIAL_GRID_INVALID) {
+		m_pPrev[m_pNext[iSlot]] = m_pPrev[iSlot];
+	}
+
+	m_pCell[iSlot] = SPATIAL_GRID_INVALID;
+	m_pNext[iSlot] = SPATIAL_GRID_INVALID;
+	m_pPrev[iSlot] = SPATIAL_GRID_INVALID;
+}
+
+// keeps m_fMaxRadius the largest radius of the slots in the grid, a query reaches that
+// much further into the neighbouring cells
+void CSpatialGrid::SetRadius(int iSlot, float fRadius)
+{
+	float fOld = m_pRadius[iSlot];
+	m_pRadius[iSlot] = fRadius;
+
+	if (fRadius > m_fMaxRadius) {
+		m_fMaxRadius = fRadius;
+		m_iMaxRadiusCount = 1;
+		return;
+	}
+	if (fRadius == m_fMaxRadius && fRadius != fOld) {
+		m_iMaxRadiusCount++;
+	}
+	if (fOld != m_fMaxRadius || fRadius == fOld || --m_iMaxRadiusCount > 0) return;
+
+	// the last slot with the largest radius shrank or left, find the next largest
+	m_fMaxRadius = 0.0f;
+	m_iMaxRadiusCount = 0;
+	for (int i = 0; i < m_iCapacity; i++)
+	{
+		if (m_pCell[i] == SPATIAL_GRID_INVALID && i != iSlot) continue;
+
+		if (m_pRadius[i] > m_fMaxRadius) {
+			m_fMaxRadius = m_pRadius[i];
+			m_iMaxRadiusCount = 1;
+		}
+		else if (m_pRadius[i] == m_fMaxRadius) {
+			m_iMaxRadiusCount++;
+		}
+	}
+}
+
+void CSpatialGrid::Update(int iSlot, const CVector& vecPos, float fRadius)
+{
+	if (iSlot < 0 || iSlot >= m_iCapacity) return;
+
+	int iCell = GetCellIndex(vecPos);
+
+	m_pPos[iSlot] = vecPos;
+	SetRadius(iSlot, fRadius);
+
+	if (m_pCell[iSlot] == iCell) return;
+
+	if (m_pCell[iSlot] != SPATIAL_GRID_INVALID) {
+		Unlink(iSlot);
+	}
+	else {
+		m_iCount++;
+	}
+
+	Link(iSlot, iCell);
+}
+
+void CSpatialGrid::Remove(int iSlot)
+{
+	if (!Contains(iSlot)) return;
+
+	Unlink(iSlot);
+	SetRadius(iSlot, 0.0f);
+	m_iCount--;
+}
+
+int CSpatialGrid::Query(const CVector& vecCenter, float fRadius, int* pResult, int iMaxResult) const
+{
+	if (m_iCount == 0) return 0;
+
+	float fReach = fRadius + m_fMaxRadius;
+
+	int iMinX = GetCellCoord(vecCenter.x - fReach);
+	int iMaxX = GetCellCoord(vecCenter.x + fReach);
+	int iMinY = GetCellCoord(vecCenter.y - fReach);
+	int iMaxY = GetCellCoord(vecCenter.y + fReach);
+
+	int iFound = 0;
+
+	for (int y = iMinY; y <= iMaxY; y++)
+	{
+		for (int x = iMinX; x <= iMaxX; x++)
+		{
+			for (int i = m_iCellHead[y * SPATIAL_GRID_DIM + x]; i != SPATIAL_GRID_INVALID; i = m_pNext[i])
+			{
+				float fDX = m_pPos[i].x - vecCenter.x;
+				float fDY = m_pPos[i].y - vecCenter.y;
+				float fDZ = m_pPos[i].z - vecCenter.z;
+				float fLimit = fRadius + m_pRadius[i];
+
+				if (fDX * fDX + fDY * fDY + fDZ * fDZ > fLimit * fLimit) continue;
+
+				pResult[iFound++] = i;
+				if (iFound >= iMaxResult) return iFound;
+			}
+		}
+	}
+
+	return iFound;
+}
+
+int CSpatialGrid::QueryVisible(const CVector& vecCamPos, const CVector& vecCamForward, float fRadius,
+							   int* pResult, int iMaxResult, float fMargin) const
+{
+	int iFound = Query(vecCamPos, fRadius, pResult, iMaxResult);
+	int iVisible = 0;
+
+	for (int i = 0; i < iFound; i++)
+	{
+		int iSlot = pResult[i];
+		if (IsInViewCone(vecCamPos, vecCamForward, m_pPos[iSlot], fMargin)) {
+			pResult[iVisible++] = iSlot;
+		}
+	}
+
+	return iVisible;
+}
+
+bool CSpatialGrid::IsInViewCone(const CVector& vecCamPos, const CVector& vecCamForward,
+								const CVector& vecPos, float fMargin)
+{
+	float fDX = vecPos.x - vecCamPos.x;
+	float fDY = vecPos.y - vecCamPos.y;
+	float fDZ = vecPos.z - vecCamPos.z;
+	float fDistSq = fDX * fDX + fDY * fDY + fDZ * fDZ;
+
+	// close enough that it can still overlap the near plane
+	if (fDistSq <= fMargin * fMargin) return true;
+
+	float fDot = fDX * vecCamForward.x + fDY * vecCamForward.y + fDZ * vecCamForward.z;
+	if (fDot < -fMargin) return false;
+
+	// widen the cone by the angle the margin spans at this distance
+	float fDist = sqrtf(fDistSq);
+	return fDot + fMargin >= SPATIAL_GRID_VIEW_COS * fDist;
+}
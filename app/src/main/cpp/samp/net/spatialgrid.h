@@ -0,0 +1,69 @@
+#pragma once
+
+// World-space uniform grid for streamed SA-MP entities (labels, pickups, players).
+// Cells are bucketed on the XY plane; each cell keeps an intrusive doubly linked
+// list of slot ids so insert/move/remove are O(1) and a radius query only walks
+// the cells overlapping the query circle.
+
+#define SPATIAL_GRID_WORLD_MIN		-3000.0f
+#define SPATIAL_GRID_WORLD_MAX		3000.0f
+#define SPATIAL_GRID_CELL_SIZE		100.0f
+#define SPATIAL_GRID_DIM			60
+#define SPATIAL_GRID_INVALID		-1
+
+// cos(75deg): generous half-angle so wide screens and objects on the edge still pass
+#define SPATIAL_GRID_VIEW_COS		0.2588f
+
+class CSpatialGrid
+{
+public:
+	CSpatialGrid(int iCapacity);
+	~CSpatialGrid();
+
+	// insert or move a slot, fRadius is the slot's own cull radius (0 = point)
+	void Update(int iSlot, const CVector& vecPos, float fRadius = 0.0f);
+	void Remove(int iSlot);
+	void Clear();
+
+	bool Contains(int iSlot) const {
+		return iSlot >= 0 && iSlot < m_iCapacity && m_pCell[iSlot] != SPATIAL_GRID_INVALID;
+	}
+
+	const CVector& GetPosition(int iSlot) const { return m_pPos[iSlot]; }
+	float GetMaxRadius() const { return m_fMaxRadius; }
+	int GetCount() const { return m_iCount; }
+
+	// every slot within fRadius of vecCenter
+	int Query(const CVector& vecCenter, float fRadius, int* pResult, int iMaxResult) const;
+
+	// every slot within fRadius of the camera and inside its view cone,
+	// fMargin is the entity's on-screen extent so edge items aren't popped
+	int QueryVisible(const CVector& vecCamPos, const CVector& vecCamForward, float fRadius,
+					 int* pResult, int iMaxResult, float fMargin = 2.0f) const;
+
+	static bool IsInViewCone(const CVector& vecCamPos, const CVector& vecCamForward,
+							 const CVector& vecPos, float fMargin);
+
+private:
+	static int GetCellCoord(float fCoord);
+	static int GetCellIndex(const CVector& vecPos) {
+		return GetCellCoord(vecPos.y) * SPATIAL_GRID_DIM + GetCellCoord(vecPos.x);
+	}
+
+	void Link(int iSlot, int iCell);
+	void Unlink(int iSlot);
+
+	void SetRadius(int iSlot, float fRadius);
+
+	int		m_iCapacity;
+	int		m_iCount;
+	float	m_fMaxRadius;
+	int		m_iMaxRadiusCount;	// slots whose radius is m_fMaxRadius
+
+	int		m_iCellHead[SPATIAL_GRID_DIM * SPATIAL_GRID_DIM];
+	int		*m_pCell;
+	int		*m_pNext;
+	int		*m_pPrev;
+	float	*m_pRadius;
+	CVector	*m_pPos;
+};
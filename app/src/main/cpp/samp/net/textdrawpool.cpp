@@ -2,6 +2,8 @@
 #include "../game/game.h"
 #include "netgame.h"
 
+#include <algorithm>
+
 extern CGame* pGame;
 extern CNetGame* pNetGame;
 
@@ -39,6 +41,11 @@ void CTextDrawPool::New(uint16_t wTextDrawID, TEXT_DRAW_TRANSMIT* pTextDrawTrans
 
     m_pTextDraw[wTextDrawID] = pTextDraw;
     m_bSlotState[wTextDrawID] = true;
+
+    auto it = std::lower_bound(m_ActiveIds.begin(), m_ActiveIds.end(), wTextDrawID);
+    if (it == m_ActiveIds.end() || *it != wTextDrawID) {
+        m_ActiveIds.insert(it, wTextDrawID);
+    }
 }
 // 0.3.7
 void CTextDrawPool::Delete(uint16_t wTextDrawID)
@@ -47,17 +54,25 @@ void CTextDrawPool::Delete(uint16_t wTextDrawID)
         delete m_pTextDraw[wTextDrawID];
         m_pTextDraw[wTextDrawID] = nullptr;
         m_bSlotState[wTextDrawID] = false;
+
+        auto it = std::lower_bound(m_ActiveIds.begin(), m_ActiveIds.end(), wTextDrawID);
+        if (it != m_ActiveIds.end() && *it == wTextDrawID) {
+            m_ActiveIds.erase(it);
+        }
     }
 }
 // 0.3.7
 void CTextDrawPool::Draw()
 {
-    for (int i = 0; i < MAX_TEXT_DRAWS; i++)
-    {
-        if (m_bSlotState[i]) {
-            m_pTextDraw[i]->Draw();
-        }
+    PROFILE_SCOPE("CTextDrawPool::Draw");
+
+    m_Renderer.Begin();
+
+    for (uint16_t wTextDrawID : m_ActiveIds) {
+        m_pTextDraw[wTextDrawID]->Draw(&m_Renderer);
     }
+
+    m_Renderer.End();
 }
 
 void CTextDrawPool::DrawImage()
@@ -90,13 +105,11 @@ void CTextDrawPool::SetSelectState(bool bState, uint32_t dwColor)
 
         SendClick();
 
-        for (int i = 0; i < MAX_TEXT_DRAWS; i++)
+        for (uint16_t i : m_ActiveIds)
         {
-            if (m_bSlotState[i] && m_pTextDraw[i]) {
-                CTextDraw* pTextDraw = m_pTextDraw[i];
-                pTextDraw->m_bHovered = false;
-                pTextDraw->m_dwHoverColor = 0;
-            }
+            CTextDraw* pTextDraw = m_pTextDraw[i];
+            pTextDraw->m_bHovered = false;
+            pTextDraw->m_dwHoverColor = 0;
         }
     }
 }
@@ -116,7 +129,7 @@ bool CTextDrawPool::onTouchEvent(int type, bool multi, int x, int y)
     m_wClickedTextDrawID = 0xFFFF;
 
 
-    for (int i = 0; i < MAX_TEXT_DRAWS; i++)
+    for (uint16_t i : m_ActiveIds)
     {
         if (m_bSlotState[i] && m_pTextDraw[i])
         {
@@ -166,10 +179,7 @@ bool CTextDrawPool::onTouchEvent(int type, bool multi, int x, int y)
 
 void CTextDrawPool::SnapshotProcess()
 {
-    for (int i = 0; i < MAX_TEXT_DRAWS; i++)
-    {
-        if (m_bSlotState[i] && m_pTextDraw[i]) {
-            m_pTextDraw[i]->SnapshotProcess();
-        }
+    for (uint16_t i : m_ActiveIds) {
+        m_pTextDraw[i]->SnapshotProcess();
     }
 }
\ No newline at end of file
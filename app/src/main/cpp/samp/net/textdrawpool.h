@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #define MAX_TEXT_DRAW_LINE 800
 
 class CTextDrawPool
@@ -28,12 +30,18 @@ public:
 
     void SnapshotProcess();
 
+    const TEXT_DRAW_RENDER_STATS& GetRenderStats() const { return m_Renderer.GetStats(); }
+    int GetActiveCount() const { return (int)m_ActiveIds.size(); }
+
 private:
     void SendClick();
 
 private:
     uint8_t m_bSlotState[MAX_TEXT_DRAWS];
     CTextDraw* m_pTextDraw[MAX_TEXT_DRAWS];
+    // ids of the live slots in ascending order, the draw order
+    std::vector<uint16_t> m_ActiveIds;
+    CTextDrawRenderer m_Renderer;
 
     bool m_bSelectState;
     uint32_t m_dwHoverColor;
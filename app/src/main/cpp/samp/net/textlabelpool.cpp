@@ -2,12 +2,13 @@
 #include "../game/game.h"
 #include "netgame.h"
 #include "game/World.h"
+#include <algorithm>
 
 extern CGame* pGame;
 extern CNetGame* pNetGame;
 
 // 0.3.7
-C3DTextLabelPool::C3DTextLabelPool()
+C3DTextLabelPool::C3DTextLabelPool() : m_Grid(MAX_TEXT_LABELS)
 {
 	for (int i = 0; i < MAX_TEXT_LABELS; i++) {
 		//m_TextLabels[i].pszText = nullptr;
@@ -32,9 +33,7 @@ void C3DTextLabelPool::NewLabel(uint16_t wLabelId, TEXT_LABEL* pLabel) {
 
 		if (m_TextLabels[wLabelId])
 		{
-			delete m_TextLabels[wLabelId];
-			m_TextLabels[wLabelId] = nullptr;
-			m_bSlotUsed[wLabelId] = false;
+			this->ClearLabel(wLabelId);
 		}
 
 		//labelInfo.dwColor = (labelInfo.dwColor >> 8) | (labelInfo.dwColor << 24);
@@ -54,6 +53,13 @@ void C3DTextLabelPool::NewLabel(uint16_t wLabelId, TEXT_LABEL* pLabel) {
 
 		m_TextLabels[wLabelId] = pTextLabel;
 		m_bSlotUsed[wLabelId] = true;
+
+		if (pTextLabel->playerId != INVALID_PLAYER_ID || pTextLabel->vehicleId != INVALID_VEHICLE_ID) {
+			m_AttachedLabels.push_back(wLabelId);
+		}
+		else {
+			m_Grid.Update(wLabelId, pTextLabel->vecPos, pTextLabel->fDistance);
+		}
 	}
 }
 // 0.3.7
@@ -63,6 +69,17 @@ void C3DTextLabelPool::ClearLabel(uint16_t wLabelId) {
 		return;
 	}
 	m_bSlotUsed[wLabelId] = false;
+	m_Grid.Remove(wLabelId);
+	if (pNetGame && pNetGame->GetVisibilityService()) {
+		pNetGame->GetVisibilityService()->Forget(LOS_KEY_LABEL(wLabelId));
+	}
+
+	auto it = std::find(m_AttachedLabels.begin(), m_AttachedLabels.end(), wLabelId);
+	if (it != m_AttachedLabels.end()) {
+		*it = m_AttachedLabels.back();
+		m_AttachedLabels.pop_back();
+	}
+
 	if (m_TextLabels[wLabelId])
 	{
 		delete m_TextLabels[wLabelId];
@@ -75,66 +92,84 @@ void C3DTextLabelPool::Render(ImGuiRenderer* renderer)
 	CPlayerPed *pPlayerPed = pGame->FindPlayerPed();
 	if(!pPlayerPed) return;
 
+	CPlayerPool *pPlayerPool = pNetGame->GetPlayerPool();
+	if (!pPlayerPool) return;
+
     static CCamera& TheCamera = *reinterpret_cast<CCamera*>(g_libGTASA + (VER_x32 ? 0x00951FA8 : 0xBBA8D0));
 
-	for (int i = 0; i < MAX_TEXT_LABELS; i++)
+	for (uint16_t wLabelId : m_AttachedLabels) {
+		this->DrawAttached(renderer, wLabelId, m_TextLabels[wLabelId]);
+	}
+
+	if (m_Grid.GetCount() == 0) return;
+
+	// draw distance is measured from the ped, so reach out from the camera
+	// by the camera-ped gap; each slot's own fDistance is its grid radius
+	static int iVisible[MAX_TEXT_LABELS];
+	CVector vecCamPos = TheCamera.GetPosition();
+	CVector vecPedPos = pPlayerPed->m_pPed->GetPosition();
+	CVector vecGap = vecPedPos - vecCamPos;
+
+	int iCount = m_Grid.QueryVisible(vecCamPos, TheCamera.GetForward(), vecGap.Magnitude(),
+									 iVisible, MAX_TEXT_LABELS, 4.0f);
+
+	for (int i = 0; i < iCount; i++)
 	{
-		if (m_bSlotUsed[i]) {
-            CPlayerPool *pPlayerPool = pNetGame->GetPlayerPool();
-            if (!pPlayerPool) break;
-
-            TEXT_LABEL *pTextLabel = m_TextLabels[i];
-
-            CVector vecTextPos = pTextLabel->vecPos;
-
-            if (pTextLabel->playerId != INVALID_PLAYER_ID) {
-                if (pTextLabel->playerId == pPlayerPool->GetLocalPlayerID()) continue;
-
-                if (pPlayerPool && pPlayerPool->GetSlotState(pTextLabel->playerId)) {
-                    CRemotePlayer *pPlayer = pPlayerPool->GetAt(pTextLabel->playerId);
-                    if (pPlayer && pPlayer->GetDistanceFromLocalPlayer() < pTextLabel->fDistance) {
-                        CPlayerPed *pPlayerPed = pPlayer->GetPlayerPed();
-                        if (pPlayerPed && pPlayerPed->m_pPed->IsAdded()) {
-                            CVector matBone;
-                            pPlayerPed->GetBonePosition(8, &matBone);
-
-                            vecTextPos.x = matBone.x + pTextLabel->vecPos.x;
-                            vecTextPos.y = matBone.y + pTextLabel->vecPos.y;
-                            vecTextPos.z = matBone.z + 0.23 + pTextLabel->vecPos.z;
-
-                            this->Draw(renderer, pTextLabel, vecTextPos, pTextLabel->text,
-                                       pTextLabel->dwColor);
-
-                        }
-                    }
-                }
-            }
-			if (pTextLabel->vehicleId != INVALID_VEHICLE_ID) {
-				CVehiclePool *pVehiclePool = pNetGame->GetVehiclePool();
-				if (pVehiclePool && pVehiclePool->GetSlotState(pTextLabel->vehicleId)) {
-					CVehicle *pVehicle = pVehiclePool->GetAt(pTextLabel->vehicleId);
-					if (pVehicle && pVehicle->m_pVehicle->IsAdded() &&
-						pVehicle->m_pVehicle->GetDistanceFromLocalPlayerPed() < pTextLabel->fDistance) {
-						RwMatrix matVehicle = pVehicle->m_pVehicle->GetMatrix().ToRwMatrix();
-
-						vecTextPos.x = matVehicle.pos.x + pTextLabel->vecPos.x;
-						vecTextPos.y = matVehicle.pos.y + pTextLabel->vecPos.y;
-						vecTextPos.z = matVehicle.pos.z + pTextLabel->vecPos.z;
-
-						this->Draw(renderer, pTextLabel, vecTextPos, pTextLabel->text,
-								   pTextLabel->dwColor);
-					}
+		uint16_t wLabelId = (uint16_t)iVisible[i];
+		TEXT_LABEL *pTextLabel = m_TextLabels[wLabelId];
+		if (!pTextLabel) continue;
+
+		this->Draw(renderer, wLabelId, pTextLabel, pTextLabel->vecPos, pTextLabel->text, pTextLabel->dwColor);
+	}
+}
+
+void C3DTextLabelPool::DrawAttached(ImGuiRenderer* renderer, uint16_t wLabelId, TEXT_LABEL* pTextLabel)
+{
+	CPlayerPool *pPlayerPool = pNetGame->GetPlayerPool();
+	CVector vecTextPos = pTextLabel->vecPos;
+
+	if (pTextLabel->playerId != INVALID_PLAYER_ID) {
+		if (pTextLabel->playerId == pPlayerPool->GetLocalPlayerID()) return;
+
+		if (pPlayerPool->GetSlotState(pTextLabel->playerId)) {
+			CRemotePlayer *pPlayer = pPlayerPool->GetAt(pTextLabel->playerId);
+			if (pPlayer && pPlayer->GetDistanceFromLocalPlayer() < pTextLabel->fDistance) {
+				CPlayerPed *pPlayerPed = pPlayer->GetPlayerPed();
+				if (pPlayerPed && pPlayerPed->m_pPed->IsAdded()) {
+					CVector matBone;
+					pPlayerPed->GetBonePosition(8, &matBone);
+
+					vecTextPos.x = matBone.x + pTextLabel->vecPos.x;
+					vecTextPos.y = matBone.y + pTextLabel->vecPos.y;
+					vecTextPos.z = matBone.z + 0.23 + pTextLabel->vecPos.z;
+
+					this->Draw(renderer, wLabelId, pTextLabel, vecTextPos, pTextLabel->text,
+							   pTextLabel->dwColor);
 				}
 			}
+		}
+	}
+
+	if (pTextLabel->vehicleId != INVALID_VEHICLE_ID) {
+		CVehiclePool *pVehiclePool = pNetGame->GetVehiclePool();
+		if (pVehiclePool && pVehiclePool->GetSlotState(pTextLabel->vehicleId)) {
+			CVehicle *pVehicle = pVehiclePool->GetAt(pTextLabel->vehicleId);
+			if (pVehicle && pVehicle->m_pVehicle->IsAdded() &&
+				pVehicle->m_pVehicle->GetDistanceFromLocalPlayerPed() < pTextLabel->fDistance) {
+				RwMatrix matVehicle = pVehicle->m_pVehicle->GetMatrix().ToRwMatrix();
 
-			if (pPlayerPed->m_pPed->GetDistanceFromPoint(pTextLabel->vecPos.x, pTextLabel->vecPos.y, pTextLabel->vecPos.z) <= pTextLabel->fDistance)
-				this->Draw(renderer, pTextLabel, vecTextPos, pTextLabel->text,
+				vecTextPos.x = matVehicle.pos.x + pTextLabel->vecPos.x;
+				vecTextPos.y = matVehicle.pos.y + pTextLabel->vecPos.y;
+				vecTextPos.z = matVehicle.pos.z + pTextLabel->vecPos.z;
+
+				this->Draw(renderer, wLabelId, pTextLabel, vecTextPos, pTextLabel->text,
 						   pTextLabel->dwColor);
-        }
+			}
+		}
 	}
 }
 
-void C3DTextLabelPool::Draw(ImGuiRenderer* renderer, TEXT_LABEL* label, CVector vecPos, const std::string& text, uint32_t dwColor)
+void C3DTextLabelPool::Draw(ImGuiRenderer* renderer, uint16_t wLabelId, TEXT_LABEL* label, CVector vecPos, const std::string& text, uint32_t dwColor)
 {
 	CVector vPos;
 	vPos.x = vecPos.x;
@@ -143,6 +178,10 @@ void C3DTextLabelPool::Draw(ImGuiRenderer* renderer, TEXT_LABEL* label, CVector
 
     static CCamera& TheCamera = *reinterpret_cast<CCamera*>(g_libGTASA + (VER_x32 ? 0x00951FA8 : 0xBBA8D0));
 
+	if (pNetGame->GetPlayerPool()->GetLocalPlayer()->GetPlayerPed()->m_pPed->GetDistanceFromPoint(vecPos.x, vecPos.y, vecPos.z) > label->fDistance) {
+		return;
+	}
+
 	int hitEntity = 0;
     if (label->bTestLOS) {
 		CAMERA_AIM *pCam = GameGetInternalAim();
@@ -151,40 +190,24 @@ void C3DTextLabelPool::Draw(ImGuiRenderer* renderer, TEXT_LABEL* label, CVector
 			return;
 		}
 
-        RwMatrix matPlayer = pNetGame->GetPlayerPool()->GetLocalPlayer()->GetPlayerPed()->m_pPed->GetMatrix().ToRwMatrix();
-
-		CVector vec;
-		vec.x = pCam->pos1x;
-		vec.y = pCam->pos1y;
-		vec.z = pCam->pos1z;
-
-		//bool isLineOfSightClear = ((bool (*)(CVector*, CVector*, int, int, int, int, int, int, int))(g_libGTASA + 0x423418 + 1))(&vec, &matPlayer.pos, 1, 0, 0, 1, 0, 0, 0);
-
-        hitEntity = CWorld::GetIsLineOfSightClear(vecPos, TheCamera.GetPosition(), true, false, false, true, false, false, false);
-		/*if(!isLineOfSightClear)
-		{
-			LOGI("labelpool draw ok no render fuck you bitch");
-			return;
-		}*/
+        hitEntity = pNetGame->GetVisibilityService()->IsVisible(LOS_KEY_LABEL(wLabelId), vecPos, TheCamera.GetPosition());
     }
 
 	if (!label->bTestLOS || hitEntity) {
-		if (pNetGame->GetPlayerPool()->GetLocalPlayer()->GetPlayerPed()->m_pPed->GetDistanceFromPoint(vecPos.x, vecPos.y, vecPos.z) <= label->fDistance) {
-			CVector vecOut;
-			// CSprite::CalcScreenCoors
-			((void (*)(CVector *, CVector *, float *, float *, bool, bool)) (g_libGTASA + (VER_x32 ? 0x005C57E8 + 1 : 0x6E9DF8)))(
-					&vPos, &vecOut, 0, 0, 0, 0);
-			if (vecOut.z < 1.0f) return;
-
-			std::stringstream ss_data(text);
-			std::string s_row;
-			while (std::getline(ss_data, s_row, '\n')) {
-				ImVec2 sz = renderer->calculateTextSize(s_row, UISettings::fontSize() / 2);
-				renderer->drawText(ImVec2(vecOut.x - (sz.x / 2), vecOut.y),
-								   __builtin_bswap32(dwColor | (0x000000FF)), s_row, true,
-								   UISettings::fontSize() / 2);
-				vecOut.y += UISettings::fontSize() / 2;
-			}
+		CVector vecOut;
+		// CSprite::CalcScreenCoors
+		((void (*)(CVector *, CVector *, float *, float *, bool, bool)) (g_libGTASA + (VER_x32 ? 0x005C57E8 + 1 : 0x6E9DF8)))(
+				&vPos, &vecOut, 0, 0, 0, 0);
+		if (vecOut.z < 1.0f) return;
+
+		std::stringstream ss_data(text);
+		std::string s_row;
+		while (std::getline(ss_data, s_row, '\n')) {
+			ImVec2 sz = renderer->calculateTextSize(s_row, UISettings::fontSize() / 2);
+			renderer->drawText(ImVec2(vecOut.x - (sz.x / 2), vecOut.y),
+							   __builtin_bswap32(dwColor | (0x000000FF)), s_row, true,
+							   UISettings::fontSize() / 2);
+			vecOut.y += UISettings::fontSize() / 2;
 		}
 	}
 }
\ No newline at end of file
@@ -38,6 +38,12 @@ private:
 	TEXT_LABEL	*m_TextLabels[MAX_TEXT_LABELS];
 	bool		m_bSlotUsed[MAX_TEXT_LABELS];
 
-    void Draw(ImGuiRenderer *renderer, TEXT_LABEL *label, CVector vecPos, const std::string &text,
+	// world labels are culled through the grid, attached ones follow their entity
+	CSpatialGrid			m_Grid;
+	std::vector<uint16_t>	m_AttachedLabels;
+
+	void DrawAttached(ImGuiRenderer *renderer, uint16_t wLabelId, TEXT_LABEL *label);
+
+    void Draw(ImGuiRenderer *renderer, uint16_t wLabelId, TEXT_LABEL *label, CVector vecPos, const std::string &text,
               uint32_t dwColor);
 };
\ No newline at end of file
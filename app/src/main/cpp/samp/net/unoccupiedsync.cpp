@@ -0,0 +1,186 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define UNOC_ERROR_SMOOTHING	0.2f	// weight of the newest packet in the average error
+#define UNOC_MAX_FRAME_STEPS	5.0f	// a longer frame is treated as this long
+
+static CVector Add(const CVector& a, const CVector& b) { return CVector(a.x + b.x, a.y + b.y, a.z + b.z); }
+static CVector Sub(const CVector& a, const CVector& b) { return CVector(a.x - b.x, a.y - b.y, a.z - b.z); }
+static CVector Scale(const CVector& a, float f) { return CVector(a.x * f, a.y * f, a.z * f); }
+static float Dot(const CVector& a, const CVector& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static float Length(const CVector& a) { return sqrtf(Dot(a, a)); }
+
+static CVector Cross(const CVector& a, const CVector& b)
+{
+	return CVector(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+// rotates v by the rotation vector vecRot (axis * angle)
+static CVector Rotate(const CVector& v, const CVector& vecRot)
+{
+	float fAngle = Length(vecRot);
+	if (fAngle < 1e-6f) return v;
+
+	CVector k = Scale(vecRot, 1.0f / fAngle);
+	float c = cosf(fAngle), s = sinf(fAngle);
+	return Add(Add(Scale(v, c), Scale(Cross(k, v), s)), Scale(k, Dot(k, v) * (1.0f - c)));
+}
+
+// distance covered in fSteps by a velocity that turns along with the vehicle
+static CVector Arc(const CVector& v, const CVector& vecTurn, float fSteps)
+{
+	float fRate = Length(vecTurn);
+	if (fRate * fSteps < 1e-4f) return Scale(v, fSteps);
+
+	CVector k = Scale(vecTurn, 1.0f / fRate);
+	float fAngle = fRate * fSteps;
+	return Add(Add(Scale(v, sinf(fAngle) / fRate), Scale(Cross(k, v), (1.0f - cosf(fAngle)) / fRate)),
+		Scale(k, Dot(k, v) * (fSteps - sinf(fAngle) / fRate)));
+}
+
+// rotation vector taking the orientation of a onto the one of b, in world space
+static CVector RotationBetween(const UNOC_STATE& a, const UNOC_STATE& b)
+{
+	CVector vecAtA = Cross(a.vecRight, a.vecUp);
+	CVector vecAtB = Cross(b.vecRight, b.vecUp);
+
+	// half the sum is sin(angle) * axis, the trace gives 1 + 2 cos(angle)
+	CVector vecSin = Scale(Add(Add(Cross(a.vecRight, b.vecRight), Cross(a.vecUp, b.vecUp)), Cross(vecAtA, vecAtB)), 0.5f);
+	float fCos = (Dot(a.vecRight, b.vecRight) + Dot(a.vecUp, b.vecUp) + Dot(vecAtA, vecAtB) - 1.0f) * 0.5f;
+
+	float fSin = Length(vecSin);
+	if (fSin < 1e-6f)
+	{
+		if (fCos > 0.0f) return CVector(0.0f, 0.0f, 0.0f);
+
+		// half a turn: every axis of a plus its image in b lies along the rotation axis
+		CVector vecAxis = Add(a.vecRight, b.vecRight);
+		CVector vecUpAxis = Add(a.vecUp, b.vecUp);
+		CVector vecAtAxis = Add(vecAtA, vecAtB);
+		if (Dot(vecUpAxis, vecUpAxis) > Dot(vecAxis, vecAxis)) vecAxis = vecUpAxis;
+		if (Dot(vecAtAxis, vecAtAxis) > Dot(vecAxis, vecAxis)) vecAxis = vecAtAxis;
+		return Scale(vecAxis, (float)M_PI / Length(vecAxis));
+	}
+
+	return Scale(vecSin, atan2f(fSin, fCos) / fSin);
+}
+
+// one frame of a critically damped error: e'' + 2w e' + w^2 e = 0, solved exactly over
+// dt so any frame time is stable; returns the velocity that closes the error as
+// planned and updates the rate the error closes at
+static CVector DampError(const CVector& vecError, CVector& vecRate, float fOmega, float dt)
+{
+	float fDecay = expf(-fOmega * dt);
+	CVector vecErrorRate = Scale(vecRate, -1.0f);
+	CVector vecTerm = Add(vecErrorRate, Scale(vecError, fOmega));
+
+	CVector vecNextError = Scale(Add(vecError, Scale(vecTerm, dt)), fDecay);
+	CVector vecNextErrorRate = Scale(Sub(vecErrorRate, Scale(vecTerm, fOmega * dt)), fDecay);
+
+	vecRate = Scale(vecNextErrorRate, -1.0f);
+	return Scale(Sub(vecError, vecNextError), 1.0f / dt);
+}
+
+CUnoccupiedCorrector::CUnoccupiedCorrector()
+{
+	Reset();
+	m_fAvgError = 0.0f;
+	m_iSnaps = 0;
+}
+
+void CUnoccupiedCorrector::Reset()
+{
+	m_bHasTarget = false;
+	m_bNewTarget = false;
+	m_dwTargetTime = 0;
+	m_vecPosRate = CVector(0.0f, 0.0f, 0.0f);
+	m_vecRotRate = CVector(0.0f, 0.0f, 0.0f);
+	m_bHaveUpdate = false;
+	m_dwLastUpdate = 0;
+	m_fPosError = 0.0f;
+	m_fAngleError = 0.0f;
+}
+
+void CUnoccupiedCorrector::SetTarget(uint32_t dwTime, const UNOC_STATE& target)
+{
+	m_Target = target;
+	m_dwTargetTime = dwTime;
+	m_bHasTarget = true;
+	m_bNewTarget = true;
+}
+
+void CUnoccupiedCorrector::GetTarget(uint32_t dwNow, UNOC_STATE& out) const
+{
+	out = m_Target;
+
+	uint32_t dwAge = std::min<uint32_t>(dwNow - m_dwTargetTime, UNOC_EXTRAPOLATE_LIMIT);
+	float fSteps = (float)dwAge / UNOC_STEP_TIME;
+	if (fSteps <= 0.0f) return;
+
+	// a turning vehicle drives an arc, its velocity turns with it
+	CVector vecRot = Scale(m_Target.vecTurnSpeed, fSteps);
+	out.vecPos = Add(m_Target.vecPos, Arc(m_Target.vecMoveSpeed, m_Target.vecTurnSpeed, fSteps));
+	out.vecMoveSpeed = Rotate(m_Target.vecMoveSpeed, vecRot);
+	out.vecRight = Rotate(m_Target.vecRight, vecRot);
+	out.vecUp = Rotate(m_Target.vecUp, vecRot);
+}
+
+int CUnoccupiedCorrector::Update(uint32_t dwNow, const UNOC_STATE& current, UNOC_STATE& out)
+{
+	if (!m_bHasTarget) return UNOC_CORRECTION_NONE;
+
+	if (dwNow - m_dwTargetTime > UNOC_TIMEOUT)
+	{
+		// the sender stopped, whatever the vehicle does now is local
+		Reset();
+		return UNOC_CORRECTION_NONE;
+	}
+
+	GetTarget(dwNow, out);
+
+	CVector vecPosError = Sub(out.vecPos, current.vecPos);
+	CVector vecRotError = RotationBetween(current, out);
+	m_fPosError = Length(vecPosError);
+	m_fAngleError = Length(vecRotError);
+
+	if (m_bNewTarget)
+	{
+		m_bNewTarget = false;
+		m_fAvgError += (m_fPosError - m_fAvgError) * UNOC_ERROR_SMOOTHING;
+	}
+
+	if (m_fPosError > UNOC_SNAP_DIST || m_fAngleError > UNOC_SNAP_ANGLE)
+	{
+		m_vecPosRate = CVector(0.0f, 0.0f, 0.0f);
+		m_vecRotRate = CVector(0.0f, 0.0f, 0.0f);
+		m_bHaveUpdate = false;
+		m_iSnaps++;
+		return UNOC_CORRECTION_SNAP;
+	}
+
+	if (m_fPosError < UNOC_SETTLE_DIST && m_fAngleError < UNOC_SETTLE_ANGLE &&
+		Length(out.vecMoveSpeed) < UNOC_SETTLE_SPEED && Length(out.vecTurnSpeed) < UNOC_SETTLE_SPEED)
+	{
+		// at rest where the sender has it, don't hold it against local physics
+		m_vecPosRate = CVector(0.0f, 0.0f, 0.0f);
+		m_vecRotRate = CVector(0.0f, 0.0f, 0.0f);
+		m_bHaveUpdate = false;
+		return UNOC_CORRECTION_NONE;
+	}
+
+	// the coming frame is assumed as long as the last one
+	float dt = m_bHaveUpdate ? (float)(dwNow - m_dwLastUpdate) / UNOC_STEP_TIME : 1.0f;
+	dt = std::clamp(dt, 0.05f, UNOC_MAX_FRAME_STEPS);
+	m_bHaveUpdate = true;
+	m_dwLastUpdate = dwNow;
+
+	float fOmega = UNOC_STEP_TIME / UNOC_CORRECTION_TIME;
+	out.vecMoveSpeed = Add(out.vecMoveSpeed, DampError(vecPosError, m_vecPosRate, fOmega, dt));
+	out.vecTurnSpeed = Add(out.vecTurnSpeed, DampError(vecRotError, m_vecRotRate, fOmega, dt));
+
+	return UNOC_CORRECTION_STEER;
+}
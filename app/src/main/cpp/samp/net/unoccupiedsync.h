@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+
+// Reconciles an unoccupied vehicle with the UNOCCUPIED_SYNC_DATA of the player moving it.
+// A packet is stamped with its arrival time and extrapolated along its move and turn
+// speed, so the target keeps moving between packets. The local physics keeps running
+// and the vehicle is steered onto the target through its move and turn speed: the
+// error follows a critically damped curve, closing within a few hundred ms without
+// overshoot, while collisions still act on the vehicle. Only a large error snaps.
+// CUnoccupiedCorrector only sees states and times, a recorded packet trace drives it
+// the same way; CVehiclePool applies it to the game vehicles.
+
+#define UNOC_CORRECTION_TIME	80		// ms, 1 / omega of the correction; 90% of an error is gone after 4x this
+#define UNOC_STEP_TIME			20.0f	// ms, move and turn speeds are per physics step
+#define UNOC_EXTRAPOLATE_LIMIT	250		// ms a packet is extrapolated at most
+#define UNOC_TIMEOUT			2000	// ms without a packet before local physics owns the vehicle again
+#define UNOC_SNAP_DIST			8.0f	// position error that's jumped over instead of corrected
+#define UNOC_SNAP_ANGLE			1.0f	// rad
+#define UNOC_SETTLE_DIST		0.05f	// a resting vehicle this close is left alone
+#define UNOC_SETTLE_ANGLE		0.02f	// rad
+#define UNOC_SETTLE_SPEED		0.001f	// units per step
+
+struct UNOC_STATE
+{
+	CVector	vecPos;
+	CVector	vecRight;		// matrix right, from vecRoll
+	CVector	vecUp;			// matrix up (forward in GTA), from vecDirection
+	CVector	vecMoveSpeed;	// units per step
+	CVector	vecTurnSpeed;	// rad per step, world space
+};
+
+enum eUnoccupiedCorrection
+{
+	UNOC_CORRECTION_NONE = 0,	// nothing to do, the vehicle is left to local physics
+	UNOC_CORRECTION_STEER,		// apply the move and turn speed
+	UNOC_CORRECTION_SNAP,		// put the vehicle at the target state
+};
+
+class CUnoccupiedCorrector
+{
+public:
+	CUnoccupiedCorrector();
+
+	void Reset();
+
+	void SetTarget(uint32_t dwTime, const UNOC_STATE& target);
+	bool HasTarget() const { return m_bHasTarget; }
+	uint32_t GetTargetTime() const { return m_dwTargetTime; }
+
+	// the sender's vehicle as of dwNow
+	void GetTarget(uint32_t dwNow, UNOC_STATE& out) const;
+
+	// once a frame: current is the local vehicle; fills the speeds to apply (STEER)
+	// or the state to put the vehicle in (SNAP)
+	int Update(uint32_t dwNow, const UNOC_STATE& current, UNOC_STATE& out);
+
+	float GetPositionError() const { return m_fPosError; }
+	float GetAngleError() const { return m_fAngleError; }
+	// position error seen on packet arrival, smoothed over packets
+	float GetAverageError() const { return m_fAvgError; }
+	int GetSnapCount() const { return m_iSnaps; }
+
+private:
+	UNOC_STATE	m_Target;
+	uint32_t	m_dwTargetTime;
+	bool		m_bHasTarget;
+	bool		m_bNewTarget;
+
+	// rate the remaining error closes at, carried between frames (per step)
+	CVector		m_vecPosRate;
+	CVector		m_vecRotRate;
+	bool		m_bHaveUpdate;
+	uint32_t	m_dwLastUpdate;
+
+	float		m_fPosError;
+	float		m_fAngleError;
+	float		m_fAvgError;
+	int			m_iSnaps;
+};
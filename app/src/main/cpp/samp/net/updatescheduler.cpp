@@ -0,0 +1,166 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+
+#include <algorithm>
+
+#define LOD_COST_SMOOTHING	0.1f	// weight of the newest measured tick in the tier cost
+
+CUpdateScheduler::CUpdateScheduler(int iCapacity, float fBudget)
+{
+	m_iCapacity = iCapacity;
+	m_fBudget = fBudget;
+	m_dwNow = 0;
+
+	m_pTier = new int8_t[iCapacity];
+	m_pScheduled = new bool[iCapacity];
+	m_pSeen = new bool[iCapacity];
+	m_pTicked = new bool[iCapacity];
+	m_pLastTick = new uint32_t[iCapacity];
+	m_pCandidates = new int[iCapacity];
+
+	for (int i = 0; i < iCapacity; i++) {
+		Remove(i);
+	}
+
+	memset(&m_Stats, 0, sizeof(m_Stats));
+	for (int i = 0; i < LOD_TIER_COUNT; i++) {
+		m_Stats.fTickCost[i] = LOD_DEFAULT_COST;
+	}
+}
+
+CUpdateScheduler::~CUpdateScheduler()
+{
+	delete[] m_pTier;
+	delete[] m_pScheduled;
+	delete[] m_pSeen;
+	delete[] m_pTicked;
+	delete[] m_pLastTick;
+	delete[] m_pCandidates;
+}
+
+uint32_t CUpdateScheduler::GetInterval(int iTier)
+{
+	switch (iTier)
+	{
+		case LOD_TIER_MID: return LOD_MID_INTERVAL;
+		case LOD_TIER_FAR: return LOD_FAR_INTERVAL;
+		default: return 0;
+	}
+}
+
+void CUpdateScheduler::Remove(int iSlot)
+{
+	m_pTier[iSlot] = -1;
+	m_pScheduled[iSlot] = false;
+	m_pSeen[iSlot] = false;
+	m_pTicked[iSlot] = false;
+	m_pLastTick[iSlot] = 0;
+}
+
+void CUpdateScheduler::BeginFrame(uint32_t dwNow)
+{
+	m_dwNow = dwNow;
+
+	for (int i = 0; i < m_iCapacity; i++) {
+		m_pSeen[i] = false;
+		m_pScheduled[i] = false;
+	}
+
+	for (int i = 0; i < LOD_TIER_COUNT; i++) {
+		m_Stats.iSlots[i] = 0;
+		m_Stats.iUpdated[i] = 0;
+	}
+	m_Stats.iDeferred = 0;
+	m_Stats.fBudget = m_fBudget;
+	m_Stats.fPlanned = 0.0f;
+	m_Stats.fSpent = 0.0f;
+}
+
+void CUpdateScheduler::Classify(int iSlot, float fDistance, bool bOnScreen, bool bForceNear)
+{
+	int iPrev = m_pTier[iSlot];
+
+	// a slot keeps a nearer tier a little past its border so it doesn't flap on it
+	float fNearDist = LOD_NEAR_DIST + (iPrev == LOD_TIER_NEAR ? LOD_HYSTERESIS : 0.0f);
+	float fMidDist = LOD_MID_DIST + (iPrev == LOD_TIER_NEAR || iPrev == LOD_TIER_MID ? LOD_HYSTERESIS : 0.0f);
+
+	int iTier;
+	if (bForceNear || fDistance <= fNearDist)
+		iTier = LOD_TIER_NEAR;
+	else if (bOnScreen && fDistance <= fMidDist)
+		iTier = LOD_TIER_MID;
+	else
+		iTier = LOD_TIER_FAR;
+
+	m_pTier[iSlot] = (int8_t)iTier;
+	m_pSeen[iSlot] = true;
+	m_Stats.iSlots[iTier]++;
+}
+
+void CUpdateScheduler::Schedule()
+{
+	int iCandidates = 0;
+
+	for (int i = 0; i < m_iCapacity; i++)
+	{
+		if (!m_pSeen[i]) continue;
+
+		int iTier = m_pTier[i];
+		if (iTier == LOD_TIER_NEAR) {
+			m_pScheduled[i] = true;
+		}
+		else if (!m_pTicked[i] || m_dwNow - m_pLastTick[i] >= GetInterval(iTier)) {
+			m_pCandidates[iCandidates++] = i;
+		}
+	}
+
+	for (int i = 0; i < m_iCapacity; i++)
+	{
+		if (m_pScheduled[i]) {
+			m_Stats.fPlanned += m_Stats.fTickCost[LOD_TIER_NEAR];
+			m_Stats.iUpdated[LOD_TIER_NEAR]++;
+			m_pLastTick[i] = m_dwNow;
+			m_pTicked[i] = true;
+		}
+	}
+
+	// most overdue first, a slot that never ticked comes before everything
+	auto overdue = [this](int iSlot) {
+		if (!m_pTicked[iSlot]) return 1e9f;
+		return (float)(m_dwNow - m_pLastTick[iSlot]) / (float)GetInterval(m_pTier[iSlot]);
+	};
+	std::sort(m_pCandidates, m_pCandidates + iCandidates, [&](int a, int b) {
+		return overdue(a) > overdue(b);
+	});
+
+	// near slots tick regardless, the budget is for everything further out
+	float fPlanned = 0.0f;
+	for (int i = 0; i < iCandidates; i++)
+	{
+		int iSlot = m_pCandidates[i];
+		int iTier = m_pTier[iSlot];
+		float fCost = m_Stats.fTickCost[iTier];
+
+		if (i > 0 && fPlanned + fCost > m_fBudget) {
+			m_Stats.iDeferred++;
+			continue;
+		}
+
+		m_pScheduled[iSlot] = true;
+		m_pLastTick[iSlot] = m_dwNow;
+		m_pTicked[iSlot] = true;
+		fPlanned += fCost;
+		m_Stats.fPlanned += fCost;
+		m_Stats.iUpdated[iTier]++;
+	}
+}
+
+void CUpdateScheduler::ReportCost(int iSlot, float fMicros)
+{
+	int iTier = m_pTier[iSlot];
+	if (iTier < 0) return;
+
+	m_Stats.fTickCost[iTier] += (fMicros - m_Stats.fTickCost[iTier]) * LOD_COST_SMOOTHING;
+	m_Stats.fSpent += fMicros;
+}
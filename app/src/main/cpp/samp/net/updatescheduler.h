@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+// Spreads the per-entity logic of a pool over frames by level of detail. Each frame the
+// pool classifies its streamed slots by camera distance and whether they're on screen:
+// near slots run every frame, mid and far ones on a slower tick and the pool only keeps
+// their interpolation going in between. Due mid and far slots are picked most overdue
+// first until the frame's CPU budget for them is used up, the rest wait for the next
+// frame; the most overdue slot always runs so nothing starves. Costs are reported by the caller,
+// so a synthetic clock drives the scheduler the same way as the game does.
+
+#define LOD_TIER_NEAR		0
+#define LOD_TIER_MID		1
+#define LOD_TIER_FAR		2
+#define LOD_TIER_COUNT		3
+
+#define LOD_NEAR_DIST		40.0f	// within this a slot is near, on screen or not
+#define LOD_MID_DIST		120.0f	// within this an on-screen slot is mid, else far
+#define LOD_HYSTERESIS		5.0f	// a slot keeps its tier until it's this far past a border
+#define LOD_MID_INTERVAL	66		// ms between logic ticks of a mid slot
+#define LOD_FAR_INTERVAL	200		// ms between logic ticks of a far slot
+#define LOD_DEFAULT_COST	20.0f	// us a tick is assumed to cost before one is measured
+
+struct LOD_STATS
+{
+	int		iSlots[LOD_TIER_COUNT];		// classified this frame
+	int		iUpdated[LOD_TIER_COUNT];	// ticked this frame
+	int		iDeferred;					// due but over the budget
+	float	fBudget;					// us for mid and far ticks
+	float	fPlanned;					// us the scheduled ticks were expected to cost, near ones too
+	float	fSpent;						// us reported for this frame, near ones too
+	float	fTickCost[LOD_TIER_COUNT];	// us a tick costs on average
+};
+
+class CUpdateScheduler
+{
+public:
+	CUpdateScheduler(int iCapacity, float fBudget);
+	~CUpdateScheduler();
+
+	void SetBudget(float fBudget) { m_fBudget = fBudget; }
+
+	void BeginFrame(uint32_t dwNow);
+	// every active slot once a frame; bForceNear for slots the local player deals with
+	void Classify(int iSlot, float fDistance, bool bOnScreen, bool bForceNear);
+	// picks the slots that tick this frame, after all Classify calls
+	void Schedule();
+
+	bool IsScheduled(int iSlot) const { return m_pScheduled[iSlot]; }
+	int GetTier(int iSlot) const { return m_pTier[iSlot]; }
+
+	// measured cost of a slot's tick this frame
+	void ReportCost(int iSlot, float fMicros);
+	void Remove(int iSlot);
+
+	const LOD_STATS& GetStats() const { return m_Stats; }
+
+private:
+	static uint32_t GetInterval(int iTier);
+
+	int			m_iCapacity;
+	float		m_fBudget;
+	uint32_t	m_dwNow;
+
+	int8_t*		m_pTier;			// -1 for a slot that was never classified
+	bool*		m_pScheduled;
+	bool*		m_pSeen;			// classified this frame
+	bool*		m_pTicked;			// ticked at least once
+	uint32_t*	m_pLastTick;
+
+	int*		m_pCandidates;
+	LOD_STATS	m_Stats;
+};
@@ -2,11 +2,16 @@
 #include "../game/game.h"
 #include "netgame.h"
 #include "vehiclepool.h"
+#include "../game/Streaming.h"
+
+#include <chrono>
 
 extern CGame* pGame;
 extern CNetGame* pNetGame;
 
-CVehiclePool::CVehiclePool()
+void DecompressNormalVector(RwV3d* vecOut, RwV3d vecIn);
+
+CVehiclePool::CVehiclePool() : m_Scheduler(MAX_VEHICLES, VEHICLE_LOD_BUDGET)
 {
     for (int i = 0; i < MAX_VEHICLES; i++)
     {
@@ -17,11 +22,14 @@ CVehiclePool::CVehiclePool()
         m_bIsWasted[i] = false;
         m_bIsMarker[i] = 0;
         m_dwWastedTime[i] = 0;
+        m_dwModelRequest[i] = INVALID_MODEL_REQUEST;
     }
 }
 // 0.3.7
 CVehiclePool::~CVehiclePool()
 {
+    CStreaming::GetModelRequests().CancelOwner(this);
+
     for (int i = 0; i < MAX_VEHICLES; i++)
     {
         Delete(i);
@@ -30,11 +38,39 @@ CVehiclePool::~CVehiclePool()
 // 0.3.7
 bool CVehiclePool::New(NEW_VEHICLE* new_veh)
 {
-    if (m_pVehicles[new_veh->VehicleID]) {
+    if (m_pVehicles[new_veh->VehicleID] || IsPending(new_veh->VehicleID)) {
         //if (pUI) gui->chat()->addDebugMessage("Warning: vehicle %u was not deleted", new_veh->VehicleID);
         Delete(new_veh->VehicleID);
     }
 
+    int iModels[5];
+    int iModelCount = CVehicle::GetRequiredModels(new_veh->iVehicleType, iModels);
+
+    // a join burst streams its vehicles in over several frames instead of blocking on each
+    NEW_VEHICLE info = *new_veh;
+    MODELREQUEST hRequest = CStreaming::GetModelRequests().Request(iModels, iModelCount, MODEL_PRIORITY_NORMAL,
+        [this, info](bool bLoaded) mutable {
+            m_dwModelRequest[info.VehicleID] = INVALID_MODEL_REQUEST;
+
+            // the streamer fell behind: load it blocking like before rather than lose a
+            // vehicle the server created
+            if (!bLoaded) FLog("Vehicle %d: model %d not streamed in time, loading it now", info.VehicleID, info.iVehicleType);
+
+            if (Create(&info)) ApplyDeferred(info.VehicleID);
+            else m_Deferred.erase(info.VehicleID);
+        }, this);
+
+    // still waiting if the callback didn't run right away
+    if (CStreaming::GetModelRequests().GetState(hRequest) == MODEL_REQUEST_PENDING) {
+        m_dwModelRequest[new_veh->VehicleID] = hRequest;
+        m_vecPendingPos[new_veh->VehicleID] = new_veh->vecPos;
+    }
+
+    return true;
+}
+
+bool CVehiclePool::Create(NEW_VEHICLE* new_veh)
+{
     CVehicle* pNewVehicle = pGame->NewVehicle(
             new_veh->iVehicleType,
             new_veh->vecPos.x,
@@ -91,17 +127,56 @@ bool CVehiclePool::New(NEW_VEHICLE* new_veh)
     return true;
 }
 
+bool CVehiclePool::Apply(VEHICLEID VehicleID, std::function<void(CVehicle*)> fn)
+{
+    if (IsPending(VehicleID)) {
+        m_Deferred[VehicleID].push_back(std::move(fn));
+        return true;
+    }
+
+    CVehicle* pVehicle = GetAt(VehicleID);
+    if (!pVehicle) return false;
+
+    fn(pVehicle);
+    return true;
+}
+
+void CVehiclePool::ApplyDeferred(VEHICLEID VehicleID)
+{
+    auto it = m_Deferred.find(VehicleID);
+    if (it == m_Deferred.end()) return;
+
+    std::vector<std::function<void(CVehicle*)>> deferred = std::move(it->second);
+    m_Deferred.erase(it);
+
+    for (auto& fn : deferred)
+    {
+        // one of them may have taken the vehicle away
+        CVehicle* pVehicle = GetAt(VehicleID);
+        if (!pVehicle) break;
+        fn(pVehicle);
+    }
+}
+
 bool CVehiclePool::Delete(VEHICLEID VehicleID)
 {
+    if (IsPending(VehicleID)) {
+        CStreaming::GetModelRequests().Cancel(m_dwModelRequest[VehicleID]);
+        m_dwModelRequest[VehicleID] = INVALID_MODEL_REQUEST;
+    }
+    m_Deferred.erase(VehicleID);
+
     if(!GetSlotState(VehicleID) || !m_pVehicles[VehicleID])
         return false;
 
     m_bIsActive[VehicleID] = false;
     m_bIsMarker[VehicleID] = 0;
     m_bVehicleSlotState[VehicleID] = false;
+    m_Scheduler.Remove(VehicleID);
     delete m_pVehicles[VehicleID];
     m_pVehicles[VehicleID] = nullptr;
     m_pGTAVehicles[VehicleID] = nullptr;
+    m_UnoccupiedSync.erase(VehicleID);
 
     //CountVehicles();
 
@@ -110,6 +185,13 @@ bool CVehiclePool::Delete(VEHICLEID VehicleID)
 // 0.3.7
 void CVehiclePool::AssignSpecialParamsToVehicle(VEHICLEID VehicleID, uint8_t byteObjective, uint8_t byteDoorsLocked)
 {
+    if (IsPending(VehicleID)) {
+        Apply(VehicleID, [this, VehicleID, byteObjective, byteDoorsLocked](CVehicle*) {
+            AssignSpecialParamsToVehicle(VehicleID, byteObjective, byteDoorsLocked);
+        });
+        return;
+    }
+
     if (VehicleID < MAX_VEHICLES && m_bVehicleSlotState[VehicleID])
     {
         CVehicle* pVehicle = m_pVehicles[VehicleID];
@@ -128,9 +210,9 @@ void CVehiclePool::AssignSpecialParamsToVehicle(VEHICLEID VehicleID, uint8_t byt
 
 void CVehiclePool::LinkToInterior(VEHICLEID VehicleID, uint8_t byteInterior)
 {
-    if (m_bVehicleSlotState[VehicleID] && m_pVehicles[VehicleID]) {
-        m_pVehicles[VehicleID]->LinkToInterior(byteInterior);
-    }
+    Apply(VehicleID, [byteInterior](CVehicle* pVehicle) {
+        pVehicle->LinkToInterior(byteInterior);
+    });
 }
 // 0.3.7
 VEHICLEID CVehiclePool::FindNearestToLocalPlayerPed()
@@ -174,10 +256,34 @@ void CVehiclePool::Process()
     uint32_t dwThisTick = GetTickCount();
     CLocalPlayer* pLocalPlayer = pNetGame->GetPlayerPool()->GetLocalPlayer();
 
+    static CCamera& TheCamera = *reinterpret_cast<CCamera*>(g_libGTASA + (VER_x32 ? 0x00951FA8 : 0xBBA8D0));
+    const CVector& vecCamPos = TheCamera.GetPosition();
+    const CVector& vecCamForward = TheCamera.GetForward();
+
+    CVehicleGTA* pLocalVehicle = nullptr;
+    if (pLocalPlayer && pLocalPlayer->GetPlayerPed()) {
+        pLocalVehicle = pLocalPlayer->GetPlayerPed()->GetGtaVehicle();
+    }
+
+    // far and off-screen vehicles tick less often, the one we're in always
+    m_Scheduler.BeginFrame(dwThisTick);
+    for (VEHICLEID VehicleID = 0; VehicleID < MAX_VEHICLES; VehicleID++)
+    {
+        if (!m_bVehicleSlotState[VehicleID] || !m_bIsActive[VehicleID]) continue;
+
+        CVehicleGTA* pGtaVehicle = m_pVehicles[VehicleID]->m_pVehicle;
+        const CVector& vecPos = pGtaVehicle->GetPosition();
+        m_Scheduler.Classify(VehicleID, (vecPos - vecCamPos).Magnitude(),
+            CSpatialGrid::IsInViewCone(vecCamPos, vecCamForward, vecPos, 5.0f), pGtaVehicle == pLocalVehicle);
+    }
+    m_Scheduler.Schedule();
+
     for (VEHICLEID VehicleID = 0; VehicleID < MAX_VEHICLES; VehicleID++)
     {
-        if (m_bVehicleSlotState[VehicleID] && m_bIsActive[VehicleID])
+        if (m_bVehicleSlotState[VehicleID] && m_bIsActive[VehicleID] && m_Scheduler.IsScheduled(VehicleID))
         {
+            auto start = std::chrono::steady_clock::now();
+
             if (m_bIsWasted[VehicleID] && (dwThisTick - m_dwWastedTime[VehicleID]) > 15000)
             {
                 this->Delete(VehicleID);
@@ -244,7 +350,79 @@ void CVehiclePool::Process()
                     }
                 }
             }
+
+            m_Scheduler.ReportCost(VehicleID, std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+
+    ProcessUnoccupiedSync(dwThisTick);
+}
+
+void CVehiclePool::StoreUnoccupiedSync(UNOCCUPIED_SYNC_DATA* pSync)
+{
+    CVehicle* pVehicle = GetAt(pSync->vehicleId);
+    if (!pVehicle || !pVehicle->m_pVehicle || pVehicle->HasADriver()) return;
+
+    UNOC_STATE target;
+    target.vecPos = pSync->vecPos;
+    DecompressNormalVector(&target.vecRight, pSync->vecRoll);
+    DecompressNormalVector(&target.vecUp, pSync->vecDirection);
+    target.vecMoveSpeed = pSync->vecMoveSpeed;
+    target.vecTurnSpeed = pSync->vecTurnSpeed;
+
+    // the packet carries no time of its own, it counts from its arrival
+    m_UnoccupiedSync[pSync->vehicleId].SetTarget(GetTickCount(), target);
+}
+
+void CVehiclePool::ProcessUnoccupiedSync(uint32_t dwNow)
+{
+    for (auto it = m_UnoccupiedSync.begin(); it != m_UnoccupiedSync.end();)
+    {
+        CVehicle* pVehicle = GetAt(it->first);
+
+        // once someone drives it their sync owns the vehicle, it keeps its current motion
+        if (!pVehicle || !pVehicle->m_pVehicle || pVehicle->HasADriver()) {
+            it = m_UnoccupiedSync.erase(it);
+            continue;
+        }
+
+        RwMatrix matWorld = pVehicle->m_pVehicle->GetMatrix().ToRwMatrix();
+
+        UNOC_STATE current;
+        current.vecPos = matWorld.pos;
+        current.vecRight = matWorld.right;
+        current.vecUp = matWorld.up;
+        current.vecMoveSpeed = pVehicle->m_pVehicle->GetMoveSpeed();
+        current.vecTurnSpeed = pVehicle->m_pVehicle->GetTurnSpeed();
+
+        UNOC_STATE target;
+        int iCorrection = it->second.Update(dwNow, current, target);
+
+        if (iCorrection == UNOC_CORRECTION_NONE)
+        {
+            if (!it->second.HasTarget()) {
+                it = m_UnoccupiedSync.erase(it);
+                continue;
+            }
+        }
+        else if (iCorrection == UNOC_CORRECTION_SNAP || !pVehicle->m_pVehicle->IsAdded())
+        {
+            matWorld.pos = target.vecPos;
+            matWorld.right = target.vecRight;
+            matWorld.up = target.vecUp;
+            matWorld.at = target.vecRight.Cross(target.vecUp);
+
+            pVehicle->m_pVehicle->SetMatrix((CMatrix&)matWorld);
+            pVehicle->m_pVehicle->SetVelocity(target.vecMoveSpeed);
+            pVehicle->m_pVehicle->SetTurnSpeed(target.vecTurnSpeed);
+        }
+        else
+        {
+            pVehicle->m_pVehicle->SetVelocity(target.vecMoveSpeed);
+            pVehicle->m_pVehicle->SetTurnSpeed(target.vecTurnSpeed);
         }
+
+        ++it;
     }
 }
 /*if((GetTickCount() - m_dwLastUndrivenProcessTick[x]) < 100 &&
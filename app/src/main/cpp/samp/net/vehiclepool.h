@@ -1,7 +1,14 @@
 #pragma once
 
 #define INVALID_VEHICLE_ID	0xFFFF
+#define VEHICLE_LOD_BUDGET	1000.0f		// us of mid and far vehicle ticks per frame
 #include "../game/util.h"
+#include "../game/modelrequests.h"
+#include "unoccupiedsync.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
 
 #pragma pack(push, 1)
 typedef struct _NEW_VEHICLE
@@ -54,12 +61,27 @@ public:
 	CVehiclePool();
 	~CVehiclePool();
 
+	// creation waits for the vehicle's models, the slot stays empty until then
 	bool New(NEW_VEHICLE* new_veh);
 	bool Delete(VEHICLEID VehicleID);
+	bool IsPending(VEHICLEID VehicleID) { return VehicleID < MAX_VEHICLES && m_dwModelRequest[VehicleID] != INVALID_MODEL_REQUEST; }
+	MODELREQUEST GetPendingRequest(VEHICLEID VehicleID) { return IsPending(VehicleID) ? m_dwModelRequest[VehicleID] : INVALID_MODEL_REQUEST; }
+	const CVector& GetPendingPos(VEHICLEID VehicleID) { return m_vecPendingPos[VehicleID]; }
+	// runs fn on the vehicle, or once it's created if it's still pending; false if there's neither
+	bool Apply(VEHICLEID VehicleID, std::function<void(CVehicle*)> fn);
 
 	void Process();
 	void NotifyVehicleDeath(VEHICLEID VehicleID);
 
+	// sync of a vehicle nobody drives, steered towards over the next frames
+	void StoreUnoccupiedSync(UNOCCUPIED_SYNC_DATA* pSync);
+
+	const CUpdateScheduler& GetUpdateScheduler() { return m_Scheduler; }
+	CUnoccupiedCorrector* GetUnoccupiedCorrector(VEHICLEID VehicleID) {
+		auto it = m_UnoccupiedSync.find(VehicleID);
+		return it != m_UnoccupiedSync.end() ? &it->second : nullptr;
+	}
+
 	// 0.3.7
 	CVehicle* GetAt(VEHICLEID vehicleID) {
 		if (vehicleID < MAX_VEHICLES && m_bVehicleSlotState[vehicleID])
@@ -103,6 +125,10 @@ public:
 	CVector			m_vecSpawnPos[MAX_VEHICLES];
 	float 			m_fSpawnRotation[MAX_VEHICLES];
 private:
+	bool Create(NEW_VEHICLE* new_veh);
+	void ApplyDeferred(VEHICLEID VehicleID);
+	void ProcessUnoccupiedSync(uint32_t dwNow);
+
 	CVehicle* m_pVehicles[MAX_VEHICLES];
 	bool m_bVehicleSlotState[MAX_VEHICLES];
     CVehicleGTA* m_pGTAVehicles[MAX_VEHICLES];
@@ -115,4 +141,14 @@ private:
 
 	PLAYERID		m_lastUndrivenId[MAX_VEHICLES]; // not used
 	uint32_t		m_dwLastUndrivenProcessTick[MAX_VEHICLES];
+
+	MODELREQUEST	m_dwModelRequest[MAX_VEHICLES];
+	CVector			m_vecPendingPos[MAX_VEHICLES];
+	// what RPCs did to pending vehicles, in the order they came
+	std::unordered_map<VEHICLEID, std::vector<std::function<void(CVehicle*)>>> m_Deferred;
+
+	// only vehicles with unoccupied sync in flight
+	std::unordered_map<VEHICLEID, CUnoccupiedCorrector> m_UnoccupiedSync;
+
+	CUpdateScheduler m_Scheduler;
 };
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "../main.h"
+#include "../game/game.h"
+#include "netgame.h"
+#include <algorithm>
+
+CVisibilityService::CVisibilityService(RaycastFunc raycast, int iBudgetPerFrame)
+{
+	m_Raycast = raycast;
+	m_iBudgetPerFrame = iBudgetPerFrame;
+	m_iBudget = iBudgetPerFrame;
+	m_dwNow = 0;
+	m_dwLastEvict = 0;
+}
+
+void CVisibilityService::Clear()
+{
+	m_Entries.clear();
+	m_Pending.clear();
+}
+
+void CVisibilityService::Forget(uint32_t dwKey)
+{
+	auto it = m_Entries.find(dwKey);
+	if (it == m_Entries.end()) return;
+
+	// a key requested again must not sit in the queue twice
+	if (it->second.bPending) {
+		m_Pending.erase(std::find(m_Pending.begin(), m_Pending.end(), dwKey));
+	}
+	m_Entries.erase(it);
+}
+
+void CVisibilityService::Process(uint32_t dwNow)
+{
+	m_dwNow = dwNow;
+	m_iBudget = m_iBudgetPerFrame;
+
+	// oldest requests first, whatever is left goes to first-time requests this frame
+	while (m_iBudget > 0 && !m_Pending.empty())
+	{
+		uint32_t dwKey = m_Pending.front();
+		m_Pending.pop_front();
+
+		auto it = m_Entries.find(dwKey);
+		if (it == m_Entries.end()) continue;
+
+		it->second.bPending = false;
+		m_iBudget--;
+		Test(it->second);
+	}
+
+	if (dwNow - m_dwLastEvict >= 1000)
+	{
+		m_dwLastEvict = dwNow;
+
+		for (auto it = m_Entries.begin(); it != m_Entries.end(); )
+		{
+			if (dwNow - it->second.dwLastRequest > LOS_EVICT_TIME) {
+				if (it->second.bPending) {
+					m_Pending.erase(std::find(m_Pending.begin(), m_Pending.end(), it->first));
+				}
+				it = m_Entries.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+}
+
+bool CVisibilityService::IsVisible(uint32_t dwKey, const CVector& vecFrom, const CVector& vecTo)
+{
+	Entry& entry = m_Entries[dwKey];
+
+	entry.dwLastRequest = m_dwNow ? m_dwNow : 1;
+	entry.vecReqFrom = vecFrom;
+	entry.vecReqTo = vecTo;
+
+	if (entry.bPending) {
+		return entry.bVisible;
+	}
+
+	if (!entry.bTested)
+	{
+		// unseen pairs get an immediate test while the frame budget lasts
+		if (m_iBudget > 0) {
+			m_iBudget--;
+			Test(entry);
+		}
+		else {
+			entry.bPending = true;
+			m_Pending.push_back(dwKey);
+		}
+	}
+	else if (NeedsRetest(entry, vecFrom, vecTo))
+	{
+		entry.bPending = true;
+		m_Pending.push_back(dwKey);
+	}
+
+	return entry.bVisible;
+}
+
+bool CVisibilityService::NeedsRetest(const Entry& entry, const CVector& vecFrom, const CVector& vecTo) const
+{
+	// a flip in progress is confirmed as soon as possible
+	if (entry.iStreak > 0) return true;
+	if (m_dwNow - entry.dwLastTest >= LOS_RESULT_TTL) return true;
+
+	CVector vecFromDelta = vecFrom - entry.vecFrom;
+	CVector vecToDelta = vecTo - entry.vecTo;
+	float fThreshold = LOS_MOVE_THRESHOLD * LOS_MOVE_THRESHOLD;
+
+	return vecFromDelta.SquaredMagnitude() > fThreshold || vecToDelta.SquaredMagnitude() > fThreshold;
+}
+
+void CVisibilityService::Test(Entry& entry)
+{
+	bool bClear = m_Raycast(entry.vecReqFrom, entry.vecReqTo);
+
+	entry.vecFrom = entry.vecReqFrom;
+	entry.vecTo = entry.vecReqTo;
+	entry.dwLastTest = m_dwNow;
+
+	if (!entry.bTested)
+	{
+		entry.bTested = true;
+		entry.bVisible = bClear;
+		entry.iStreak = 0;
+		return;
+	}
+
+	// hysteresis: one stray hit or miss doesn't flicker the tag
+	if (bClear != entry.bVisible)
+	{
+		if (++entry.iStreak >= LOS_FLIP_STREAK) {
+			entry.bVisible = bClear;
+			entry.iStreak = 0;
+		}
+	}
+	else {
+		entry.iStreak = 0;
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <deque>
+
+// Amortized line-of-sight checks for name tags and 3D text labels.
+// Callers ask for the last known visibility of a keyed pair of points, the
+// service re-tests it when the result is too old or an endpoint moved, and
+// spends at most a fixed number of world raycasts per frame doing so.
+
+#define LOS_RAYCASTS_PER_FRAME	12
+#define LOS_RESULT_TTL			250		// ms
+#define LOS_MOVE_THRESHOLD		0.5f	// units either endpoint may drift before a re-test
+#define LOS_EVICT_TIME			5000	// ms without a request before the entry is dropped
+#define LOS_FLIP_STREAK			2		// consecutive opposite results needed to flip
+
+#define LOS_KEY_PLAYER(id)		((1u << 16) | (uint16_t)(id))
+#define LOS_KEY_LABEL(id)		((2u << 16) | (uint16_t)(id))
+
+class CVisibilityService
+{
+public:
+	typedef std::function<bool(const CVector& vecFrom, const CVector& vecTo)> RaycastFunc;
+
+	CVisibilityService(RaycastFunc raycast, int iBudgetPerFrame = LOS_RAYCASTS_PER_FRAME);
+
+	// once per frame, before any IsVisible() call of that frame
+	void Process(uint32_t dwNow);
+
+	bool IsVisible(uint32_t dwKey, const CVector& vecFrom, const CVector& vecTo);
+	void Forget(uint32_t dwKey);
+	void Clear();
+
+	int GetRaycastsThisFrame() const { return m_iBudgetPerFrame - m_iBudget; }
+	int GetPendingCount() const { return (int)m_Pending.size(); }
+
+private:
+	struct Entry
+	{
+		CVector		vecFrom;		// endpoints of the last raycast
+		CVector		vecTo;
+		CVector		vecReqFrom;		// endpoints of the latest request
+		CVector		vecReqTo;
+		uint32_t	dwLastTest = 0;
+		uint32_t	dwLastRequest = 0;
+		bool		bVisible = false;
+		bool		bTested = false;
+		bool		bPending = false;
+		int			iStreak = 0;
+	};
+
+	bool NeedsRetest(const Entry& entry, const CVector& vecFrom, const CVector& vecTo) const;
+	void Test(Entry& entry);
+
+	RaycastFunc		m_Raycast;
+	int				m_iBudgetPerFrame;
+	int				m_iBudget;
+	uint32_t		m_dwNow;
+	uint32_t		m_dwLastEvict;
+
+	std::unordered_map<uint32_t, Entry>	m_Entries;
+	std::deque<uint32_t>				m_Pending;
+};
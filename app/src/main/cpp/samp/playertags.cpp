@@ -35,8 +35,14 @@ void CPlayerTags::Render(ImGuiRenderer* renderer)
 		CPlayerPool* pPlayerPool = pNetGame->GetPlayerPool();
         matLocal = pGame->FindPlayerPed()->m_pPed->GetMatrix().ToRwMatrix();
 
-		for (PLAYERID playerId = 0; playerId < MAX_PLAYERS; playerId++)
+		// only peds near the camera and in front of it, the exact distance check follows
+		static int iVisible[MAX_PLAYERS];
+		int iCount = pPlayerPool->GetSpatialGrid().QueryVisible(TheCamera.GetPosition(), TheCamera.GetForward(),
+			pNetGame->m_pNetSet->fNameTagDrawDistance, iVisible, MAX_PLAYERS, 3.0f);
+
+		for (int i = 0; i < iCount; i++)
 		{
+			PLAYERID playerId = (PLAYERID)iVisible[i];
 			if (pPlayerPool->GetSlotState(playerId) == true)
 			{
 				CRemotePlayer* pRemotePlayer = pPlayerPool->GetAt(playerId);
@@ -70,7 +76,7 @@ void CPlayerTags::Render(ImGuiRenderer* renderer)
 
 						if (pNetGame->m_pNetSet->bNameTagLOS)
 						{
-							dwHitEntity = CWorld::GetIsLineOfSightClear(vecPos, TheCamera.GetPosition(), true, false, false, true, false, false, false);
+							dwHitEntity = pNetGame->GetVisibilityService()->IsVisible(LOS_KEY_PLAYER(playerId), vecPos, TheCamera.GetPosition());
 						}
 
 						if (!pNetGame->m_pNetSet->bNameTagLOS || dwHitEntity && !pRemotePlayer->IsNPC())
@@ -111,7 +117,7 @@ void CPlayerTags::Draw(ImGuiRenderer* renderer, CVector* vec, const char* szNick
 	//pos.x -= ImGui::CalcTextSize(szNick).x / 2;
 	//ImGuiEx::AddOutlinedText(ImGui::GetBackgroundDrawList(), pos, __builtin_bswap32(dwColor | (0x000000FF)), true, szNick);
 	pos.x -= renderer->calculateTextSize(szNick, UISettings::fontSize() / 2).x / 2;
-	renderer->drawText(pos, __builtin_bswap32(dwColor | (0x000000FF)), std::string(szNick), true, UISettings::fontSize() / 2);
+	renderer->drawText(pos, __builtin_bswap32(dwColor | (0x000000FF)), szNick, true, UISettings::fontSize() / 2);
 
 
 	// Health bar
@@ -0,0 +1,315 @@
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+static CProfileRing* g_pProfileRings[PROFILE_MAX_THREADS];
+static std::atomic<int> g_iProfileRingCount(0);
+// taken when a thread gets its ring, never on the recording path
+static std::mutex g_ProfileRingMutex;
+
+static thread_local CProfileRing* t_pProfileRing = nullptr;
+static thread_local bool t_bProfileRegistered = false;
+
+// hands the ring back when the thread exits, RakNet and voice threads come and go with the connection
+struct ProfileRingOwner
+{
+	CProfileRing* pRing = nullptr;
+	~ProfileRingOwner() {
+		if (pRing) pRing->Release();
+	}
+};
+static thread_local ProfileRingOwner t_ProfileRingOwner;
+
+// rolling stats, main thread only
+struct ProfileScopeStat
+{
+	const char*	szName;
+	int			iRing;
+	uint64_t	qwFrameNs;
+	int			iFrameCalls;
+	float		fLastMs;
+	int			iLastCalls;
+	float		fHistory[PROFILE_STAT_FRAMES];
+};
+
+static ProfileScopeStat g_ProfileStats[PROFILE_MAX_SCOPES];
+static int g_iProfileStats = 0;
+static uint32_t g_dwProfileStatPos[PROFILE_MAX_THREADS];
+static float g_fProfileFrames[PROFILE_STAT_FRAMES];
+static int g_iProfileHistoryPos = 0;
+static int g_iProfileHistoryCount = 0;
+static uint64_t g_qwProfileLastFrame = 0;
+static std::vector<PROFILE_EVENT> g_ProfileScratch;
+
+uint32_t CProfileRing::Read(uint32_t dwFrom, std::vector<PROFILE_EVENT>& out) const
+{
+	uint32_t dwHead = m_dwHead.load(std::memory_order_acquire);
+	// the slot after the head is the next one overwritten, it's never read
+	if (dwHead - dwFrom > PROFILE_RING_SIZE - 1) dwFrom = dwHead - (PROFILE_RING_SIZE - 1);
+
+	size_t base = out.size();
+	for (uint32_t i = dwFrom; i != dwHead; i++)
+	{
+		const PROFILE_EVENT& event = m_Events[i & (PROFILE_RING_SIZE - 1)];
+		out.push_back({
+			__atomic_load_n(&event.szName, __ATOMIC_RELAXED),
+			__atomic_load_n(&event.qwStart, __ATOMIC_RELAXED),
+			__atomic_load_n(&event.dwDuration, __ATOMIC_RELAXED) });
+	}
+
+	// the producer kept going while we copied: everything up to the slot it may be
+	// writing right now can be torn, drop it
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	uint32_t dwNewHead = m_dwHead.load(std::memory_order_relaxed);
+	if (dwNewHead + 1 - dwFrom > PROFILE_RING_SIZE)
+	{
+		uint32_t dwLost = std::min(dwNewHead + 1 - PROFILE_RING_SIZE - dwFrom, dwHead - dwFrom);
+		out.erase(out.begin() + base, out.begin() + base + dwLost);
+	}
+
+	return dwHead;
+}
+
+uint64_t CProfiler::Now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+CProfileRing* CProfiler::AcquireRing(const char* szThread)
+{
+	std::lock_guard<std::mutex> lock(g_ProfileRingMutex);
+
+	int iCount = g_iProfileRingCount.load(std::memory_order_relaxed);
+	for (int i = 0; i < iCount; i++)
+	{
+		CProfileRing* pRing = g_pProfileRings[i];
+		if (!pRing->m_bOwned.load(std::memory_order_acquire) && !strcmp(pRing->GetThreadName(), szThread))
+		{
+			pRing->m_bOwned.store(true, std::memory_order_relaxed);
+			return pRing;
+		}
+	}
+
+	if (iCount >= PROFILE_MAX_THREADS) return nullptr;
+
+	CProfileRing* pRing = new CProfileRing(szThread);
+	__atomic_store_n(&g_pProfileRings[iCount], pRing, __ATOMIC_RELEASE);
+	g_iProfileRingCount.store(iCount + 1, std::memory_order_release);
+	return pRing;
+}
+
+CProfileRing* CProfiler::GetThreadRing()
+{
+	if (!t_bProfileRegistered)
+	{
+		t_bProfileRegistered = true;
+		t_pProfileRing = AcquireRing("thread");
+		t_ProfileRingOwner.pRing = t_pProfileRing;
+	}
+
+	return t_pProfileRing;
+}
+
+void CProfiler::SetThreadName(const char* szName)
+{
+	if (t_bProfileRegistered)
+	{
+		if (t_pProfileRing && t_pProfileRing->GetThreadName() != szName) {
+			t_pProfileRing->m_szThread.store(szName, std::memory_order_relaxed);
+		}
+		return;
+	}
+
+	t_bProfileRegistered = true;
+	t_pProfileRing = AcquireRing(szName);
+	t_ProfileRingOwner.pRing = t_pProfileRing;
+}
+
+int CProfiler::GetRingCount()
+{
+	return g_iProfileRingCount.load(std::memory_order_acquire);
+}
+
+CProfileRing* CProfiler::GetRing(int iIndex)
+{
+	if (iIndex < 0 || iIndex >= GetRingCount()) return nullptr;
+	return __atomic_load_n(&g_pProfileRings[iIndex], __ATOMIC_ACQUIRE);
+}
+
+static ProfileScopeStat* FindScopeStat(const char* szName, int iRing)
+{
+	for (int i = 0; i < g_iProfileStats; i++)
+	{
+		ProfileScopeStat& stat = g_ProfileStats[i];
+		if (stat.iRing == iRing && (stat.szName == szName || !strcmp(stat.szName, szName))) return &stat;
+	}
+
+	if (g_iProfileStats >= PROFILE_MAX_SCOPES) return nullptr;
+
+	ProfileScopeStat& stat = g_ProfileStats[g_iProfileStats++];
+	memset(&stat, 0, sizeof(stat));
+	stat.szName = szName;
+	stat.iRing = iRing;
+	return &stat;
+}
+
+void CProfiler::EndFrame()
+{
+	uint64_t qwNow = Now();
+
+	int iRings = GetRingCount();
+	for (int i = 0; i < iRings; i++)
+	{
+		CProfileRing* pRing = GetRing(i);
+		if (!pRing) continue;
+
+		g_ProfileScratch.clear();
+		g_dwProfileStatPos[i] = pRing->Read(g_dwProfileStatPos[i], g_ProfileScratch);
+
+		for (const PROFILE_EVENT& event : g_ProfileScratch)
+		{
+			ProfileScopeStat* pStat = FindScopeStat(event.szName, i);
+			if (!pStat) continue;
+			pStat->qwFrameNs += event.dwDuration;
+			pStat->iFrameCalls++;
+		}
+	}
+
+	g_fProfileFrames[g_iProfileHistoryPos] = g_qwProfileLastFrame ? (float)(qwNow - g_qwProfileLastFrame) / 1000000.0f : 0.0f;
+	g_qwProfileLastFrame = qwNow;
+
+	for (int i = 0; i < g_iProfileStats; i++)
+	{
+		ProfileScopeStat& stat = g_ProfileStats[i];
+		stat.fLastMs = (float)stat.qwFrameNs / 1000000.0f;
+		stat.iLastCalls = stat.iFrameCalls;
+		stat.fHistory[g_iProfileHistoryPos] = stat.fLastMs;
+		stat.qwFrameNs = 0;
+		stat.iFrameCalls = 0;
+	}
+
+	g_iProfileHistoryPos = (g_iProfileHistoryPos + 1) % PROFILE_STAT_FRAMES;
+	if (g_iProfileHistoryCount < PROFILE_STAT_FRAMES) g_iProfileHistoryCount++;
+}
+
+static void SummarizeHistory(const float* pHistory, float& fAvg, float& fMax)
+{
+	float fSum = 0.0f;
+	fMax = 0.0f;
+	for (int i = 0; i < g_iProfileHistoryCount; i++)
+	{
+		fSum += pHistory[i];
+		fMax = std::max(fMax, pHistory[i]);
+	}
+	fAvg = g_iProfileHistoryCount ? fSum / g_iProfileHistoryCount : 0.0f;
+}
+
+int CProfiler::GetStats(PROFILE_STAT* pStats, int iMax)
+{
+	if (iMax <= 0) return 0;
+
+	PROFILE_STAT& frame = pStats[0];
+	frame.szName = "Frame";
+	frame.szThread = "";
+	frame.fLastMs = GetFrameMs();
+	frame.iCalls = 1;
+	SummarizeHistory(g_fProfileFrames, frame.fAvgMs, frame.fMaxMs);
+
+	std::vector<PROFILE_STAT> scopes;
+	scopes.reserve(g_iProfileStats);
+	for (int i = 0; i < g_iProfileStats; i++)
+	{
+		const ProfileScopeStat& stat = g_ProfileStats[i];
+		CProfileRing* pRing = GetRing(stat.iRing);
+
+		PROFILE_STAT out;
+		out.szName = stat.szName;
+		out.szThread = pRing ? pRing->GetThreadName() : "";
+		out.fLastMs = stat.fLastMs;
+		out.iCalls = stat.iLastCalls;
+		SummarizeHistory(stat.fHistory, out.fAvgMs, out.fMaxMs);
+		scopes.push_back(out);
+	}
+
+	int iCount = std::min(iMax - 1, (int)scopes.size());
+	std::partial_sort(scopes.begin(), scopes.begin() + iCount, scopes.end(),
+		[](const PROFILE_STAT& a, const PROFILE_STAT& b) { return a.fAvgMs > b.fAvgMs; });
+	std::copy(scopes.begin(), scopes.begin() + iCount, pStats + 1);
+
+	return iCount + 1;
+}
+
+float CProfiler::GetFrameMs()
+{
+	if (!g_iProfileHistoryCount) return 0.0f;
+	return g_fProfileFrames[(g_iProfileHistoryPos + PROFILE_STAT_FRAMES - 1) % PROFILE_STAT_FRAMES];
+}
+
+static void WriteJsonString(FILE* pFile, const char* sz)
+{
+	fputc('"', pFile);
+	for (; *sz; sz++)
+	{
+		unsigned char c = (unsigned char)*sz;
+		if (c == '"' || c == '\\') fprintf(pFile, "\\%c", c);
+		else if (c < 0x20) fprintf(pFile, "\\u%04x", c);
+		else fputc(c, pFile);
+	}
+	fputc('"', pFile);
+}
+
+bool CProfiler::ExportChromeTrace(FILE* pFile)
+{
+	int iRings = GetRingCount();
+
+	std::vector<PROFILE_EVENT> events[PROFILE_MAX_THREADS];
+	uint64_t qwBase = UINT64_MAX;
+	for (int i = 0; i < iRings; i++)
+	{
+		if (CProfileRing* pRing = GetRing(i)) pRing->Read(0, events[i]);
+		for (const PROFILE_EVENT& event : events[i]) qwBase = std::min(qwBase, event.qwStart);
+	}
+	if (qwBase == UINT64_MAX) qwBase = 0;
+
+	bool bFirst = true;
+	fprintf(pFile, "{\"traceEvents\":[");
+
+	for (int i = 0; i < iRings; i++)
+	{
+		CProfileRing* pRing = GetRing(i);
+		if (!pRing) continue;
+
+		fprintf(pFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", bFirst ? "" : ",", i);
+		WriteJsonString(pFile, pRing->GetThreadName());
+		fprintf(pFile, "}}");
+		bFirst = false;
+
+		for (const PROFILE_EVENT& event : events[i])
+		{
+			fprintf(pFile, ",\n{\"name\":");
+			WriteJsonString(pFile, event.szName);
+			fprintf(pFile, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				i, (double)(event.qwStart - qwBase) / 1000.0, (double)event.dwDuration / 1000.0);
+		}
+	}
+
+	fprintf(pFile, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	return !ferror(pFile);
+}
+
+bool CProfiler::ExportChromeTrace(const char* szPath)
+{
+	FILE* pFile = fopen(szPath, "w");
+	if (!pFile) return false;
+
+	bool bResult = ExportChromeTrace(pFile);
+	return fclose(pFile) == 0 && bResult;
+}
+
+#endif
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <atomic>
+#include <vector>
+
+// Frame profiler.
+// PROFILE_SCOPE("name") times the rest of the enclosing block into a ring owned by
+// the calling thread, nothing is shared or locked on that path. Rings keep the last
+// PROFILE_RING_SIZE events and overwrite older ones.
+// Once a frame the main thread folds the new events into rolling per-scope times
+// for the overlay; ExportChromeTrace() writes every ring as Chrome trace JSON
+// (chrome://tracing, ui.perfetto.dev).
+// Names must be string literals, events only keep the pointer.
+// Release builds (NDEBUG) compile it out: the macros expand to nothing.
+
+#ifndef PROFILER_ENABLED
+#ifdef NDEBUG
+#define PROFILER_ENABLED	0
+#else
+#define PROFILER_ENABLED	1
+#endif
+#endif
+
+#if PROFILER_ENABLED
+
+#define PROFILE_RING_SIZE		8192	// events per thread, power of two
+#define PROFILE_MAX_THREADS		16
+#define PROFILE_MAX_SCOPES		64		// distinct scopes in the rolling stats
+#define PROFILE_STAT_FRAMES		120		// frames the rolling stats cover
+
+struct PROFILE_EVENT
+{
+	const char*	szName;
+	uint64_t	qwStart;		// ns, steady clock
+	uint32_t	dwDuration;		// ns
+};
+
+struct PROFILE_STAT
+{
+	const char*	szName;
+	const char*	szThread;
+	float		fLastMs;		// sum over the last frame
+	float		fAvgMs;			// per frame, over PROFILE_STAT_FRAMES
+	float		fMaxMs;
+	int			iCalls;			// in the last frame
+};
+
+class CProfileRing
+{
+public:
+	CProfileRing(const char* szThread) : m_szThread(szThread), m_bOwned(true), m_dwHead(0) {}
+
+	// producer side, the owning thread only
+	void Push(const char* szName, uint64_t qwStart, uint64_t qwEnd) {
+		uint32_t dwHead = m_dwHead.load(std::memory_order_relaxed);
+		PROFILE_EVENT& event = m_Events[dwHead & (PROFILE_RING_SIZE - 1)];
+		uint64_t qwDuration = qwEnd - qwStart;
+		// a reader may be copying this slot right now, it throws the copy away afterwards
+		__atomic_store_n(&event.szName, szName, __ATOMIC_RELAXED);
+		__atomic_store_n(&event.qwStart, qwStart, __ATOMIC_RELAXED);
+		__atomic_store_n(&event.dwDuration, qwDuration > UINT32_MAX ? UINT32_MAX : (uint32_t)qwDuration, __ATOMIC_RELAXED);
+		m_dwHead.store(dwHead + 1, std::memory_order_release);
+	}
+
+	// any thread: appends the events from dwFrom on that weren't overwritten while
+	// copying, returns the position to continue from
+	uint32_t Read(uint32_t dwFrom, std::vector<PROFILE_EVENT>& out) const;
+
+	// the owning thread exited, a thread of the same name may take the ring over
+	void Release() { m_bOwned.store(false, std::memory_order_release); }
+
+	const char* GetThreadName() const { return m_szThread.load(std::memory_order_relaxed); }
+	uint32_t GetHead() const { return m_dwHead.load(std::memory_order_acquire); }
+
+private:
+	friend class CProfiler;
+
+	PROFILE_EVENT				m_Events[PROFILE_RING_SIZE];
+	std::atomic<const char*>	m_szThread;
+	std::atomic<bool>			m_bOwned;		// false once the thread exited, the ring can be reused
+	std::atomic<uint32_t>		m_dwHead;
+};
+
+class CProfiler
+{
+public:
+	static uint64_t Now();
+
+	static void Record(const char* szName, uint64_t qwStart, uint64_t qwEnd) {
+		if (CProfileRing* pRing = GetThreadRing()) pRing->Push(szName, qwStart, qwEnd);
+	}
+
+	// the name shows in the trace and the overlay; a thread that never sets one is "thread"
+	static void SetThreadName(const char* szName);
+
+	// main thread, once a frame: folds the events since the last call into the stats
+	static void EndFrame();
+	// the scopes sorted by average time, the frame itself first
+	static int GetStats(PROFILE_STAT* pStats, int iMax);
+	static float GetFrameMs();
+
+	static bool ExportChromeTrace(FILE* pFile);
+	static bool ExportChromeTrace(const char* szPath);
+
+	static CProfileRing* GetThreadRing();
+	static int GetRingCount();
+	static CProfileRing* GetRing(int iIndex);
+
+private:
+	static CProfileRing* AcquireRing(const char* szThread);
+};
+
+class CProfileScope
+{
+public:
+	explicit CProfileScope(const char* szName) : m_szName(szName), m_qwStart(CProfiler::Now()) {}
+	~CProfileScope() { CProfiler::Record(m_szName, m_qwStart, CProfiler::Now()); }
+
+	CProfileScope(const CProfileScope&) = delete;
+	CProfileScope& operator=(const CProfileScope&) = delete;
+
+private:
+	const char*	m_szName;
+	uint64_t	m_qwStart;
+};
+
+#define PROFILE_CONCAT_(a, b)	a##b
+#define PROFILE_CONCAT(a, b)	PROFILE_CONCAT_(a, b)
+
+#define PROFILE_SCOPE(name)		CProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_THREAD(name)	CProfiler::SetThreadName(name)
+#define PROFILE_END_FRAME()		CProfiler::EndFrame()
+
+#else
+
+#define PROFILE_SCOPE(name)		((void)0)
+#define PROFILE_THREAD(name)	((void)0)
+#define PROFILE_END_FRAME()		((void)0)
+
+#endif
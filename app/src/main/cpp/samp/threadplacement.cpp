@@ -0,0 +1,209 @@
+#include "threadplacement.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static CPU_TOPOLOGY g_Topology;
+static std::once_flag g_TopologyOnce;
+
+static std::mutex g_PlacementMutex;
+static THREAD_PLACEMENT g_Placements[THREAD_MAX_PLACED];
+static int g_iPlacementCount = 0;
+
+static thread_local bool t_bPlaced = false;
+
+static const char* g_szRoleNames[THREAD_ROLE_COUNT] = {
+	"game", "render", "network", "voice", "worker", "background"
+};
+
+// first unsigned number in the file, 0 when there's none
+static uint32_t ReadNumber(const char* szPath)
+{
+	FILE* pFile = fopen(szPath, "r");
+	if (!pFile) return 0;
+
+	unsigned long value = 0;
+	if (fscanf(pFile, "%lu", &value) != 1) value = 0;
+	fclose(pFile);
+	return (uint32_t)value;
+}
+
+// "0-3,6,8-9" as in cpu/possible, sets the bits of the listed cpus
+static uint32_t ParseCpuList(const char* szList)
+{
+	uint32_t dwMask = 0;
+	const char* p = szList;
+	while (*p)
+	{
+		char* pEnd;
+		long first = strtol(p, &pEnd, 10);
+		if (pEnd == p) break;
+
+		long last = first;
+		p = pEnd;
+		if (*p == '-') {
+			last = strtol(p + 1, &pEnd, 10);
+			if (pEnd == p + 1) break;
+			p = pEnd;
+		}
+
+		for (long i = std::max(first, 0L); i <= last && i < THREAD_MAX_CPUS; i++) dwMask |= 1u << i;
+
+		if (*p != ',') break;
+		p++;
+	}
+	return dwMask;
+}
+
+bool CThreadPlacement::ReadTopology(const char* szRoot, CPU_TOPOLOGY& topology)
+{
+	memset(&topology, 0, sizeof(topology));
+
+	char szPath[256];
+	uint32_t dwPossible = 0;
+
+	snprintf(szPath, sizeof(szPath), "%s/devices/system/cpu/possible", szRoot);
+	if (FILE* pFile = fopen(szPath, "r"))
+	{
+		char szList[128] = {};
+		if (fgets(szList, sizeof(szList), pFile)) dwPossible = ParseCpuList(szList);
+		fclose(pFile);
+	}
+
+	if (dwPossible == 0)
+	{
+		// no sysfs: every core counts the same
+		long count = std::clamp(sysconf(_SC_NPROCESSORS_CONF), 1L, (long)THREAD_MAX_CPUS);
+		dwPossible = count >= 32 ? 0xFFFFFFFF : (1u << count) - 1;
+	}
+
+	uint32_t dwMaxCapacity = 0;
+	for (int i = 0; i < THREAD_MAX_CPUS; i++)
+	{
+		if (!(dwPossible & (1u << i))) continue;
+
+		CPU_INFO& cpu = topology.cpus[topology.iCount++];
+		cpu.iCpu = i;
+
+		snprintf(szPath, sizeof(szPath), "%s/devices/system/cpu/cpu%d/cpu_capacity", szRoot, i);
+		cpu.dwCapacity = ReadNumber(szPath);
+		if (cpu.dwCapacity == 0)
+		{
+			snprintf(szPath, sizeof(szPath), "%s/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", szRoot, i);
+			cpu.dwCapacity = ReadNumber(szPath);
+		}
+		dwMaxCapacity = std::max(dwMaxCapacity, cpu.dwCapacity);
+	}
+
+	// a core that told nothing is taken for a big one
+	for (int i = 0; i < topology.iCount; i++)
+	{
+		CPU_INFO& cpu = topology.cpus[i];
+		cpu.bBig = cpu.dwCapacity == 0 || (uint64_t)cpu.dwCapacity * 2 >= dwMaxCapacity;
+
+		uint32_t dwBit = 1u << cpu.iCpu;
+		topology.dwAllMask |= dwBit;
+		if (cpu.bBig) {
+			topology.dwBigMask |= dwBit;
+			topology.iBigCount++;
+		}
+		else {
+			topology.dwLittleMask |= dwBit;
+			topology.iLittleCount++;
+		}
+	}
+
+	return dwMaxCapacity != 0;
+}
+
+void CThreadPlacement::GetPolicy(const CPU_TOPOLOGY& topology, eThreadRole role, uint32_t& dwMask, int& iNice)
+{
+	const uint32_t dwAll = topology.dwAllMask;
+	const uint32_t dwLittle = topology.dwLittleMask ? topology.dwLittleMask : dwAll;
+
+	switch (role)
+	{
+	case THREAD_ROLE_GAME:
+	case THREAD_ROLE_RENDER:
+		// the frame waits on them
+		dwMask = topology.dwBigMask;
+		iNice = THREAD_NICE_URGENT;
+		break;
+
+	case THREAD_ROLE_NETWORK:
+	case THREAD_ROLE_VOICE:
+		// short bursts; any free core beats waiting for a big one
+		dwMask = dwAll;
+		iNice = THREAD_NICE_LATENCY;
+		break;
+
+	case THREAD_ROLE_WORKER:
+		dwMask = dwAll;
+		iNice = THREAD_NICE_DEFAULT;
+		break;
+
+	default:
+		dwMask = dwLittle;
+		iNice = THREAD_NICE_BACKGROUND;
+		break;
+	}
+
+	if (dwMask == 0) dwMask = dwAll;
+}
+
+int CThreadPlacement::GetWorkerCount(const CPU_TOPOLOGY& topology)
+{
+	// game and render keep two big cores busy, or one when there's only one
+	int iTaken = std::min(topology.iBigCount, 2);
+	return std::max(topology.iCount - iTaken, 1);
+}
+
+void CThreadPlacement::Initialise(const char* szSysRoot)
+{
+	std::call_once(g_TopologyOnce, [szSysRoot]() {
+		ReadTopology(szSysRoot, g_Topology);
+	});
+}
+
+const CPU_TOPOLOGY& CThreadPlacement::GetTopology()
+{
+	Initialise("/sys");
+	return g_Topology;
+}
+
+void CThreadPlacement::Register(eThreadRole role)
+{
+	if (t_bPlaced) return;
+	t_bPlaced = true;
+
+	THREAD_PLACEMENT placement;
+	placement.tid = (pid_t)syscall(__NR_gettid);
+	placement.role = role;
+	GetPolicy(GetTopology(), role, placement.dwMask, placement.iNice);
+
+	placement.bAffinitySet = syscall(__NR_sched_setaffinity, placement.tid, sizeof(placement.dwMask), &placement.dwMask) == 0;
+	placement.bNiceSet = setpriority(PRIO_PROCESS, placement.tid, placement.iNice) == 0;
+
+	std::lock_guard<std::mutex> lock(g_PlacementMutex);
+	if (g_iPlacementCount < THREAD_MAX_PLACED) g_Placements[g_iPlacementCount++] = placement;
+}
+
+int CThreadPlacement::GetPlacements(THREAD_PLACEMENT* pPlacements, int iMax)
+{
+	std::lock_guard<std::mutex> lock(g_PlacementMutex);
+	int iCount = std::min(iMax, g_iPlacementCount);
+	memcpy(pPlacements, g_Placements, iCount * sizeof(THREAD_PLACEMENT));
+	return iCount;
+}
+
+const char* CThreadPlacement::GetRoleName(eThreadRole role)
+{
+	return role >= 0 && role < THREAD_ROLE_COUNT ? g_szRoleNames[role] : "?";
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <sys/types.h>
+
+// Thread placement.
+// The CPU topology is read from sysfs once: each core's capacity (cpu_capacity, or
+// cpuinfo_max_freq where the kernel doesn't export it) puts it in the big cluster when it
+// has at least half the capacity of the fastest core, else in the little one; prime cores
+// count as big. A thread says what it is by calling Register() from itself. The policy
+// maps that role to a core mask and a nice value, and both are applied right then, once.
+// Every decision is kept for the profiler and "/threads", whether the kernel took it or not.
+
+enum eThreadRole
+{
+	THREAD_ROLE_GAME,			// game logic, the thread MainLoop runs on
+	THREAD_ROLE_RENDER,			// GL, the render queue
+	THREAD_ROLE_NETWORK,		// RakNet
+	THREAD_ROLE_VOICE,
+	THREAD_ROLE_WORKER,			// job system
+	THREAD_ROLE_BACKGROUND,		// logging and the like, runs whenever
+
+	THREAD_ROLE_COUNT
+};
+
+#define THREAD_MAX_CPUS			32
+#define THREAD_MAX_PLACED		32
+
+#define THREAD_NICE_URGENT		-4		// game and render
+#define THREAD_NICE_LATENCY		-2		// network and voice: little CPU, but on time
+#define THREAD_NICE_DEFAULT		0
+#define THREAD_NICE_BACKGROUND	10
+
+struct CPU_INFO
+{
+	int			iCpu;
+	uint32_t	dwCapacity;		// cpu_capacity, else the max frequency in kHz
+	bool		bBig;
+};
+
+struct CPU_TOPOLOGY
+{
+	int			iCount;
+	CPU_INFO	cpus[THREAD_MAX_CPUS];
+	uint32_t	dwAllMask;
+	uint32_t	dwBigMask;
+	uint32_t	dwLittleMask;	// 0 when all cores are alike
+	int			iBigCount;
+	int			iLittleCount;
+};
+
+struct THREAD_PLACEMENT
+{
+	pid_t		tid;
+	eThreadRole	role;
+	uint32_t	dwMask;
+	int			iNice;
+	bool		bAffinitySet;
+	bool		bNiceSet;
+};
+
+class CThreadPlacement
+{
+public:
+	// parses <szRoot>/devices/system/cpu; szRoot is "/sys" on the device, a fake tree in tests
+	static bool ReadTopology(const char* szRoot, CPU_TOPOLOGY& topology);
+	static void GetPolicy(const CPU_TOPOLOGY& topology, eThreadRole role, uint32_t& dwMask, int& iNice);
+	// job system workers: the cores game and render don't take
+	static int GetWorkerCount(const CPU_TOPOLOGY& topology);
+
+	// reads the topology; Register() does it with "/sys" if nobody did before
+	static void Initialise(const char* szSysRoot);
+	static const CPU_TOPOLOGY& GetTopology();
+
+	// from the thread itself; it's placed the first time, later calls return right away
+	static void Register(eThreadRole role);
+
+	static int GetPlacements(THREAD_PLACEMENT* pPlacements, int iMax);
+	static const char* GetRoleName(eThreadRole role);
+};
@@ -188,6 +188,9 @@ std::size_t Network::AddDisconnectCallback(DisconnectCallback callback) noexcept
 
 void Network::VoiceThread() noexcept
 {
+    PROFILE_THREAD("Voice");
+    CThreadPlacement::Register(THREAD_ROLE_VOICE);
+
     VoicePacket keepAlivePacket;
     Timer::time_t keepAliveLastTime { NULL };
 
@@ -237,6 +240,8 @@ void Network::VoiceThread() noexcept
         if(received == SOCKET_ERROR)
             break;
 
+        PROFILE_SCOPE("Network::VoicePacket");
+
         if(received < static_cast<decltype(received)>(sizeof(VoicePacket)))
             continue;
 
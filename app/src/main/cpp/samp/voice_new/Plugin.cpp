@@ -96,6 +96,8 @@ void Plugin::MainLoop()
 {
     if(!Samp::IsLoaded()) return;
 
+    PROFILE_SCOPE("Plugin::MainLoop");
+
     while(const auto controlPacket = Network::ReceiveControlPacket())
     {
         Plugin::ControlPacketHandler(*&*controlPacket);